@@ -0,0 +1,43 @@
+// Boot timeline, see boot_trace.h.
+
+#include "boot_trace.h"
+
+typedef struct {
+    const char *phase;
+    uint32_t us;
+} mark_t;
+
+static mark_t marks[BOOT_TRACE_MAX_MARKS];
+static uint8_t mark_count = 0;
+static volatile uint32_t first_pixel_us = 0;  // set from the flush callback, maybe on the other core
+static uint32_t interactive_us = 0;
+
+void boot_trace_mark(const char *phase) {
+    uint32_t now = micros();
+    if (interactive_us) {
+        Serial.printf("boot: %-20s at %7lu us\n", phase, (unsigned long)now);
+        return;
+    }
+    if (mark_count < BOOT_TRACE_MAX_MARKS)
+        marks[mark_count++] = {phase, now};
+}
+
+void boot_trace_first_pixel() {
+    if (!first_pixel_us)
+        first_pixel_us = micros();
+}
+
+void boot_trace_interactive() {
+    if (interactive_us)
+        return;
+    interactive_us = micros();
+
+    uint32_t last = 0;
+    for (uint8_t i = 0; i < mark_count; i++) {
+        Serial.printf("boot: %-20s %7lu us, at %7lu us\n", marks[i].phase, (unsigned long)(marks[i].us - last),
+                      (unsigned long)marks[i].us);
+        last = marks[i].us;
+    }
+    Serial.printf("boot: first pixel at %lu us, interactive at %lu us\n", (unsigned long)first_pixel_us,
+                  (unsigned long)interactive_us);
+}
@@ -0,0 +1,34 @@
+// Boot timeline.
+//
+// setup() marks the end of each boot phase with BOOT_MARK("phase"). Times
+// are micros(), which starts counting when the app starts, after the ROM
+// and second-stage bootloader. Two milestones are marked once each: first
+// pixel, when the panel first shows something of the UI, and interactive,
+// when loop() has handled input for the first time. Work deferred past
+// setup() can still mark its end afterwards. The timeline goes to Serial
+// once, at interactive; later marks are printed as they come.
+//
+// Without -D BOOT_TRACE the BOOT_* macros compile to nothing.
+
+#ifndef BOOT_TRACE_H
+#define BOOT_TRACE_H
+
+#include <Arduino.h>
+
+#define BOOT_TRACE_MAX_MARKS 16
+
+void boot_trace_mark(const char *phase);
+void boot_trace_first_pixel();
+void boot_trace_interactive();
+
+#ifdef BOOT_TRACE
+#define BOOT_MARK(phase) boot_trace_mark(phase)
+#define BOOT_FIRST_PIXEL() boot_trace_first_pixel()
+#define BOOT_INTERACTIVE() boot_trace_interactive()
+#else
+#define BOOT_MARK(phase)
+#define BOOT_FIRST_PIXEL()
+#define BOOT_INTERACTIVE()
+#endif
+
+#endif
@@ -2,6 +2,8 @@
 #include <lvgl.h>
 #include <TFT_eSPI.h>
 #include "ui/ui.h"
+#include "profiler.h"
+#include "boot_trace.h"
 
 #define XPT2046_IRQ 36   // T_IRQ
 #define XPT2046_MOSI 32  // T_DIN
@@ -13,71 +15,356 @@
 // Display configuration - matches EEZ Studio project settings
 static const uint16_t screenWidth = 320;
 static const uint16_t screenHeight = 240;
-static lv_color_t buf[screenWidth * 10]; // 10 lines buffer
+// Two 40-line RGB565 buffers: LVGL renders into one while DMA sends the other.
+// Static, so they sit in internal DMA-capable RAM.
+static uint16_t buf1[screenWidth * 40] __attribute__((aligned(4)));
+static uint16_t buf2[screenWidth * 40] __attribute__((aligned(4)));
+
+// 1: flush through TFT_eSPI's DMA engine, 0: blocking pushPixels
+#ifndef DEMO_FLUSH_DMA
+#define DEMO_FLUSH_DMA 1
+#endif
+
+// 1: LVGL renders in loop() and a task on the other core sends the
+// finished buffers, 0: loop() sends them itself
+#ifndef DEMO_FLUSH_TASK
+#define DEMO_FLUSH_TASK 0
+#endif
+
+// 1: LVGL ticks from millis() and loop() sleeps until its next timer,
+// 0: the fixed lv_tick_inc() / delay() loop
+#ifndef DEMO_TICKLESS
+#define DEMO_TICKLESS 1
+#endif
+
+// Longest sleep when LVGL has no timer due, so ui_tick() still runs
+#define DEMO_MAX_IDLE_MS 500
+
+// 1: a splash in the main screen's background colour goes out through
+// TFT_eSPI before lv_init() and the backlight waits for it, 0: the panel
+// shows nothing of the UI until LVGL's first frame
+#ifndef DEMO_FAST_BOOT
+#define DEMO_FAST_BOOT 1
+#endif
+
+// bg_color of the main screen in screens.c
+#define SPLASH_RGB 0x2e8608
+
+static uint32_t flush_us = 0;  // time spent in my_disp_flush
+static uint32_t wait_us = 0;   // time LVGL waited for a buffer to come back
+
+#ifdef PROFILER
+// Probe ids index prof_probes; the parents give prof_report its tree
+enum { PROF_LOOP, PROF_TIMER_HANDLER, PROF_RENDER, PROF_FLUSH, PROF_UI_TICK };
+static const prof_probe_t prof_probes[] = {
+    {"loop", -1}, {"lv_timer_handler", PROF_LOOP}, {"render", PROF_TIMER_HANDLER},
+    {"flush", PROF_RENDER}, {"ui_tick", PROF_LOOP},
+};
+
+// One render pass, flushes included
+static void prof_render_cb(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START)
+        PROF_MARK(PROF_RENDER);
+    else
+        PROF_MARK_END(PROF_RENDER);
+}
+#endif
 
 TFT_eSPI tft = TFT_eSPI();
 
-// Display flushing callback - TFT_eSPI implementation
-void my_disp_flush(lv_display_t *display, const lv_area_t *area, uint8_t *color_p) {
+// Sends one rendered area. The buffer is rendered byte-swapped
+// (RGB565_SWAPPED), so it goes out as is.
+static void push_area(const lv_area_t *area, uint16_t *pixels) {
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
-    
+
+#if DEMO_FLUSH_DMA
+    tft.pushImageDMA(area->x1, area->y1, w, h, pixels);
+#else
     tft.startWrite();
     tft.setAddrWindow(area->x1, area->y1, w, h);
-    tft.pushColors((uint16_t*)color_p, w * h, true);
+    tft.pushPixels(pixels, w * h);
     tft.endWrite();
-    
+#endif
+}
+
+#if DEMO_FLUSH_TASK
+// A rendered buffer on its way to the flush task. LVGL does not touch it
+// again until the task gives flush_done, so each buffer has one owner at a
+// time. With two buffers at most one is in flight: the queue has one slot
+// and my_flush_wait() is the back-pressure.
+struct flush_job_t {
+    lv_area_t area;
+    uint16_t *pixels;
+};
+
+static QueueHandle_t flush_queue;
+static SemaphoreHandle_t flush_done;
+static volatile uint32_t flush_task_us = 0; // running total, read by loop()
+
+static void flush_task(void *arg) {
+    flush_job_t job;
+    for (;;) {
+        xQueueReceive(flush_queue, &job, portMAX_DELAY);
+        uint32_t start = micros();
+        push_area(&job.area, job.pixels);
+#if DEMO_FLUSH_DMA
+        tft.dmaWait(); // the buffer is free once the transfer is
+#endif
+        flush_task_us += micros() - start;
+        xSemaphoreGive(flush_done);
+    }
+}
+#endif
+
+// Display flushing callback - TFT_eSPI implementation
+void my_disp_flush(lv_display_t *display, const lv_area_t *area, uint8_t *color_p) {
+    uint32_t start = micros();
+    PROF_BEGIN(PROF_FLUSH);
+    BOOT_FIRST_PIXEL();
+
+#if DEMO_FLUSH_TASK
+    flush_job_t job = { *area, (uint16_t *)color_p };
+    xQueueSend(flush_queue, &job, portMAX_DELAY);
+#elif DEMO_FLUSH_DMA
+    // Queue the transfer and return; LVGL renders into the other buffer
+    // meanwhile and waits in my_flush_wait() before reusing this one
+    push_area(area, (uint16_t *)color_p);
+#else
+    push_area(area, (uint16_t *)color_p);
     lv_display_flush_ready(display); // Tell LVGL you are ready with the flushing
+#endif
+    PROF_END(PROF_FLUSH);
+    flush_us += micros() - start;
+}
+
+#if DEMO_FLUSH_TASK || DEMO_FLUSH_DMA
+// Called by LVGL instead of polling flush_ready: the flush is complete
+// when the flush task hands the buffer back or the DMA transfer ends
+void my_flush_wait(lv_display_t *display) {
+    uint32_t start = micros();
+#if DEMO_FLUSH_TASK
+    xSemaphoreTake(flush_done, portMAX_DELAY);
+#else
+    tft.dmaWait();
+#endif
+    wait_us += micros() - start;
+}
+#endif
+
+#ifdef DEMO_FPS_TEST
+// Full-screen animation for the frame-rate measurement: the whole screen
+// changes colour every frame, so each refresh renders and flushes 320x240
+static uint32_t fps_frames = 0;
+static uint32_t frame_start = 0;
+static uint32_t frame_us = 0;
+
+static void fps_anim_cb(void *obj, int32_t v) {
+    lv_obj_set_style_bg_color((lv_obj_t *)obj, lv_color_hsv_to_rgb((uint16_t)v, 100, 100), 0);
+}
+
+static void fps_refr_cb(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+        frame_start = micros();
+    } else {
+        frame_us += micros() - frame_start;
+        fps_frames++;
+    }
+}
+
+static void fps_report_cb(lv_timer_t *timer) {
+#if DEMO_FLUSH_TASK
+    static uint32_t task_us_seen = 0;
+    uint32_t task_us = flush_task_us - task_us_seen;
+    task_us_seen += task_us;
+#endif
+    if (fps_frames) {
+        Serial.printf("%s%s: %lu fps, flush %lu us/frame, wait %lu us/frame\n", DEMO_FLUSH_TASK ? "task+" : "", DEMO_FLUSH_DMA ? "dma" : "blocking",
+                      (unsigned long)fps_frames, (unsigned long)(flush_us / fps_frames), (unsigned long)(wait_us / fps_frames));
+#if DEMO_FLUSH_TASK
+        // The render core is busy for the frame minus its waits and queueing;
+        // whatever the flush task adds beyond the frame time ran in parallel
+        uint32_t frame = frame_us / fps_frames;
+        uint32_t idle = (wait_us + flush_us) / fps_frames;
+        uint32_t render = frame > idle ? frame - idle : 0;
+        uint32_t sent = task_us / fps_frames;
+        Serial.printf("  frame %lu us: render %lu us, flush task %lu us, overlap %lu us\n", (unsigned long)frame,
+                      (unsigned long)render, (unsigned long)sent, (unsigned long)(render + sent > frame ? render + sent - frame : 0));
+#endif
+    }
+    fps_frames = 0;
+    frame_us = 0;
+    flush_us = 0;
+    wait_us = 0;
+}
+
+static void fps_test_start(lv_display_t *display) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *label = lv_label_create(scr);
+    lv_label_set_text(label, "FPS test");
+    lv_obj_center(label);
+    lv_screen_load(scr);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, scr);
+    lv_anim_set_exec_cb(&a, fps_anim_cb);
+    lv_anim_set_values(&a, 0, 359);
+    lv_anim_set_duration(&a, 3000);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_start(&a);
+
+    lv_timer_set_period(lv_display_get_refr_timer(display), 1); // as fast as it goes
+    lv_display_add_event_cb(display, fps_refr_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(display, fps_refr_cb, LV_EVENT_REFR_READY, NULL);
+    lv_timer_create(fps_report_cb, 1000, NULL);
+}
+#endif
+
+// LVGL's clock: millis() instead of counting loop passes
+static uint32_t my_tick(void) {
+    return millis();
+}
+
+#ifdef DEMO_LOOP_STATS
+// Loop wake-ups and time awake, printed every 5 s
+static uint32_t stats_start_us = 0;
+static uint32_t loop_wakeups = 0;
+static uint32_t loop_sleep_us = 0;
+
+static void loop_stats_cb(lv_timer_t *timer) {
+    uint32_t elapsed = micros() - stats_start_us;
+    uint32_t busy = (uint32_t)((uint64_t)(elapsed - loop_sleep_us) * 1000 / elapsed);
+    Serial.printf("%s loop: %lu wakeups/s, busy %lu.%lu%%\n", DEMO_TICKLESS ? "tickless" : "fixed",
+                  (unsigned long)(loop_wakeups * 1000000ULL / elapsed), (unsigned long)(busy / 10), (unsigned long)(busy % 10));
+    stats_start_us += elapsed;
+    loop_wakeups = 0;
+    loop_sleep_us = 0;
+}
+#endif
+
+static void loop_sleep(uint32_t ms) {
+#ifdef DEMO_LOOP_STATS
+    uint32_t start = micros();
+#endif
+    delay(ms);
+#ifdef DEMO_LOOP_STATS
+    loop_sleep_us += micros() - start;
+    loop_wakeups++;
+#endif
 }
 
 void setup() {
     Serial.begin(115200);
     Serial.println("EEZ Studio LVGL Demo Starting...");
-
-    String LVGL_Arduino = String("LVGL Library Version: ") + lv_version_major() + "." + lv_version_minor() + "." + lv_version_patch();
-    Serial.println(LVGL_Arduino);
-
+    Serial.printf("LVGL Library Version: %d.%d.%d\n", lv_version_major(), lv_version_minor(), lv_version_patch());
     Serial.println("In setup()");
+    BOOT_MARK("serial");
   
     // Initialize TFT display hardware
     tft.init();
     tft.setRotation(2); 
     pinMode(LCD_BACKLIGHT_PIN, OUTPUT);
+#if DEMO_FAST_BOOT
+    // Backlight on only once the splash is there, so the panel's power-on
+    // contents are never seen
+    tft.fillScreen(tft.color565(SPLASH_RGB >> 16, (SPLASH_RGB >> 8) & 0xFF, SPLASH_RGB & 0xFF));
+    BOOT_FIRST_PIXEL();
+#endif
     digitalWrite(LCD_BACKLIGHT_PIN, HIGH); // Turn on backlight
+    tft.setSwapBytes(false); // LVGL renders the panel's byte order already
+#if DEMO_FLUSH_DMA
+    tft.initDMA();
+    tft.startWrite(); // the display keeps its SPI bus
+#endif
+    BOOT_MARK("tft.init");
     
     // Initialize LVGL
     lv_init();
+#if DEMO_TICKLESS
+    lv_tick_set_cb(my_tick);
+#endif
+#ifdef DEMO_LOOP_STATS
+    lv_timer_create(loop_stats_cb, 5000, NULL);
+    stats_start_us = micros();
+#endif
     
     // Create display (LVGL 9.x API)
     lv_display_t *display = lv_display_create(screenWidth, screenHeight);
     
-    // Set display buffer
-    lv_display_set_buffers(display, buf, NULL, sizeof(buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    // Set display buffer with double buffering, rendered in the panel's byte order
+    lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565_SWAPPED);
+    lv_display_set_buffers(display, buf1, buf2, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
     
     // Set display flush callback
     lv_display_set_flush_cb(display, my_disp_flush);
+#ifdef PROFILER
+    prof_init(prof_probes, sizeof(prof_probes) / sizeof(prof_probes[0]));
+    lv_display_add_event_cb(display, prof_render_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(display, prof_render_cb, LV_EVENT_RENDER_READY, NULL);
+#endif
+#if DEMO_FLUSH_TASK || DEMO_FLUSH_DMA
+    lv_display_set_flush_wait_cb(display, my_flush_wait);
+#endif
+#if DEMO_FLUSH_TASK
+    // Flush on the core loop() does not run on
+    flush_queue = xQueueCreate(1, sizeof(flush_job_t));
+    flush_done = xSemaphoreCreateBinary();
+    xTaskCreatePinnedToCore(flush_task, "flush", 4096, NULL, 2, NULL, xPortGetCoreID() ^ 1);
+#endif
         
+    BOOT_MARK("lv_init, display");
+
     // Initialize EEZ Studio generated UI
     ui_init();
+    BOOT_MARK("ui_init");
+#ifdef DEMO_FPS_TEST
+    fps_test_start(display);
+#endif
     
     Serial.println("UI initialized and ready!");
     
     // Force initial screen refresh
     lv_refr_now(display);
+    BOOT_MARK("first frame");
     
     Serial.println("Setup complete!");
 }
 
 void loop() {
+    PROF_BEGIN(PROF_LOOP);
+    PROF_BEGIN(PROF_TIMER_HANDLER);
+#if DEMO_TICKLESS
+    // Handle LVGL tasks; returns how long until the next one is due
+    uint32_t idle_ms = lv_timer_handler();
+#else
     // CRITICAL: Tell LVGL how much time has passed
     lv_tick_inc(5); // 5ms matches our delay below
     
     // Handle LVGL tasks
     lv_timer_handler();
+#endif
+    PROF_END(PROF_TIMER_HANDLER);
+    BOOT_INTERACTIVE(); // the first pass after setup(), LVGL timers included
     
-    // Handle EEZ Studio UI updates
+    // Handle EEZ Studio UI updates. ui_tick() changes objects outside
+    // lv_timer_handler(), so it takes the lock lv_timer_handler() renders under
+    lv_lock();
+    PROF_BEGIN(PROF_UI_TICK);
     ui_tick();
+    PROF_END(PROF_UI_TICK);
+    lv_unlock();
+    PROF_END(PROF_LOOP);
+#ifdef PROFILER
+    prof_serial(); // 'p' arms, 'd' dumps, 'c' clears
+#endif
     
+#if DEMO_TICKLESS
+    // Sleep until LVGL has work again
+    if (idle_ms > DEMO_MAX_IDLE_MS) idle_ms = DEMO_MAX_IDLE_MS;
+    loop_sleep(idle_ms);
+#else
     // Small delay to prevent watchdog issues
-    delay(5);
-}
\ No newline at end of file
+    loop_sleep(5);
+#endif
+}
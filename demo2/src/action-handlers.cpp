@@ -2,16 +2,17 @@
 #include <TFT_eSPI.h>
 #include "ui/ui.h"
 #include "ui/actions.h"
+#include "screen_cache.h"
 
 extern "C" void action_navigate_main(lv_event_t *e) {
-    loadScreen(SCREEN_ID_MAIN);
+    screen_cache_load(SCREEN_ID_MAIN);
 }
 
 extern "C" void action_navigate_screen_1(lv_event_t *e) {
-    loadScreen(SCREEN_ID_SCREEN1);
+    screen_cache_load(SCREEN_ID_SCREEN1);
 }
 
 extern "C" void action_navigate_screen_2(lv_event_t *e) {
-    loadScreen(SCREEN_ID_SCREEN2);
+    screen_cache_load(SCREEN_ID_SCREEN2);
 }
 
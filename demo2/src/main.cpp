@@ -2,7 +2,13 @@
 #include <lvgl.h>
 #include <TFT_eSPI.h>
 #include <XPT2046_Touchscreen.h>
+#include <algorithm>
 #include "ui/ui.h"
+#include "touch_input.h"
+#include "profiler.h"
+#include "screen_cache.h"
+#include "ui_table.h"
+#include "boot_trace.h"
 
 #define XPT2046_IRQ 36   // T_IRQ
 #define XPT2046_MOSI 32  // T_DIN
@@ -14,13 +20,104 @@
 // Display configuration - matches EEZ Studio project settings
 static const uint16_t screenWidth = 320;
 static const uint16_t screenHeight = 240;
-static lv_color_t buf1[screenWidth * 40]; // 40 lines buffer for faster refresh
-static lv_color_t buf2[screenWidth * 40]; // Second buffer for double buffering
+// Two 40-line RGB565 buffers: LVGL renders into one while DMA sends the other.
+// Static, so they sit in internal DMA-capable RAM.
+static uint16_t buf1[screenWidth * 40] __attribute__((aligned(4)));
+static uint16_t buf2[screenWidth * 40] __attribute__((aligned(4)));
+
+// 1: flush through TFT_eSPI's DMA engine, 0: blocking pushPixels
+#ifndef DEMO_FLUSH_DMA
+#define DEMO_FLUSH_DMA 1
+#endif
+
+// 1: LVGL renders in loop() and a task on the other core sends the
+// finished buffers, 0: loop() sends them itself
+#ifndef DEMO_FLUSH_TASK
+#define DEMO_FLUSH_TASK 0
+#endif
+
+// 1: LVGL ticks from millis() and loop() sleeps until its next timer or a
+// touch 0: the fixed lv_tick_inc() / delay() loop
+#ifndef DEMO_TICKLESS
+#define DEMO_TICKLESS 1
+#endif
+
+// Longest sleep when LVGL has no timer due, so ui_tick() still runs
+#define DEMO_MAX_IDLE_MS 500
+
+// 1: touch is sampled by an IRQ-driven task (touch_input.cpp), 0: the
+// XPT2046 library is polled from the LVGL input callback
+#ifndef DEMO_TOUCH_TASK
+#define DEMO_TOUCH_TASK 1
+#endif
+
+// Screens kept built at once (screen_cache.cpp); 0 builds them all at boot
+// like ui_init()
+#ifndef DEMO_SCREEN_CACHE
+#define DEMO_SCREEN_CACHE 2
+#endif
+
+// 1: screens are built from the table tools/ui_table.py compiles out of
+// screens.c (ui_table.cpp), 0: by the generated create functions
+#ifndef DEMO_UI_TABLE
+#define DEMO_UI_TABLE 1
+#endif
+
+#if DEMO_UI_TABLE
+template <int ID> static void create_table_screen() {
+    ui_table_create_screen(&ui_table, ID - 1);
+}
+#define SCREEN_CREATE(id, create) create_table_screen<id>
+#else
+#define SCREEN_CREATE(id, create) create
+#endif
+
+// 1: a splash in the main screen's background colour goes out through
+// TFT_eSPI before lv_init() and the backlight waits for it; the screens
+// other than the main one are built in idle time after boot instead of on
+// their first load. 0: the panel shows nothing of the UI until LVGL's
+// first frame
+#ifndef DEMO_FAST_BOOT
+#define DEMO_FAST_BOOT 1
+#endif
+
+// bg_color of the main screen in screens.c
+#define SPLASH_RGB 0x1baa1b
+
+static const screen_def_t screen_defs[] = {
+    {SCREEN_ID_MAIN, true, SCREEN_CREATE(SCREEN_ID_MAIN, create_screen_main), &objects.main},
+    {SCREEN_ID_SCREEN1, true, SCREEN_CREATE(SCREEN_ID_SCREEN1, create_screen_screen1), &objects.screen1},
+    {SCREEN_ID_SCREEN2, true, SCREEN_CREATE(SCREEN_ID_SCREEN2, create_screen_screen2), &objects.screen2},
+};
+
+static uint32_t flush_us = 0;  // time spent in my_disp_flush
+static uint32_t wait_us = 0;   // time LVGL waited for a buffer to come back
+
+#ifdef PROFILER
+// Probe ids index prof_probes; the parents give prof_report its tree
+enum { PROF_LOOP, PROF_TIMER_HANDLER, PROF_RENDER, PROF_FLUSH, PROF_TOUCH_READ, PROF_UI_TICK };
+static const prof_probe_t prof_probes[] = {
+    {"loop", -1}, {"lv_timer_handler", PROF_LOOP}, {"render", PROF_TIMER_HANDLER},
+    {"flush", PROF_RENDER}, {"touch_read", PROF_TIMER_HANDLER}, {"ui_tick", PROF_LOOP},
+};
+
+// One render pass, flushes included
+static void prof_render_cb(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START)
+        PROF_MARK(PROF_RENDER);
+    else
+        PROF_MARK_END(PROF_RENDER);
+}
+#endif
 
 TFT_eSPI tft = TFT_eSPI();
 SPIClass touchscreenSpi = SPIClass(VSPI);
-XPT2046_Touchscreen touchscreen(XPT2046_CS, XPT2046_IRQ);
+#if !DEMO_TOUCH_TASK
+// T_IRQ belongs to touch_irq() below, so the library reads the controller
+// without waiting for its own interrupt
+XPT2046_Touchscreen touchscreen(XPT2046_CS);
 uint16_t touchScreenMinimumX = 200, touchScreenMaximumX = 3700, touchScreenMinimumY = 240, touchScreenMaximumY = 3800;
+#endif
 
 // LVGL log callback
 void my_log_print(lv_log_level_t level, const char * buf) {
@@ -29,20 +126,302 @@ void my_log_print(lv_log_level_t level, const char * buf) {
   Serial.flush();
 }
 
-// Display flushing callback - TFT_eSPI implementation
-void my_disp_flush(lv_display_t *display, const lv_area_t *area, uint8_t *color_p) {
+// Sends one rendered area. The buffer is rendered byte-swapped
+// (RGB565_SWAPPED), so it goes out as is.
+static void push_area(const lv_area_t *area, uint16_t *pixels) {
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
 
+#if DEMO_FLUSH_DMA
+    tft.pushImageDMA(area->x1, area->y1, w, h, pixels);
+#else
     tft.startWrite();
     tft.setAddrWindow(area->x1, area->y1, w, h);
-    tft.pushPixels((uint16_t *)color_p, w * h);
+    tft.pushPixels(pixels, w * h);
     tft.endWrite();
+#endif
+}
+
+#if DEMO_FLUSH_TASK
+// A rendered buffer on its way to the flush task. LVGL does not touch it
+// again until the task gives flush_done, so each buffer has one owner at a
+// time. With two buffers at most one is in flight: the queue has one slot
+// and my_flush_wait() is the back-pressure.
+struct flush_job_t {
+    lv_area_t area;
+    uint16_t *pixels;
+};
+
+static QueueHandle_t flush_queue;
+static SemaphoreHandle_t flush_done;
+static volatile uint32_t flush_task_us = 0; // running total, read by loop()
 
+static void flush_task(void *arg) {
+    flush_job_t job;
+    for (;;) {
+        xQueueReceive(flush_queue, &job, portMAX_DELAY);
+        uint32_t start = micros();
+        push_area(&job.area, job.pixels);
+#if DEMO_FLUSH_DMA
+        tft.dmaWait(); // the buffer is free once the transfer is
+#endif
+        flush_task_us += micros() - start;
+        xSemaphoreGive(flush_done);
+    }
+}
+#endif
+
+// Display flushing callback - TFT_eSPI implementation
+void my_disp_flush(lv_display_t *display, const lv_area_t *area, uint8_t *color_p) {
+    uint32_t start = micros();
+    PROF_BEGIN(PROF_FLUSH);
+    BOOT_FIRST_PIXEL();
+
+#if DEMO_FLUSH_TASK
+    flush_job_t job = { *area, (uint16_t *)color_p };
+    xQueueSend(flush_queue, &job, portMAX_DELAY);
+#elif DEMO_FLUSH_DMA
+    // Queue the transfer and return; LVGL renders into the other buffer
+    // meanwhile and waits in my_flush_wait() before reusing this one
+    push_area(area, (uint16_t *)color_p);
+#else
+    push_area(area, (uint16_t *)color_p);
     lv_display_flush_ready(display); // Tell LVGL you are ready with the flushing
+#endif
+    PROF_END(PROF_FLUSH);
+    flush_us += micros() - start;
+}
+
+#if DEMO_FLUSH_TASK || DEMO_FLUSH_DMA
+// Called by LVGL instead of polling flush_ready: the flush is complete
+// when the flush task hands the buffer back or the DMA transfer ends
+void my_flush_wait(lv_display_t *display) {
+    uint32_t start = micros();
+#if DEMO_FLUSH_TASK
+    xSemaphoreTake(flush_done, portMAX_DELAY);
+#else
+    tft.dmaWait();
+#endif
+    wait_us += micros() - start;
+}
+#endif
+
+#ifdef DEMO_FPS_TEST
+// Full-screen animation for the frame-rate measurement: the whole screen
+// changes colour every frame, so each refresh renders and flushes 320x240
+static uint32_t fps_frames = 0;
+static uint32_t frame_start = 0;
+static uint32_t frame_us = 0;
+
+static void fps_anim_cb(void *obj, int32_t v) {
+    lv_obj_set_style_bg_color((lv_obj_t *)obj, lv_color_hsv_to_rgb((uint16_t)v, 100, 100), 0);
+}
+
+static void fps_refr_cb(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+        frame_start = micros();
+    } else {
+        frame_us += micros() - frame_start;
+        fps_frames++;
+    }
+}
+
+static void fps_report_cb(lv_timer_t *timer) {
+#if DEMO_FLUSH_TASK
+    static uint32_t task_us_seen = 0;
+    uint32_t task_us = flush_task_us - task_us_seen;
+    task_us_seen += task_us;
+#endif
+    if (fps_frames) {
+        Serial.printf("%s%s: %lu fps, flush %lu us/frame, wait %lu us/frame\n", DEMO_FLUSH_TASK ? "task+" : "", DEMO_FLUSH_DMA ? "dma" : "blocking",
+                      (unsigned long)fps_frames, (unsigned long)(flush_us / fps_frames), (unsigned long)(wait_us / fps_frames));
+#if DEMO_FLUSH_TASK
+        // The render core is busy for the frame minus its waits and queueing;
+        // whatever the flush task adds beyond the frame time ran in parallel
+        uint32_t frame = frame_us / fps_frames;
+        uint32_t idle = (wait_us + flush_us) / fps_frames;
+        uint32_t render = frame > idle ? frame - idle : 0;
+        uint32_t sent = task_us / fps_frames;
+        Serial.printf("  frame %lu us: render %lu us, flush task %lu us, overlap %lu us\n", (unsigned long)frame,
+                      (unsigned long)render, (unsigned long)sent, (unsigned long)(render + sent > frame ? render + sent - frame : 0));
+#endif
+    }
+    fps_frames = 0;
+    frame_us = 0;
+    flush_us = 0;
+    wait_us = 0;
+}
+
+static void fps_test_start(lv_display_t *display) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *label = lv_label_create(scr);
+    lv_label_set_text(label, "FPS test");
+    lv_obj_center(label);
+    lv_screen_load(scr);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, scr);
+    lv_anim_set_exec_cb(&a, fps_anim_cb);
+    lv_anim_set_values(&a, 0, 359);
+    lv_anim_set_duration(&a, 3000);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_start(&a);
+
+    lv_timer_set_period(lv_display_get_refr_timer(display), 1); // as fast as it goes
+    lv_display_add_event_cb(display, fps_refr_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(display, fps_refr_cb, LV_EVENT_REFR_READY, NULL);
+    lv_timer_create(fps_report_cb, 1000, NULL);
+}
+#endif
+
+// LVGL's clock: millis() instead of counting loop passes
+static uint32_t my_tick(void) {
+    return millis();
+}
+
+static SemaphoreHandle_t touch_wake;         // given on a touch, wakes loop()
+static lv_timer_t *touch_read_timer = NULL;
+static bool touch_on = false;                // the touch_input sampler is running
+static volatile uint32_t touch_irq_us = 0;   // first T_IRQ edge not yet redrawn
+
+#ifdef DEMO_TOUCH_STATS
+// T_IRQ edge to LV_EVENT_PRESSED, distribution printed every 10 s
+#define TOUCH_STATS_MAX 64
+static volatile uint32_t press_irq_us = 0;
+static uint32_t press_latency_us[TOUCH_STATS_MAX];
+static uint32_t press_count = 0;
+
+static void touch_pressed_cb(lv_event_t *e) {
+    uint32_t irq = press_irq_us;
+    if (!irq)
+        return;
+    press_irq_us = 0;
+    if (press_count < TOUCH_STATS_MAX)
+        press_latency_us[press_count++] = micros() - irq;
+}
+
+static void touch_stats_cb(lv_timer_t *timer) {
+    if (!press_count)
+        return;
+    std::sort(press_latency_us, press_latency_us + press_count);
+    Serial.printf("%s touch: %lu presses, IRQ to PRESSED min %lu us, p50 %lu us, p90 %lu us, max %lu us\n",
+                  DEMO_TOUCH_TASK ? "sampled" : "polled", (unsigned long)press_count, (unsigned long)press_latency_us[0],
+                  (unsigned long)press_latency_us[press_count / 2], (unsigned long)press_latency_us[press_count * 9 / 10],
+                  (unsigned long)press_latency_us[press_count - 1]);
+    press_count = 0;
+}
+#endif
+
+#if DEMO_TOUCH_TASK
+// Runs in the touch sampler task after each new sample
+static void touch_sampled() {
+    xSemaphoreGive(touch_wake);
+}
+#else
+// T_IRQ goes low when the panel is pressed
+static void IRAM_ATTR touch_irq() {
+    if (!touch_irq_us)
+        touch_irq_us = micros();
+#ifdef DEMO_TOUCH_STATS
+    if (!press_irq_us)
+        press_irq_us = micros();
+#endif
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(touch_wake, &woken);
+    if (woken)
+        portYIELD_FROM_ISR();
+}
+#endif
+
+#ifdef DEMO_LOOP_STATS
+// Loop wake-ups, time awake and touch-to-redraw latency, printed every 5 s
+static uint32_t stats_start_us = 0;
+static uint32_t loop_wakeups = 0;
+static uint32_t loop_sleep_us = 0;
+static uint32_t touch_redraws = 0;
+static uint32_t touch_latency_us = 0;
+static uint32_t touch_latency_max_us = 0;
+
+static void touch_redraw_cb(lv_event_t *e) {
+    uint32_t irq = touch_irq_us;
+    if (!irq)
+        return;
+    touch_irq_us = 0;
+    uint32_t latency = micros() - irq;
+    if (latency < 1000000) { // older presses did not change the screen
+        touch_redraws++;
+        touch_latency_us += latency;
+        if (latency > touch_latency_max_us)
+            touch_latency_max_us = latency;
+    }
+}
+
+static void loop_stats_cb(lv_timer_t *timer) {
+    uint32_t elapsed = micros() - stats_start_us;
+    uint32_t busy = (uint32_t)((uint64_t)(elapsed - loop_sleep_us) * 1000 / elapsed);
+    Serial.printf("%s loop: %lu wakeups/s, busy %lu.%lu%%, touch-to-redraw avg %lu us, max %lu us (%lu)\n",
+                  DEMO_TICKLESS ? "tickless" : "fixed", (unsigned long)(loop_wakeups * 1000000ULL / elapsed),
+                  (unsigned long)(busy / 10), (unsigned long)(busy % 10),
+                  (unsigned long)(touch_redraws ? touch_latency_us / touch_redraws : 0),
+                  (unsigned long)touch_latency_max_us, (unsigned long)touch_redraws);
+    stats_start_us += elapsed;
+    loop_wakeups = 0;
+    loop_sleep_us = 0;
+    touch_redraws = 0;
+    touch_latency_us = 0;
+    touch_latency_max_us = 0;
+}
+#endif
+
+// Sleeps up to ms; true when a touch cut it short
+static bool loop_sleep(uint32_t ms) {
+#ifdef DEMO_LOOP_STATS
+    uint32_t start = micros();
+#endif
+#if DEMO_TICKLESS
+    bool touched = xSemaphoreTake(touch_wake, pdMS_TO_TICKS(ms)) == pdTRUE;
+#else
+    delay(ms);
+    bool touched = false;
+#endif
+#ifdef DEMO_LOOP_STATS
+    loop_sleep_us += micros() - start;
+    loop_wakeups++;
+#endif
+    return touched;
 }
 
+#if DEMO_TOUCH_TASK
+// Samples arrive filtered and calibrated; LVGL gets one per read and reads
+// again while more are queued
 void my_touchpad_read(lv_indev_t *indev, lv_indev_data_t *data) {
+    PROF_BEGIN(PROF_TOUCH_READ);
+    static touch_sample_t last = {0, 0, false, 0};
+    touch_sample_t sample;
+    if (touch_input_read(&sample)) {
+        if (sample.irq_us) {
+            touch_irq_us = sample.irq_us;
+#ifdef DEMO_TOUCH_STATS
+            press_irq_us = sample.irq_us;
+#endif
+        }
+        last = sample;
+        data->continue_reading = touch_input_pending();
+    }
+    data->point.x = LV_CLAMP(0, last.x, screenWidth - 1);
+    data->point.y = LV_CLAMP(0, last.y, screenHeight - 1);
+    data->state = last.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+#if DEMO_TICKLESS
+    // Nothing to poll until the sampler has more
+    if (!last.pressed && !data->continue_reading)
+        lv_timer_pause(lv_indev_get_read_timer(indev));
+#endif
+    PROF_END(PROF_TOUCH_READ);
+}
+#else
+void my_touchpad_read(lv_indev_t *indev, lv_indev_data_t *data) {
+  PROF_BEGIN(PROF_TOUCH_READ);
   if (touchscreen.touched()) {
     TS_Point p = touchscreen.getPoint();
     //Some very basic auto calibration so it doesn't go out of range
@@ -61,68 +440,477 @@ void my_touchpad_read(lv_indev_t *indev, lv_indev_data_t *data) {
     Serial.println(data->point.y);
   } else {
     data->state = LV_INDEV_STATE_RELEASED;
+#if DEMO_TICKLESS
+    // Nothing to poll until the next touch IRQ
+    lv_timer_pause(lv_indev_get_read_timer(indev));
+#endif
   }
+  PROF_END(PROF_TOUCH_READ);
+}
+#endif
+
+#if DEMO_TOUCH_TASK && defined(DEMO_TOUCH_CALIBRATE)
+// Three-point calibration: touch each square, the transform goes to NVS
+static void touch_calibrate(lv_display_t *display) {
+    static const int16_t targets[3][2] = {{32, 24}, {288, 120}, {160, 216}};
+    int16_t raw[3][2];
+
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *label = lv_label_create(scr);
+    lv_label_set_text(label, "Touch the red square");
+    lv_obj_center(label);
+    lv_obj_t *mark = lv_obj_create(scr);
+    lv_obj_set_size(mark, 9, 9);
+    lv_obj_set_style_radius(mark, 0, 0);
+    lv_obj_set_style_bg_color(mark, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_screen_load(scr);
+
+    touch_input_set_raw(true);
+    for (int i = 0; i < 3; i++) {
+        lv_obj_set_pos(mark, targets[i][0] - 4, targets[i][1] - 4);
+        lv_refr_now(display);
+
+        // The last filtered point before the release
+        touch_sample_t sample;
+        bool down = false;
+        for (;;) {
+            if (!touch_input_read(&sample)) {
+                delay(5);
+                continue;
+            }
+            if (!sample.pressed && down)
+                break;
+            if (sample.pressed) {
+                raw[i][0] = sample.x;
+                raw[i][1] = sample.y;
+                down = true;
+            }
+        }
+    }
+    touch_input_set_raw(false);
+
+    touch_calibration_t calibration;
+    if (touch_input_solve(raw, targets, &calibration)) {
+        touch_input_set_calibration(&calibration, true);
+        Serial.printf("Touch calibration saved: x = %f x + %f y + %f, y = %f x + %f y + %f\n", calibration.a, calibration.b,
+                      calibration.c, calibration.d, calibration.e, calibration.f);
+    } else {
+        Serial.println("Touch calibration failed, points are collinear");
+    }
+    screen_cache_load(SCREEN_ID_MAIN);
+    lv_obj_delete(scr);
+}
+#endif
+
+#ifdef DEMO_SCREEN_BENCH
+// Ten screens, the three EEZ ones and seven settings-like pages of about
+// 40 widgets, built eagerly and then lazily with at most three kept
+#define SCREEN_BENCH_EXTRA 7
+#define SCREEN_BENCH_LOADS 30
+
+static lv_obj_t *bench_roots[SCREEN_BENCH_EXTRA];
+
+static lv_obj_t *bench_build_screen(int n) {
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *title = lv_label_create(scr);
+    lv_label_set_text_fmt(title, "Settings %d", n + 1);
+    lv_obj_set_pos(title, 10, 8);
+    for (int i = 0; i < 8; i++) {
+        lv_obj_t *button = lv_button_create(scr);
+        lv_obj_set_size(button, 70, 30);
+        lv_obj_set_pos(button, 10 + (i % 4) * 76, 34 + (i / 4) * 36);
+        lv_obj_t *label = lv_label_create(button);
+        lv_label_set_text_fmt(label, "Opt %d", i + 1);
+        lv_obj_center(label);
+    }
+    for (int i = 0; i < 4; i++) {
+        lv_obj_t *label = lv_label_create(scr);
+        lv_label_set_text_fmt(label, "Level %d", i + 1);
+        lv_obj_set_pos(label, 10, 114 + i * 30);
+        lv_obj_t *slider = lv_slider_create(scr);
+        lv_obj_set_size(slider, 150, 10);
+        lv_obj_set_pos(slider, 80, 118 + i * 30);
+        lv_slider_set_value(slider, 25 * i, LV_ANIM_OFF);
+        lv_obj_t *sw = lv_switch_create(scr);
+        lv_obj_set_pos(sw, 250, 110 + i * 30);
+    }
+    return scr;
+}
+
+template <int N> static void bench_create() {
+    bench_roots[N] = bench_build_screen(N);
+}
+
+static const screen_def_t bench_defs[] = {
+    screen_defs[0], screen_defs[1], screen_defs[2],
+    {100, false, bench_create<0>, &bench_roots[0]}, {101, false, bench_create<1>, &bench_roots[1]},
+    {102, false, bench_create<2>, &bench_roots[2]}, {103, false, bench_create<3>, &bench_roots[3]},
+    {104, false, bench_create<4>, &bench_roots[4]}, {105, false, bench_create<5>, &bench_roots[5]},
+    {106, false, bench_create<6>, &bench_roots[6]},
+};
+
+// Boot is screen_cache_init() plus showing the main screen; navigation is
+// a load plus its first frame. Heap is sampled after every step.
+static void screen_bench_run(lv_display_t *display, const screen_def_t *defs, uint8_t count, uint8_t capacity) {
+    // None of the screens screen_cache_init() deletes may be active
+    lv_obj_t *blank = lv_obj_create(NULL);
+    lv_screen_load(blank);
+
+    uint32_t heap0 = ESP.getFreeHeap();
+    uint32_t heap_low = heap0;
+    uint32_t start = micros();
+    screen_cache_init(defs, count, capacity);
+    screen_cache_load(SCREEN_ID_MAIN);
+    uint32_t boot_us = micros() - start;
+    heap_low = std::min(heap_low, ESP.getFreeHeap());
+    lv_refr_now(display);
+    lv_obj_delete(blank);
+
+    uint32_t nav_total = 0, nav_max = 0;
+    for (int i = 0; i < SCREEN_BENCH_LOADS; i++) {
+        uint32_t t = micros();
+        screen_cache_load(defs[(i * 7 + 1) % count].id);
+        lv_refr_now(display);
+        uint32_t us = micros() - t;
+        nav_total += us;
+        nav_max = std::max(nav_max, us);
+        heap_low = std::min(heap_low, ESP.getFreeHeap());
+    }
+
+    screen_cache_stats_t stats;
+    screen_cache_get_stats(&stats);
+    Serial.printf("screens %u of %u kept: boot %lu us, peak heap %lu bytes, navigation %lu us mean, %lu us max, %lu builds\n",
+                  capacity ? capacity : count, count, (unsigned long)boot_us, (unsigned long)(heap0 - heap_low),
+                  (unsigned long)(nav_total / SCREEN_BENCH_LOADS), (unsigned long)nav_max, (unsigned long)stats.builds);
+}
+
+static void screen_bench(lv_display_t *display) {
+    uint8_t count = sizeof(bench_defs) / sizeof(bench_defs[0]);
+    screen_bench_run(display, bench_defs, count, 0);
+    screen_bench_run(display, bench_defs, count, 3);
+    // Back to the demo's own screens
+    screen_bench_run(display, screen_defs, sizeof(screen_defs) / sizeof(screen_defs[0]), DEMO_SCREEN_CACHE);
+    screen_cache_load(SCREEN_ID_MAIN);
+}
+#endif
+
+#ifdef DEMO_UI_TABLE_BENCH
+// Every screen built and deleted again, by its generated create function
+// and from the table; objects.* is put back afterwards
+#define UI_TABLE_BENCH_ROUNDS 20
+
+static void (*const create_functions[])() = {create_screen_main, create_screen_screen1, create_screen_screen2};
+
+static void ui_table_bench() {
+    objects_t shown = objects;
+    for (int i = 0; i < ui_table.screen_count; i++) {
+        uint32_t code_us = 0, table_us = 0, code_heap = 0, table_heap = 0;
+        for (int round = 0; round < UI_TABLE_BENCH_ROUNDS; round++) {
+            uint32_t heap = ESP.getFreeHeap();
+            uint32_t start = micros();
+            create_functions[i]();
+            code_us += micros() - start;
+            code_heap = heap - ESP.getFreeHeap();
+            // Screens come first in objects_t, in ScreensEnum order
+            lv_obj_delete(((lv_obj_t **)&objects)[i]);
+
+            heap = ESP.getFreeHeap();
+            start = micros();
+            lv_obj_t *screen = ui_table_create_screen(&ui_table, i);
+            table_us += micros() - start;
+            table_heap = heap - ESP.getFreeHeap();
+            lv_obj_delete(screen);
+        }
+        Serial.printf("screen %d built by code %lu us, from the table %lu us; heap %lu / %lu bytes\n", i + 1,
+                      (unsigned long)(code_us / UI_TABLE_BENCH_ROUNDS), (unsigned long)(table_us / UI_TABLE_BENCH_ROUNDS),
+                      (unsigned long)code_heap, (unsigned long)table_heap);
+    }
+    objects = shown;
+}
+#endif
+
+#ifdef DEMO_STYLE_BENCH
+// A 120-widget screen, 60 buttons with a label each styled like the EEZ
+// buttons: the same properties set as local styles on every widget, then
+// through one shared style per widget kind. Heap is what the screen takes,
+// refresh is lv_obj_refresh_style() over all of it as on a theme change,
+// render is a full redraw without the display time.
+#define STYLE_BENCH_BUTTONS 60
+#define STYLE_BENCH_ROUNDS 10
+
+static lv_style_t bench_button_style;
+static lv_style_t bench_label_style;
+
+static void style_bench_run(lv_display_t *display, bool shared) {
+    const lv_style_selector_t main = LV_PART_MAIN | LV_STATE_DEFAULT;
+    lv_obj_t *shown = lv_screen_active();
+    uint32_t heap0 = ESP.getFreeHeap();
+    uint32_t start = micros();
+    lv_obj_t *scr = lv_obj_create(NULL);
+    for (int i = 0; i < STYLE_BENCH_BUTTONS; i++) {
+        lv_obj_t *button = lv_button_create(scr);
+        lv_obj_set_pos(button, 4 + (i % 5) * 63, 4 + (i / 5) * 19);
+        lv_obj_set_size(button, 60, 17);
+        lv_obj_t *label = lv_label_create(button);
+        lv_label_set_text_static(label, "Option");
+        if (shared) {
+            lv_obj_add_style(button, &bench_button_style, main);
+            lv_obj_add_style(label, &bench_label_style, main);
+        } else {
+            lv_obj_set_style_bg_color(button, lv_color_hex(0x000000), main);
+            lv_obj_set_style_radius(button, 4, main);
+            lv_obj_set_style_border_width(button, 0, main);
+            lv_obj_set_style_shadow_width(button, 0, main);
+            lv_obj_set_style_text_color(label, lv_color_hex(0xffffff), main);
+            lv_obj_set_style_text_font(label, &lv_font_montserrat_12, main);
+            lv_obj_set_style_align(label, LV_ALIGN_CENTER, main);
+        }
+    }
+    uint32_t build_us = micros() - start;
+    uint32_t heap = heap0 - ESP.getFreeHeap();
+    lv_screen_load(scr);
+    lv_refr_now(display);
+
+    start = micros();
+    for (int i = 0; i < STYLE_BENCH_ROUNDS; i++)
+        lv_obj_refresh_style(scr, LV_PART_ANY, LV_STYLE_PROP_ANY);
+    uint32_t refresh_us = (micros() - start) / STYLE_BENCH_ROUNDS;
+    lv_refr_now(display);
+
+    uint32_t flush0 = flush_us, wait0 = wait_us;
+    start = micros();
+    for (int i = 0; i < STYLE_BENCH_ROUNDS; i++) {
+        lv_obj_invalidate(scr);
+        lv_refr_now(display);
+    }
+    uint32_t render_us = (micros() - start - (flush_us - flush0) - (wait_us - wait0)) / STYLE_BENCH_ROUNDS;
+
+    lv_screen_load(shown);
+    lv_obj_delete(scr);
+    Serial.printf("%s styles, %d widgets: built %lu us, heap %lu bytes, style refresh %lu us, render %lu us\n",
+                  shared ? "shared" : "local", STYLE_BENCH_BUTTONS * 2, (unsigned long)build_us, (unsigned long)heap,
+                  (unsigned long)refresh_us, (unsigned long)render_us);
 }
 
+// Heap of the EEZ screens built from the table, either way
+static void style_bench_table(bool shared) {
+    objects_t kept = objects;
+    lv_obj_t *screens[8];
+    uint8_t count = std::min<uint8_t>(ui_table.screen_count, 8);
+    ui_table_set_shared_styles(shared);
+    uint32_t heap0 = ESP.getFreeHeap();
+    for (uint8_t i = 0; i < count; i++)
+        screens[i] = ui_table_create_screen(&ui_table, i);
+    uint32_t heap = heap0 - ESP.getFreeHeap();
+    for (uint8_t i = 0; i < count; i++)
+        lv_obj_delete(screens[i]);
+    ui_table_set_shared_styles(true);
+    objects = kept;
+    Serial.printf("%s styles, the %u EEZ screens: heap %lu bytes\n", shared ? "shared" : "local", count,
+                  (unsigned long)heap);
+}
+
+static void style_bench(lv_display_t *display) {
+    lv_style_init(&bench_button_style);
+    lv_style_set_bg_color(&bench_button_style, lv_color_hex(0x000000));
+    lv_style_set_radius(&bench_button_style, 4);
+    lv_style_set_border_width(&bench_button_style, 0);
+    lv_style_set_shadow_width(&bench_button_style, 0);
+    lv_style_init(&bench_label_style);
+    lv_style_set_text_color(&bench_label_style, lv_color_hex(0xffffff));
+    lv_style_set_text_font(&bench_label_style, &lv_font_montserrat_12);
+    lv_style_set_align(&bench_label_style, LV_ALIGN_CENTER);
+
+    style_bench_run(display, false);
+    style_bench_run(display, true);
+    style_bench_table(false);
+    style_bench_table(true);
+
+    ui_table_style_stats_t stats;
+    ui_table_get_style_stats(&stats);
+    Serial.printf("ui_table styles: %u shared with %u properties, %lu references, %lu local properties\n",
+                  stats.styles, stats.props, (unsigned long)stats.refs, (unsigned long)stats.local_props);
+}
+#endif
+
+#if DEMO_FAST_BOOT
+// One screen per LVGL timer pass, so input and rendering get in between
+static void prebuild_cb(lv_timer_t *timer) {
+    if (!screen_cache_build_next()) {
+        lv_timer_delete(timer);
+        BOOT_MARK("screens prebuilt");
+    }
+}
+#endif
+
 void setup() {
     Serial.begin(115200);
     Serial.println("EEZ Studio LVGL Demo Starting...");
-
-    String LVGL_Arduino = String("LVGL Library Version: ") + lv_version_major() + "." + lv_version_minor() + "." + lv_version_patch();
-    Serial.println(LVGL_Arduino);
-
+    Serial.printf("LVGL Library Version: %d.%d.%d\n", lv_version_major(), lv_version_minor(), lv_version_patch());
     Serial.println("In setup()");
+    BOOT_MARK("serial");
   
     // Initialize TFT display hardware
     tft.init();
     tft.setRotation(2); 
     pinMode(LCD_BACKLIGHT_PIN, OUTPUT);
+#if DEMO_FAST_BOOT
+    // Backlight on only once the splash is there, so the panel's power-on
+    // contents are never seen
+    tft.fillScreen(tft.color565(SPLASH_RGB >> 16, (SPLASH_RGB >> 8) & 0xFF, SPLASH_RGB & 0xFF));
+    BOOT_FIRST_PIXEL();
+#endif
     digitalWrite(LCD_BACKLIGHT_PIN, HIGH); // Turn on backlight
+    tft.setSwapBytes(false); // LVGL renders the panel's byte order already
+#if DEMO_FLUSH_DMA
+    tft.initDMA();
+    tft.startWrite(); // the display keeps its SPI bus, touch is on VSPI
+#endif
+    BOOT_MARK("tft.init");
 
     //Initialize the touchscreen
     touchscreenSpi.begin(XPT2046_CLK, XPT2046_MISO, XPT2046_MOSI, XPT2046_CS); // Start second SPI bus for touchscreen
+#if !DEMO_TOUCH_TASK
     touchscreen.begin(touchscreenSpi);                                         // Touchscreen init
     touchscreen.setRotation(1);                                                // Inverted landscape orientation to match screen
+#endif
+
+    BOOT_MARK("touch");
 
     // Initialize LVGL
     lv_init();
     lv_log_register_print_cb(my_log_print);
+#if DEMO_TICKLESS
+    lv_tick_set_cb(my_tick);
+#endif
     
     // Create display (LVGL 9.x API)
     lv_display_t *display = lv_display_create(screenWidth, screenHeight);
     
     // Set display buffer with double buffering for smoother refresh
+    lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565_SWAPPED);
     lv_display_set_buffers(display, buf1, buf2, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
     
     // Set display flush callback
     lv_display_set_flush_cb(display, my_disp_flush);
+#ifdef PROFILER
+    prof_init(prof_probes, sizeof(prof_probes) / sizeof(prof_probes[0]));
+    lv_display_add_event_cb(display, prof_render_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(display, prof_render_cb, LV_EVENT_RENDER_READY, NULL);
+#endif
+#if DEMO_FLUSH_TASK || DEMO_FLUSH_DMA
+    lv_display_set_flush_wait_cb(display, my_flush_wait);
+#endif
+#if DEMO_FLUSH_TASK
+    // Flush on the core loop() does not run on
+    flush_queue = xQueueCreate(1, sizeof(flush_job_t));
+    flush_done = xSemaphoreCreateBinary();
+    xTaskCreatePinnedToCore(flush_task, "flush", 4096, NULL, 2, NULL, xPortGetCoreID() ^ 1);
+#endif
         
     // Set up touch input device
     lv_indev_t *indev_touchpad = lv_indev_create();
     lv_indev_set_type(indev_touchpad, LV_INDEV_TYPE_POINTER);
     lv_indev_set_read_cb(indev_touchpad, my_touchpad_read);
 
-    // Initialize EEZ Studio generated UI
-    ui_init();
+    // Touch IRQ: wakes loop() in tickless mode, timestamps the press for the stats
+    touch_read_timer = lv_indev_get_read_timer(indev_touchpad);
+    touch_wake = xSemaphoreCreateBinary();
+#if DEMO_TOUCH_TASK
+    // Without the sampler task there is no touch input; the screens still run
+    touch_on = touch_input_begin(touchscreenSpi, XPT2046_CS, XPT2046_IRQ, touch_sampled);
+    if (!touch_on)
+        Serial.println("Touch sampler task did not start, touch is off");
+#else
+    pinMode(XPT2046_IRQ, INPUT);
+    attachInterrupt(digitalPinToInterrupt(XPT2046_IRQ), touch_irq, FALLING);
+#endif
+#ifdef DEMO_TOUCH_STATS
+    lv_indev_add_event_cb(indev_touchpad, touch_pressed_cb, LV_EVENT_PRESSED, NULL);
+    lv_timer_create(touch_stats_cb, 10000, NULL);
+#endif
+#ifdef DEMO_LOOP_STATS
+    lv_display_add_event_cb(display, touch_redraw_cb, LV_EVENT_RENDER_READY, NULL);
+    lv_timer_create(loop_stats_cb, 5000, NULL);
+    stats_start_us = micros();
+#endif
+
+    BOOT_MARK("lv_init, display");
+
+    // EEZ Studio generated UI; screen_cache.cpp builds the screens instead
+    // of ui_init()
+    screen_cache_init(screen_defs, sizeof(screen_defs) / sizeof(screen_defs[0]), DEMO_SCREEN_CACHE);
+    screen_cache_load(SCREEN_ID_MAIN);
+    BOOT_MARK("main screen");
+#if DEMO_FAST_BOOT
+    lv_timer_create(prebuild_cb, 0, NULL);
+#endif
+#ifdef DEMO_SCREEN_BENCH
+    screen_bench(display);
+#endif
+#ifdef DEMO_UI_TABLE_BENCH
+    ui_table_bench();
+#endif
+#ifdef DEMO_STYLE_BENCH
+    style_bench(display);
+#endif
+#if DEMO_TOUCH_TASK && defined(DEMO_TOUCH_CALIBRATE)
+    if (touch_on)
+        touch_calibrate(display);
+#endif
+#ifdef DEMO_FPS_TEST
+    fps_test_start(display);
+#endif
     
     Serial.println("UI initialized and ready!");
     
     // Force initial screen refresh
     lv_refr_now(display);
+    BOOT_MARK("first frame");
     
     Serial.println("Setup complete!");
 }
 
 void loop() {
+    PROF_BEGIN(PROF_LOOP);
+    PROF_BEGIN(PROF_TIMER_HANDLER);
+#if DEMO_TICKLESS
+    // Handle LVGL tasks; returns how long until the next one is due
+    uint32_t idle_ms = lv_timer_handler();
+#else
     // CRITICAL: Tell LVGL how much time has passed
     lv_tick_inc(3); // 3ms matches our delay below for faster refresh
     
     // Handle LVGL tasks
     lv_timer_handler();
+#endif
+    PROF_END(PROF_TIMER_HANDLER);
+    BOOT_INTERACTIVE(); // input has been read and handled once
     
-    // Handle EEZ Studio UI updates
+    // Handle EEZ Studio UI updates. ui_tick() changes objects outside
+    // lv_timer_handler(), so it takes the lock lv_timer_handler() renders under
+    lv_lock();
+    PROF_BEGIN(PROF_UI_TICK);
     ui_tick();
+    PROF_END(PROF_UI_TICK);
+    lv_unlock();
+    PROF_END(PROF_LOOP);
+#ifdef PROFILER
+    prof_serial(); // 'p' arms, 'd' dumps, 'c' clears
+#endif
     
+#if DEMO_TICKLESS
+    // Sleep until LVGL has work again or the panel is touched
+    if (idle_ms > DEMO_MAX_IDLE_MS) idle_ms = DEMO_MAX_IDLE_MS;
+    if (loop_sleep(idle_ms)) {
+        // Read the touch right away and keep polling while it is pressed
+        lv_lock();
+        lv_timer_resume(touch_read_timer);
+        lv_timer_ready(touch_read_timer);
+        lv_unlock();
+    }
+#else
     // Small delay to prevent watchdog issues - reduced for faster refresh
-    delay(3);
-}
\ No newline at end of file
+    loop_sleep(3);
+#endif
+}
@@ -0,0 +1,65 @@
+// Cycle-counter profiler.
+//
+// Spans are timed with the CPU cycle counter and go into a fixed
+// log-linear histogram per probe: four buckets per power of two, so a
+// bucket is at most 25% wide. Nothing is allocated and nothing is printed
+// while recording; prof_serial() dumps the histograms as CSV on request,
+// and edisplay/host/prof_report turns a dump into percentiles and a
+// flame-style tree.
+//
+// Without -D PROFILER the PROF_* macros compile to nothing. With it, a
+// disarmed probe costs a load and a branch; 'p' on Serial arms and disarms,
+// 'd' dumps, 'c' clears.
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+
+#define PROF_MAX_PROBES 8
+#define PROF_BUCKETS 124  // cycle counts 0..2^32, see prof_bucket()
+
+typedef struct {
+    const char *name;
+    int8_t parent;  // probe this one runs inside, -1 for a root
+} prof_probe_t;
+
+// The probe table stays owned by the caller; ids index into it
+void prof_init(const prof_probe_t *probes, uint8_t count);
+void prof_arm(bool armed);
+void prof_clear();
+void prof_dump(Print &out);
+// Handles the 'p', 'd' and 'c' commands waiting on Serial
+void prof_serial();
+// One character read from Serial by a caller with commands of its own;
+// false when it is none of the profiler's
+bool prof_command(int c);
+
+extern volatile bool prof_armed;
+void prof_record(uint8_t id, uint32_t cycles);
+
+static inline uint32_t prof_begin() {
+    return prof_armed ? ESP.getCycleCount() : 0;
+}
+
+static inline void prof_end(uint8_t id, uint32_t start) {
+    if (start)
+        prof_record(id, ESP.getCycleCount() - start);
+}
+
+// Spans that start and end in different callbacks
+extern uint32_t prof_started[PROF_MAX_PROBES];
+
+#ifdef PROFILER
+#define PROF_BEGIN(id) uint32_t prof_start_##id = prof_begin()
+#define PROF_END(id) prof_end(id, prof_start_##id)
+#define PROF_MARK(id) (prof_started[id] = prof_begin())
+#define PROF_MARK_END(id) prof_end(id, prof_started[id])
+#else
+#define PROF_BEGIN(id)
+#define PROF_END(id)
+#define PROF_MARK(id)
+#define PROF_MARK_END(id)
+#endif
+
+#endif
@@ -0,0 +1,180 @@
+// Lazy screen construction, see screen_cache.h.
+
+#include "screen_cache.h"
+#include "ui/ui.h"
+
+// objects_t is an array of widget pointers, ui.c indexes it the same way
+#define OBJECT_COUNT (sizeof(objects_t) / sizeof(lv_obj_t *))
+#define OBJECT_WORDS ((OBJECT_COUNT + 31) / 32)
+// States a rebuilt screen gets back; pressed, focused and the like are transient
+#define KEPT_STATES (LV_STATE_CHECKED | LV_STATE_DISABLED)
+
+typedef struct {
+    uint32_t last_used;             // 0 while the screen isn't built
+    uint32_t owned[OBJECT_WORDS];   // objects.* fields its create function sets
+    int32_t scroll_x;
+    int32_t scroll_y;
+} entry_t;
+
+static const screen_def_t *defs;
+static uint8_t def_count = 0;
+static uint8_t capacity;
+static entry_t entries[SCREEN_CACHE_MAX_SCREENS];
+static uint32_t use_clock = 0;
+static screen_cache_stats_t stats;
+static void (*built_cb)(int id) = NULL;
+
+// State of the named widgets of evicted screens
+static lv_state_t saved_state[OBJECT_COUNT];
+static uint32_t saved[OBJECT_WORDS];
+
+static lv_obj_t **object_fields() {
+    return (lv_obj_t **)&objects;
+}
+
+static bool has_bit(const uint32_t *bits, uint32_t i) {
+    return bits[i / 32] & (1u << (i % 32));
+}
+
+static void build(uint8_t index) {
+    const screen_def_t *def = &defs[index];
+    entry_t *entry = &entries[index];
+    lv_obj_t **fields = object_fields();
+    lv_obj_t *before[OBJECT_COUNT];
+    memcpy(before, fields, sizeof(before));
+
+    uint32_t start = micros();
+    def->create();
+    stats.build_us += micros() - start;
+    stats.builds++;
+    stats.live++;
+
+    memset(entry->owned, 0, sizeof(entry->owned));
+    for (uint32_t i = 0; i < OBJECT_COUNT; i++) {
+        if (fields[i] == before[i] || !fields[i])
+            continue;
+        entry->owned[i / 32] |= 1u << (i % 32);
+        if (has_bit(saved, i)) {
+            lv_obj_remove_state(fields[i], KEPT_STATES & ~saved_state[i]);
+            lv_obj_add_state(fields[i], saved_state[i]);
+        }
+    }
+    if (entry->scroll_x || entry->scroll_y) {
+        lv_obj_update_layout(*def->root);
+        lv_obj_scroll_to(*def->root, entry->scroll_x, entry->scroll_y, LV_ANIM_OFF);
+    }
+    if (built_cb)
+        built_cb(def->id);
+}
+
+static void evict(uint8_t index) {
+    const screen_def_t *def = &defs[index];
+    entry_t *entry = &entries[index];
+    lv_obj_t **fields = object_fields();
+
+    for (uint32_t i = 0; i < OBJECT_COUNT; i++) {
+        if (!has_bit(entry->owned, i))
+            continue;
+        if (fields[i]) {
+            saved_state[i] = lv_obj_get_state(fields[i]) & KEPT_STATES;
+            saved[i / 32] |= 1u << (i % 32);
+        }
+    }
+    entry->scroll_x = lv_obj_get_scroll_x(*def->root);
+    entry->scroll_y = lv_obj_get_scroll_y(*def->root);
+
+    lv_obj_delete(*def->root);
+    *def->root = NULL;
+    for (uint32_t i = 0; i < OBJECT_COUNT; i++) {
+        if (has_bit(entry->owned, i))
+            fields[i] = NULL;
+    }
+    entry->last_used = 0;
+    stats.evictions++;
+    stats.live--;
+}
+
+// Least recently shown screen that may go: built, not active, not `keep`
+static int oldest_idle(uint8_t keep) {
+    lv_obj_t *active = lv_screen_active();
+    int oldest = -1;
+    for (uint8_t i = 0; i < def_count; i++) {
+        if (!entries[i].last_used || i == keep || *defs[i].root == active)
+            continue;
+        if (oldest < 0 || entries[i].last_used < entries[oldest].last_used)
+            oldest = i;
+    }
+    return oldest;
+}
+
+void screen_cache_init(const screen_def_t *screen_defs, uint8_t count, uint8_t screen_capacity) {
+    for (uint8_t i = 0; i < def_count; i++) {
+        if (entries[i].last_used)
+            evict(i);
+    }
+    memset(entries, 0, sizeof(entries));
+    memset(saved, 0, sizeof(saved));
+    memset(&stats, 0, sizeof(stats));
+    defs = screen_defs;
+    def_count = count < SCREEN_CACHE_MAX_SCREENS ? count : SCREEN_CACHE_MAX_SCREENS;
+    capacity = screen_capacity;
+
+    lv_display_t *display = lv_display_get_default();
+    lv_theme_t *theme = lv_theme_default_init(display, lv_palette_main(LV_PALETTE_BLUE),
+                                              lv_palette_main(LV_PALETTE_RED), false, LV_FONT_DEFAULT);
+    lv_display_set_theme(display, theme);
+
+    if (!capacity) {
+        for (uint8_t i = 0; i < def_count; i++) {
+            build(i);
+            entries[i].last_used = ++use_clock;
+        }
+    }
+}
+
+void screen_cache_set_built_cb(void (*built)(int id)) {
+    built_cb = built;
+}
+
+bool screen_cache_load(int id) {
+    uint8_t index = 0;
+    while (index < def_count && defs[index].id != id)
+        index++;
+    if (index == def_count)
+        return false;
+
+    if (!entries[index].last_used) {
+        // Make room first, so the heap never holds more than capacity screens
+        while (capacity && stats.live >= capacity) {
+            int oldest = oldest_idle(index);
+            if (oldest < 0)
+                break;  // only the active screen is left; it goes on the next load
+            evict(oldest);
+        }
+        build(index);
+    }
+    entries[index].last_used = ++use_clock;
+
+    if (defs[index].eez)
+        loadScreen((enum ScreensEnum)id);
+    else
+        lv_screen_load(*defs[index].root);
+    return true;
+}
+
+bool screen_cache_build_next() {
+    if (capacity && stats.live >= capacity)
+        return false;
+    for (uint8_t i = 0; i < def_count; i++) {
+        if (!entries[i].last_used) {
+            build(i);
+            entries[i].last_used = ++use_clock;
+            return true;
+        }
+    }
+    return false;
+}
+
+void screen_cache_get_stats(screen_cache_stats_t *out) {
+    *out = stats;
+}
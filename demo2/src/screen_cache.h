@@ -0,0 +1,54 @@
+// Lazy screen construction for the EEZ-generated screens.
+//
+// ui_init() builds every screen at boot and keeps them all. Here a screen
+// is built the first time it is loaded, and at most `capacity` screens are
+// kept: loading one more deletes the least recently shown screen other
+// than the active one. A rebuilt screen gets back the checked/disabled
+// states of its named widgets (the objects.* fields its create function
+// sets) and its scroll position; the built callback can restore anything
+// else.
+//
+// The generated src/ui files stay untouched: EEZ screens are still shown
+// through loadScreen(), so ui_tick() ticks the right one.
+
+#ifndef SCREEN_CACHE_H
+#define SCREEN_CACHE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#define SCREEN_CACHE_MAX_SCREENS 16
+
+typedef struct {
+    int id;                 // ScreensEnum value for EEZ screens
+    bool eez;               // shown through loadScreen(); false for screens EEZ doesn't know
+    void (*create)(void);   // create_screen_*()
+    lv_obj_t **root;        // where create() leaves the screen, e.g. &objects.main
+} screen_def_t;
+
+typedef struct {
+    uint32_t builds;
+    uint32_t evictions;
+    uint32_t build_us;  // total time in create functions
+    uint8_t live;
+} screen_cache_stats_t;
+
+// Sets the theme create_screens() would and takes over screen creation;
+// capacity 0 builds every screen now, as ui_init() does. Calling it again
+// deletes the screens built so far, so none of them may be active.
+void screen_cache_init(const screen_def_t *defs, uint8_t count, uint8_t capacity);
+
+// Called after a screen was built, first time or again after an eviction
+void screen_cache_set_built_cb(void (*built)(int id));
+
+// Builds the screen if needed and shows it; false for an unknown id
+bool screen_cache_load(int id);
+
+// Builds the next screen that isn't built yet, without showing it, while
+// fewer than capacity are; false when there is nothing left to build. For
+// idle time after boot, so the first load of a screen finds it ready.
+bool screen_cache_build_next();
+
+void screen_cache_get_stats(screen_cache_stats_t *stats);
+
+#endif
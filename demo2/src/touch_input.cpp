@@ -0,0 +1,244 @@
+// Interrupt-driven XPT2046 touch sampler, see touch_input.h.
+
+#include <atomic>
+#include <Preferences.h>
+#include "touch_input.h"
+
+// XPT2046 control bytes: start bit, channel, 12-bit differential mode
+#define XPT_Z1 0xB1
+#define XPT_Z2 0xC1
+#define XPT_X 0x91
+#define XPT_Y_PD 0xD0  // last Y conversion powers down, re-arming PENIRQ
+
+// The raw range the demos used to map linearly onto 320x240
+static const touch_calibration_t default_calibration = {
+    319.0f / 3500, 0, 1 - 200 * 319.0f / 3500,
+    0, 239.0f / 3560, 1 - 240 * 239.0f / 3560,
+};
+
+static SPIClass *spi;  // NULL: clk, mosi and miso are driven by hand
+static uint8_t cs;
+static uint8_t clk, mosi, miso;
+static void (*sample_cb)(void);
+static TaskHandle_t sampler;
+static touch_calibration_t calibration;
+static volatile bool raw_mode = false;
+
+static volatile bool pressing = false;
+static volatile uint32_t irq_us = 0;
+
+// Written by the sampler only (head) and by the reader only (tail)
+static touch_sample_t ring[TOUCH_RING_SIZE];
+static std::atomic<uint32_t> ring_head(0);
+static std::atomic<uint32_t> ring_tail(0);
+static std::atomic<uint32_t> ring_dropped(0);
+
+static void IRAM_ATTR touch_irq() {
+    if (!pressing)
+        irq_us = micros();
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(sampler, &woken);
+    if (woken)
+        portYIELD_FROM_ISR();
+}
+
+static void push(const touch_sample_t *sample) {
+    uint32_t head = ring_head.load(std::memory_order_relaxed);
+    if (head - ring_tail.load(std::memory_order_acquire) == TOUCH_RING_SIZE) {
+        ring_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    ring[head & (TOUCH_RING_SIZE - 1)] = *sample;
+    ring_head.store(head + 1, std::memory_order_release);
+    if (sample_cb)
+        sample_cb();
+}
+
+// SPI mode 0 by hand, MSB first: the controller shifts out on the falling
+// clock edge and in on the rising one
+static uint16_t soft_transfer(uint16_t out, uint8_t bits) {
+    uint16_t in = 0;
+    for (int i = bits - 1; i >= 0; i--) {
+        digitalWrite(mosi, out >> i & 1);
+        delayMicroseconds(1);
+        digitalWrite(clk, HIGH);
+        in = in << 1 | digitalRead(miso);
+        delayMicroseconds(1);
+        digitalWrite(clk, LOW);
+    }
+    return in;
+}
+
+static uint16_t transfer(uint16_t out, uint8_t bits) {
+    if (!spi)
+        return soft_transfer(out, bits);
+    return bits == 8 ? spi->transfer(out) : spi->transfer16(out);
+}
+
+// One conversion set; each transfer returns the result of the previous command
+static bool read_raw(uint16_t *x, uint16_t *y) {
+    if (spi)
+        spi->beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
+    digitalWrite(cs, LOW);
+    transfer(XPT_Z1, 8);
+    int16_t z1 = transfer(XPT_Z2, 16) >> 3;
+    int16_t z2 = transfer(XPT_X, 16) >> 3;
+    transfer(XPT_X, 16);  // the first X after Z is noisy
+    *x = transfer(XPT_Y_PD, 16) >> 3;
+    *y = transfer(0, 16) >> 3;
+    digitalWrite(cs, HIGH);
+    if (spi)
+        spi->endTransaction();
+    return z1 + 4095 - z2 >= TOUCH_Z_THRESHOLD;
+}
+
+static uint16_t median(uint16_t *v, int n) {
+    for (int i = 1; i < n; i++) {
+        uint16_t t = v[i];
+        int j = i;
+        for (; j > 0 && v[j - 1] > t; j--)
+            v[j] = v[j - 1];
+        v[j] = t;
+    }
+    return v[n / 2];
+}
+
+// Median of a burst; false when most conversions saw no pressure
+static bool sample_burst(uint16_t *x, uint16_t *y) {
+    uint16_t xs[TOUCH_BURST], ys[TOUCH_BURST];
+    int n = 0;
+    for (int i = 0; i < TOUCH_BURST; i++) {
+        if (read_raw(&xs[n], &ys[n]))
+            n++;
+    }
+    if (n <= TOUCH_BURST / 2)
+        return false;
+    *x = median(xs, n);
+    *y = median(ys, n);
+    return true;
+}
+
+static void calibrated(float rx, float ry, touch_sample_t *sample) {
+    if (raw_mode) {
+        sample->x = (int16_t)(rx + 0.5f);
+        sample->y = (int16_t)(ry + 0.5f);
+        return;
+    }
+    sample->x = (int16_t)(calibration.a * rx + calibration.b * ry + calibration.c + 0.5f);
+    sample->y = (int16_t)(calibration.d * rx + calibration.e * ry + calibration.f + 0.5f);
+}
+
+static void sampler_task(void *arg) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        pressing = true;
+
+        touch_sample_t sample = {0, 0, true, irq_us};
+        float fx = 0, fy = 0;
+        bool down = false;
+        uint16_t rx, ry;
+        while (sample_burst(&rx, &ry)) {
+            fx = down ? fx + (rx - fx) * TOUCH_IIR_ALPHA : rx;
+            fy = down ? fy + (ry - fy) * TOUCH_IIR_ALPHA : ry;
+            down = true;
+            calibrated(fx, fy, &sample);
+            push(&sample);
+            sample.irq_us = 0;  // only the first sample of a press carries the edge
+            vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_MS));
+        }
+        if (down) {
+            sample.pressed = false;
+            push(&sample);
+        }
+
+        // PENIRQ also drops during our own conversions; forget those edges
+        ulTaskNotifyTake(pdTRUE, 0);
+        pressing = false;
+    }
+}
+
+static bool start(uint8_t cs_pin, uint8_t irq_pin, void (*on_sample)(void)) {
+    cs = cs_pin;
+    sample_cb = on_sample;
+    pinMode(cs, OUTPUT);
+    digitalWrite(cs, HIGH);
+
+    Preferences prefs;
+    prefs.begin("touch", true);
+    if (prefs.getBytes("cal", &calibration, sizeof(calibration)) != sizeof(calibration))
+        calibration = default_calibration;
+    prefs.end();
+
+    if (xTaskCreatePinnedToCore(sampler_task, "touch", 3072, NULL, 3, &sampler, xPortGetCoreID() ^ 1) != pdPASS)
+        return false;
+    pinMode(irq_pin, INPUT);
+    attachInterrupt(digitalPinToInterrupt(irq_pin), touch_irq, FALLING);
+    return true;
+}
+
+bool touch_input_begin(SPIClass &touch_spi, uint8_t cs_pin, uint8_t irq_pin, void (*on_sample)(void)) {
+    spi = &touch_spi;
+    return start(cs_pin, irq_pin, on_sample);
+}
+
+bool touch_input_begin_pins(uint8_t clk_pin, uint8_t mosi_pin, uint8_t miso_pin, uint8_t cs_pin, uint8_t irq_pin,
+                            void (*on_sample)(void)) {
+    spi = NULL;
+    clk = clk_pin;
+    mosi = mosi_pin;
+    miso = miso_pin;
+    pinMode(clk, OUTPUT);
+    digitalWrite(clk, LOW);
+    pinMode(mosi, OUTPUT);
+    pinMode(miso, INPUT);
+    return start(cs_pin, irq_pin, on_sample);
+}
+
+bool touch_input_read(touch_sample_t *sample) {
+    uint32_t tail = ring_tail.load(std::memory_order_relaxed);
+    if (tail == ring_head.load(std::memory_order_acquire))
+        return false;
+    *sample = ring[tail & (TOUCH_RING_SIZE - 1)];
+    ring_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool touch_input_pending() {
+    return ring_tail.load(std::memory_order_relaxed) != ring_head.load(std::memory_order_acquire);
+}
+
+uint32_t touch_input_dropped() {
+    return ring_dropped.load(std::memory_order_relaxed);
+}
+
+void touch_input_set_raw(bool raw) {
+    raw_mode = raw;
+}
+
+bool touch_input_solve(const int16_t raw[3][2], const int16_t screen[3][2], touch_calibration_t *cal) {
+    float x0 = raw[0][0] - raw[2][0], y0 = raw[0][1] - raw[2][1];
+    float x1 = raw[1][0] - raw[2][0], y1 = raw[1][1] - raw[2][1];
+    float det = x0 * y1 - x1 * y0;
+    if (det > -1 && det < 1)
+        return false;
+
+    float sx0 = screen[0][0] - screen[2][0], sx1 = screen[1][0] - screen[2][0];
+    float sy0 = screen[0][1] - screen[2][1], sy1 = screen[1][1] - screen[2][1];
+    cal->a = (sx0 * y1 - sx1 * y0) / det;
+    cal->b = (x0 * sx1 - x1 * sx0) / det;
+    cal->c = screen[2][0] - cal->a * raw[2][0] - cal->b * raw[2][1];
+    cal->d = (sy0 * y1 - sy1 * y0) / det;
+    cal->e = (x0 * sy1 - x1 * sy0) / det;
+    cal->f = screen[2][1] - cal->d * raw[2][0] - cal->e * raw[2][1];
+    return true;
+}
+
+void touch_input_set_calibration(const touch_calibration_t *cal, bool save) {
+    calibration = *cal;
+    if (save) {
+        Preferences prefs;
+        prefs.begin("touch", false);
+        prefs.putBytes("cal", cal, sizeof(*cal));
+        prefs.end();
+    }
+}
@@ -0,0 +1,58 @@
+// Interrupt-driven XPT2046 touch sampler.
+//
+// A falling T_IRQ edge wakes a sampler task that reads the controller in
+// bursts of TOUCH_BURST conversions while the panel is pressed, takes the
+// median of each burst and smooths the medians with an IIR filter. The
+// calibrated points go into a single-producer/single-consumer ring that
+// the LVGL input callback drains without locks.
+//
+// Calibration is an affine transform from raw ADC values to screen pixels.
+// It is kept in NVS and defaults to the panel's nominal raw range.
+
+#ifndef TOUCH_INPUT_H
+#define TOUCH_INPUT_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#define TOUCH_BURST 5          // conversions per sample, median taken
+#define TOUCH_SAMPLE_MS 10     // sample period while pressed
+#define TOUCH_IIR_ALPHA 0.5f   // weight of a new median
+#define TOUCH_Z_THRESHOLD 400  // pressure that counts as a touch
+#define TOUCH_RING_SIZE 32     // power of two
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    bool pressed;
+    uint32_t irq_us;  // T_IRQ edge that started the press
+} touch_sample_t;
+
+// screen_x = a * raw_x + b * raw_y + c, screen_y = d * raw_x + e * raw_y + f
+typedef struct {
+    float a, b, c;
+    float d, e, f;
+} touch_calibration_t;
+
+// Loads the calibration, claims T_IRQ and starts the sampler on the other
+// core. on_sample runs in the sampler task after each new sample.
+bool touch_input_begin(SPIClass &spi, uint8_t cs_pin, uint8_t irq_pin, void (*on_sample)(void));
+// Same, driving the controller's clock and data pins by hand, for when its
+// SPI peripheral is taken by another device (sd_fs). A burst then takes
+// about 1 ms of the sampler's core instead of a fifth of that.
+bool touch_input_begin_pins(uint8_t clk_pin, uint8_t mosi_pin, uint8_t miso_pin, uint8_t cs_pin, uint8_t irq_pin,
+                            void (*on_sample)(void));
+
+// Consumer side, one reader only
+bool touch_input_read(touch_sample_t *sample);
+bool touch_input_pending();
+uint32_t touch_input_dropped();
+
+// Raw mode delivers filtered ADC values instead of screen points, for calibrating
+void touch_input_set_raw(bool raw);
+
+// Affine transform through three raw/screen point pairs; false when they are collinear
+bool touch_input_solve(const int16_t raw[3][2], const int16_t screen[3][2], touch_calibration_t *cal);
+void touch_input_set_calibration(const touch_calibration_t *cal, bool save);
+
+#endif
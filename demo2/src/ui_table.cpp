@@ -0,0 +1,173 @@
+// Table-driven screen construction, see ui_table.h.
+
+#include "ui_table.h"
+#include "ui/ui.h"
+
+static bool shared_styles = true;
+static ui_table_style_stats_t style_stats;
+
+static uint16_t read16(const uint8_t *p) {
+    return p[0] | p[1] << 8;
+}
+
+static lv_obj_t *create_child(uint8_t type, lv_obj_t *parent) {
+    switch (type) {
+    case UI_TABLE_LABEL:
+        return lv_label_create(parent);
+#if LV_USE_BUTTON
+    case UI_TABLE_BUTTON:
+        return lv_button_create(parent);
+#endif
+#if LV_USE_BUTTONMATRIX
+    case UI_TABLE_BUTTONMATRIX:
+        return lv_buttonmatrix_create(parent);
+#endif
+#if LV_USE_IMAGE
+    case UI_TABLE_IMAGE:
+        return lv_image_create(parent);
+#endif
+    default:
+        return lv_obj_create(parent);
+    }
+}
+
+// Reads one style set entry into prop and value; returns the next entry
+static const uint8_t *read_entry(const ui_table_t *table, const uint8_t *entry, lv_style_prop_t *prop,
+                                 lv_style_value_t *value) {
+    *prop = table->props[entry[0]];
+    switch (entry[1]) {
+    case UI_TABLE_VALUE_COLOR:
+        value->color = lv_color_make(entry[2], entry[3], entry[4]);
+        return entry + 5;
+    case UI_TABLE_VALUE_FONT:
+        value->ptr = table->fonts[entry[2]];
+        return entry + 3;
+    default:
+        value->num = table->nums[read16(entry + 2)];
+        return entry + 4;
+    }
+}
+
+static void apply_style_set(const ui_table_t *table, lv_obj_t *obj, uint16_t index) {
+    const uint8_t *set = table->styles + table->style_sets[index];
+    lv_style_selector_t selector = table->selectors[set[0]];
+    uint8_t count = set[1];
+    const uint8_t *entry = set + 2;
+    lv_style_prop_t prop;
+    lv_style_value_t value;
+
+    if (!shared_styles) {
+        // The same lv_obj_set_local_style_prop() calls the lv_obj_set_style_*() setters make
+        for (uint8_t i = 0; i < count; i++) {
+            entry = read_entry(table, entry, &prop, &value);
+            lv_obj_set_local_style_prop(obj, prop, value, selector);
+        }
+        style_stats.local_props += count;
+        return;
+    }
+
+    lv_style_t *style = &table->shared_styles[index];
+    // Still zeroed; lv_style_is_empty() would trip LV_USE_ASSERT_STYLE on it
+    if (!style->prop_cnt) {
+        lv_style_init(style);
+        for (uint8_t i = 0; i < count; i++) {
+            entry = read_entry(table, entry, &prop, &value);
+            lv_style_set_prop(style, prop, value);
+        }
+        style_stats.styles++;
+        style_stats.props += count;
+    }
+    lv_obj_add_style(obj, style, selector);
+    style_stats.refs++;
+}
+
+lv_obj_t *ui_table_create_screen(const ui_table_t *table, int index) {
+    const uint8_t *op = table->ops + table->screens[index];
+    const int32_t *nums = table->nums;
+    lv_obj_t *parents[UI_TABLE_MAX_DEPTH];
+    uint8_t depth = 0;
+    lv_obj_t *screen = NULL;
+    lv_obj_t *obj = NULL;
+
+    for (;;) {
+        switch (*op) {
+        case UI_TABLE_OP_SCREEN:
+            obj = screen = lv_obj_create(NULL);
+            op += 1;
+            break;
+        case UI_TABLE_OP_CHILD:
+            obj = create_child(op[1], parents[depth - 1]);
+            op += 2;
+            break;
+        case UI_TABLE_OP_OBJECT:
+            ((lv_obj_t **)&objects)[op[1]] = obj;
+            op += 2;
+            break;
+        case UI_TABLE_OP_POS:
+            lv_obj_set_pos(obj, nums[read16(op + 1)], nums[read16(op + 3)]);
+            op += 5;
+            break;
+        case UI_TABLE_OP_SIZE:
+            lv_obj_set_size(obj, nums[read16(op + 1)], nums[read16(op + 3)]);
+            op += 5;
+            break;
+        case UI_TABLE_OP_STYLE:
+            apply_style_set(table, obj, read16(op + 1));
+            op += 3;
+            break;
+        case UI_TABLE_OP_TEXT:
+            // Copied, as screens.c does: the label owns its text, so setting
+            // it later frees nothing the table holds
+            lv_label_set_text(obj, table->strings[read16(op + 1)]);
+            op += 3;
+            break;
+        case UI_TABLE_OP_LONG_MODE:
+            lv_label_set_long_mode(obj, (lv_label_long_mode_t)nums[read16(op + 1)]);
+            op += 3;
+            break;
+        case UI_TABLE_OP_EVENT:
+            lv_obj_add_event_cb(obj, table->actions[op[1]], (lv_event_code_t)nums[read16(op + 2)],
+                                (void *)(intptr_t)nums[read16(op + 4)]);
+            op += 6;
+            break;
+        case UI_TABLE_OP_MAP:
+#if LV_USE_BUTTONMATRIX
+            lv_buttonmatrix_set_map(obj, table->maps[op[1]]);
+#endif
+            op += 2;
+            break;
+        case UI_TABLE_OP_PUSH:
+            parents[depth++] = obj;
+            op += 1;
+            break;
+        case UI_TABLE_OP_POP:
+            obj = parents[--depth];
+            op += 1;
+            break;
+        case UI_TABLE_OP_END:
+            tick_screen(op[1]);
+            return screen;
+        default:
+            return screen;  // a table from another version of this file
+        }
+    }
+}
+
+void ui_table_init(const ui_table_t *table) {
+    lv_display_t *display = lv_display_get_default();
+    lv_theme_t *theme = lv_theme_default_init(display, lv_palette_main(LV_PALETTE_BLUE),
+                                              lv_palette_main(LV_PALETTE_RED), false, LV_FONT_DEFAULT);
+    lv_display_set_theme(display, theme);
+
+    for (int i = 0; i < table->screen_count; i++)
+        ui_table_create_screen(table, i);
+    loadScreen(SCREEN_ID_MAIN);
+}
+
+void ui_table_set_shared_styles(bool shared) {
+    shared_styles = shared;
+}
+
+void ui_table_get_style_stats(ui_table_style_stats_t *stats) {
+    *stats = style_stats;
+}
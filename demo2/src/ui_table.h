@@ -0,0 +1,106 @@
+// Table-driven construction of the EEZ-generated screens.
+//
+// tools/ui_table.py compiles src/ui/screens.c into src/ui_table_data.c:
+// per screen a byte stream of ops (create a widget, set its geometry,
+// apply a style set, set text, add an event, descend into its children),
+// plus tables for the values C has to evaluate (numbers and enum
+// constants, style properties, fonts, actions, strings). Widgets that
+// share their local styles share one style set. ui_table_create_screen()
+// walks the ops with one loop instead of running a create function per
+// screen, and ends like the create function does, with the screen's tick.
+//
+// The result is the screen create_screen_*() builds, objects.* included,
+// except that a style set becomes one lv_style_t, built the first time a
+// widget uses it and added to every widget using it, where screens.c gives
+// each widget its own local style. Widgets then only hold a reference, and
+// LVGL looks at one style per set instead of a local style per widget.
+
+#ifndef UI_TABLE_H
+#define UI_TABLE_H
+
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Widgets nested deeper than this don't fit the interpreter's parent stack
+#define UI_TABLE_MAX_DEPTH 8
+
+typedef enum {
+    UI_TABLE_OP_SCREEN = 1,   // screen = lv_obj_create(NULL)
+    UI_TABLE_OP_CHILD,        // u8 widget type, created in the current parent
+    UI_TABLE_OP_OBJECT,       // u8 objects.* field index
+    UI_TABLE_OP_POS,          // u16 x, u16 y number indices
+    UI_TABLE_OP_SIZE,         // u16 w, u16 h number indices
+    UI_TABLE_OP_STYLE,        // u16 style set index
+    UI_TABLE_OP_TEXT,         // u16 string index
+    UI_TABLE_OP_LONG_MODE,    // u16 number index
+    UI_TABLE_OP_EVENT,        // u8 action, u16 event code and u16 user data number indices
+    UI_TABLE_OP_MAP,          // u8 button matrix map index
+    UI_TABLE_OP_PUSH,         // the widget becomes the parent of the next ones
+    UI_TABLE_OP_POP,          // the parent is the current widget again
+    UI_TABLE_OP_END,          // u8 tick_screen() index
+} ui_table_op_t;
+
+typedef enum {
+    UI_TABLE_OBJ,
+    UI_TABLE_LABEL,
+    UI_TABLE_BUTTON,
+    UI_TABLE_BUTTONMATRIX,
+    UI_TABLE_IMAGE,
+} ui_table_widget_t;
+
+// A style set is a u8 selector index and a u8 count of entries: u8 property,
+// u8 value kind, then the value; a number index (u16), RGB bytes or a font
+// index (u8)
+typedef enum {
+    UI_TABLE_VALUE_NUM,
+    UI_TABLE_VALUE_COLOR,
+    UI_TABLE_VALUE_FONT,
+} ui_table_value_t;
+
+typedef struct {
+    const uint8_t *ops;
+    const uint8_t *styles;
+    const uint16_t *style_sets;  // styles offset per set
+    lv_style_t *shared_styles;   // one per set, zeroed until first use
+    uint16_t style_count;
+    const int32_t *nums;
+    const lv_style_prop_t *props;
+    const lv_style_selector_t *selectors;
+    const char *const *strings;
+    const lv_font_t *const *fonts;
+    const lv_event_cb_t *actions;
+    const char *const *const *maps;
+    const uint16_t *screens;  // ops offset per screen, in tick_screen() order
+    uint8_t screen_count;
+} ui_table_t;
+
+typedef struct {
+    uint16_t styles;       // shared styles built
+    uint16_t props;        // properties in them
+    uint32_t refs;         // lv_obj_add_style() calls with them
+    uint32_t local_props;  // properties set as local styles instead
+} ui_table_style_stats_t;
+
+// src/ui_table_data.c
+extern const ui_table_t ui_table;
+
+// false sets style sets as local styles like screens.c does, for comparison;
+// affects the screens built afterwards
+void ui_table_set_shared_styles(bool shared);
+
+void ui_table_get_style_stats(ui_table_style_stats_t *stats);
+
+// Builds screen index (ScreensEnum value - 1) and returns it
+lv_obj_t *ui_table_create_screen(const ui_table_t *table, int index);
+
+// ui_init() with the screens built from the table
+void ui_table_init(const ui_table_t *table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
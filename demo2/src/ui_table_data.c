@@ -0,0 +1,86 @@
+/* Generated by tools/ui_table.py from src/ui/screens.c, do not edit. */
+
+#include "ui_table.h"
+#include "ui/actions.h"
+#include "ui/fonts.h"
+
+/* Screens: 3, ops: 447 bytes, style sets: 7 in 67 bytes */
+static const uint8_t ops[] = {
+    0x01,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x05,0x01,0x00,0x02,0x00,0x06,0x00,0x00,0x0b,0x02,0x01,0x03,0x03,0x04,0x04,0x00,
+    0x05,0x00,0x05,0x06,0x00,0x06,0x00,0x06,0x01,0x00,0x07,0x00,0x00,0x02,0x03,0x03,0x04,0x04,0x07,0x00,0x08,0x00,0x05,0x09,
+    0x00,0x0a,0x00,0x0a,0x00,0x06,0x02,0x00,0x0b,0x02,0x02,0x03,0x05,0x04,0x0b,0x00,0x00,0x00,0x05,0x0c,0x00,0x0d,0x00,0x09,
+    0x00,0x0e,0x00,0x00,0x00,0x06,0x03,0x00,0x0b,0x02,0x01,0x04,0x00,0x00,0x00,0x00,0x05,0x06,0x00,0x06,0x00,0x06,0x04,0x00,
+    0x07,0x01,0x00,0x0c,0x02,0x02,0x03,0x06,0x04,0x0b,0x00,0x10,0x00,0x05,0x0c,0x00,0x0d,0x00,0x09,0x01,0x0e,0x00,0x00,0x00,
+    0x06,0x03,0x00,0x0b,0x02,0x01,0x04,0x00,0x00,0x00,0x00,0x05,0x06,0x00,0x06,0x00,0x06,0x04,0x00,0x07,0x02,0x00,0x0c,0x0c,
+    0x0c,0x0d,0x00,0x01,0x03,0x01,0x04,0x00,0x00,0x00,0x00,0x05,0x01,0x00,0x02,0x00,0x06,0x05,0x00,0x0b,0x02,0x01,0x03,0x07,
+    0x04,0x11,0x00,0x12,0x00,0x05,0x06,0x00,0x06,0x00,0x06,0x01,0x00,0x07,0x01,0x00,0x02,0x03,0x03,0x08,0x04,0x07,0x00,0x08,
+    0x00,0x05,0x09,0x00,0x0a,0x00,0x0a,0x00,0x06,0x02,0x00,0x0b,0x02,0x02,0x03,0x09,0x04,0x0b,0x00,0x00,0x00,0x05,0x0c,0x00,
+    0x0d,0x00,0x09,0x02,0x0e,0x00,0x00,0x00,0x06,0x03,0x00,0x0b,0x02,0x01,0x04,0x00,0x00,0x00,0x00,0x05,0x06,0x00,0x06,0x00,
+    0x09,0x02,0x0e,0x00,0x00,0x00,0x06,0x04,0x00,0x07,0x00,0x00,0x0c,0x02,0x02,0x03,0x0a,0x04,0x0b,0x00,0x10,0x00,0x05,0x0c,
+    0x00,0x0d,0x00,0x09,0x01,0x0e,0x00,0x00,0x00,0x06,0x03,0x00,0x0b,0x02,0x01,0x04,0x00,0x00,0x00,0x00,0x05,0x06,0x00,0x06,
+    0x00,0x06,0x04,0x00,0x07,0x02,0x00,0x0c,0x0c,0x0c,0x0d,0x01,0x01,0x03,0x02,0x04,0x00,0x00,0x00,0x00,0x05,0x01,0x00,0x02,
+    0x00,0x06,0x06,0x00,0x0b,0x02,0x01,0x03,0x0b,0x04,0x04,0x00,0x05,0x00,0x05,0x06,0x00,0x06,0x00,0x06,0x01,0x00,0x07,0x02,
+    0x00,0x02,0x03,0x03,0x0c,0x04,0x07,0x00,0x08,0x00,0x05,0x09,0x00,0x0a,0x00,0x0a,0x00,0x06,0x02,0x00,0x0b,0x02,0x02,0x03,
+    0x0d,0x04,0x0b,0x00,0x00,0x00,0x05,0x0c,0x00,0x0d,0x00,0x09,0x02,0x0e,0x00,0x00,0x00,0x06,0x03,0x00,0x0b,0x02,0x01,0x04,
+    0x00,0x00,0x00,0x00,0x05,0x06,0x00,0x06,0x00,0x06,0x04,0x00,0x07,0x00,0x00,0x0c,0x02,0x02,0x03,0x0e,0x04,0x0b,0x00,0x10,
+    0x00,0x05,0x0c,0x00,0x0d,0x00,0x09,0x00,0x0e,0x00,0x00,0x00,0x06,0x03,0x00,0x0b,0x02,0x01,0x04,0x00,0x00,0x00,0x00,0x05,
+    0x06,0x00,0x06,0x00,0x06,0x04,0x00,0x07,0x01,0x00,0x0c,0x0c,0x0c,0x0d,0x02,
+};
+
+static const uint8_t styles[] = {
+    0x00,0x02,0x00,0x01,0x1b,0xaa,0x1b,0x01,0x00,0x03,0x00,0x00,0x02,0x02,0x01,0xff,0xff,0xff,0x03,0x02,0x00,0x00,0x03,0x02,
+    0x01,0x21,0x21,0x21,0x04,0x00,0x00,0x00,0x01,0x00,0x03,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x01,0x05,0x00,0x0f,
+    0x00,0x00,0x02,0x00,0x01,0x92,0x0c,0x0c,0x01,0x00,0x03,0x00,0x00,0x01,0x00,0x01,0x13,0x83,0xb6,
+};
+
+static const uint16_t style_sets[] = {
+    0, 11, 21, 36, 43, 49, 60,
+};
+
+/* Built on first use, see ui_table.cpp */
+static lv_style_t shared_styles[7];
+
+static const int32_t nums[] = {
+    0, 320, 240, LV_BORDER_SIDE_NONE, 10, 14,
+    LV_SIZE_CONTENT, 141, 94, 179, 146, 25,
+    100, 50, LV_EVENT_PRESSED, LV_ALIGN_CENTER, 65, 12,
+    11,
+};
+
+static const lv_style_prop_t props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_BORDER_SIDE, LV_STYLE_TEXT_COLOR, LV_STYLE_TEXT_FONT, LV_STYLE_BG_OPA, LV_STYLE_ALIGN,
+};
+
+static const lv_style_selector_t selectors[] = {
+    LV_PART_MAIN | LV_STATE_DEFAULT,
+};
+
+static const char *const strings[] = {
+    "Main", "Screen 1", "Screen 2",
+};
+
+static const lv_font_t *const fonts[] = {
+    &lv_font_montserrat_20,
+};
+
+static const lv_event_cb_t actions[] = {
+    action_navigate_screen_1, action_navigate_screen_2,
+    action_navigate_main,
+};
+
+static const char *const map_0[] = {
+    NULL,
+};
+
+static const char *const *const maps[] = {
+    map_0,
+};
+
+static const uint16_t screens[] = {
+    0, 147, 300,
+};
+
+const ui_table_t ui_table = {
+    ops, styles, style_sets, shared_styles, 7,
+    nums, props, selectors, strings, fonts, actions, maps, screens, 3,
+};
@@ -0,0 +1,396 @@
+"""Compiles the EEZ-generated screens into a table for src/ui_table.cpp.
+
+EEZ Studio turns the .eez-project into src/ui/screens.c, one long run of
+lv_*() calls per screen. This script reads those calls back and writes
+src/ui_table_data.c: a byte stream of widget ops (create, geometry, style
+set, text, event, children) per screen, plus small tables for everything
+symbolic (numbers and enum constants, style properties, selectors, fonts,
+actions, strings, button matrix maps) so that C still evaluates them. The
+local style properties a widget gets per selector become one style set;
+identical sets are stored once, and ui_table.cpp turns each into a shared
+lv_style_t. ui_table.cpp builds a screen by walking its ops.
+
+screens.c rather than the .eez-project is read because it is exactly what
+EEZ generated for this LVGL version, codegen rules included (container
+defaults, objects.* assignment). A call the table has no op for stops the
+build with its line number; DEMO_UI_TABLE=0 builds with screens.c again.
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and
+rewrites the output only when screens.c is newer. Standalone:
+
+    python3 tools/ui_table.py [--force]
+
+prints the table size per screen and checks the encoding round trip.
+"""
+
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821, PlatformIO pre-build hook; SCons leaves __file__ unset
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    env = None
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SCREENS_C = os.path.join(PROJECT_DIR, "src", "ui", "screens.c")
+SCREENS_H = os.path.join(PROJECT_DIR, "src", "ui", "screens.h")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "ui_table_data.c")
+SCRIPT = os.path.join(PROJECT_DIR, "tools", "ui_table.py")
+
+# Ops, as in src/ui_table.h
+OP_SCREEN, OP_CHILD, OP_OBJECT, OP_POS, OP_SIZE, OP_STYLE, OP_TEXT, OP_LONG_MODE, OP_EVENT, OP_MAP, \
+    OP_PUSH, OP_POP, OP_END = range(1, 14)
+
+# Widget classes ui_table.cpp can create, in its order
+WIDGETS = ["obj", "label", "button", "buttonmatrix", "image"]
+
+# UI_TABLE_MAX_DEPTH in src/ui_table.h
+MAX_DEPTH = 8
+
+# Style value kinds
+VALUE_NUM, VALUE_COLOR, VALUE_FONT = range(3)
+
+
+class Table:
+    def __init__(self):
+        self.nums = []
+        self.props = []
+        self.selectors = []
+        self.strings = []
+        self.fonts = []
+        self.actions = []
+        self.maps = []
+
+    @staticmethod
+    def index(items, item, limit, what):
+        if item not in items:
+            items.append(item)
+            if len(items) > limit:
+                sys.exit("ui_table: more than %d %s" % (limit, what))
+        return items.index(item)
+
+    def num(self, expr):
+        return self.index(self.nums, expr.strip(), 0xFFFF, "numbers")
+
+
+def split_args(text):
+    """Splits a C argument list at the top-level commas."""
+    args, depth, current = [], 0, ""
+    for c in text:
+        if c == "(" or c == "{":
+            depth += 1
+        elif c == ")" or c == "}":
+            depth -= 1
+        if c == "," and depth == 0:
+            args.append(current.strip())
+            current = ""
+        else:
+            current += c
+    args.append(current.strip())
+    return args
+
+
+def object_fields():
+    text = open(SCREENS_H).read()
+    body = re.search(r"typedef struct _objects_t \{(.*?)\} objects_t;", text, re.S).group(1)
+    return re.findall(r"lv_obj_t \*(\w+);", body)
+
+
+def parse_screens(table):
+    """Returns [(name, [widget op, ...])] in tick_screen_funcs order."""
+    text = open(SCREENS_C).read()
+    fields = object_fields()
+    ticks = re.search(r"tick_screen_funcs\[\] = \{(.*?)\};", text, re.S).group(1)
+    tick_order = [t.strip() for t in ticks.split(",") if t.strip()]
+
+    screens = []
+    for m in re.finditer(r"^void create_screen_(\w+)\(\) \{\n(.*?)^\}\n", text, re.S | re.M):
+        name, body = m.group(1), m.group(2)
+        first_line = text[:m.start(2)].count("\n") + 1
+        screens.append((name, parse_body(table, body, first_line, fields, tick_order)))
+    screens.sort(key=lambda s: tick_order.index("tick_screen_" + s[0]))
+    return screens
+
+
+def parse_body(table, body, first_line, fields, tick_order):
+    """One screen's ops as tuples; a widget's style calls become one set per selector."""
+    ops = []
+    blocks = []        # True for blocks that hold children
+    styles = None      # selector -> style list of the current widget, already in ops
+    map_entries = None
+    map_index = None
+    for n, raw in enumerate(body.split("\n"), first_line):
+        line = raw.strip()
+        if map_entries is not None:
+            if line == "};":
+                map_index = Table.index(table.maps, map_entries, 0xFF, "button maps")
+                map_entries = None
+            else:
+                map_entries.append(line.rstrip(","))
+            continue
+        if not line or line.startswith("//"):
+            continue
+        if line == "{":
+            blocks.append(False)
+            continue
+        if line == "}":
+            if blocks.pop():
+                ops.append((OP_POP,))
+                styles = None
+            continue
+
+        m = re.match(r"lv_obj_t \*obj = lv_(\w+)_create\((\w+)\);$", line)
+        if m:
+            if m.group(2) == "0":
+                ops.append((OP_SCREEN,))
+            elif m.group(1) in WIDGETS and m.group(2) == "parent_obj":
+                ops.append((OP_CHILD, WIDGETS.index(m.group(1))))
+            else:
+                sys.exit("%s:%d: ui_table can't create lv_%s" % (SCREENS_C, n, m.group(1)))
+            styles = None
+            continue
+        if line == "lv_obj_t *parent_obj = obj;":
+            if blocks.count(True) == MAX_DEPTH:
+                sys.exit("%s:%d: ui_table nests at most %d widgets deep" % (SCREENS_C, n, MAX_DEPTH))
+            blocks[-1] = True
+            ops.append((OP_PUSH,))
+            styles = None
+            continue
+        m = re.match(r"objects\.(\w+) = obj;$", line)
+        if m:
+            ops.append((OP_OBJECT, fields.index(m.group(1))))
+            continue
+        m = re.match(r"static const char \*map\[\d+\] = \{$", line)
+        if m:
+            map_entries = []
+            continue
+        m = re.match(r"(tick_screen_\w+)\(\);$", line)
+        if m:
+            ops.append((OP_END, tick_order.index(m.group(1))))
+            continue
+
+        m = re.match(r"(lv_\w+)\(obj, (.*)\);$", line)
+        if not m:
+            sys.exit("%s:%d: ui_table has no op for: %s" % (SCREENS_C, n, line))
+        call, args = m.group(1), split_args(m.group(2))
+        if call == "lv_obj_set_pos":
+            ops.append((OP_POS, table.num(args[0]), table.num(args[1])))
+        elif call == "lv_obj_set_size":
+            ops.append((OP_SIZE, table.num(args[0]), table.num(args[1])))
+        elif call == "lv_label_set_text":
+            ops.append((OP_TEXT, Table.index(table.strings, args[0], 0xFFFF, "strings")))
+        elif call == "lv_label_set_long_mode":
+            ops.append((OP_LONG_MODE, table.num(args[0])))
+        elif call == "lv_obj_add_event_cb":
+            user_data = re.match(r"\(void \*\)(\d+)$", args[2])
+            if not user_data:
+                sys.exit("%s:%d: ui_table takes (void *)N user data only" % (SCREENS_C, n))
+            ops.append((OP_EVENT, Table.index(table.actions, args[0], 0xFF, "actions"), table.num(args[1]),
+                        table.num(user_data.group(1))))
+        elif call == "lv_buttonmatrix_set_map" and args == ["map"]:
+            ops.append((OP_MAP, map_index))
+        elif call.startswith("lv_obj_set_style_"):
+            selector = Table.index(table.selectors, args[1], 0xFF, "selectors")
+            if styles is None:
+                styles = {}
+            if selector not in styles:
+                styles[selector] = []
+                ops.append((OP_STYLE, selector, styles[selector]))
+            styles[selector].append(style_entry(table, call[len("lv_obj_set_style_"):], args, n))
+        else:
+            sys.exit("%s:%d: ui_table has no op for %s" % (SCREENS_C, n, call))
+    return ops
+
+
+def style_entry(table, prop, args, line):
+    prop_index = Table.index(table.props, "LV_STYLE_" + prop.upper(), 0xFF, "style properties")
+    color = re.match(r"lv_color_hex\(0x([0-9a-fA-F]+)\)$", args[0])
+    if color:
+        return (prop_index, VALUE_COLOR, int(color.group(1), 16) & 0xFFFFFF)
+    if args[0].startswith("&"):
+        return (prop_index, VALUE_FONT, Table.index(table.fonts, args[0], 0xFF, "fonts"))
+    if "(" in args[0] and not re.match(r"LV_PCT\(", args[0]):
+        sys.exit("%s:%d: ui_table can't store style value %s" % (SCREENS_C, line, args[0]))
+    return (prop_index, VALUE_NUM, table.num(args[0]))
+
+
+def u16(v):
+    return [v & 0xFF, v >> 8]
+
+
+def encode_style_set(selector, entries):
+    out = [selector, len(entries)]
+    for prop, kind, value in entries:
+        out += [prop, kind]
+        if kind == VALUE_COLOR:
+            out += [(value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF]
+        elif kind == VALUE_FONT:
+            out.append(value)
+        else:
+            out += u16(value)
+    return out
+
+
+def encode(table, screens):
+    """Ops of all screens and the style sets as byte lists, the offset of each
+    set and each screen's start."""
+    ops, style_bytes, sets, set_offsets, starts = [], [], [], [], []
+    for _, screen_ops in screens:
+        starts.append(len(ops))
+        for op in screen_ops:
+            if op[0] == OP_STYLE:
+                key = (op[1], tuple(op[2]))
+                if key not in sets:
+                    sets.append(key)
+                    set_offsets.append(len(style_bytes))
+                    style_bytes += encode_style_set(op[1], op[2])
+                ops += [OP_STYLE] + u16(sets.index(key))
+            elif op[0] in (OP_POS, OP_SIZE):
+                ops += [op[0]] + u16(op[1]) + u16(op[2])
+            elif op[0] in (OP_TEXT, OP_LONG_MODE):
+                ops += [op[0]] + u16(op[1])
+            elif op[0] == OP_EVENT:
+                ops += [op[0], op[1]] + u16(op[2]) + u16(op[3])
+            else:
+                ops += list(op)
+    if len(style_bytes) > 0xFFFF:
+        sys.exit("ui_table: style sets over 64 KB")
+    return ops, style_bytes, set_offsets, starts
+
+
+def decode(ops, style_bytes, set_offsets, start):
+    """The op tuples of one screen back from the bytes, for the round trip check."""
+    def rd16(b, i):
+        return b[i] | b[i + 1] << 8
+
+    out, i = [], start
+    while True:
+        op = ops[i]
+        if op == OP_STYLE:
+            j = set_offsets[rd16(ops, i + 1)] + 1
+            selector = style_bytes[j - 1]
+            entries = []
+            for _ in range(style_bytes[j]):
+                prop, kind = style_bytes[j + 1:j + 3]
+                j += 2
+                if kind == VALUE_COLOR:
+                    value = style_bytes[j + 1] << 16 | style_bytes[j + 2] << 8 | style_bytes[j + 3]
+                    j += 3
+                elif kind == VALUE_FONT:
+                    value = style_bytes[j + 1]
+                    j += 1
+                else:
+                    value = rd16(style_bytes, j + 1)
+                    j += 2
+                entries.append((prop, kind, value))
+            out.append((OP_STYLE, selector, entries))
+            i += 3
+        elif op in (OP_POS, OP_SIZE):
+            out.append((op, rd16(ops, i + 1), rd16(ops, i + 3)))
+            i += 5
+        elif op in (OP_TEXT, OP_LONG_MODE):
+            out.append((op, rd16(ops, i + 1)))
+            i += 3
+        elif op == OP_EVENT:
+            out.append((op, ops[i + 1], rd16(ops, i + 2), rd16(ops, i + 4)))
+            i += 6
+        elif op in (OP_CHILD, OP_OBJECT, OP_MAP, OP_END):
+            out.append((op, ops[i + 1]))
+            i += 2
+            if op == OP_END:
+                return out
+        else:
+            out.append((op,))
+            i += 1
+
+
+def c_bytes(data, indent="    ", per_line=24):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ",".join("0x%02x" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def c_array(decl, items, per_line=6):
+    if not items:
+        return []
+    lines = ["static const %s[] = {" % decl]
+    for i in range(0, len(items), per_line):
+        lines.append("    " + ", ".join(items[i:i + per_line]) + ",")
+    return lines + ["};", ""]
+
+
+def emit(table, screens, ops, style_bytes, set_offsets, starts):
+    out = ["/* Generated by tools/ui_table.py from src/ui/screens.c, do not edit. */",
+           "",
+           "#include \"ui_table.h\"",
+           "#include \"ui/actions.h\"",
+           "#include \"ui/fonts.h\"",
+           "",
+           "/* Screens: %d, ops: %d bytes, style sets: %d in %d bytes */" % (
+               len(screens), len(ops), len(set_offsets), len(style_bytes)),
+           "static const uint8_t ops[] = {",
+           c_bytes(ops),
+           "};",
+           "",
+           "static const uint8_t styles[] = {",
+           c_bytes(style_bytes) if style_bytes else "    0,",
+           "};",
+           ""]
+    out += c_array("uint16_t style_sets", [str(o) for o in set_offsets], 12)
+    if set_offsets:
+        out += ["/* Built on first use, see ui_table.cpp */",
+                "static lv_style_t shared_styles[%d];" % len(set_offsets),
+                ""]
+    out += c_array("int32_t nums", table.nums)
+    out += c_array("lv_style_prop_t props", table.props)
+    out += c_array("lv_style_selector_t selectors", table.selectors, 2)
+    out += c_array("char *const strings", table.strings, 4)
+    out += c_array("lv_font_t *const fonts", table.fonts, 4)
+    out += c_array("lv_event_cb_t actions", table.actions, 2)
+    for i, entries in enumerate(table.maps):
+        out += c_array("char *const map_%d" % i, entries)
+    out += c_array("char *const *const maps", ["map_%d" % i for i in range(len(table.maps))])
+    out += c_array("uint16_t screens", [str(s) for s in starts], 12)
+
+    def ref(name, items):
+        return name if items else "NULL"
+
+    out += ["const ui_table_t ui_table = {",
+            "    ops, styles, %s, %s, %d," % (
+                ref("style_sets", set_offsets), ref("shared_styles", set_offsets), len(set_offsets)),
+            "    %s, %s, %s, %s, %s, %s, %s, screens, %d," % (
+                ref("nums", table.nums), ref("props", table.props), ref("selectors", table.selectors),
+                ref("strings", table.strings), ref("fonts", table.fonts), ref("actions", table.actions),
+                ref("maps", table.maps), len(screens)),
+            "};",
+            ""]
+    return "\n".join(out)
+
+
+def build(force=False):
+    if (not force and os.path.exists(OUTPUT)
+            and os.path.getmtime(OUTPUT) >= max(os.path.getmtime(p) for p in (SCREENS_C, SCREENS_H, SCRIPT))):
+        return
+
+    table = Table()
+    screens = parse_screens(table)
+    ops, style_bytes, set_offsets, starts = encode(table, screens)
+    for (name, screen_ops), start in zip(screens, starts):
+        expected = [(op[0], op[1], list(op[2])) if op[0] == OP_STYLE else op for op in screen_ops]
+        if decode(ops, style_bytes, set_offsets, start) != expected:
+            sys.exit("ui_table: %s does not decode to what was encoded" % name)
+        end = starts[starts.index(start) + 1] if start != starts[-1] else len(ops)
+        print("ui_table: screen %-12s %5d bytes of ops" % (name, end - start))
+
+    with open(OUTPUT, "w") as f:
+        f.write(emit(table, screens, ops, style_bytes, set_offsets, starts))
+    print("ui_table: %d screens, %d op + %d style + %d number bytes, %d shared styles"
+          % (len(screens), len(ops), len(style_bytes), 4 * len(table.nums), len(set_offsets)))
+
+
+if env is not None:
+    build()
+elif __name__ == "__main__":
+    build(force="--force" in sys.argv)
@@ -0,0 +1,286 @@
+// icon_cache's pixel conversion and slot bookkeeping test, on the host.
+//
+// Runs src/icon_store.cpp, the LVGL-free part of src/icon_cache.cpp:
+//
+//   convert  RGB565 and RGB565A8 rows, at an offset as tjpgd's blocks come,
+//            with the alpha plane after the colours at half their stride
+//            and the stride's padding left alone; L8 luma, alpha flattened
+//            onto white
+//   dither   every level of every grey at every cell of the 4x4 matrix
+//            against the thresholds worked out in floating point, and the
+//            share of each tile that is rounded up
+//   slots    least recently used eviction of idle images only, the byte
+//            limit and the slot count, refcounts, lookups by address, path
+//            and format, and the byte counters
+//
+//   g++ -std=c++11 -O2 -I../src icon_test.cpp ../src/icon_store.cpp -o icon_test
+//
+// Exits 1 on the first failure, after saying what it was.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "icon_store.h"
+
+static std::string g_test;
+static std::vector<int> g_released;
+
+static void Check(bool Ok, const char *What)
+{
+    if (!Ok) {
+        fprintf(stderr, "FAIL %s: %s\n", g_test.c_str(), What);
+        exit(1);
+    }
+}
+
+static uint16_t Rgb565(const uint8_t *Px)
+{
+    return (uint16_t)((Px[0] >> 3) << 11 | (Px[1] >> 2) << 5 | Px[2] >> 3);
+}
+
+// W x H RGBA pixels that differ in every channel
+static std::vector<uint8_t> Pattern(uint32_t W, uint32_t H, uint8_t Step)
+{
+    std::vector<uint8_t> Px(W * H * Step);
+    for (size_t I = 0; I < Px.size(); I++)
+        Px[I] = (uint8_t)(I * 37 + 11);
+    return Px;
+}
+
+static void TestRgb565A8()
+{
+    g_test = "convert RGB565A8";
+    // 3 x 2 with 2 bytes of padding per row, as a stride alignment leaves
+    const uint32_t W = 3, H = 2, Stride = 8;
+    std::vector<uint8_t> Buf(H * Stride + H * (Stride / 2), 0xAA);
+    icon_pixels_t Out = {Buf.data(), H, Stride, true};
+    std::vector<uint8_t> Px = Pattern(W, H, 4);
+
+    // Row 0 whole, as lodepng's rows come; row 1 as two blocks
+    icon_convert(&Out, ICON_RGB565, 0, 0, Px.data(), W, 4);
+    icon_convert(&Out, ICON_RGB565, 0, 1, Px.data() + W * 4, 1, 4);
+    icon_convert(&Out, ICON_RGB565, 1, 1, Px.data() + W * 4 + 4, 2, 4);
+
+    for (uint32_t Y = 0; Y < H; Y++) {
+        for (uint32_t X = 0; X < W; X++) {
+            const uint8_t *P = Px.data() + (Y * W + X) * 4;
+            uint16_t Got;
+            memcpy(&Got, Buf.data() + Y * Stride + X * 2, 2);
+            Check(Got == Rgb565(P), "colour");
+            Check(Buf[H * Stride + Y * (Stride / 2) + X] == P[3], "alpha at h * stride + y * stride / 2 + x");
+        }
+        for (uint32_t B = W * 2; B < Stride; B++)
+            Check(Buf[Y * Stride + B] == 0xAA, "colour padding written");
+        Check(Buf[H * Stride + Y * (Stride / 2) + W] == 0xAA, "alpha padding written");
+    }
+
+    g_test = "convert RGB565A8 from RGB";
+    icon_convert(&Out, ICON_RGB565, 1, 0, Px.data(), 2, 3);
+    Check(Buf[H * Stride + 1] == 0xFF && Buf[H * Stride + 2] == 0xFF, "RGB is opaque");
+    Check(Buf[H * Stride] == Px[3], "alpha left of the block written");
+
+    g_test = "convert RGB565";
+    std::vector<uint8_t> Plain(H * Stride + 16, 0xAA);
+    icon_pixels_t NoAlpha = {Plain.data(), H, Stride, false};
+    for (uint32_t Y = 0; Y < H; Y++)
+        icon_convert(&NoAlpha, ICON_RGB565, 0, Y, Px.data() + Y * W * 4, W, 4);
+    for (uint32_t B = H * Stride; B < Plain.size(); B++)
+        Check(Plain[B] == 0xAA, "written past the colours without an alpha plane");
+    uint16_t First;
+    memcpy(&First, Plain.data(), 2);
+    Check(First == Rgb565(Px.data()), "colour");
+}
+
+static void TestL8()
+{
+    g_test = "convert L8";
+    const uint32_t W = 4;
+    std::vector<uint8_t> Buf(W, 0xAA);
+    icon_pixels_t Out = {Buf.data(), 1, W, false};
+    // Transparent black, opaque red, half-transparent black, opaque white
+    const uint8_t Px[] = {0, 0, 0, 0, 255, 0, 0, 255, 0, 0, 0, 128, 255, 255, 255, 255};
+    for (int Format = ICON_L8_MONO; Format <= ICON_L8_GRAY4; Format++) {
+        uint32_t Levels = Format == ICON_L8_MONO ? 2 : 4;
+        icon_convert(&Out, (icon_format_t)Format, 0, 0, Px, W, 4);
+        Check(Buf[0] == 255, "transparent is white paper");
+        Check(Buf[1] == icon_dither(255 * 77 >> 8, 1, 0, Levels), "red by its luma");
+        Check(Buf[2] == icon_dither(127, 2, 0, Levels), "half-transparent black is half grey");
+        Check(Buf[3] == 255, "white");
+    }
+    const uint8_t Rgb[] = {255, 255, 255, 0, 0, 0};
+    icon_convert(&Out, ICON_L8_MONO, 2, 0, Rgb, 2, 3);
+    Check(Buf[2] == 255 && Buf[3] == 0, "RGB at an offset");
+}
+
+static void TestDither()
+{
+    static const uint8_t Bayer[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+    for (uint32_t Levels = 2; Levels <= 4; Levels += 2) {
+        g_test = Levels == 2 ? "dither mono" : "dither 4 greys";
+        for (uint32_t Lum = 0; Lum < 256; Lum++) {
+            uint32_t Raised = 0;
+            for (uint32_t Y = 0; Y < 4; Y++) {
+                for (uint32_t X = 0; X < 4; X++) {
+                    // Rounded up past the cell's threshold, (b + 0.5) / 16
+                    // of the way to the next level
+                    double Exact = Lum * (Levels - 1) / 255.0;
+                    uint32_t Level = (uint32_t)Exact;
+                    bool Up = Exact - Level > (Bayer[Y][X] + 0.5) / 16;
+                    uint32_t Want = (Level + Up) * 255 / (Levels - 1);
+                    uint8_t Got = icon_dither(Lum, X, Y, Levels);
+                    Check(Got == Want, "level");
+                    Check(Got == icon_dither(Lum, X + 4, Y + 8, Levels), "matrix does not repeat every 4 pixels");
+                    Raised += Up;
+                }
+            }
+            // The tile averages out to the grey
+            double Frac = Lum * (Levels - 1) / 255.0;
+            Frac -= (uint32_t)Frac;
+            Check(Raised >= Frac * 16 - 0.5 && Raised <= Frac * 16 + 0.5, "share of the tile rounded up");
+        }
+        Check(icon_dither(0, 1, 2, Levels) == 0 && icon_dither(255, 3, 3, Levels) == 255, "black and white");
+    }
+    g_test = "dither mono";
+    uint32_t White = 0;
+    for (uint32_t I = 0; I < 16; I++)
+        White += icon_dither(128, I & 3, I >> 2, 2) == 255;
+    Check(White == 8, "mid grey is half white");
+    g_test = "dither 4 greys";
+    for (uint32_t I = 0; I < 16; I++)
+        Check(icon_dither(85, I & 3, I >> 2, 4) == 85 && icon_dither(170, I & 3, I >> 2, 4) == 170,
+              "a grey of the panel stays as it is");
+}
+
+// Decoded images are just numbers here, from 1
+static void Release(void *Decoded)
+{
+    g_released.push_back((int)(intptr_t)Decoded);
+}
+
+static void *Image(int N)
+{
+    return (void *)(intptr_t)N;
+}
+
+static const int g_srcs[ICON_STORE_SLOTS + 2] = {0};
+
+static icon_slot_t *Add(icon_store_t *Store, int N, uint32_t Size)
+{
+    return icon_store_add(Store, &g_srcs[N], NULL, ICON_RGB565, Image(N), Size);
+}
+
+// Added, opened and closed, as a draw leaves it
+static icon_slot_t *Drawn(icon_store_t *Store, int N, uint32_t Size)
+{
+    icon_slot_t *Slot = Add(Store, N, Size);
+    Check(Slot != NULL, "no room");
+    icon_store_use(Store, Slot);
+    icon_store_done(Slot);
+    return Slot;
+}
+
+static void TestEviction()
+{
+    icon_store_t Store;
+
+    g_test = "evict least recently used";
+    g_released.clear();
+    icon_store_init(&Store, 100, Release);
+    Drawn(&Store, 1, 40);
+    icon_slot_t *Two = Drawn(&Store, 2, 40);
+    Check(Store.cached_bytes == 80 && Store.peak_bytes == 80, "cached bytes");
+    icon_slot_t *One = icon_store_find(&Store, &g_srcs[1], NULL, ICON_RGB565);
+    Check(One != NULL, "find by address");
+    icon_store_use(&Store, One);  // now 2 is the older
+    icon_store_done(One);
+    icon_slot_t *Three = Drawn(&Store, 3, 40);
+    Check(g_released.size() == 1 && g_released[0] == 2, "2 released");
+    Check(Store.evictions == 1 && Store.cached_bytes == 80 && Store.peak_bytes == 80, "counters after one");
+    Check(!icon_store_find(&Store, &g_srcs[2], NULL, ICON_RGB565), "2 still found");
+    Check(Three == Two, "slot of 2 not reused");
+
+    g_test = "keep images in use";
+    Check(icon_store_find(&Store, &g_srcs[3], NULL, ICON_RGB565) == Three, "find 3");
+    icon_store_use(&Store, One);
+    icon_store_use(&Store, Three);
+    icon_store_use(&Store, Three);
+    Check(Three->refs == 2, "refs");
+    Check(!Add(&Store, 4, 40), "room made while every image is in use");
+    Check(g_released.size() == 1, "an image in use released");
+    Check(Store.cached_bytes == 80 && Store.evictions == 1, "counters changed without room");
+    icon_store_done(Three);
+    Check(!Add(&Store, 4, 40), "room made from an image with an open left");
+    icon_store_done(Three);
+    Check(Three->refs == 0, "refs after closes");
+    Check(Add(&Store, 4, 40) != NULL, "no room once 3 is closed");
+    Check(g_released.size() == 2 && g_released[1] == 3, "3 released");
+    Check(icon_store_find(&Store, &g_srcs[1], NULL, ICON_RGB565) == One, "1 in use evicted");
+    icon_store_done(One);
+
+    g_test = "evict as many as needed, oldest first";
+    g_released.clear();
+    icon_store_init(&Store, 100, Release);
+    for (int N = 1; N <= 4; N++)
+        Drawn(&Store, N, 25);
+    Check(Store.cached_bytes == 100, "cached bytes");
+    Drawn(&Store, 5, 60);
+    Check(g_released.size() == 3 && g_released[0] == 1 && g_released[1] == 2 && g_released[2] == 3,
+          "released 1, 2, 3");
+    Check(Store.cached_bytes == 85 && Store.evictions == 3 && Store.peak_bytes == 100, "counters");
+
+    g_test = "larger than the limit";
+    g_released.clear();
+    Check(!Add(&Store, 6, 101), "kept");
+    Check(g_released.empty() && Store.cached_bytes == 85, "evicted for an image that cannot fit");
+
+    g_test = "slots run out before bytes";
+    g_released.clear();
+    icon_store_init(&Store, 1000000, Release);
+    for (int N = 1; N <= ICON_STORE_SLOTS; N++)
+        Drawn(&Store, N, 10);
+    Drawn(&Store, ICON_STORE_SLOTS + 1, 10);
+    Check(g_released.size() == 1 && g_released[0] == 1, "oldest not released for a slot");
+    for (int I = 0; I < ICON_STORE_SLOTS; I++)
+        icon_store_use(&Store, &Store.slots[I]);
+    Check(!icon_store_add(&Store, NULL, "/x.png", ICON_RGB565, Image(99), 10), "slot taken from an image in use");
+    Check(Store.cached_bytes == 10 * ICON_STORE_SLOTS, "cached bytes");
+}
+
+static void TestLookup()
+{
+    icon_store_t Store;
+    g_test = "lookup";
+    g_released.clear();
+    icon_store_init(&Store, 1000, Release);
+    Check(Add(&Store, 1, 10) != NULL, "add by address");
+    Check(icon_store_add(&Store, NULL, "S:/icons/rain.png", ICON_RGB565, Image(2), 10) != NULL, "add by path");
+    Check(icon_store_add(&Store, NULL, "S:/icons/rain.png", ICON_L8_MONO, Image(3), 10) != NULL, "add other format");
+
+    icon_slot_t *Path = icon_store_find(&Store, NULL, "S:/icons/rain.png", ICON_RGB565);
+    Check(Path && Path->decoded == Image(2), "find by path");
+    Path = icon_store_find(&Store, NULL, "S:/icons/rain.png", ICON_L8_MONO);
+    Check(Path && Path->decoded == Image(3), "find by path and format");
+    Check(!icon_store_find(&Store, NULL, "S:/icons/snow.png", ICON_RGB565), "other path found");
+    Check(!icon_store_find(&Store, &g_srcs[1], NULL, ICON_L8_GRAY4), "other format found");
+    Check(!icon_store_find(&Store, &g_srcs[2], NULL, ICON_RGB565), "other address found");
+
+    std::string Long(ICON_STORE_PATH_LEN, 'a');
+    Check(!icon_store_add(&Store, NULL, Long.c_str(), ICON_RGB565, Image(4), 10), "path too long kept");
+    Long.resize(ICON_STORE_PATH_LEN - 1);
+    Check(icon_store_add(&Store, NULL, Long.c_str(), ICON_RGB565, Image(4), 10) != NULL, "longest path not kept");
+    Check(Store.cached_bytes == 40 && g_released.empty(), "counters");
+}
+
+int main()
+{
+    TestRgb565A8();
+    TestL8();
+    TestDither();
+    TestEviction();
+    TestLookup();
+    printf("ok   convert, dither, slots\n");
+    return 0;
+}
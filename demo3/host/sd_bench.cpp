@@ -0,0 +1,212 @@
+// Cold and warm open and draw latency of images on the SD card, on the host.
+//
+// Runs src/sd_cache.cpp on its POSIX backend against a directory laid out
+// like the card (tools/sd_images.py) and replays what LVGL does with a
+// file image on every draw, as the firmware has LV_CACHE_DEF_SIZE 0:
+//
+//   open   lv_image_decoder_get_info() opens the file and reads the header,
+//          then lv_image_decoder_open() opens it again
+//   draw   the image's rows are read into strips and copied into the 40-line
+//          draw buffer, byte-swapped as for the RGB565_SWAPPED display
+//
+// Rows are read one per read (LVGL's bin decoder) or SD_IMAGE_STRIP_ROWS at
+// a time (src/sd_image.cpp), with no read-ahead (one sector-sized window)
+// or with the firmware's windows. Cold empties the windows and asks the
+// kernel to drop the file's pages before every round; warm keeps them.
+//
+// The host's disk says little about a card on a 20 MHz SPI bus, so next
+// to the measured times the card reads are also costed at a fixed time per
+// command plus the bus rate (--cmd-us, --mbps). Opening a file on FAT also
+// reads directory sectors, which are not counted.
+//
+//   g++ -std=c++11 -O2 -I../src sd_bench.cpp ../src/sd_cache.cpp -o sd_bench
+//   build/sd_bench [--cmd-us 400] [--mbps 2.5] [card dir, default ../sdcard] [image ...]
+//
+// The default images are the flattened partly cloudy image (20 KB, fits
+// the windows) and bench.bin (150 KB, full screen, does not).
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+#include "sd_cache.h"
+
+// src/sd_image.h and src/sd_fs.h, which need LVGL and Arduino
+#define SD_IMAGE_STRIP_ROWS 8
+#define SD_FS_WINDOWS 4
+#define SD_FS_WINDOW_SIZE 8192
+
+#define HEADER_SIZE 12      // lv_image_header_t
+#define DRAW_BUF_LINES 40   // main.cpp's buf1 / buf2
+#define ROUNDS 20
+
+struct Header {
+    uint16_t W;
+    uint16_t H;
+    uint16_t Stride;
+};
+
+struct Config {
+    const char *Name;
+    uint32_t StripRows;
+    uint32_t Windows;
+    uint32_t WindowSize;
+};
+
+static std::string g_dir;
+static std::string g_image;
+
+static double Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// The kernel's pages of the image, so a cold round reads the disk as well
+static void DropPages()
+{
+    int fd = open((g_dir + g_image).c_str(), O_RDONLY);
+    if (fd >= 0) {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+}
+
+static bool ReadHeader(sd_file_t *File, Header *Out)
+{
+    uint8_t h[HEADER_SIZE];
+    if (sd_read(File, h, sizeof(h)) != (int32_t)sizeof(h) || h[0] != 0x19)
+        return false;
+    Out->W = h[4] | h[5] << 8;
+    Out->H = h[6] | h[7] << 8;
+    Out->Stride = h[8] | h[9] << 8;
+    return true;
+}
+
+// get_info, then open: the file stays open for the draw
+static sd_file_t *Open(Header *Out)
+{
+    sd_file_t *file = sd_open(g_image.c_str());
+    if (!file)
+        return NULL;
+    bool ok = ReadHeader(file, Out);
+    sd_close(file);
+    return ok ? sd_open(g_image.c_str()) : NULL;
+}
+
+static bool Draw(sd_file_t *File, const Header &H, uint32_t StripRows, std::vector<uint8_t> &Strip,
+                 std::vector<uint8_t> &DrawBuf)
+{
+    uint32_t rowBytes = H.W * 2;
+    for (uint32_t y = 0; y < H.H; y += StripRows) {
+        uint32_t rows = y + StripRows > H.H ? H.H - y : StripRows;
+        if (!sd_seek(File, HEADER_SIZE + y * H.Stride))
+            return false;
+        uint32_t bytes = rows * H.Stride;
+        if (sd_read(File, Strip.data(), bytes) != (int32_t)bytes)
+            return false;
+        for (uint32_t r = 0; r < rows; r++) {
+            const uint8_t *src = Strip.data() + r * H.Stride;
+            uint8_t *dst = DrawBuf.data() + ((y + r) % DRAW_BUF_LINES) * rowBytes;
+            for (uint32_t i = 0; i < rowBytes; i += 2) {
+                dst[i] = src[i + 1];
+                dst[i + 1] = src[i];
+            }
+        }
+    }
+    return true;
+}
+
+static void Run(const Config &C, bool Cold, double CmdUs, double Mbps)
+{
+    if (!sd_cache_begin(g_dir.c_str(), C.Windows, C.WindowSize)) {
+        printf("no memory for the windows\n");
+        exit(2);
+    }
+    Header h;
+    sd_file_t *file = Open(&h);
+    if (!file || h.W > 2048) {
+        printf("%s%s: not an RGB565 image from tools/sd_images.py\n", g_dir.c_str(), g_image.c_str());
+        exit(2);
+    }
+    sd_close(file);
+    std::vector<uint8_t> strip(C.StripRows * h.Stride), drawBuf(h.W * 2 * DRAW_BUF_LINES);
+
+    double openUs = 0, drawUs = 0;
+    sd_cache_clear_stats();
+    uint32_t openReads = 0;
+    for (int round = 0; round < ROUNDS; round++) {
+        if (Cold) {
+            sd_cache_drop();
+            DropPages();
+        }
+        sd_cache_stats_t s0, s1;
+        sd_cache_get_stats(&s0);
+        double t0 = Now();
+        file = Open(&h);
+        double t1 = Now();
+        sd_cache_get_stats(&s1);
+        openReads += s1.card_reads - s0.card_reads;
+        if (!file || !Draw(file, h, C.StripRows, strip, drawBuf)) {
+            printf("read failed\n");
+            exit(2);
+        }
+        double t2 = Now();
+        sd_close(file);
+        openUs += t1 - t0;
+        drawUs += t2 - t1;
+    }
+
+    sd_cache_stats_t s;
+    sd_cache_get_stats(&s);
+    double reads = (double)s.card_reads / ROUNDS, bytes = (double)s.card_bytes / ROUNDS;
+    double cardUs = reads * CmdUs + bytes / Mbps;
+    printf("%-14s %-4s %8.1f %8.1f %7.1f %6.1f %9.0f %9.1f\n", C.Name, Cold ? "cold" : "warm", openUs / ROUNDS,
+           drawUs / ROUNDS, reads, (double)openReads / ROUNDS, bytes, cardUs / 1000);
+}
+
+int main(int argc, char **argv)
+{
+    double cmdUs = 400, mbps = 2.5;
+    std::vector<const char *> args;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--cmd-us") && i + 1 < argc)
+            cmdUs = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--mbps") && i + 1 < argc)
+            mbps = atof(argv[++i]);
+        else
+            args.push_back(argv[i]);
+    }
+    g_dir = args.size() > 0 ? args[0] : "../sdcard";
+    std::vector<const char *> images(args.begin() + (args.empty() ? 0 : 1), args.end());
+    if (images.empty()) {
+        images.push_back("/images/image_partly_cloudy_flat.bin");
+        images.push_back("/images/bench.bin");
+    }
+
+    const Config configs[] = {
+        { "rows", 1, 1, SD_CACHE_SECTOR },
+        { "rows+ahead", 1, SD_FS_WINDOWS, SD_FS_WINDOW_SIZE },
+        { "strips", SD_IMAGE_STRIP_ROWS, 1, SD_CACHE_SECTOR },
+        { "strips+ahead", SD_IMAGE_STRIP_ROWS, SD_FS_WINDOWS, SD_FS_WINDOW_SIZE },
+    };
+
+    printf("%d rounds; card costed at %.0f us per read + %.1f MB/s\n", ROUNDS, cmdUs, mbps);
+    for (size_t i = 0; i < images.size(); i++) {
+        g_image = images[i];
+        printf("\n%s%s\n", g_dir.c_str(), g_image.c_str());
+        printf("%-14s %-4s %8s %8s %7s %6s %9s %9s\n", "config", "", "open us", "draw us", "reads", "open", "bytes",
+               "card ms");
+        for (const Config &c : configs) {
+            Run(c, true, cmdUs, mbps);
+            Run(c, false, cmdUs, mbps);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,241 @@
+// Weather response parser test, on the host.
+//
+// Feeds each recorded response in tools/weather/ to src/weather_json.cpp
+// the way the socket hands it over, in pieces cut at arbitrary bytes:
+// split once at every offset, in pieces of a few fixed sizes and in pieces
+// of random size. Every way has to give the model a single feed of the
+// whole response gives, daily and hourly, and that model has to hold the
+// values the response has (weekdays, clock times, rounded degrees, WMO
+// codes, precipitation clamped and null as 0). A response cut short and a
+// model with fewer rows than the response are checked as well.
+//
+//   g++ -std=c++11 -O2 -I../src weather_test.cpp ../src/weather_json.cpp ../src/json_stream.cpp -o weather_test
+//   build/weather_test ../tools/weather/seattle_clear.json ../tools/weather/seattle_showers.json
+//
+// Exits 1 on the first failure, after saying which fixture, split and
+// field it was.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "weather_json.h"
+
+#define DAILY_ROWS 7
+#define HOURLY_ROWS 168
+
+struct Row {
+    uint16_t Index;
+    const char *When;
+    int16_t Temp;
+    uint8_t Precip;
+    uint8_t Icon;
+};
+
+// What a fixture holds; rows are checked by index, the others only for
+// count
+struct Expected {
+    const char *Name;
+    int16_t Temp;
+    int16_t FeelsLike;
+    const char *Time;
+    uint8_t Conditions;
+    Row Daily[3];
+    Row Hourly[3];
+};
+
+static const Expected g_expected[] = {
+    {
+        "seattle_clear.json", 49, 45, "8:15am", 1,
+        {{0, "Mon", 58, 25, 1}, {2, "Wed", 60, 48, 0}, {6, "Sun", 56, 25, 1}},
+        {{0, "08:00", 49, 0, 1}, {2, "10:00", 50, 5, 1}, {167, "07:00", 38, 0, 1}},
+    },
+    {
+        "seattle_showers.json", 57, 54, "12:15pm", 80,
+        {{0, "Mon", 65, 10, 3}, {3, "Thu", 67, 0, 81}, {5, "Sat", 62, 90, 61}},
+        {{0, "12:00", 60, 0, 3}, {2, "14:00", 64, 5, 80}, {167, "11:00", 53, 0, 61}},
+    },
+};
+
+static std::string g_fixture;
+static std::string g_split;
+
+static void Fail(const char *What)
+{
+    fprintf(stderr, "FAIL %s, %s: %s\n", g_fixture.c_str(), g_split.c_str(), What);
+    exit(1);
+}
+
+static void Check(bool Ok, const char *What)
+{
+    if (!Ok)
+        Fail(What);
+}
+
+static bool ReadFile(const char *Path, std::string *Out)
+{
+    FILE *F = fopen(Path, "rb");
+    if (!F)
+        return false;
+    char Buf[4096];
+    size_t N;
+    while ((N = fread(Buf, 1, sizeof(Buf), F)) > 0)
+        Out->append(Buf, N);
+    fclose(F);
+    return true;
+}
+
+// A weather_model_t with rows of its own
+struct Model {
+    std::vector<forecast_row_t> Rows;
+    weather_model_t M;
+
+    explicit Model(uint16_t Capacity) : Rows(Capacity)
+    {
+        memset(&M, 0, sizeof(M));
+        M.rows = Rows.data();
+        M.capacity = Capacity;
+    }
+};
+
+// The response fed in pieces of the sizes NextLen gives; parse_end's result
+template <typename Next> static bool ParsePieces(const std::string &Json, Model *Out, bool Hourly, Next NextLen)
+{
+    weather_parser_t Parser;
+    weather_parse_begin(&Parser, &Out->M, Hourly);
+    size_t Pos = 0;
+    while (Pos < Json.size()) {
+        size_t Len = NextLen(Pos);
+        if (Len > Json.size() - Pos)
+            Len = Json.size() - Pos;
+        // A copy of just the piece, so a read past it shows up under ASan
+        std::vector<char> Piece(Json.begin() + Pos, Json.begin() + Pos + Len);
+        if (!weather_parse_feed(&Parser, Piece.data(), Len))
+            return false;
+        Pos += Len;
+    }
+    return weather_parse_end(&Parser);
+}
+
+// Whole, or split once at Cut
+static bool Parse(const std::string &Json, Model *Out, bool Hourly, size_t Cut = 0)
+{
+    size_t Size = Json.size();
+    return ParsePieces(Json, Out, Hourly, [&](size_t Pos) { return Cut && Pos < Cut ? Cut - Pos : Size; });
+}
+
+static void CheckSame(const Model &A, const Model &B)
+{
+    Check(A.M.temp == B.M.temp, "temp differs from a whole parse");
+    Check(A.M.feels_like == B.M.feels_like, "feels_like differs from a whole parse");
+    Check(!strcmp(A.M.time, B.M.time), "time differs from a whole parse");
+    Check(A.M.conditions == B.M.conditions, "conditions differ from a whole parse");
+    Check(A.M.count == B.M.count, "count differs from a whole parse");
+    for (uint16_t I = 0; I < A.M.count; I++) {
+        const forecast_row_t &Ra = A.Rows[I], &Rb = B.Rows[I];
+        Check(!strcmp(Ra.when, Rb.when) && Ra.temp == Rb.temp && Ra.precip == Rb.precip && Ra.icon == Rb.icon,
+              "a row differs from a whole parse");
+    }
+}
+
+static void CheckExpected(const Model &Got, const Expected &E, bool Hourly)
+{
+    Check(Got.M.temp == E.Temp, "temp");
+    Check(Got.M.feels_like == E.FeelsLike, "feels_like");
+    Check(!strcmp(Got.M.time, E.Time), "time");
+    Check(Got.M.conditions == E.Conditions, "conditions");
+    Check(Got.M.count == (Hourly ? HOURLY_ROWS : DAILY_ROWS), "count");
+    const Row *Rows = Hourly ? E.Hourly : E.Daily;
+    for (int I = 0; I < 3; I++) {
+        const Row &R = Rows[I];
+        const forecast_row_t &G = Got.Rows[R.Index];
+        Check(!strcmp(G.when, R.When), "row when");
+        Check(G.temp == R.Temp, "row temp");
+        Check(G.precip == R.Precip, "row precip");
+        Check(G.icon == R.Icon, "row icon");
+    }
+}
+
+static void Run(const std::string &Json, const Expected &E, bool Hourly)
+{
+    uint16_t Capacity = Hourly ? HOURLY_ROWS : DAILY_ROWS;
+    const char *Kind = Hourly ? "hourly" : "daily";
+    char Name[64];
+
+    g_split = std::string(Kind) + " whole";
+    Model Whole(Capacity);
+    Check(Parse(Json, &Whole, Hourly), "parse failed");
+    CheckExpected(Whole, E, Hourly);
+
+    for (size_t Cut = 1; Cut < Json.size(); Cut++) {
+        snprintf(Name, sizeof(Name), "%s split at %zu", Kind, Cut);
+        g_split = Name;
+        Model Split(Capacity);
+        Check(Parse(Json, &Split, Hourly, Cut), "parse failed");
+        CheckSame(Split, Whole);
+    }
+
+    static const size_t Sizes[] = {1, 2, 3, 7, 64, 1460};  // 1460: a TCP segment
+    for (size_t Size : Sizes) {
+        snprintf(Name, sizeof(Name), "%s in pieces of %zu", Kind, Size);
+        g_split = Name;
+        Model Pieces(Capacity);
+        Check(ParsePieces(Json, &Pieces, Hourly, [&](size_t) { return Size; }), "parse failed");
+        CheckSame(Pieces, Whole);
+    }
+
+    for (unsigned Seed = 1; Seed <= 100; Seed++) {
+        snprintf(Name, sizeof(Name), "%s in random pieces, seed %u", Kind, Seed);
+        g_split = Name;
+        srand(Seed);
+        Model Random(Capacity);
+        Check(ParsePieces(Json, &Random, Hourly, [&](size_t) { return (size_t)(rand() % 200 + 1); }), "parse failed");
+        CheckSame(Random, Whole);
+    }
+
+    // Fewer rows than the response has: the first ones, the rest skipped
+    g_split = std::string(Kind) + " into 5 rows";
+    Model Short(5);
+    Check(Parse(Json, &Short, Hourly), "parse failed");
+    Check(Short.M.count == 5, "count of a short model");
+    Whole.M.count = 5;
+    CheckSame(Short, Whole);
+
+    // A response cut short is never complete, however it ends
+    for (size_t Len = 0; Len < Json.size(); Len += Len < 64 || Len + 64 > Json.size() ? 1 : 97) {
+        snprintf(Name, sizeof(Name), "%s cut to %zu bytes", Kind, Len);
+        g_split = Name;
+        Model Cut(Capacity);
+        Check(!Parse(Json.substr(0, Len), &Cut, Hourly), "a cut response parsed as complete");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s response.json ...\n", argv[0]);
+        return 2;
+    }
+    for (int i = 1; i < argc; i++) {
+        const char *Base = strrchr(argv[i], '/');
+        Base = Base ? Base + 1 : argv[i];
+        g_fixture = Base;
+        g_split = "reading";
+
+        const Expected *E = NULL;
+        for (const Expected &X : g_expected) {
+            if (!strcmp(X.Name, Base))
+                E = &X;
+        }
+        Check(E != NULL, "no expected values for this response");
+        std::string Json;
+        Check(ReadFile(argv[i], &Json), "cannot read it");
+
+        Run(Json, *E, false);
+        Run(Json, *E, true);
+        printf("ok   %s: %zu bytes, every split\n", Base, Json.size());
+    }
+    return 0;
+}
@@ -0,0 +1,179 @@
+// Model-to-view bindings, see bindings.h.
+
+#include "bindings.h"
+
+typedef struct {
+    bool declared;
+    bind_type_t type;
+    uint8_t decimals;
+    uint32_t version;  // store version of the last change
+    union {
+        int32_t i;
+        char s[BIND_STR_LEN];
+    } value;
+} var_t;
+
+typedef struct {
+    lv_obj_t *obj;  // NULL when the slot is free
+    uint16_t var;
+    uint32_t shown;  // variable version on screen
+    const char *fmt;
+    const lv_image_dsc_t *const *images;
+    uint8_t image_count;
+    int32_t image_shown;
+    char text[BIND_TEXT_LEN];  // label text, shown through lv_label_set_text_static
+} widget_t;
+
+static var_t vars[BIND_MAX_VARS];
+static widget_t widgets[BIND_MAX_WIDGETS];
+static uint32_t store_version = 0;
+static uint32_t ticked_version = 0;  // store_version at the end of the last bind_tick()
+
+static var_t *get_var(uint16_t id) {
+    if (id >= BIND_MAX_VARS || !vars[id].declared)
+        return NULL;
+    return &vars[id];
+}
+
+void bind_var(uint16_t id, bind_type_t type, uint8_t decimals) {
+    if (id >= BIND_MAX_VARS)
+        return;
+    var_t *var = &vars[id];
+    memset(var, 0, sizeof(*var));
+    var->declared = true;
+    var->type = type;
+    var->decimals = decimals;
+    var->version = ++store_version;
+}
+
+bool bind_set_int(uint16_t id, int32_t value) {
+    var_t *var = get_var(id);
+    if (!var || var->type == BIND_STR || var->value.i == value)
+        return false;
+    var->value.i = value;
+    var->version = ++store_version;
+    return true;
+}
+
+bool bind_set_str(uint16_t id, const char *value) {
+    var_t *var = get_var(id);
+    if (!var || var->type != BIND_STR || !strncmp(var->value.s, value, BIND_STR_LEN - 1))
+        return false;
+    strncpy(var->value.s, value, BIND_STR_LEN - 1);
+    var->value.s[BIND_STR_LEN - 1] = '\0';
+    var->version = ++store_version;
+    return true;
+}
+
+int32_t bind_get_int(uint16_t id) {
+    var_t *var = get_var(id);
+    return var && var->type != BIND_STR ? var->value.i : 0;
+}
+
+static void widget_deleted_cb(lv_event_t *e) {
+    widget_t *widget = (widget_t *)lv_event_get_user_data(e);
+    widget->obj = NULL;
+}
+
+// The slot already bound to obj, or a free one
+static widget_t *bind_widget(lv_obj_t *obj, uint16_t id) {
+    if (!get_var(id))
+        return NULL;
+    widget_t *free_slot = NULL;
+    for (int i = 0; i < BIND_MAX_WIDGETS; i++) {
+        if (widgets[i].obj == obj) {
+            free_slot = &widgets[i];
+            break;
+        }
+        if (!widgets[i].obj && !free_slot)
+            free_slot = &widgets[i];
+    }
+    if (!free_slot)
+        return NULL;
+    if (free_slot->obj != obj)
+        lv_obj_add_event_cb(obj, widget_deleted_cb, LV_EVENT_DELETE, free_slot);
+    memset(free_slot, 0, sizeof(*free_slot));
+    free_slot->obj = obj;
+    free_slot->var = id;
+    free_slot->image_shown = -1;
+    // Forces the next bind_tick() to look at it
+    ticked_version = store_version - 1;
+    return free_slot;
+}
+
+bool bind_label(lv_obj_t *label, uint16_t id, const char *fmt) {
+    widget_t *widget = bind_widget(label, id);
+    if (!widget)
+        return false;
+    widget->fmt = fmt;
+    return true;
+}
+
+bool bind_image(lv_obj_t *image, uint16_t id, const lv_image_dsc_t *const *images, uint8_t count) {
+    widget_t *widget = bind_widget(image, id);
+    if (!widget)
+        return false;
+    widget->images = images;
+    widget->image_count = count;
+    return true;
+}
+
+static void format_value(const var_t *var, char *out, size_t size) {
+    if (var->type == BIND_STR) {
+        snprintf(out, size, "%s", var->value.s);
+    } else if (var->type == BIND_FIXED && var->decimals) {
+        int32_t scale = 1;
+        for (int i = 0; i < var->decimals; i++)
+            scale *= 10;
+        uint32_t magnitude = var->value.i < 0 ? -(uint32_t)var->value.i : var->value.i;
+        snprintf(out, size, "%s%lu.%0*lu", var->value.i < 0 ? "-" : "", (unsigned long)(magnitude / scale),
+                 var->decimals, (unsigned long)(magnitude % scale));
+    } else {
+        snprintf(out, size, "%ld", (long)var->value.i);
+    }
+}
+
+// True when the widget changed on screen
+static bool update(widget_t *widget, const var_t *var) {
+    if (widget->images) {
+        int32_t index = var->value.i;
+        if (index == widget->image_shown || index < 0 || index >= widget->image_count)
+            return false;
+        lv_image_set_src(widget->obj, widget->images[index]);
+        widget->image_shown = index;
+        return true;
+    }
+
+    char value[BIND_TEXT_LEN];
+    char text[BIND_TEXT_LEN];
+    format_value(var, value, sizeof(value));
+    if (widget->fmt)
+        snprintf(text, sizeof(text), widget->fmt, value);
+    else
+        memcpy(text, value, sizeof(text));
+    // A new version can still render the same, e.g. after rounding
+    if (lv_label_get_text(widget->obj) == widget->text && !strcmp(text, widget->text))
+        return false;
+    memcpy(widget->text, text, sizeof(text));
+    lv_label_set_text_static(widget->obj, widget->text);
+    return true;
+}
+
+uint32_t bind_tick() {
+    if (ticked_version == store_version)
+        return 0;
+    uint32_t changed = 0;
+    for (int i = 0; i < BIND_MAX_WIDGETS; i++) {
+        widget_t *widget = &widgets[i];
+        if (!widget->obj)
+            continue;
+        const var_t *var = &vars[widget->var];
+        if (widget->shown == var->version)
+            continue;
+        widget->shown = var->version;
+        if (update(widget, var))
+            changed++;
+    }
+    ticked_version = store_version;
+    return changed;
+}
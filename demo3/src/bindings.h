@@ -0,0 +1,47 @@
+// Model-to-view bindings for the EEZ-generated widgets.
+//
+// Application values live in a small store of native variables: integers,
+// fixed-point numbers, short strings and image indices. Every change that
+// actually changes a value stamps it with a new store version. Widgets are
+// bound to a variable and remember the version and text they last showed;
+// bind_tick() updates only the widgets whose variable moved on, and only
+// when the new text or image differs, all in one pass before LVGL renders,
+// so LVGL joins their invalidated areas into one refresh. When nothing was
+// set since the last tick it returns after one compare.
+//
+// Variables are set and widgets updated from the thread that runs LVGL.
+
+#ifndef BINDINGS_H
+#define BINDINGS_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#define BIND_MAX_VARS 64
+#define BIND_MAX_WIDGETS 64
+#define BIND_STR_LEN 16   // string variables, terminator included
+#define BIND_TEXT_LEN 24  // label text after formatting
+
+typedef enum {
+    BIND_INT,
+    BIND_FIXED,  // integer scaled by 10^decimals, shown with the decimals
+    BIND_STR,
+    BIND_IMAGE,  // index into the image table of the bound widget
+} bind_type_t;
+
+// Declares variable id; its value starts at 0 or ""
+void bind_var(uint16_t id, bind_type_t type, uint8_t decimals = 0);
+
+// Setters return false when the value was already there
+bool bind_set_int(uint16_t id, int32_t value);  // BIND_INT, BIND_FIXED (scaled), BIND_IMAGE
+bool bind_set_str(uint16_t id, const char *value);
+int32_t bind_get_int(uint16_t id);
+
+// fmt takes the value as one %s, e.g. "%s°F"; NULL shows it as it is
+bool bind_label(lv_obj_t *label, uint16_t id, const char *fmt = NULL);
+bool bind_image(lv_obj_t *image, uint16_t id, const lv_image_dsc_t *const *images, uint8_t count);
+
+// Brings the bound widgets up to date; returns how many changed
+uint32_t bind_tick();
+
+#endif
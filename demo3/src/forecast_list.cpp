@@ -0,0 +1,165 @@
+// Virtualized forecast list, see forecast_list.h.
+
+#include "forecast_list.h"
+
+#define NO_ROW UINT32_MAX
+
+// Columns: when, icon, precipitation, temperature
+static const int16_t column_x[] = {0, 60, 100, 145};
+static const int16_t column_w[] = {60, 40, 45, 60};
+
+typedef struct {
+    uint32_t row;  // bound row, NO_ROW when it must be rebound
+    lv_obj_t *when;
+    lv_obj_t *icon;
+    lv_obj_t *precip;
+    lv_obj_t *temp;
+    char precip_text[6];  // "100%"
+    char temp_text[8];    // "-40°F"
+} slot_t;
+
+typedef struct {
+    const lv_image_dsc_t *const *icons;
+    const forecast_row_t *rows;
+    uint32_t count;
+    int32_t text_y;    // label offset inside a row
+    uint16_t visible;  // rows that fit, plus the one partly scrolled in
+    uint16_t used;     // slots with widgets; row r goes to slot r % used
+    slot_t *slots;
+} forecast_list_t;
+
+static lv_style_t cell_style;
+static bool cell_style_ready = false;
+
+static void create_slot(lv_obj_t *container, slot_t *slot) {
+    lv_obj_t **labels[] = {&slot->when, &slot->precip, &slot->temp};
+    const int columns[] = {0, 2, 3};
+    for (int i = 0; i < 3; i++) {
+        lv_obj_t *label = lv_label_create(container);
+        lv_obj_add_style(label, &cell_style, 0);
+        lv_obj_set_width(label, column_w[columns[i]]);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_CLIP);
+        *labels[i] = label;
+    }
+    slot->icon = lv_image_create(container);
+    lv_obj_set_size(slot->icon, column_w[1], FORECAST_LIST_ROW_HEIGHT);  // centred in its cell
+    slot->row = NO_ROW;
+}
+
+static void set_hidden(slot_t *slot, bool hidden) {
+    lv_obj_t *objs[] = {slot->when, slot->icon, slot->precip, slot->temp};
+    for (int i = 0; i < 4; i++) {
+        if (hidden)
+            lv_obj_add_flag(objs[i], LV_OBJ_FLAG_HIDDEN);
+        else
+            lv_obj_remove_flag(objs[i], LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+static void bind(forecast_list_t *list, slot_t *slot, uint32_t row) {
+    const forecast_row_t *r = &list->rows[row];
+    int32_t y = row * FORECAST_LIST_ROW_HEIGHT;
+
+    lv_obj_set_pos(slot->when, column_x[0], y + list->text_y);
+    lv_label_set_text_static(slot->when, r->when);
+    lv_obj_set_pos(slot->icon, column_x[1], y);
+    lv_image_set_src(slot->icon, list->icons[r->icon]);
+    lv_obj_set_pos(slot->precip, column_x[2], y + list->text_y);
+    lv_snprintf(slot->precip_text, sizeof(slot->precip_text), "%u%%", r->precip);
+    lv_label_set_text_static(slot->precip, slot->precip_text);
+    lv_obj_set_pos(slot->temp, column_x[3], y + list->text_y);
+    lv_snprintf(slot->temp_text, sizeof(slot->temp_text), "%d°F", r->temp);
+    lv_label_set_text_static(slot->temp, slot->temp_text);
+    slot->row = row;
+}
+
+// Binds the rows in view to their slots; rows already bound are left alone,
+// so scrolling by one row rebinds one slot
+static void bind_visible(lv_obj_t *container, forecast_list_t *list) {
+    if (!list->used)
+        return;
+    int32_t y = lv_obj_get_scroll_y(container);
+    uint32_t first = y > 0 ? y / FORECAST_LIST_ROW_HEIGHT : 0;  // y < 0 in elastic overscroll
+    for (uint32_t row = first; row < first + list->used && row < list->count; row++) {
+        slot_t *slot = &list->slots[row % list->used];
+        if (slot->row != row)
+            bind(list, slot, row);
+    }
+}
+
+static void list_event_cb(lv_event_t *e) {
+    lv_obj_t *container = (lv_obj_t *)lv_event_get_current_target(e);
+    forecast_list_t *list = (forecast_list_t *)lv_event_get_user_data(e);
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_SCROLL:
+        bind_visible(container, list);
+        break;
+    case LV_EVENT_GET_SELF_SIZE: {
+        // The scroll range covers every row, not just the ones with widgets
+        lv_point_t *size = (lv_point_t *)lv_event_get_param(e);
+        size->y = LV_MAX(size->y, (int32_t)(list->count * FORECAST_LIST_ROW_HEIGHT));
+        break;
+    }
+    case LV_EVENT_DELETE:
+        lv_free(list->slots);
+        lv_free(list);
+        break;
+    default:
+        break;
+    }
+}
+
+static forecast_list_t *get_list(lv_obj_t *container) {
+    return (forecast_list_t *)lv_obj_get_user_data(container);
+}
+
+void forecast_list_attach(lv_obj_t *container, const lv_image_dsc_t *const *icons) {
+    if (!cell_style_ready) {
+        lv_style_init(&cell_style);
+        lv_style_set_text_align(&cell_style, LV_TEXT_ALIGN_CENTER);
+        cell_style_ready = true;
+    }
+
+    lv_obj_set_layout(container, LV_LAYOUT_NONE);
+    lv_obj_set_scroll_dir(container, LV_DIR_VER);
+    lv_obj_update_layout(container);
+
+    forecast_list_t *list = (forecast_list_t *)lv_malloc_zeroed(sizeof(forecast_list_t));
+    list->icons = icons;
+    list->visible = lv_obj_get_content_height(container) / FORECAST_LIST_ROW_HEIGHT + 2;
+    list->slots = (slot_t *)lv_malloc_zeroed(list->visible * sizeof(slot_t));
+    const lv_font_t *font = lv_obj_get_style_text_font(container, LV_PART_MAIN);
+    list->text_y = (FORECAST_LIST_ROW_HEIGHT - lv_font_get_line_height(font)) / 2;
+
+    lv_obj_set_user_data(container, list);
+    lv_obj_add_event_cb(container, list_event_cb, LV_EVENT_SCROLL, list);
+    lv_obj_add_event_cb(container, list_event_cb, LV_EVENT_GET_SELF_SIZE, list);
+    lv_obj_add_event_cb(container, list_event_cb, LV_EVENT_DELETE, list);
+}
+
+void forecast_list_set_rows(lv_obj_t *container, const forecast_row_t *rows, uint32_t count) {
+    forecast_list_t *list = get_list(container);
+    list->rows = rows;
+    list->count = count;
+
+    // Widgets only for as many rows as can be seen; extra ones from a longer
+    // earlier list are hidden, not deleted
+    uint16_t wanted = count < list->visible ? count : list->visible;
+    while (list->used < wanted)
+        create_slot(container, &list->slots[list->used++]);
+    for (uint16_t i = 0; i < list->used; i++) {
+        list->slots[i].row = NO_ROW;
+        set_hidden(&list->slots[i], i >= count);
+    }
+
+    lv_obj_refresh_self_size(container);
+    lv_obj_readjust_scroll(container, LV_ANIM_OFF);
+    bind_visible(container, list);
+}
+
+void forecast_list_refresh(lv_obj_t *container) {
+    forecast_list_t *list = get_list(container);
+    for (uint16_t i = 0; i < list->used; i++)
+        list->slots[i].row = NO_ROW;
+    bind_visible(container, list);
+}
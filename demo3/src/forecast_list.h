@@ -0,0 +1,29 @@
+// Virtualized forecast list.
+//
+// Turns a container into a scrollable list of forecast rows that only has
+// widgets for the rows that can be seen: one label/image/label/label set
+// per visible row plus one spare. Scrolling moves those widgets to the rows
+// that came into view and rebinds them from the caller's row array, so the
+// object count stays the same for 7 rows or 168. The labels show text from
+// buffers of their own (lv_label_set_text_static) and share one style.
+
+#ifndef FORECAST_LIST_H
+#define FORECAST_LIST_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "forecast_row.h"
+
+#define FORECAST_LIST_ROW_HEIGHT 20
+
+// Lays the list out in container, which keeps its size and styles; icons
+// is indexed by forecast_row_t.icon and must outlive the list
+void forecast_list_attach(lv_obj_t *container, const lv_image_dsc_t *const *icons);
+
+// rows is not copied and must stay valid until the next call
+void forecast_list_set_rows(lv_obj_t *container, const forecast_row_t *rows, uint32_t count);
+
+// Rebinds the visible rows after the caller changed the row array
+void forecast_list_refresh(lv_obj_t *container);
+
+#endif
@@ -0,0 +1,18 @@
+// One row of the forecast list, as the weather model fills it in.
+//
+// Kept apart from forecast_list.h, which needs LVGL, so that weather_json
+// also builds on the host (host/weather_test.cpp).
+
+#ifndef FORECAST_ROW_H
+#define FORECAST_ROW_H
+
+#include <stdint.h>
+
+typedef struct {
+    char when[6];    // "Day 3", "14:00"
+    int16_t temp;    // °F
+    uint8_t precip;  // percent
+    uint8_t icon;    // index into the list's icon table
+} forecast_row_t;
+
+#endif
@@ -0,0 +1,357 @@
+// PNG and JPEG decoder and cache, see icon_cache.h.
+
+#include <lvgl_private.h>  // lv_image_decoder_dsc_t and lv_draw_buf_t fields
+#include <src/libs/tjpgd/tjpgd.h>
+#include "icon_cache.h"
+
+#if !LV_USE_LODEPNG || !LV_USE_TJPGD
+#error "icon_cache.cpp decodes with LVGL's lodepng and tjpgd: set LV_USE_LODEPNG and LV_USE_TJPGD in lv_conf.h"
+#endif
+#if JD_FORMAT != 0
+#error "icon_cache.cpp takes RGB888 from tjpgd"
+#endif
+
+// LVGL's copy of lodepng hands the pixels back as an lv_draw_buf_t in *out,
+// RGBA in memory order. Declared here as lodepng.h is not written for C++.
+extern "C" unsigned lodepng_decode32(unsigned char **out, unsigned *w, unsigned *h, const unsigned char *in,
+                                     size_t insize);
+
+typedef enum { CODED_PNG, CODED_JPEG } coded_t;
+
+// The coded bytes: the data of an lv_image_dsc_t, or a file
+typedef struct {
+    const uint8_t *data;  // NULL for a file
+    uint32_t size;
+    lv_fs_file_t file;
+} source_t;
+
+typedef struct {
+    coded_t type;
+    uint32_t w;
+    uint32_t h;
+    bool alpha;
+} coded_info_t;
+
+typedef struct {
+    source_t *source;
+    uint32_t pos;
+    icon_pixels_t out;
+    icon_format_t format;
+} jpeg_job_t;
+
+// Slots hold lv_draw_buf_t
+static icon_store_t store;
+static icon_format_t target;
+static icon_cache_stats_t stats;
+// Draw units open images from their own threads
+static lv_mutex_t cache_lock;
+
+static bool is_coded(const lv_image_decoder_dsc_t *dsc) {
+    if (dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_dsc_t *image = (const lv_image_dsc_t *)dsc->src;
+        return (image->header.cf == LV_COLOR_FORMAT_RAW || image->header.cf == LV_COLOR_FORMAT_RAW_ALPHA) &&
+               image->data && image->data_size;
+    }
+    if (dsc->src_type != LV_IMAGE_SRC_FILE)
+        return false;
+    const char *ext = lv_fs_get_ext((const char *)dsc->src);
+    return !strcmp(ext, "png") || !strcmp(ext, "jpg") || !strcmp(ext, "jpeg");
+}
+
+static bool source_open(const lv_image_decoder_dsc_t *dsc, source_t *source) {
+    if (dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_dsc_t *image = (const lv_image_dsc_t *)dsc->src;
+        source->data = image->data;
+        source->size = image->data_size;
+        return true;
+    }
+    source->data = NULL;
+    if (lv_fs_open(&source->file, (const char *)dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK)
+        return false;
+    if (lv_fs_seek(&source->file, 0, LV_FS_SEEK_END) != LV_FS_RES_OK ||
+        lv_fs_tell(&source->file, &source->size) != LV_FS_RES_OK) {
+        lv_fs_close(&source->file);
+        return false;
+    }
+    return true;
+}
+
+static void source_close(source_t *source) {
+    if (!source->data)
+        lv_fs_close(&source->file);
+}
+
+static bool source_read(source_t *source, uint32_t pos, void *buf, uint32_t len) {
+    if (pos > source->size || len > source->size - pos)
+        return false;
+    if (source->data) {
+        memcpy(buf, source->data + pos, len);
+        return true;
+    }
+    uint32_t n = 0;
+    return lv_fs_seek(&source->file, pos, LV_FS_SEEK_SET) == LV_FS_RES_OK &&
+           lv_fs_read(&source->file, buf, len, &n) == LV_FS_RES_OK && n == len;
+}
+
+static uint32_t read_be16(const uint8_t *p) {
+    return p[0] << 8 | p[1];
+}
+
+static uint32_t read_be32(const uint8_t *p) {
+    return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+// Marker segments up to the frame header, which tjpgd only takes baseline
+static bool read_jpeg_info(source_t *source, coded_info_t *info) {
+    uint8_t b[5];
+    uint32_t pos = 2;
+    while (source_read(source, pos, b, 4) && b[0] == 0xFF) {
+        uint8_t marker = b[1];
+        if (marker == 0xC0) {
+            if (!source_read(source, pos + 4, b, 5))
+                return false;
+            info->type = CODED_JPEG;
+            info->h = read_be16(b + 1);
+            info->w = read_be16(b + 3);
+            info->alpha = false;
+            return true;
+        }
+        // Progressive, lossless and arithmetic-coded frames, or a scan
+        // before any frame
+        if (((marker & 0xF0) == 0xC0 && marker != 0xC4 && marker != 0xCC) || marker == 0xDA)
+            return false;
+        pos += 2 + read_be16(b + 2);
+    }
+    return false;
+}
+
+// Type, size and whether there can be alpha, from the PNG's IHDR chunk or
+// the JPEG's frame header
+static bool read_info(source_t *source, coded_info_t *info) {
+    uint8_t b[26];
+    if (!source_read(source, 0, b, 2))
+        return false;
+    if (b[0] == 0xFF && b[1] == 0xD8) {
+        if (!read_jpeg_info(source, info))
+            return false;
+    } else {
+        if (!source_read(source, 0, b, sizeof(b)) || memcmp(b, "\x89PNG\r\n\x1a\n", 8) || memcmp(b + 12, "IHDR", 4))
+            return false;
+        info->type = CODED_PNG;
+        info->w = read_be32(b + 16);
+        info->h = read_be32(b + 20);
+        // Grey and alpha, RGBA, and palettes, which can carry alpha in tRNS
+        info->alpha = b[25] == 4 || b[25] == 6 || b[25] == 3;
+    }
+    return info->w && info->h && info->w <= 0xFFFF && info->h <= 0xFFFF;  // lv_image_header_t
+}
+
+static lv_color_format_t target_cf(icon_format_t format, bool alpha) {
+    if (format != ICON_RGB565)
+        return LV_COLOR_FORMAT_L8;
+    return alpha ? LV_COLOR_FORMAT_RGB565A8 : LV_COLOR_FORMAT_RGB565;
+}
+
+static void fill_header(lv_image_header_t *header, uint32_t w, uint32_t h, lv_color_format_t cf) {
+    lv_memzero(header, sizeof(*header));
+    header->magic = LV_IMAGE_HEADER_MAGIC;
+    header->cf = cf;
+    header->w = w;
+    header->h = h;
+    header->stride = lv_draw_buf_width_to_stride(w, cf);
+}
+
+static icon_pixels_t pixels_of(lv_draw_buf_t *buf) {
+    icon_pixels_t pixels = {buf->data, buf->header.h, buf->header.stride,
+                            buf->header.cf == LV_COLOR_FORMAT_RGB565A8};
+    return pixels;
+}
+
+static void release(void *decoded) {
+    lv_draw_buf_destroy((lv_draw_buf_t *)decoded);
+}
+
+static bool decode_png(source_t *source, lv_draw_buf_t *out, icon_format_t format) {
+    const uint8_t *png = source->data;
+    uint8_t *file = NULL;
+    if (!png) {
+        file = (uint8_t *)lv_malloc(source->size);
+        if (!file || !source_read(source, 0, file, source->size)) {
+            lv_free(file);
+            return false;
+        }
+        png = file;
+    }
+    lv_draw_buf_t *rgba = NULL;
+    unsigned w = 0, h = 0;
+    unsigned error = lodepng_decode32((unsigned char **)&rgba, &w, &h, png, source->size);
+    lv_free(file);
+    bool ok = !error && rgba && w == out->header.w && h == out->header.h;
+    icon_pixels_t pixels = pixels_of(out);
+    for (uint32_t y = 0; ok && y < h; y++)
+        icon_convert(&pixels, format, 0, y, rgba->data + y * rgba->header.stride, w, 4);
+    if (rgba)
+        lv_draw_buf_destroy(rgba);
+    return ok;
+}
+
+static size_t jpeg_in(JDEC *jd, uint8_t *buf, size_t len) {
+    jpeg_job_t *job = (jpeg_job_t *)jd->device;
+    if (len > job->source->size - job->pos)
+        len = job->source->size - job->pos;
+    if (buf && !source_read(job->source, job->pos, buf, len))
+        return 0;
+    job->pos += len;  // buf NULL: skip
+    return len;
+}
+
+// One block of RGB888, clipped to the image by tjpgd
+static int jpeg_out(JDEC *jd, void *bitmap, JRECT *rect) {
+    jpeg_job_t *job = (jpeg_job_t *)jd->device;
+    uint32_t w = rect->right - rect->left + 1;
+    const uint8_t *px = (const uint8_t *)bitmap;
+    for (uint32_t y = rect->top; y <= rect->bottom; y++, px += w * 3)
+        icon_convert(&job->out, job->format, rect->left, y, px, w, 3);
+    return 1;
+}
+
+static bool decode_jpeg(source_t *source, lv_draw_buf_t *out, icon_format_t format) {
+    void *pool = lv_malloc(ICON_CACHE_JPEG_POOL);
+    if (!pool)
+        return false;
+    jpeg_job_t job = {source, 0, pixels_of(out), format};
+    JDEC jd;
+    bool ok = jd_prepare(&jd, jpeg_in, pool, ICON_CACHE_JPEG_POOL, &job) == JDR_OK && jd.width == out->header.w &&
+              jd.height == out->header.h && jd_decomp(&jd, jpeg_out, 0) == JDR_OK;
+    lv_free(pool);
+    return ok;
+}
+
+static lv_draw_buf_t *decode(const lv_image_decoder_dsc_t *dsc, icon_format_t format) {
+    uint32_t start = micros();
+    source_t source;
+    if (!source_open(dsc, &source))
+        return NULL;
+    coded_info_t info;
+    lv_draw_buf_t *decoded = NULL;
+    if (read_info(&source, &info))
+        decoded = lv_draw_buf_create(info.w, info.h, target_cf(format, info.alpha), LV_STRIDE_AUTO);
+    if (decoded) {
+        bool ok = info.type == CODED_PNG ? decode_png(&source, decoded, format) : decode_jpeg(&source, decoded, format);
+        if (!ok) {
+            lv_draw_buf_destroy(decoded);
+            decoded = NULL;
+        }
+    }
+    source_close(&source);
+    stats.decode_us += micros() - start;
+    return decoded;
+}
+
+static icon_slot_t *find(const lv_image_decoder_dsc_t *dsc) {
+    const void *src = dsc->src_type == LV_IMAGE_SRC_VARIABLE ? dsc->src : NULL;
+    return icon_store_find(&store, src, (const char *)dsc->src, target);
+}
+
+static lv_result_t icon_info(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc, lv_image_header_t *header) {
+    LV_UNUSED(decoder);
+    if (!is_coded(dsc))
+        return LV_RESULT_INVALID;
+
+    // LVGL asks before every draw, its header cache being off as well: a
+    // cached image answers without reading the source
+    lv_mutex_lock(&cache_lock);
+    icon_slot_t *entry = find(dsc);
+    if (entry) {
+        const lv_draw_buf_t *decoded = (const lv_draw_buf_t *)entry->decoded;
+        fill_header(header, decoded->header.w, decoded->header.h, (lv_color_format_t)decoded->header.cf);
+    }
+    icon_format_t format = target;
+    lv_mutex_unlock(&cache_lock);
+    if (entry)
+        return LV_RESULT_OK;
+
+    source_t source;
+    coded_info_t info;
+    if (!source_open(dsc, &source))
+        return LV_RESULT_INVALID;
+    bool ok = read_info(&source, &info);
+    source_close(&source);
+    if (!ok)
+        return LV_RESULT_INVALID;
+    fill_header(header, info.w, info.h, target_cf(format, info.alpha));
+    return LV_RESULT_OK;
+}
+
+static lv_result_t icon_open(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+    lv_mutex_lock(&cache_lock);
+
+    icon_slot_t *entry = find(dsc);
+    if (entry) {
+        stats.hits++;
+    } else {
+        stats.misses++;
+        lv_draw_buf_t *decoded = decode(dsc, target);
+        if (!decoded) {
+            lv_mutex_unlock(&cache_lock);
+            return LV_RESULT_INVALID;
+        }
+        const void *src = dsc->src_type == LV_IMAGE_SRC_VARIABLE ? dsc->src : NULL;
+        entry = icon_store_add(&store, src, (const char *)dsc->src, target, decoded, decoded->data_size);
+        if (!entry) {
+            // Too big, or no room while every cached image is in use: this
+            // draw owns it
+            stats.uncached++;
+            dsc->decoded = decoded;
+            dsc->user_data = NULL;
+            lv_mutex_unlock(&cache_lock);
+            return LV_RESULT_OK;
+        }
+    }
+
+    icon_store_use(&store, entry);
+    dsc->decoded = (const lv_draw_buf_t *)entry->decoded;
+    dsc->user_data = entry;
+    lv_mutex_unlock(&cache_lock);
+    return LV_RESULT_OK;
+}
+
+static void icon_close(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+    icon_slot_t *entry = (icon_slot_t *)dsc->user_data;
+    if (!entry) {
+        lv_draw_buf_destroy((lv_draw_buf_t *)dsc->decoded);
+        return;
+    }
+    lv_mutex_lock(&cache_lock);
+    icon_store_done(entry);
+    lv_mutex_unlock(&cache_lock);
+}
+
+void icon_cache_init(uint32_t cache_bytes, icon_format_t format) {
+    icon_store_init(&store, cache_bytes, release);
+    target = format;
+    lv_mutex_init(&cache_lock);
+    // Decoders created later are asked first, so this one sees the PNG and
+    // JPEG images before LVGL's lodepng and tjpgd decoders
+    lv_image_decoder_t *decoder = lv_image_decoder_create();
+    lv_image_decoder_set_info_cb(decoder, icon_info);
+    lv_image_decoder_set_open_cb(decoder, icon_open);
+    lv_image_decoder_set_close_cb(decoder, icon_close);
+}
+
+void icon_cache_set_format(icon_format_t format) {
+    lv_mutex_lock(&cache_lock);
+    target = format;
+    lv_mutex_unlock(&cache_lock);
+}
+
+void icon_cache_get_stats(icon_cache_stats_t *out) {
+    lv_mutex_lock(&cache_lock);
+    *out = stats;
+    out->evictions = store.evictions;
+    out->cached_bytes = store.cached_bytes;
+    out->peak_bytes = store.peak_bytes;
+    lv_mutex_unlock(&cache_lock);
+}
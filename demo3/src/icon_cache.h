@@ -0,0 +1,51 @@
+// LVGL image decoder for PNG and JPEG images, with a cache of decoded
+// images.
+//
+// Takes PNG and baseline JPEG files (".png", ".jpg", ".jpeg" on any LVGL
+// drive) and images held in memory as they were downloaded: an
+// lv_image_dsc_t with cf LV_COLOR_FORMAT_RAW or RAW_ALPHA whose data is the
+// file. The pixels are decoded with LVGL's lodepng and tjpgd and converted
+// to the format the display wants; with LV_CACHE_DEF_SIZE 0, LVGL's own
+// decoders would do that again on every draw, in ARGB8888.
+//
+// Decoded images stay in a cache bounded by cache_bytes, keyed by source
+// (the lv_image_dsc_t's address or the path) and target format, so rows
+// that show the same icon share one decoded copy. The data of an
+// lv_image_dsc_t must therefore not change once it has been drawn. Only
+// images no draw is holding are evicted, least recently used first
+// (icon_store); an image that does not fit is decoded for the draw that
+// wants it and freed after it.
+//
+// Decoding a PNG takes 4 bytes per pixel of RGBA on top of the result for
+// as long as it runs, plus the file when it is not in memory already;
+// JPEGs are decoded block by block.
+
+#ifndef ICON_CACHE_H
+#define ICON_CACHE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "icon_store.h"
+
+#define ICON_CACHE_JPEG_POOL 4096  // tjpgd work area, as LVGL's own decoder has
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;         // decodes
+    uint32_t evictions;
+    uint32_t uncached;       // decodes that did not fit and were freed after the draw
+    uint32_t decode_us;      // total time spent decoding and converting
+    uint32_t cached_bytes;
+    uint32_t peak_bytes;     // most cached_bytes has been
+} icon_cache_stats_t;
+
+// Registers the decoder ahead of LVGL's; cache_bytes bounds the decoded
+// images kept. Call after lv_init().
+void icon_cache_init(uint32_t cache_bytes, icon_format_t format);
+
+// Images opened from now on are decoded to format; those of the old
+// format are no longer found and age out of the cache
+void icon_cache_set_format(icon_format_t format);
+void icon_cache_get_stats(icon_cache_stats_t *stats);
+
+#endif
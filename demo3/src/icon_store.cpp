@@ -0,0 +1,120 @@
+// Pixel conversion and slot bookkeeping of icon_cache, see icon_store.h.
+
+#include <string.h>
+#include "icon_store.h"
+
+// Ordered dither for the e-paper formats
+static const uint8_t bayer4[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+
+uint8_t icon_dither(uint32_t lum, uint32_t x, uint32_t y, uint32_t levels) {
+    uint32_t scaled = lum * (levels - 1);
+    uint32_t level = scaled / 255;
+    if (scaled % 255 * 16 > bayer4[y & 3][x & 3] * 255u + 127)
+        level++;
+    return level * 255 / (levels - 1);
+}
+
+void icon_convert(const icon_pixels_t *out, icon_format_t format, uint32_t x, uint32_t y, const uint8_t *px,
+                  uint32_t count, uint8_t step) {
+    uint32_t stride = out->stride;
+    uint8_t *row = out->data + y * stride;
+    if (format == ICON_RGB565) {
+        uint16_t *rgb = (uint16_t *)row + x;
+        // RGB565A8: the alpha plane follows the colours, at half their stride
+        uint8_t *alpha = NULL;
+        if (out->alpha_plane)
+            alpha = out->data + out->h * stride + y * (stride / 2) + x;
+        for (uint32_t i = 0; i < count; i++, px += step) {
+            rgb[i] = (px[0] & 0xF8) << 8 | (px[1] & 0xFC) << 3 | px[2] >> 3;
+            if (alpha)
+                alpha[i] = step == 4 ? px[3] : 0xFF;
+        }
+        return;
+    }
+    uint32_t levels = format == ICON_L8_MONO ? 2 : 4;
+    for (uint32_t i = 0; i < count; i++, px += step) {
+        uint32_t lum = (px[0] * 77 + px[1] * 150 + px[2] * 29) >> 8;
+        if (step == 4)
+            lum = (lum * px[3] + 255 * (255 - px[3])) / 255;  // onto white paper
+        row[x + i] = icon_dither(lum, x + i, y, levels);
+    }
+}
+
+void icon_store_init(icon_store_t *store, uint32_t limit, void (*release)(void *decoded)) {
+    memset(store, 0, sizeof(*store));
+    store->limit = limit;
+    store->release = release;
+}
+
+static bool same_source(const icon_slot_t *slot, const void *src, const char *path) {
+    if (src)
+        return slot->src == src;
+    return !slot->src && !strcmp(slot->path, path);
+}
+
+icon_slot_t *icon_store_find(icon_store_t *store, const void *src, const char *path, icon_format_t format) {
+    for (int i = 0; i < ICON_STORE_SLOTS; i++) {
+        icon_slot_t *slot = &store->slots[i];
+        if (slot->decoded && slot->format == format && same_source(slot, src, path))
+            return slot;
+    }
+    return NULL;
+}
+
+// Evicts idle images, oldest first, until `size` more bytes and a slot are
+// free; NULL when the images in use leave no room
+static icon_slot_t *make_room(icon_store_t *store, uint32_t size) {
+    if (size > store->limit)
+        return NULL;
+    for (;;) {
+        icon_slot_t *free_slot = NULL;
+        icon_slot_t *oldest = NULL;
+        for (int i = 0; i < ICON_STORE_SLOTS; i++) {
+            icon_slot_t *slot = &store->slots[i];
+            if (!slot->decoded) {
+                if (!free_slot)
+                    free_slot = slot;
+            } else if (!slot->refs && (!oldest || slot->last_used < oldest->last_used)) {
+                oldest = slot;
+            }
+        }
+        if (free_slot && store->cached_bytes + size <= store->limit)
+            return free_slot;
+        if (!oldest)
+            return NULL;
+        store->cached_bytes -= oldest->size;
+        store->release(oldest->decoded);
+        oldest->decoded = NULL;
+        oldest->src = NULL;
+        store->evictions++;
+    }
+}
+
+icon_slot_t *icon_store_add(icon_store_t *store, const void *src, const char *path, icon_format_t format,
+                            void *decoded, uint32_t size) {
+    if (!src && strlen(path) >= ICON_STORE_PATH_LEN)
+        return NULL;
+    icon_slot_t *slot = make_room(store, size);
+    if (!slot)
+        return NULL;
+    slot->src = src;
+    if (!src)
+        strcpy(slot->path, path);
+    slot->format = format;
+    slot->decoded = decoded;
+    slot->size = size;
+    slot->refs = 0;
+    store->cached_bytes += size;
+    if (store->cached_bytes > store->peak_bytes)
+        store->peak_bytes = store->cached_bytes;
+    return slot;
+}
+
+void icon_store_use(icon_store_t *store, icon_slot_t *slot) {
+    slot->refs++;
+    slot->last_used = ++store->clock;
+}
+
+void icon_store_done(icon_slot_t *slot) {
+    slot->refs--;
+}
@@ -0,0 +1,86 @@
+// Pixel conversion and slot bookkeeping of icon_cache; packed_image keeps
+// its decoded images in an icon_store_t of its own.
+//
+// The parts of the decoder that need neither LVGL nor the board, so that
+// they also build on the host (host/icon_test.cpp): turning decoded RGBA or
+// RGB rows into the display's format, and the slots that keep decoded
+// images within a byte budget.
+//
+// A slot holds an image its owner decoded, keyed by source and format, and
+// counts the opens of it that are not closed yet. Room for a new image is
+// made by freeing idle images, least recently used first, through the
+// owner's release function; images in use are never freed. Not
+// thread-safe; icon_cache and packed_image hold their locks around every
+// call.
+
+#ifndef ICON_STORE_H
+#define ICON_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ICON_STORE_SLOTS 12     // decoded images kept at most
+#define ICON_STORE_PATH_LEN 32  // longer paths are decoded but not kept
+
+typedef enum {
+    ICON_RGB565,     // RGB565, RGB565A8 for PNGs that can have alpha
+    ICON_L8_MONO,    // e-paper: L8 of 0 and 255, dithered, alpha onto white
+    ICON_L8_GRAY4,   // e-paper: L8 of 0, 85, 170 and 255 for 4-grey refreshes
+} icon_format_t;
+
+// Where converted pixels go: h rows of stride bytes, RGB565 or L8. With
+// alpha_plane (RGB565A8), h rows of stride / 2 alpha bytes follow them.
+typedef struct {
+    uint8_t *data;
+    uint32_t h;
+    uint32_t stride;
+    bool alpha_plane;
+} icon_pixels_t;
+
+typedef struct {
+    const void *src;                  // the image's address, NULL for a file
+    char path[ICON_STORE_PATH_LEN];   // the file
+    icon_format_t format;
+    void *decoded;                    // the owner's, NULL while the slot is free
+    uint32_t size;                    // bytes of decoded
+    uint32_t refs;                    // opens not closed yet
+    uint32_t last_used;
+} icon_slot_t;
+
+typedef struct {
+    icon_slot_t slots[ICON_STORE_SLOTS];
+    uint32_t limit;
+    uint32_t clock;
+    uint32_t cached_bytes;
+    uint32_t peak_bytes;
+    uint32_t evictions;
+    void (*release)(void *decoded);
+} icon_store_t;
+
+// lum to one of `levels` evenly spaced greys, 0 to 255, rounding up where
+// it is past the pixel's threshold in a 4x4 ordered dither
+uint8_t icon_dither(uint32_t lum, uint32_t x, uint32_t y, uint32_t levels);
+
+// count pixels of RGBA (step 4) or RGB (step 3) into out from (x, y) on.
+// ICON_RGB565 keeps alpha in the alpha plane, when out has one; the L8
+// formats flatten it onto white and dither.
+void icon_convert(const icon_pixels_t *out, icon_format_t format, uint32_t x, uint32_t y, const uint8_t *px,
+                  uint32_t count, uint8_t step);
+
+// Empty store of limit bytes; release frees what the owner decoded
+void icon_store_init(icon_store_t *store, uint32_t limit, void (*release)(void *decoded));
+
+// src for an image in memory, else path
+icon_slot_t *icon_store_find(icon_store_t *store, const void *src, const char *path, icon_format_t format);
+
+// Keeps decoded, size bytes, evicting idle images as needed; NULL when it
+// is larger than the limit, the path too long or the images in use leave
+// no room, and the caller still owns it
+icon_slot_t *icon_store_add(icon_store_t *store, const void *src, const char *path, icon_format_t format,
+                            void *decoded, uint32_t size);
+
+// An open of the slot's image, and its close
+void icon_store_use(icon_store_t *store, icon_slot_t *slot);
+void icon_store_done(icon_slot_t *slot);
+
+#endif
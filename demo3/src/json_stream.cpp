@@ -0,0 +1,278 @@
+// Streaming JSON tokenizer, see json_stream.h.
+
+#include <string.h>
+#include "json_stream.h"
+
+enum {
+    ST_VALUE,           // a value must come
+    ST_VALUE_OR_CLOSE,  // after '['
+    ST_KEY,             // after ',' in an object
+    ST_KEY_OR_CLOSE,    // after '{'
+    ST_COLON,
+    ST_AFTER_VALUE,  // ',' or the end of the container
+    ST_STRING,
+    ST_ESCAPE,
+    ST_UNICODE,
+    ST_BARE,  // number or literal
+    ST_DONE,
+    ST_ERROR,
+};
+
+static bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool is_bare(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == '-' || c == '+' || c == '.' || c == 'E';
+}
+
+static void append(json_stream_t *js, char c) {
+    if (js->len < JSON_STREAM_TOKEN_LEN - 1)
+        js->token[js->len++] = c;
+    else
+        js->truncated = true;
+}
+
+// Code point as UTF-8; a lone surrogate half becomes '?'
+static void append_code(json_stream_t *js, uint16_t code) {
+    if (code < 0x80) {
+        append(js, (char)code);
+    } else if (code < 0x800) {
+        append(js, (char)(0xC0 | code >> 6));
+        append(js, (char)(0x80 | (code & 0x3F)));
+    } else if (code >= 0xD800 && code < 0xE000) {
+        append(js, '?');
+    } else {
+        append(js, (char)(0xE0 | code >> 12));
+        append(js, (char)(0x80 | ((code >> 6) & 0x3F)));
+        append(js, (char)(0x80 | (code & 0x3F)));
+    }
+}
+
+static void start_token(json_stream_t *js) {
+    js->len = 0;
+    js->truncated = false;
+}
+
+// The value that just ended; the container decides what may follow
+static void value_done(json_stream_t *js) {
+    js->state = js->depth ? ST_AFTER_VALUE : ST_DONE;
+}
+
+static bool emit(json_stream_t *js, json_type_t type) {
+    js->token[js->len] = 0;
+    if (js->on_value)
+        js->on_value(js->ctx, js, type, js->token);
+    value_done(js);
+    return true;
+}
+
+static bool emit_bare(json_stream_t *js) {
+    js->token[js->len] = 0;
+    if (!strcmp(js->token, "true"))
+        return emit(js, JSON_TRUE);
+    if (!strcmp(js->token, "false"))
+        return emit(js, JSON_FALSE);
+    if (!strcmp(js->token, "null"))
+        return emit(js, JSON_NULL);
+    // The number's syntax is left to whoever converts it
+    char c = js->token[0];
+    if (js->truncated || !(c == '-' || (c >= '0' && c <= '9')))
+        return false;
+    return emit(js, JSON_NUMBER);
+}
+
+static bool push(json_stream_t *js, bool array) {
+    if (js->depth == JSON_STREAM_MAX_DEPTH)
+        return false;
+    json_frame_t *frame = &js->frames[js->depth++];
+    frame->array = array;
+    frame->index = 0;
+    frame->key[0] = 0;
+    js->state = array ? ST_VALUE_OR_CLOSE : ST_KEY_OR_CLOSE;
+    return true;
+}
+
+static bool pop(json_stream_t *js, bool array) {
+    if (!js->depth || js->frames[js->depth - 1].array != array)
+        return false;
+    js->depth--;
+    value_done(js);
+    return true;
+}
+
+static bool begin_value(json_stream_t *js, char c) {
+    if (c == '{')
+        return push(js, false);
+    if (c == '[')
+        return push(js, true);
+    start_token(js);
+    if (c == '"') {
+        js->key = false;
+        js->state = ST_STRING;
+        return true;
+    }
+    if (c == '-' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z')) {
+        append(js, c);
+        js->state = ST_BARE;
+        return true;
+    }
+    return false;
+}
+
+// One character; false on an error
+static bool step(json_stream_t *js, char c) {
+    switch (js->state) {
+    case ST_STRING:
+        if (c == '"') {
+            if (!js->key)
+                return emit(js, JSON_STRING);
+            json_frame_t *frame = &js->frames[js->depth - 1];
+            size_t n = js->len < JSON_STREAM_KEY_LEN - 1 ? js->len : JSON_STREAM_KEY_LEN - 1;
+            memcpy(frame->key, js->token, n);
+            frame->key[n] = 0;
+            js->state = ST_COLON;
+            return true;
+        }
+        if (c == '\\') {
+            js->state = ST_ESCAPE;
+            return true;
+        }
+        if ((uint8_t)c < 0x20)
+            return false;
+        append(js, c);
+        return true;
+
+    case ST_ESCAPE: {
+        static const char escapes[] = "\"\"\\\\//b\bf\fn\nr\rt\t";
+        js->state = ST_STRING;
+        if (c == 'u') {
+            js->hex = 4;
+            js->code = 0;
+            js->state = ST_UNICODE;
+            return true;
+        }
+        for (const char *e = escapes; *e; e += 2) {
+            if (*e == c) {
+                append(js, e[1]);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    case ST_UNICODE: {
+        uint8_t digit;
+        if (c >= '0' && c <= '9')
+            digit = c - '0';
+        else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+            digit = (c | 0x20) - 'a' + 10;
+        else
+            return false;
+        js->code = js->code << 4 | digit;
+        if (--js->hex == 0) {
+            append_code(js, js->code);
+            js->state = ST_STRING;
+        }
+        return true;
+    }
+
+    case ST_BARE:
+        if (is_bare(c)) {
+            append(js, c);
+            return true;
+        }
+        // The character after the token still has to be read
+        return emit_bare(js) && step(js, c);
+
+    default:
+        break;
+    }
+
+    if (is_space(c))
+        return true;
+
+    switch (js->state) {
+    case ST_VALUE:
+        return begin_value(js, c);
+    case ST_VALUE_OR_CLOSE:
+        return c == ']' ? pop(js, true) : begin_value(js, c);
+    case ST_KEY_OR_CLOSE:
+        if (c == '}')
+            return pop(js, false);
+        // fall through
+    case ST_KEY:
+        if (c != '"')
+            return false;
+        start_token(js);
+        js->key = true;
+        js->state = ST_STRING;
+        return true;
+    case ST_COLON:
+        if (c != ':')
+            return false;
+        js->state = ST_VALUE;
+        return true;
+    case ST_AFTER_VALUE: {
+        json_frame_t *frame = &js->frames[js->depth - 1];
+        if (c == ',') {
+            if (frame->array) {
+                frame->index++;
+                js->state = ST_VALUE;
+            } else {
+                js->state = ST_KEY;
+            }
+            return true;
+        }
+        return c == (frame->array ? ']' : '}') && pop(js, frame->array);
+    }
+    default:
+        // ST_DONE: only white space may follow the document
+        return false;
+    }
+}
+
+void json_stream_begin(json_stream_t *js, json_value_cb_t on_value, void *ctx) {
+    memset(js, 0, sizeof(*js));
+    js->on_value = on_value;
+    js->ctx = ctx;
+    js->state = ST_VALUE;
+}
+
+bool json_stream_feed(json_stream_t *js, const char *data, size_t len) {
+    for (size_t i = 0; i < len && js->state != ST_ERROR; i++) {
+        if (!step(js, data[i]))
+            js->state = ST_ERROR;
+        else
+            js->offset++;
+    }
+    return js->state != ST_ERROR;
+}
+
+bool json_stream_done(const json_stream_t *js) {
+    return js->state == ST_DONE;
+}
+
+bool json_stream_failed(const json_stream_t *js) {
+    return js->state == ST_ERROR;
+}
+
+uint8_t json_stream_depth(const json_stream_t *js) {
+    return js->depth;
+}
+
+const char *json_stream_key(const json_stream_t *js, uint8_t level) {
+    if (level >= js->depth || js->frames[level].array)
+        return NULL;
+    return js->frames[level].key;
+}
+
+int32_t json_stream_index(const json_stream_t *js, uint8_t level) {
+    if (level >= js->depth || !js->frames[level].array)
+        return -1;
+    return js->frames[level].index;
+}
+
+bool json_stream_truncated(const json_stream_t *js) {
+    return js->truncated;
+}
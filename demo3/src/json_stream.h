@@ -0,0 +1,79 @@
+// Streaming JSON tokenizer.
+//
+// Takes a document in pieces of any size, as they come off the socket, and
+// calls back once per scalar value (string, number, true, false, null) with
+// the path that leads to it: the key of every enclosing object member and
+// the index of every enclosing array element. Objects and arrays are never
+// built; the state is this struct, a frame per nesting level and one token
+// buffer, so parsing allocates nothing and its stack use does not depend on
+// the document. A token split across two pieces is joined in the buffer.
+//
+// Strings longer than JSON_STREAM_TOKEN_LEN - 1 bytes reach the callback
+// cut short with truncated set, keys are cut to JSON_STREAM_KEY_LEN - 1
+// bytes. Nesting deeper than JSON_STREAM_MAX_DEPTH is an error, as is
+// anything that is not JSON; the rest of the input is then ignored.
+
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define JSON_STREAM_MAX_DEPTH 6
+#define JSON_STREAM_KEY_LEN 32    // member names, terminator included
+#define JSON_STREAM_TOKEN_LEN 32  // string values and numbers, terminator included
+
+typedef enum {
+    JSON_STRING,
+    JSON_NUMBER,
+    JSON_TRUE,
+    JSON_FALSE,
+    JSON_NULL,
+} json_type_t;
+
+typedef struct json_stream json_stream_t;
+
+// text is the value's characters with escapes resolved, 0-terminated;
+// numbers and literals as written
+typedef void (*json_value_cb_t)(void *ctx, const json_stream_t *js, json_type_t type, const char *text);
+
+typedef struct {
+    bool array;
+    uint16_t index;                 // element index in an array
+    char key[JSON_STREAM_KEY_LEN];  // member name in an object
+} json_frame_t;
+
+struct json_stream {
+    json_value_cb_t on_value;
+    void *ctx;
+    uint8_t state;
+    uint8_t depth;
+    bool key;        // the string being read is a member name
+    bool truncated;  // the token did not fit
+    uint8_t hex;     // \u digits still to come
+    uint16_t code;   // \u code point so far
+    uint16_t len;
+    uint32_t offset;  // bytes consumed, where an error is
+    json_frame_t frames[JSON_STREAM_MAX_DEPTH];
+    char token[JSON_STREAM_TOKEN_LEN];
+};
+
+void json_stream_begin(json_stream_t *js, json_value_cb_t on_value, void *ctx);
+
+// false once the input is not JSON or nests too deep
+bool json_stream_feed(json_stream_t *js, const char *data, size_t len);
+
+// The top-level value is complete
+bool json_stream_done(const json_stream_t *js);
+bool json_stream_failed(const json_stream_t *js);
+
+// Path of the current value, for the callback: level 0 is the outermost
+// container. key is NULL for an array level, index -1 for an object level.
+uint8_t json_stream_depth(const json_stream_t *js);
+const char *json_stream_key(const json_stream_t *js, uint8_t level);
+int32_t json_stream_index(const json_stream_t *js, uint8_t level);
+
+// The value was truncated to JSON_STREAM_TOKEN_LEN - 1 bytes
+bool json_stream_truncated(const json_stream_t *js);
+
+#endif
@@ -2,7 +2,21 @@
 #include <lvgl.h>
 #include <TFT_eSPI.h>
 #include <XPT2046_Touchscreen.h>
+#include <algorithm>
 #include "ui/ui.h"
+#include "touch_input.h"
+#include "profiler.h"
+#include "packed_image.h"
+#include "forecast_list.h"
+#include "bindings.h"
+#include "ui_table.h"
+#include "boot_trace.h"
+#include "weather_fetch.h"
+#include "sd_cache.h"
+#include "sd_fs.h"
+#include "sd_image.h"
+#include "icon_cache.h"
+#include "weather_icons.h"
 
 #define XPT2046_IRQ 36  // T_IRQ
 #define XPT2046_MOSI 32 // T_DIN
@@ -14,19 +28,164 @@
 // Display configuration - matches EEZ Studio project settings
 static const uint16_t screenWidth = 320;
 static const uint16_t screenHeight = 240;
-static lv_color_t buf1[screenWidth * 40]; // 40 lines buffer for faster refresh
-static lv_color_t buf2[screenWidth * 40]; // Second buffer for double buffering
+// Two 40-line RGB565 buffers: LVGL renders into one while DMA sends the other.
+// Static, so they sit in internal DMA-capable RAM.
+static uint16_t buf1[screenWidth * 40] __attribute__((aligned(4)));
+static uint16_t buf2[screenWidth * 40] __attribute__((aligned(4)));
 
-// Forecast grid widgets
-static lv_obj_t *forecast_datetime_label[7];
-static lv_obj_t *forecast_visibility_image[7];
-static lv_obj_t *forecast_precip_low_label[7];
-static lv_obj_t *forecast_temp_label[7];
+// 1: flush through TFT_eSPI's DMA engine, 0: blocking pushPixels
+#ifndef DEMO_FLUSH_DMA
+#define DEMO_FLUSH_DMA 1
+#endif
+
+// 1: LVGL renders in loop() and a task on the other core sends the
+// finished buffers, 0: loop() sends them itself
+#ifndef DEMO_FLUSH_TASK
+#define DEMO_FLUSH_TASK 0
+#endif
+
+// 1: LVGL ticks from millis() and loop() sleeps until its next timer or a
+// touch 0: the fixed lv_tick_inc() / delay() loop
+#ifndef DEMO_TICKLESS
+#define DEMO_TICKLESS 1
+#endif
+
+// Longest sleep when LVGL has no timer due, so ui_tick() still runs
+#define DEMO_MAX_IDLE_MS 500
+
+// 1: touch is sampled by an IRQ-driven task (touch_input.cpp), 0: the
+// XPT2046 library is polled from the LVGL input callback
+#ifndef DEMO_TOUCH_TASK
+#define DEMO_TOUCH_TASK 1
+#endif
+
+// Bytes of decoded images packed_image.cpp keeps. 0 leaves the packed
+// images to LVGL's bin decoder (LV_USE_RLE), which decodes them per draw.
+#ifndef DEMO_IMAGE_CACHE
+#define DEMO_IMAGE_CACHE (40 * 1024)
+#endif
+
+// Bytes of decoded PNG and JPEG images icon_cache.cpp keeps, the forecast
+// icons among them (a 20x20 icon with alpha takes 1200). 0 leaves them to
+// LVGL's lodepng and tjpgd decoders, which decode them per draw.
+#ifndef DEMO_ICON_CACHE
+#define DEMO_ICON_CACHE (8 * 1024)
+#endif
+
+// Rows in the forecast list: 7 daily, more are shown as hourly
+#ifndef DEMO_FORECAST_ROWS
+#define DEMO_FORECAST_ROWS 7
+#endif
+
+// 1: the screen is built from the table tools/ui_table.py compiles out of
+// screens.c (ui_table.cpp), 0: by ui_init() and the generated code. Off by
+// default: for demo3's one screen the table and its ~800-byte interpreter
+// take more flash than the generated code does.
+#ifndef DEMO_UI_TABLE
+#define DEMO_UI_TABLE 0
+#endif
+
+// 1: a splash in the main screen's background gradient goes out through
+// TFT_eSPI before lv_init() and the backlight waits for it; the forecast
+// rows are filled in after the first frame. 0: the panel shows nothing of
+// the UI until LVGL's first frame, which already has the rows
+#ifndef DEMO_FAST_BOOT
+#define DEMO_FAST_BOOT 1
+#endif
+
+// With -D DEMO_WEATHER the forecast and current conditions are fetched
+// from DEMO_WEATHER_URL every DEMO_WEATHER_INTERVAL_S (weather_fetch.cpp)
+// and replace the placeholders; tools/weather_server.py serves recorded
+// responses for it on the local network
+#ifndef DEMO_WIFI_SSID
+#define DEMO_WIFI_SSID ""
+#endif
+#ifndef DEMO_WIFI_PASSWORD
+#define DEMO_WIFI_PASSWORD ""
+#endif
+#ifndef DEMO_WEATHER_URL
+#define DEMO_WEATHER_URL "http://192.168.1.100:8080/v1/forecast?latitude=47.61&longitude=-122.33" \
+  "&current=temperature_2m,apparent_temperature,weather_code" \
+  "&daily=weather_code,temperature_2m_max,precipitation_probability_max" \
+  "&hourly=temperature_2m,precipitation_probability,weather_code" \
+  "&temperature_unit=fahrenheit&timezone=auto&forecast_days=7&forecast_hours=168"
+#endif
+#ifndef DEMO_WEATHER_INTERVAL_S
+#define DEMO_WEATHER_INTERVAL_S 900
+#endif
+// Forecast icons are downloaded from here, the icon's name appended
+// (weather_icons.h); "" keeps the compiled-in icon on every row
+#ifndef DEMO_ICON_URL
+#define DEMO_ICON_URL "http://192.168.1.100:8080/icons/"
+#endif
+
+// With -D DEMO_SD the microSD card is drive S: (sd_fs.cpp) and .bin images
+// on it are drawn in strips (sd_image.cpp). The card takes the VSPI
+// peripheral the touch controller is on, so touch_input.cpp drives the
+// controller's pins by hand; the XPT2046 library (DEMO_TOUCH_TASK 0) needs
+// the peripheral and is not used then.
+#if defined(DEMO_SD) && !DEMO_TOUCH_TASK
+#undef DEMO_TOUCH_TASK
+#define DEMO_TOUCH_TASK 1
+#endif
+
+// Image DEMO_SD_BENCH opens and draws; tools/sd_images.py writes it
+#define SD_BENCH_IMAGE "S:/images/bench.bin"
+
+// bg_color and bg_grad_color of the main screen in screens.c
+#define SPLASH_RGB 0x8f9391
+#define SPLASH_GRAD_RGB 0xa6cdec
+
+static uint32_t flush_us = 0;  // time spent in my_disp_flush
+static uint32_t wait_us = 0;   // time LVGL waited for a buffer to come back
+
+#ifdef PROFILER
+// Probe ids index prof_probes; the parents give prof_report its tree
+enum { PROF_LOOP, PROF_TIMER_HANDLER, PROF_RENDER, PROF_FLUSH, PROF_TOUCH_READ, PROF_UI_TICK };
+static const prof_probe_t prof_probes[] = {
+  {"loop", -1}, {"lv_timer_handler", PROF_LOOP}, {"render", PROF_TIMER_HANDLER},
+  {"flush", PROF_RENDER}, {"touch_read", PROF_TIMER_HANDLER}, {"ui_tick", PROF_LOOP},
+};
+
+// One render pass, flushes included
+static void prof_render_cb(lv_event_t *e)
+{
+  if (lv_event_get_code(e) == LV_EVENT_RENDER_START)
+    PROF_MARK(PROF_RENDER);
+  else
+    PROF_MARK_END(PROF_RENDER);
+}
+#endif
+
+// Forecast rows; forecast_list.cpp only has widgets for the visible ones
+static forecast_row_t forecast[DEMO_FORECAST_ROWS];
+// Row icons by kind of weather: the compiled-in icon for every kind until
+// one is downloaded (weather_icons.cpp)
+static const lv_image_dsc_t *forecast_icons[WEATHER_ICONS];
+#ifdef DEMO_RENDER_BENCH
+static uint32_t forecast_heap = 0;  // heap the list took in my_setup_ui
+#endif
+#ifdef DEMO_WEATHER
+// Front and back model of weather_fetch.cpp; forecast[] keeps the
+// placeholders until the first fetch
+static forecast_row_t weather_rows[2][DEMO_FORECAST_ROWS];
+static weather_model_t weather[2] = {
+  {0, 0, "", 0, weather_rows[0], DEMO_FORECAST_ROWS, 0},
+  {0, 0, "", 0, weather_rows[1], DEMO_FORECAST_ROWS, 0},
+};
+#endif
+
+// Native variables behind the current conditions widgets (bindings.cpp)
+enum { VAR_TEMPERATURE, VAR_FEELS_LIKE, VAR_TIME, VAR_CONDITIONS, VAR_COUNT };
 
 TFT_eSPI tft = TFT_eSPI();
 SPIClass touchscreenSpi = SPIClass(VSPI);
-XPT2046_Touchscreen touchscreen(XPT2046_CS, XPT2046_IRQ);
+#if !DEMO_TOUCH_TASK
+// T_IRQ belongs to touch_irq() below, so the library reads the controller
+// without waiting for its own interrupt
+XPT2046_Touchscreen touchscreen(XPT2046_CS);
 uint16_t touchScreenMinimumX = 200, touchScreenMaximumX = 3700, touchScreenMinimumY = 240, touchScreenMaximumY = 3800;
+#endif
 
 // LVGL log callback
 void my_log_print(lv_log_level_t level, const char *buf)
@@ -36,22 +195,329 @@ void my_log_print(lv_log_level_t level, const char *buf)
   Serial.flush();
 }
 
-// Display flushing callback - TFT_eSPI implementation
-void my_disp_flush(lv_display_t *display, const lv_area_t *area, uint8_t *color_p)
+// Sends one rendered area. The buffer is rendered byte-swapped
+// (RGB565_SWAPPED), so it goes out as is.
+static void push_area(const lv_area_t *area, uint16_t *pixels)
 {
   uint32_t w = (area->x2 - area->x1 + 1);
   uint32_t h = (area->y2 - area->y1 + 1);
 
+#if DEMO_FLUSH_DMA
+  tft.pushImageDMA(area->x1, area->y1, w, h, pixels);
+#else
   tft.startWrite();
   tft.setAddrWindow(area->x1, area->y1, w, h);
-  tft.pushPixels((uint16_t *)color_p, w * h);
+  tft.pushPixels(pixels, w * h);
   tft.endWrite();
+#endif
+}
 
+#if DEMO_FLUSH_TASK
+// A rendered buffer on its way to the flush task. LVGL does not touch it
+// again until the task gives flush_done, so each buffer has one owner at a
+// time. With two buffers at most one is in flight: the queue has one slot
+// and my_flush_wait() is the back-pressure.
+struct flush_job_t
+{
+  lv_area_t area;
+  uint16_t *pixels;
+};
+
+static QueueHandle_t flush_queue;
+static SemaphoreHandle_t flush_done;
+static volatile uint32_t flush_task_us = 0; // running total, read by loop()
+
+static void flush_task(void *arg)
+{
+  flush_job_t job;
+  for (;;)
+  {
+    xQueueReceive(flush_queue, &job, portMAX_DELAY);
+    uint32_t start = micros();
+    push_area(&job.area, job.pixels);
+#if DEMO_FLUSH_DMA
+    tft.dmaWait(); // the buffer is free once the transfer is
+#endif
+    flush_task_us += micros() - start;
+    xSemaphoreGive(flush_done);
+  }
+}
+#endif
+
+// Display flushing callback - TFT_eSPI implementation
+void my_disp_flush(lv_display_t *display, const lv_area_t *area, uint8_t *color_p)
+{
+  uint32_t start = micros();
+  PROF_BEGIN(PROF_FLUSH);
+  BOOT_FIRST_PIXEL();
+
+#if DEMO_FLUSH_TASK
+  flush_job_t job = { *area, (uint16_t *)color_p };
+  xQueueSend(flush_queue, &job, portMAX_DELAY);
+#elif DEMO_FLUSH_DMA
+  // Queue the transfer and return; LVGL renders into the other buffer
+  // meanwhile and waits in my_flush_wait() before reusing this one
+  push_area(area, (uint16_t *)color_p);
+#else
+  push_area(area, (uint16_t *)color_p);
   lv_display_flush_ready(display); // Tell LVGL you are ready with the flushing
+#endif
+  PROF_END(PROF_FLUSH);
+  flush_us += micros() - start;
+}
+
+#if DEMO_FLUSH_TASK || DEMO_FLUSH_DMA
+// Called by LVGL instead of polling flush_ready: the flush is complete
+// when the flush task hands the buffer back or the DMA transfer ends
+void my_flush_wait(lv_display_t *display)
+{
+  uint32_t start = micros();
+#if DEMO_FLUSH_TASK
+  xSemaphoreTake(flush_done, portMAX_DELAY);
+#else
+  tft.dmaWait();
+#endif
+  wait_us += micros() - start;
+}
+#endif
+
+#ifdef DEMO_FPS_TEST
+// Full-screen animation for the frame-rate measurement: the whole screen
+// changes colour every frame, so each refresh renders and flushes 320x240
+static uint32_t fps_frames = 0;
+static uint32_t frame_start = 0;
+static uint32_t frame_us = 0;
+
+static void fps_anim_cb(void *obj, int32_t v)
+{
+  lv_obj_set_style_bg_color((lv_obj_t *)obj, lv_color_hsv_to_rgb((uint16_t)v, 100, 100), 0);
+}
+
+static void fps_refr_cb(lv_event_t *e)
+{
+  if (lv_event_get_code(e) == LV_EVENT_REFR_START)
+  {
+    frame_start = micros();
+  }
+  else
+  {
+    frame_us += micros() - frame_start;
+    fps_frames++;
+  }
+}
+
+static void fps_report_cb(lv_timer_t *timer)
+{
+#if DEMO_FLUSH_TASK
+  static uint32_t task_us_seen = 0;
+  uint32_t task_us = flush_task_us - task_us_seen;
+  task_us_seen += task_us;
+#endif
+  if (fps_frames)
+  {
+    Serial.printf("%s%s: %lu fps, flush %lu us/frame, wait %lu us/frame\n", DEMO_FLUSH_TASK ? "task+" : "", DEMO_FLUSH_DMA ? "dma" : "blocking",
+                  (unsigned long)fps_frames, (unsigned long)(flush_us / fps_frames), (unsigned long)(wait_us / fps_frames));
+#if DEMO_FLUSH_TASK
+    // The render core is busy for the frame minus its waits and queueing;
+    // whatever the flush task adds beyond the frame time ran in parallel
+    uint32_t frame = frame_us / fps_frames;
+    uint32_t idle = (wait_us + flush_us) / fps_frames;
+    uint32_t render = frame > idle ? frame - idle : 0;
+    uint32_t sent = task_us / fps_frames;
+    Serial.printf("  frame %lu us: render %lu us, flush task %lu us, overlap %lu us\n", (unsigned long)frame,
+                  (unsigned long)render, (unsigned long)sent, (unsigned long)(render + sent > frame ? render + sent - frame : 0));
+#endif
+  }
+  fps_frames = 0;
+  frame_us = 0;
+  flush_us = 0;
+  wait_us = 0;
+}
+
+static void fps_test_start(lv_display_t *display)
+{
+  lv_obj_t *scr = lv_obj_create(NULL);
+  lv_obj_t *label = lv_label_create(scr);
+  lv_label_set_text(label, "FPS test");
+  lv_obj_center(label);
+  lv_screen_load(scr);
+
+  lv_anim_t a;
+  lv_anim_init(&a);
+  lv_anim_set_var(&a, scr);
+  lv_anim_set_exec_cb(&a, fps_anim_cb);
+  lv_anim_set_values(&a, 0, 359);
+  lv_anim_set_duration(&a, 3000);
+  lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+  lv_anim_start(&a);
+
+  lv_timer_set_period(lv_display_get_refr_timer(display), 1); // as fast as it goes
+  lv_display_add_event_cb(display, fps_refr_cb, LV_EVENT_REFR_START, NULL);
+  lv_display_add_event_cb(display, fps_refr_cb, LV_EVENT_REFR_READY, NULL);
+  lv_timer_create(fps_report_cb, 1000, NULL);
+}
+#endif
+
+// LVGL's clock: millis() instead of counting loop passes
+static uint32_t my_tick(void)
+{
+  return millis();
+}
+
+static SemaphoreHandle_t touch_wake;         // given on a touch, wakes loop()
+static lv_timer_t *touch_read_timer = NULL;
+static bool touch_on = false;                // the touch_input sampler is running
+static volatile uint32_t touch_irq_us = 0;   // first T_IRQ edge not yet redrawn
+
+#ifdef DEMO_TOUCH_STATS
+// T_IRQ edge to LV_EVENT_PRESSED, distribution printed every 10 s
+#define TOUCH_STATS_MAX 64
+static volatile uint32_t press_irq_us = 0;
+static uint32_t press_latency_us[TOUCH_STATS_MAX];
+static uint32_t press_count = 0;
+
+static void touch_pressed_cb(lv_event_t *e)
+{
+  uint32_t irq = press_irq_us;
+  if (!irq)
+    return;
+  press_irq_us = 0;
+  if (press_count < TOUCH_STATS_MAX)
+    press_latency_us[press_count++] = micros() - irq;
+}
+
+static void touch_stats_cb(lv_timer_t *timer)
+{
+  if (!press_count)
+    return;
+  std::sort(press_latency_us, press_latency_us + press_count);
+  Serial.printf("%s touch: %lu presses, IRQ to PRESSED min %lu us, p50 %lu us, p90 %lu us, max %lu us\n",
+                DEMO_TOUCH_TASK ? "sampled" : "polled", (unsigned long)press_count, (unsigned long)press_latency_us[0],
+                (unsigned long)press_latency_us[press_count / 2], (unsigned long)press_latency_us[press_count * 9 / 10],
+                (unsigned long)press_latency_us[press_count - 1]);
+  press_count = 0;
+}
+#endif
+
+#if DEMO_TOUCH_TASK
+// Runs in the touch sampler task after each new sample
+static void touch_sampled()
+{
+  xSemaphoreGive(touch_wake);
+}
+#else
+// T_IRQ goes low when the panel is pressed
+static void IRAM_ATTR touch_irq()
+{
+  if (!touch_irq_us)
+    touch_irq_us = micros();
+#ifdef DEMO_TOUCH_STATS
+  if (!press_irq_us)
+    press_irq_us = micros();
+#endif
+  BaseType_t woken = pdFALSE;
+  xSemaphoreGiveFromISR(touch_wake, &woken);
+  if (woken)
+    portYIELD_FROM_ISR();
+}
+#endif
+
+#ifdef DEMO_LOOP_STATS
+// Loop wake-ups, time awake and touch-to-redraw latency, printed every 5 s
+static uint32_t stats_start_us = 0;
+static uint32_t loop_wakeups = 0;
+static uint32_t loop_sleep_us = 0;
+static uint32_t touch_redraws = 0;
+static uint32_t touch_latency_us = 0;
+static uint32_t touch_latency_max_us = 0;
+
+static void touch_redraw_cb(lv_event_t *e)
+{
+  uint32_t irq = touch_irq_us;
+  if (!irq)
+    return;
+  touch_irq_us = 0;
+  uint32_t latency = micros() - irq;
+  if (latency < 1000000) // older presses did not change the screen
+  {
+    touch_redraws++;
+    touch_latency_us += latency;
+    if (latency > touch_latency_max_us)
+      touch_latency_max_us = latency;
+  }
 }
 
+static void loop_stats_cb(lv_timer_t *timer)
+{
+  uint32_t elapsed = micros() - stats_start_us;
+  uint32_t busy = (uint32_t)((uint64_t)(elapsed - loop_sleep_us) * 1000 / elapsed);
+  Serial.printf("%s loop: %lu wakeups/s, busy %lu.%lu%%, touch-to-redraw avg %lu us, max %lu us (%lu)\n",
+                DEMO_TICKLESS ? "tickless" : "fixed", (unsigned long)(loop_wakeups * 1000000ULL / elapsed),
+                (unsigned long)(busy / 10), (unsigned long)(busy % 10),
+                (unsigned long)(touch_redraws ? touch_latency_us / touch_redraws : 0),
+                (unsigned long)touch_latency_max_us, (unsigned long)touch_redraws);
+  stats_start_us += elapsed;
+  loop_wakeups = 0;
+  loop_sleep_us = 0;
+  touch_redraws = 0;
+  touch_latency_us = 0;
+  touch_latency_max_us = 0;
+}
+#endif
+
+// Sleeps up to ms; true when a touch cut it short
+static bool loop_sleep(uint32_t ms)
+{
+#ifdef DEMO_LOOP_STATS
+  uint32_t start = micros();
+#endif
+#if DEMO_TICKLESS
+  bool touched = xSemaphoreTake(touch_wake, pdMS_TO_TICKS(ms)) == pdTRUE;
+#else
+  delay(ms);
+  bool touched = false;
+#endif
+#ifdef DEMO_LOOP_STATS
+  loop_sleep_us += micros() - start;
+  loop_wakeups++;
+#endif
+  return touched;
+}
+
+#if DEMO_TOUCH_TASK
+// Samples arrive filtered and calibrated; LVGL gets one per read and reads
+// again while more are queued
+void my_touchpad_read(lv_indev_t *indev, lv_indev_data_t *data)
+{
+  PROF_BEGIN(PROF_TOUCH_READ);
+  static touch_sample_t last = {0, 0, false, 0};
+  touch_sample_t sample;
+  if (touch_input_read(&sample))
+  {
+    if (sample.irq_us)
+    {
+      touch_irq_us = sample.irq_us;
+#ifdef DEMO_TOUCH_STATS
+      press_irq_us = sample.irq_us;
+#endif
+    }
+    last = sample;
+    data->continue_reading = touch_input_pending();
+  }
+  data->point.x = LV_CLAMP(0, last.x, screenWidth - 1);
+  data->point.y = LV_CLAMP(0, last.y, screenHeight - 1);
+  data->state = last.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+#if DEMO_TICKLESS
+  // Nothing to poll until the sampler has more
+  if (!last.pressed && !data->continue_reading)
+    lv_timer_pause(lv_indev_get_read_timer(indev));
+#endif
+  PROF_END(PROF_TOUCH_READ);
+}
+#else
 void my_touchpad_read(lv_indev_t *indev, lv_indev_data_t *data)
 {
+  PROF_BEGIN(PROF_TOUCH_READ);
   if (touchscreen.touched())
   {
     TS_Point p = touchscreen.getPoint();
@@ -77,122 +543,731 @@ void my_touchpad_read(lv_indev_t *indev, lv_indev_data_t *data)
   else
   {
     data->state = LV_INDEV_STATE_RELEASED;
+#if DEMO_TICKLESS
+    // Nothing to poll until the next touch IRQ
+    lv_timer_pause(lv_indev_get_read_timer(indev));
+#endif
   }
+  PROF_END(PROF_TOUCH_READ);
+}
+#endif
+
+#if DEMO_IMAGE_CACHE && defined(DEMO_IMAGE_STATS)
+// Decoded-image cache counters, printed every 10 s
+static void image_stats_cb(lv_timer_t *timer)
+{
+  packed_image_stats_t stats;
+  packed_image_get_stats(&stats);
+  Serial.printf("images: %lu hits, %lu misses, %lu evictions, %lu not cached, %lu us per decode, "
+                "%lu bytes cached\n",
+                (unsigned long)stats.hits, (unsigned long)stats.misses, (unsigned long)stats.evictions,
+                (unsigned long)stats.uncached, (unsigned long)(stats.misses ? stats.decode_us / stats.misses : 0), (unsigned long)stats.cached_bytes);
 }
+#endif
+
+#if DEMO_ICON_CACHE && defined(DEMO_ICON_STATS)
+// PNG / JPEG cache counters against its budget, printed every 10 s
+static void icon_stats_cb(lv_timer_t *timer)
+{
+  icon_cache_stats_t stats;
+  icon_cache_get_stats(&stats);
+  uint32_t opens = stats.hits + stats.misses;
+  Serial.printf("icons: %lu%% of %lu opens hit, %lu evictions, %lu not cached, %lu us per decode, "
+                "%lu bytes of %lu cached (peak %lu)\n",
+                (unsigned long)(opens ? stats.hits * 100ULL / opens : 0), (unsigned long)opens,
+                (unsigned long)stats.evictions, (unsigned long)stats.uncached,
+                (unsigned long)(stats.misses ? stats.decode_us / stats.misses : 0), (unsigned long)stats.cached_bytes,
+                (unsigned long)DEMO_ICON_CACHE, (unsigned long)stats.peak_bytes);
+}
+#endif
+
+// Placeholder forecast until real data is fetched
+static void forecast_fill()
+{
+  LV_IMG_DECLARE(icon_partly_cloudy);
+  for (int icon = 0; icon < WEATHER_ICONS; icon++)
+    forecast_icons[icon] = &icon_partly_cloudy;
+
+  for (int row = 0; row < DEMO_FORECAST_ROWS; row++)
+  {
+    if (DEMO_FORECAST_ROWS <= 7)
+      lv_snprintf(forecast[row].when, sizeof(forecast[row].when), "Day %d", row + 1);
+    else
+      lv_snprintf(forecast[row].when, sizeof(forecast[row].when), "%02d:00", row % 24);
+    forecast[row].temp = 60 + (row * 7) % 40;
+    forecast[row].precip = (row * 13) % 100;
+    forecast[row].icon = WEATHER_ICON_PARTLY_CLOUDY;
+  }
+
+#ifdef DEMO_RENDER_BENCH
+  uint32_t heap_before = ESP.getFreeHeap();
+#endif
+  forecast_list_attach(objects.temperature_grid, forecast_icons);
+  forecast_list_set_rows(objects.temperature_grid, forecast, DEMO_FORECAST_ROWS);
+#ifdef DEMO_RENDER_BENCH
+  forecast_heap = heap_before - ESP.getFreeHeap();
+#endif
+}
+
+#if DEMO_FAST_BOOT && !defined(DEMO_RENDER_BENCH)
+static void forecast_fill_cb(lv_timer_t *timer)
+{
+  forecast_fill();
+  BOOT_MARK("forecast rows");
+}
+#endif
+
+#ifdef DEMO_WEATHER
+// Shows a forecast the fetch task has finished. The rows and the current
+// conditions change in the same pass, before LVGL renders, so no frame
+// mixes the old forecast with the new one.
+static bool weather_tick()
+{
+  weather_model_t *model = weather_fetch_take();
+  if (!model)
+    return false;
+
+  // The rows and the current conditions have WMO weather codes; the
+  // icons of the rows' kinds of weather came with them
+  for (uint8_t icon = 0; icon < WEATHER_ICONS; icon++)
+  {
+    if (weather_icon_src(icon))
+      forecast_icons[icon] = weather_icon_src(icon);
+  }
+  for (uint16_t row = 0; row < model->count; row++)
+    model->rows[row].icon = weather_icon_of(model->rows[row].icon);
+  bind_set_int(VAR_TEMPERATURE, model->temp);
+  bind_set_int(VAR_FEELS_LIKE, model->feels_like);
+  bind_set_str(VAR_TIME, model->time);
+  bind_set_int(VAR_CONDITIONS, weather_icon_of(model->conditions));
+  forecast_list_set_rows(objects.temperature_grid, model->rows, model->count);
+  return true;
+}
+#endif
 
 void my_setup_ui()
 {
   // Load images
-  LV_IMG_DECLARE(icon_partly_cloudy);
+  LV_IMG_DECLARE(image_partly_cloudy_flat);
+
+  // Current conditions, bound to native variables. VAR_CONDITIONS is the
+  // kind of weather (weather_icons.h); the partly cloudy image, flattened
+  // onto the screen gradient by tools/pack_images.py, is the only one the
+  // project has so far and stands in for every kind.
+  static const lv_image_dsc_t *condition_images[WEATHER_ICONS];
+  for (int icon = 0; icon < WEATHER_ICONS; icon++)
+    condition_images[icon] = &image_partly_cloudy_flat;
+  bind_var(VAR_TEMPERATURE, BIND_INT);
+  bind_var(VAR_FEELS_LIKE, BIND_INT);
+  bind_var(VAR_TIME, BIND_STR);
+  bind_var(VAR_CONDITIONS, BIND_IMAGE);
+  bind_label(objects.current_temperature_label, VAR_TEMPERATURE, "%s°F");
+  bind_label(objects.feels_temperature_label, VAR_FEELS_LIKE, "%s°F");
+  bind_label(objects.current_time_label, VAR_TIME);
+  bind_image(objects.current_conditions_image, VAR_CONDITIONS, condition_images, WEATHER_ICONS);
+
+  // Placeholder conditions until real data is fetched
+  bind_set_int(VAR_TEMPERATURE, 72);
+  bind_set_int(VAR_FEELS_LIKE, 75);
+  bind_set_str(VAR_TIME, "12:24pm");
+  bind_set_int(VAR_CONDITIONS, WEATHER_ICON_PARTLY_CLOUDY);
+
+#if DEMO_FAST_BOOT && !defined(DEMO_RENDER_BENCH)
+  // One LVGL timer pass after the first frame; the render bench needs the
+  // rows right away
+  lv_timer_t *timer = lv_timer_create(forecast_fill_cb, 0, NULL);
+  lv_timer_set_repeat_count(timer, 1);
+#else
+  forecast_fill();
+#endif
+
+  bind_tick();
+}
+
+#ifdef DEMO_RENDER_BENCH
+// Screen set for comparing one draw unit with two (-D LV_DRAW_SW_DRAW_UNIT_CNT=1).
+// Apart from the main screen every screen is made of separate, non-overlapping
+// widgets, so the draw tasks of one buffer can go to different units.
+static lv_obj_t *bench_screen_fill()
+{
+  lv_obj_t *scr = lv_obj_create(NULL);
+  for (int i = 0; i < 12; i++)
+  {
+    lv_obj_t *box = lv_obj_create(scr);
+    lv_obj_set_size(box, 76, 76);
+    lv_obj_set_pos(box, (i % 4) * 80 + 2, (i / 4) * 80 + 2);
+    lv_obj_set_style_radius(box, 12, 0);
+    lv_obj_set_style_border_width(box, 3, 0);
+    lv_obj_set_style_bg_color(box, lv_palette_main((lv_palette_t)i), 0);
+    lv_obj_set_style_bg_grad_color(box, lv_palette_darken((lv_palette_t)i, 3), 0);
+    lv_obj_set_style_bg_grad_dir(box, LV_GRAD_DIR_VER, 0);
+  }
+  return scr;
+}
+
+static lv_obj_t *bench_screen_text()
+{
+  lv_obj_t *scr = lv_obj_create(NULL);
+  for (int i = 0; i < 24; i++)
+  {
+    lv_obj_t *label = lv_label_create(scr);
+    lv_label_set_text_fmt(label, "Day %d  99°F  10%%", i + 1);
+    lv_obj_set_pos(label, (i % 2) * 160 + 4, (i / 2) * 20);
+  }
+  return scr;
+}
+
+static lv_obj_t *bench_screen_images()
+{
   LV_IMG_DECLARE(image_partly_cloudy);
 
-  // Set the current conditions image to the partly cloudy image
+  lv_obj_t *scr = lv_obj_create(NULL);
+  for (int i = 0; i < 6; i++)
+  {
+    lv_obj_t *image = lv_image_create(scr);
+    lv_image_set_src(image, &image_partly_cloudy);
+    lv_obj_set_pos(image, (i % 3) * 106 + 3, (i / 3) * 110 + 10);
+  }
+  return scr;
+}
+
+// Redraws of `dirty` on one screen, the whole screen unless given; render
+// time is the frame minus the time spent handing buffers to the display
+static void bench_run(lv_display_t *display, const char *name, lv_obj_t *scr, lv_obj_t *dirty = NULL)
+{
+  const uint32_t frames = 20;
+  lv_screen_load(scr);
+  lv_refr_now(display);
+
+  uint32_t flush0 = flush_us, wait0 = wait_us;
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < frames; i++)
+  {
+    lv_obj_invalidate(dirty ? dirty : scr);
+    lv_refr_now(display);
+  }
+  uint32_t frame = (micros() - start) / frames;
+  uint32_t display_us = (flush_us - flush0 + wait_us - wait0) / frames;
+
+  Serial.printf("bench %-6s %d draw unit(s): render %lu us/frame, frame %lu us\n", name, LV_DRAW_SW_DRAW_UNIT_CNT,
+                (unsigned long)(frame > display_us ? frame - display_us : 0), (unsigned long)frame);
+}
+
+// Scrolls the forecast list from top to bottom in half-row steps, one
+// frame per step
+static void bench_scroll(lv_display_t *display)
+{
+  lv_obj_t *list = objects.temperature_grid;
+  Serial.printf("bench list   %d rows: %lu objects, %lu bytes of heap\n", DEMO_FORECAST_ROWS,
+                (unsigned long)lv_obj_get_child_count(list), (unsigned long)forecast_heap);
+
+  lv_screen_load(objects.main);
+  lv_obj_scroll_to_y(list, 0, LV_ANIM_OFF);
+  lv_refr_now(display);
+  int32_t end = lv_obj_get_scroll_bottom(list);
+  if (end <= 0)
+    return;  // everything fits, nothing to scroll
+
+  uint32_t frames = 0;
+  uint32_t flush0 = flush_us, wait0 = wait_us;
+  uint32_t start = micros();
+  for (int32_t y = FORECAST_LIST_ROW_HEIGHT / 2; y <= end; y += FORECAST_LIST_ROW_HEIGHT / 2, frames++)
+  {
+    lv_obj_scroll_to_y(list, y, LV_ANIM_OFF);
+    lv_refr_now(display);
+  }
+  uint32_t frame = (micros() - start) / frames;
+  uint32_t display_us = (flush_us - flush0 + wait_us - wait0) / frames;
+  lv_obj_scroll_to_y(list, 0, LV_ANIM_OFF);
+
+  Serial.printf("bench scroll %d rows: render %lu us/frame, frame %lu us over %lu frames\n", DEMO_FORECAST_ROWS,
+                (unsigned long)(frame > display_us ? frame - display_us : 0), (unsigned long)frame,
+                (unsigned long)frames);
+}
+
+static void bench_run_all(lv_display_t *display)
+{
+  lv_obj_t *screens[] = {bench_screen_fill(), bench_screen_text(), bench_screen_images()};
+  const char *names[] = {"fill", "text", "images"};
+
+  bench_run(display, "main", objects.main);
+  for (int i = 0; i < 3; i++)
+  {
+    bench_run(display, names[i], screens[i]);
+  }
+
+  // Current conditions region with the alpha image blended over the
+  // gradient, then with the flattened one
+  LV_IMG_DECLARE(image_partly_cloudy);
+  LV_IMG_DECLARE(image_partly_cloudy_flat);
   lv_image_set_src(objects.current_conditions_image, &image_partly_cloudy);
+  bench_run(display, "alpha", objects.main, objects.current_conditions_image);
+  lv_image_set_src(objects.current_conditions_image, &image_partly_cloudy_flat);
+  bench_run(display, "flat", objects.main, objects.current_conditions_image);
 
-  static const int32_t col_widths[] = {60, 30, 30, 35, LV_GRID_TEMPLATE_LAST};
-  static const int32_t row_heights[] = {20, 20, 20, 20, 20, 20, 20, LV_GRID_TEMPLATE_LAST};
+  bench_scroll(display);
 
-  lv_obj_set_style_grid_column_dsc_array(objects.temperature_grid, col_widths, 0);
-  lv_obj_set_style_grid_row_dsc_array(objects.temperature_grid, row_heights, 0);
-  lv_obj_set_layout(objects.temperature_grid, LV_LAYOUT_GRID);
+  loadScreen(SCREEN_ID_MAIN);
+  for (int i = 0; i < 3; i++)
+  {
+    lv_obj_delete(screens[i]);
+  }
+}
+#endif
 
-  // Set up the 7-day forecast grid
-  for (int row = 0; row < 7; row++)
+#if defined(DEMO_SD) && defined(DEMO_SD_BENCH)
+// Opens SD_BENCH_IMAGE the way LVGL does before every draw of a file image
+// (finds its decoder, which reads the header), then draws it; cold empties
+// the read-ahead windows before each. Draw time leaves out the flush.
+static void sd_bench_run(lv_display_t *display, lv_obj_t *scr, const char *name, bool cold)
+{
+  const uint32_t rounds = 10;
+  uint32_t open_us = 0, draw_us = 0;
+  sd_cache_clear_stats();
+  for (uint32_t i = 0; i < rounds; i++)
+  {
+    lv_image_header_t header;
+    if (cold)
+      sd_cache_drop();
+    uint32_t start = micros();
+    if (lv_image_decoder_get_info(SD_BENCH_IMAGE, &header) != LV_RESULT_OK)
+    {
+      Serial.println("sd bench: no " SD_BENCH_IMAGE);
+      return;
+    }
+    open_us += micros() - start;
+
+    if (cold)
+      sd_cache_drop();
+    uint32_t flush0 = flush_us, wait0 = wait_us;
+    start = micros();
+    lv_obj_invalidate(scr);
+    lv_refr_now(display);
+    draw_us += micros() - start - (flush_us - flush0 + wait_us - wait0);
+  }
+
+  sd_cache_stats_t stats;
+  sd_cache_get_stats(&stats);
+  Serial.printf("sd bench %s: open %lu us, draw %lu us; %lu card reads, %lu bytes, %lu us on the card per round\n", name,
+                (unsigned long)(open_us / rounds), (unsigned long)(draw_us / rounds),
+                (unsigned long)(stats.card_reads / rounds), (unsigned long)(stats.card_bytes / rounds),
+                (unsigned long)(stats.card_us / rounds));
+}
+
+static void sd_bench(lv_display_t *display)
+{
+  lv_obj_t *scr = lv_obj_create(NULL);
+  lv_obj_t *image = lv_image_create(scr);
+  lv_image_set_src(image, SD_BENCH_IMAGE);
+  lv_screen_load(scr);
+  lv_refr_now(display);
+
+  sd_bench_run(display, scr, "cold", true);
+  sd_bench_run(display, scr, "warm", false);
+
+  loadScreen(SCREEN_ID_MAIN);
+  lv_obj_delete(scr);
+}
+#endif
+
+#ifdef DEMO_BIND_BENCH
+// A 50-label dashboard with 5% of its values changing per second, run for
+// 10 s of simulated 33 ms ticks: bound through bindings.cpp, then with
+// every label set on every tick as application code tends to do
+#define BIND_BENCH_WIDGETS 50
+#define BIND_BENCH_TICK_MS 33
+#define BIND_BENCH_TICKS (10 * 1000 / BIND_BENCH_TICK_MS)
+#define BIND_BENCH_CHANGE_MS (1000 * 100 / (5 * BIND_BENCH_WIDGETS))
+
+static uint32_t bind_bench_px = 0;  // pixels invalidated
+
+static void bind_bench_invalidate_cb(lv_event_t *e)
+{
+  bind_bench_px += lv_area_get_size((const lv_area_t *)lv_event_get_param(e));
+}
+
+static void bind_bench_run(lv_display_t *display, bool bound)
+{
+  lv_obj_t *scr = lv_obj_create(NULL);
+  lv_obj_t *labels[BIND_BENCH_WIDGETS];
+  int32_t values[BIND_BENCH_WIDGETS];
+  for (int i = 0; i < BIND_BENCH_WIDGETS; i++)
+  {
+    labels[i] = lv_label_create(scr);
+    lv_obj_set_size(labels[i], 60, 20);
+    lv_obj_set_pos(labels[i], (i % 5) * 64, (i / 5) * 24);
+    values[i] = i * 10;
+    if (bound)
+    {
+      bind_var(VAR_COUNT + i, BIND_FIXED, 1);
+      bind_set_int(VAR_COUNT + i, values[i]);
+      bind_label(labels[i], VAR_COUNT + i);
+    }
+    else
+    {
+      lv_label_set_text_fmt(labels[i], "%ld.%ld", (long)(values[i] / 10), (long)(values[i] % 10));
+    }
+  }
+  bind_tick();
+  lv_screen_load(scr);
+  lv_refr_now(display);
+
+  uint32_t changes = 0;
+  uint32_t cpu_us = 0;
+  uint32_t flush0 = flush_us, wait0 = wait_us;
+  bind_bench_px = 0;
+  for (uint32_t tick = 0; tick < BIND_BENCH_TICKS; tick++)
+  {
+    uint32_t start = micros();
+    if (tick * BIND_BENCH_TICK_MS >= changes * BIND_BENCH_CHANGE_MS)
+    {
+      int i = (changes * 17) % BIND_BENCH_WIDGETS;
+      values[i] += 7;
+      if (bound)
+        bind_set_int(VAR_COUNT + i, values[i]);
+      changes++;
+    }
+    if (bound)
+    {
+      bind_tick();
+    }
+    else
+    {
+      for (int i = 0; i < BIND_BENCH_WIDGETS; i++)
+        lv_label_set_text_fmt(labels[i], "%ld.%ld", (long)(values[i] / 10), (long)(values[i] % 10));
+    }
+    lv_refr_now(display);
+    cpu_us += micros() - start;
+  }
+  uint32_t display_us = flush_us - flush0 + wait_us - wait0;
+
+  Serial.printf("bind %-5s: %lu us/tick without display, %lu px invalidated/tick, %lu changes\n",
+                bound ? "bound" : "all", (unsigned long)((cpu_us > display_us ? cpu_us - display_us : 0) / BIND_BENCH_TICKS),
+                (unsigned long)(bind_bench_px / BIND_BENCH_TICKS), (unsigned long)changes);
+  loadScreen(SCREEN_ID_MAIN);
+  lv_obj_delete(scr);  // unbinds the labels
+}
+
+static void bind_bench(lv_display_t *display)
+{
+  lv_display_add_event_cb(display, bind_bench_invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+  bind_bench_run(display, false);
+  bind_bench_run(display, true);
+  lv_display_remove_event_cb_with_user_data(display, bind_bench_invalidate_cb, NULL);
+}
+#endif
+
+#if DEMO_TOUCH_TASK && defined(DEMO_TOUCH_CALIBRATE)
+// Three-point calibration: touch each square, the transform goes to NVS
+static void touch_calibrate(lv_display_t *display)
+{
+  static const int16_t targets[3][2] = {{32, 24}, {288, 120}, {160, 216}};
+  int16_t raw[3][2];
+
+  lv_obj_t *scr = lv_obj_create(NULL);
+  lv_obj_t *label = lv_label_create(scr);
+  lv_label_set_text(label, "Touch the red square");
+  lv_obj_center(label);
+  lv_obj_t *mark = lv_obj_create(scr);
+  lv_obj_set_size(mark, 9, 9);
+  lv_obj_set_style_radius(mark, 0, 0);
+  lv_obj_set_style_bg_color(mark, lv_palette_main(LV_PALETTE_RED), 0);
+  lv_screen_load(scr);
+
+  touch_input_set_raw(true);
+  for (int i = 0; i < 3; i++)
   {
-    // Create date/time label
-    int col = 0;
-    forecast_datetime_label[row] = lv_label_create(objects.temperature_grid);
-    auto date = "Day " + String(row + 1);
-    lv_label_set_text(forecast_datetime_label[row], date.c_str());
-    lv_obj_set_style_text_align(forecast_datetime_label[row], LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_set_grid_cell(forecast_datetime_label[row], LV_GRID_ALIGN_CENTER, col, 1, LV_GRID_ALIGN_CENTER, row, 1);
+    lv_obj_set_pos(mark, targets[i][0] - 4, targets[i][1] - 4);
+    lv_refr_now(display);
 
-    // Create visibility image
-    ++col;
-    forecast_visibility_image[row] = lv_img_create(objects.temperature_grid);
-    lv_img_set_src(forecast_visibility_image[row], &icon_partly_cloudy);
-    lv_obj_set_grid_cell(forecast_visibility_image[row], LV_GRID_ALIGN_CENTER, col, 1, LV_GRID_ALIGN_CENTER, row, 1);
+    // The last filtered point before the release
+    touch_sample_t sample;
+    bool down = false;
+    for (;;)
+    {
+      if (!touch_input_read(&sample))
+      {
+        delay(5);
+        continue;
+      }
+      if (!sample.pressed && down)
+        break;
+      if (sample.pressed)
+      {
+        raw[i][0] = sample.x;
+        raw[i][1] = sample.y;
+        down = true;
+      }
+    }
+  }
+  touch_input_set_raw(false);
 
-    // Create precipitation low label
-    ++col;
-    forecast_precip_low_label[row] = lv_label_create(objects.temperature_grid);
-    lv_label_set_text(forecast_precip_low_label[row], "10%");
-    lv_obj_set_style_text_align(forecast_precip_low_label[row], LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_set_grid_cell(forecast_precip_low_label[row], LV_GRID_ALIGN_CENTER, col, 1, LV_GRID_ALIGN_CENTER, row, 1);
+  touch_calibration_t calibration;
+  if (touch_input_solve(raw, targets, &calibration))
+  {
+    touch_input_set_calibration(&calibration, true);
+    Serial.printf("Touch calibration saved: x = %f x + %f y + %f, y = %f x + %f y + %f\n", calibration.a, calibration.b,
+                  calibration.c, calibration.d, calibration.e, calibration.f);
+  }
+  else
+  {
+    Serial.println("Touch calibration failed, points are collinear");
+  }
+  loadScreen(SCREEN_ID_MAIN);
+  lv_obj_delete(scr);
+}
+#endif
 
-    // Create temperature label
-    ++col;
-    forecast_temp_label[row] = lv_label_create(objects.temperature_grid);
-    lv_label_set_text(forecast_temp_label[row], "99°F");
-    lv_obj_set_style_text_align(forecast_temp_label[row], LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_set_grid_cell(forecast_temp_label[row], LV_GRID_ALIGN_CENTER, col, 1, LV_GRID_ALIGN_CENTER, row, 1);
+#ifdef DEMO_UI_TABLE_BENCH
+// The screen built and deleted again, by its generated create function and
+// from the table; objects.* is put back afterwards
+#define UI_TABLE_BENCH_ROUNDS 20
+
+static void ui_table_bench()
+{
+  objects_t shown = objects;
+  uint32_t code_us = 0, table_us = 0, code_heap = 0, table_heap = 0;
+  for (int round = 0; round < UI_TABLE_BENCH_ROUNDS; round++)
+  {
+    uint32_t heap = ESP.getFreeHeap();
+    uint32_t start = micros();
+    create_screen_main();
+    code_us += micros() - start;
+    code_heap = heap - ESP.getFreeHeap();
+    lv_obj_delete(objects.main);
+
+    heap = ESP.getFreeHeap();
+    start = micros();
+    lv_obj_t *screen = ui_table_create_screen(&ui_table, SCREEN_ID_MAIN - 1);
+    table_us += micros() - start;
+    table_heap = heap - ESP.getFreeHeap();
+    lv_obj_delete(screen);
   }
+  objects = shown;
+  Serial.printf("Main screen built by code %lu us, from the table %lu us; heap %lu / %lu bytes\n",
+                (unsigned long)(code_us / UI_TABLE_BENCH_ROUNDS), (unsigned long)(table_us / UI_TABLE_BENCH_ROUNDS),
+                (unsigned long)code_heap, (unsigned long)table_heap);
 }
+#endif
 
 void setup()
 {
   Serial.begin(115200);
   Serial.println("EEZ Studio LVGL Demo Starting...");
-
-  String LVGL_Arduino = String("LVGL Library Version: ") + lv_version_major() + "." + lv_version_minor() + "." + lv_version_patch();
-  Serial.println(LVGL_Arduino);
-
+  Serial.printf("LVGL Library Version: %d.%d.%d\n", lv_version_major(), lv_version_minor(), lv_version_patch());
   Serial.println("In setup()");
+  BOOT_MARK("serial");
 
   // Initialize TFT display hardware
   tft.init();
   tft.setRotation(2);
   pinMode(LCD_BACKLIGHT_PIN, OUTPUT);
+#if DEMO_FAST_BOOT
+  // Backlight on only once the splash is there, so the panel's power-on
+  // contents are never seen
+  tft.fillRectVGradient(0, 0, tft.width(), tft.height(),
+                        tft.color565(SPLASH_RGB >> 16, (SPLASH_RGB >> 8) & 0xFF, SPLASH_RGB & 0xFF),
+                        tft.color565(SPLASH_GRAD_RGB >> 16, (SPLASH_GRAD_RGB >> 8) & 0xFF, SPLASH_GRAD_RGB & 0xFF));
+  BOOT_FIRST_PIXEL();
+#endif
   digitalWrite(LCD_BACKLIGHT_PIN, HIGH); // Turn on backlight
+  tft.setSwapBytes(false); // LVGL renders the panel's byte order already
+#if DEMO_FLUSH_DMA
+  tft.initDMA();
+  tft.startWrite(); // the display keeps its SPI bus, touch is on VSPI
+#endif
+  BOOT_MARK("tft.init");
 
   // Initialize the touchscreen
+#ifndef DEMO_SD
   touchscreenSpi.begin(XPT2046_CLK, XPT2046_MISO, XPT2046_MOSI, XPT2046_CS); // Start second SPI bus for touchscreen
+#endif
+#if !DEMO_TOUCH_TASK
   touchscreen.begin(touchscreenSpi);                                         // Touchscreen init
   touchscreen.setRotation(1);                                                // Inverted landscape orientation to match screen
+#endif
+
+  BOOT_MARK("touch");
 
   // Initialize LVGL
   lv_init();
   lv_log_register_print_cb(my_log_print);
+#if DEMO_TICKLESS
+  lv_tick_set_cb(my_tick);
+#endif
+#if DEMO_IMAGE_CACHE
+  packed_image_init(DEMO_IMAGE_CACHE);
+#endif
+#if DEMO_IMAGE_CACHE && defined(DEMO_IMAGE_STATS)
+  lv_timer_create(image_stats_cb, 10000, NULL);
+#endif
+#if DEMO_ICON_CACHE
+  icon_cache_init(DEMO_ICON_CACHE, ICON_RGB565);
+#endif
+#if DEMO_ICON_CACHE && defined(DEMO_ICON_STATS)
+  lv_timer_create(icon_stats_cb, 10000, NULL);
+#endif
 
   // Create display (LVGL 9.x API)
   lv_display_t *display = lv_display_create(screenWidth, screenHeight);
 
   // Set display buffer with double buffering for smoother refresh
+  lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565_SWAPPED);
   lv_display_set_buffers(display, buf1, buf2, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
 
   // Set display flush callback
   lv_display_set_flush_cb(display, my_disp_flush);
+#ifdef PROFILER
+  prof_init(prof_probes, sizeof(prof_probes) / sizeof(prof_probes[0]));
+  lv_display_add_event_cb(display, prof_render_cb, LV_EVENT_RENDER_START, NULL);
+  lv_display_add_event_cb(display, prof_render_cb, LV_EVENT_RENDER_READY, NULL);
+#endif
+#if DEMO_FLUSH_TASK || DEMO_FLUSH_DMA
+  lv_display_set_flush_wait_cb(display, my_flush_wait);
+#endif
+#if DEMO_FLUSH_TASK
+  // Flush on the core loop() does not run on
+  flush_queue = xQueueCreate(1, sizeof(flush_job_t));
+  flush_done = xSemaphoreCreateBinary();
+  xTaskCreatePinnedToCore(flush_task, "flush", 4096, NULL, 2, NULL, xPortGetCoreID() ^ 1);
+#endif
 
   // Set up touch input device
   lv_indev_t *indev_touchpad = lv_indev_create();
   lv_indev_set_type(indev_touchpad, LV_INDEV_TYPE_POINTER);
   lv_indev_set_read_cb(indev_touchpad, my_touchpad_read);
 
+  // Touch IRQ: wakes loop() in tickless mode, timestamps the press for the stats
+  touch_read_timer = lv_indev_get_read_timer(indev_touchpad);
+  touch_wake = xSemaphoreCreateBinary();
+#ifdef DEMO_SD
+  // VSPI goes to the card instead, touch is sampled on its pins by hand
+  sd_fs_begin(touchscreenSpi, 'S');
+  sd_image_init();
+  touch_on = touch_input_begin_pins(XPT2046_CLK, XPT2046_MOSI, XPT2046_MISO, XPT2046_CS, XPT2046_IRQ, touch_sampled);
+#elif DEMO_TOUCH_TASK
+  touch_on = touch_input_begin(touchscreenSpi, XPT2046_CS, XPT2046_IRQ, touch_sampled);
+#endif
+#if DEMO_TOUCH_TASK
+  // Without the sampler task there is no touch input; the screens still run
+  if (!touch_on)
+    Serial.println("Touch sampler task did not start, touch is off");
+#else
+  pinMode(XPT2046_IRQ, INPUT);
+  attachInterrupt(digitalPinToInterrupt(XPT2046_IRQ), touch_irq, FALLING);
+#endif
+#ifdef DEMO_TOUCH_STATS
+  lv_indev_add_event_cb(indev_touchpad, touch_pressed_cb, LV_EVENT_PRESSED, NULL);
+  lv_timer_create(touch_stats_cb, 10000, NULL);
+#endif
+#ifdef DEMO_LOOP_STATS
+  lv_display_add_event_cb(display, touch_redraw_cb, LV_EVENT_RENDER_READY, NULL);
+  lv_timer_create(loop_stats_cb, 5000, NULL);
+  stats_start_us = micros();
+#endif
+
+  BOOT_MARK("lv_init, display");
+
   // Initialize EEZ Studio generated UI
+#if DEMO_UI_TABLE
+  ui_table_init(&ui_table);
+#else
   ui_init();
+#endif
+
+  BOOT_MARK("ui_init");
 
   // Set up custom UI elements
   my_setup_ui();
+  BOOT_MARK("my_setup_ui");
+#ifdef DEMO_WEATHER
+  weather_fetch_begin(DEMO_WIFI_SSID, DEMO_WIFI_PASSWORD, DEMO_WEATHER_URL, DEMO_ICON_URL, weather,
+                      DEMO_FORECAST_ROWS > 7, DEMO_WEATHER_INTERVAL_S * 1000UL);
+#endif
+#if DEMO_TOUCH_TASK && defined(DEMO_TOUCH_CALIBRATE)
+  if (touch_on)
+    touch_calibrate(display);
+#endif
+#ifdef DEMO_RENDER_BENCH
+  bench_run_all(display);
+#endif
+#ifdef DEMO_BIND_BENCH
+  bind_bench(display);
+#endif
+#ifdef DEMO_UI_TABLE_BENCH
+  ui_table_bench();
+#endif
+#if defined(DEMO_SD) && defined(DEMO_SD_BENCH)
+  sd_bench(display);
+#endif
+#ifdef DEMO_FPS_TEST
+  fps_test_start(display);
+#endif
 
   Serial.println("UI initialized and ready!");
 
   // Force initial screen refresh
   lv_refr_now(display);
+  BOOT_MARK("first frame");
 
   Serial.println("Setup complete!");
 }
 
 void loop()
 {
+  PROF_BEGIN(PROF_LOOP);
+  PROF_BEGIN(PROF_TIMER_HANDLER);
+#if DEMO_TICKLESS
+  // Handle LVGL tasks; returns how long until the next one is due
+  uint32_t idle_ms = lv_timer_handler();
+#else
   // CRITICAL: Tell LVGL how much time has passed
   lv_tick_inc(3); // 3ms matches our delay below for faster refresh
 
   // Handle LVGL tasks
   lv_timer_handler();
+#endif
+  PROF_END(PROF_TIMER_HANDLER);
+  BOOT_INTERACTIVE(); // input has been read and handled once
 
-  // Handle EEZ Studio UI updates
+  // Handle EEZ Studio UI updates. ui_tick() changes objects outside
+  // lv_timer_handler(), so it takes the lock lv_timer_handler() renders under
+  lv_lock();
+  PROF_BEGIN(PROF_UI_TICK);
   ui_tick();
+#if defined(DEMO_WEATHER) && DEMO_TICKLESS
+  if (weather_tick())
+    idle_ms = 0; // the new rows are drawn now too
+#elif defined(DEMO_WEATHER)
+  weather_tick();
+#endif
+#if DEMO_TICKLESS
+  if (bind_tick())
+    idle_ms = 0; // redraw the widgets whose variables changed now, not after the sleep
+#else
+  bind_tick();
+#endif
+  PROF_END(PROF_UI_TICK);
+  lv_unlock();
+  PROF_END(PROF_LOOP);
+#ifdef PROFILER
+  prof_serial(); // 'p' arms, 'd' dumps, 'c' clears
+#endif
 
+#if DEMO_TICKLESS
+  // Sleep until LVGL has work again or the panel is touched
+  if (idle_ms > DEMO_MAX_IDLE_MS)
+    idle_ms = DEMO_MAX_IDLE_MS;
+  if (loop_sleep(idle_ms))
+  {
+    // Read the touch right away and keep polling while it is pressed
+    lv_lock();
+    lv_timer_resume(touch_read_timer);
+    lv_timer_ready(touch_read_timer);
+    lv_unlock();
+  }
+#else
   // Small delay to prevent watchdog issues - reduced for faster refresh
-  delay(3);
-}
\ No newline at end of file
+  loop_sleep(3);
+#endif
+}
@@ -0,0 +1,158 @@
+// RLE-packed image decoder and cache, see packed_image.h.
+
+#include <lvgl_private.h>  // lv_image_decoder_dsc_t and lv_draw_buf_t fields
+#include "packed_image.h"
+
+// lv_image_compressed_t in front of the RLE stream: method, compressed
+// size, decompressed size
+#define PACKED_HEADER_SIZE 12
+#define PACKED_METHOD_RLE 1
+
+// Slots hold lv_draw_buf_t, keyed by the lv_image_dsc_t's address. A packed
+// image keeps its own colour format, so all are stored under one format.
+#define PACKED_FORMAT ICON_RGB565
+
+static icon_store_t store;
+static packed_image_stats_t stats;
+// Draw units open images from their own threads
+static lv_mutex_t cache_lock;
+
+static uint32_t read_u32(const uint8_t *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static bool is_packed(lv_image_decoder_dsc_t *dsc) {
+    if (dsc->src_type != LV_IMAGE_SRC_VARIABLE)
+        return false;
+    const lv_image_dsc_t *image = (const lv_image_dsc_t *)dsc->src;
+    return (image->header.flags & LV_IMAGE_FLAGS_COMPRESSED) && image->data_size > PACKED_HEADER_SIZE &&
+           (read_u32(image->data) & 0x0F) == PACKED_METHOD_RLE;
+}
+
+// lv_rle: 0x80 | n and n literal blocks, or n and one block repeated n times
+static bool rle_decode(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len, uint8_t block) {
+    const uint8_t *in_end = in + in_len;
+    const uint8_t *out_end = out + out_len;
+    while (in < in_end) {
+        uint8_t ctrl = *in++;
+        uint32_t bytes = (ctrl & 0x7F) * block;
+        if (out + bytes > out_end)
+            return false;
+        if (ctrl & 0x80) {
+            if (in + bytes > in_end)
+                return false;
+            memcpy(out, in, bytes);
+            in += bytes;
+        } else {
+            if (in + block > in_end)
+                return false;
+            for (uint32_t i = 0; i < bytes; i += block)
+                memcpy(out + i, in, block);
+            in += block;
+        }
+        out += bytes;
+    }
+    return out == out_end;
+}
+
+static lv_draw_buf_t *decode(const lv_image_dsc_t *image) {
+    uint32_t start = micros();
+    uint32_t packed_size = read_u32(image->data + 4);
+    uint32_t size = read_u32(image->data + 8);
+    if (packed_size > image->data_size - PACKED_HEADER_SIZE)
+        return NULL;
+
+    lv_color_format_t cf = (lv_color_format_t)image->header.cf;
+    lv_draw_buf_t *decoded = lv_draw_buf_create(image->header.w, image->header.h, cf, image->header.stride);
+    if (!decoded)
+        return NULL;
+    // Blocks as LVGL's bin decoder takes them: RGB565A8 in 2-byte units over both planes
+    uint8_t block = cf == LV_COLOR_FORMAT_RGB565A8 ? 2 : (lv_color_format_get_bpp(cf) + 7) / 8;
+    if (size > decoded->data_size ||
+        !rle_decode(image->data + PACKED_HEADER_SIZE, packed_size, decoded->data, size, block)) {
+        lv_draw_buf_destroy(decoded);
+        return NULL;
+    }
+    stats.decode_us += micros() - start;
+    return decoded;
+}
+
+static void release(void *decoded) {
+    lv_draw_buf_destroy((lv_draw_buf_t *)decoded);
+}
+
+static lv_result_t packed_info(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc, lv_image_header_t *header) {
+    LV_UNUSED(decoder);
+    if (!is_packed(dsc))
+        return LV_RESULT_INVALID;
+    *header = ((const lv_image_dsc_t *)dsc->src)->header;
+    header->flags &= ~LV_IMAGE_FLAGS_COMPRESSED;  // the draw gets decoded pixels
+    return LV_RESULT_OK;
+}
+
+static lv_result_t packed_open(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+    lv_mutex_lock(&cache_lock);
+
+    icon_slot_t *entry = icon_store_find(&store, dsc->src, NULL, PACKED_FORMAT);
+    if (entry) {
+        stats.hits++;
+    } else {
+        stats.misses++;
+        lv_draw_buf_t *decoded = decode((const lv_image_dsc_t *)dsc->src);
+        if (!decoded) {
+            lv_mutex_unlock(&cache_lock);
+            return LV_RESULT_INVALID;
+        }
+        // Idle images are evicted for the bytes and for a slot alike
+        entry = icon_store_add(&store, dsc->src, NULL, PACKED_FORMAT, decoded, decoded->data_size);
+        if (!entry) {
+            // Too big, or no room while every cached image is in use: this
+            // draw owns it
+            stats.uncached++;
+            dsc->decoded = decoded;
+            dsc->user_data = NULL;
+            lv_mutex_unlock(&cache_lock);
+            return LV_RESULT_OK;
+        }
+    }
+
+    icon_store_use(&store, entry);
+    dsc->decoded = (const lv_draw_buf_t *)entry->decoded;
+    dsc->user_data = entry;
+    lv_mutex_unlock(&cache_lock);
+    return LV_RESULT_OK;
+}
+
+static void packed_close(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+    icon_slot_t *entry = (icon_slot_t *)dsc->user_data;
+    if (!entry) {
+        lv_draw_buf_destroy((lv_draw_buf_t *)dsc->decoded);
+        return;
+    }
+    lv_mutex_lock(&cache_lock);
+    icon_store_done(entry);
+    lv_mutex_unlock(&cache_lock);
+}
+
+void packed_image_init(uint32_t cache_bytes) {
+    icon_store_init(&store, cache_bytes, release);
+    lv_mutex_init(&cache_lock);
+    // Decoders created later are asked first, so this one sees the packed
+    // images before LVGL's bin decoder
+    lv_image_decoder_t *decoder = lv_image_decoder_create();
+    lv_image_decoder_set_info_cb(decoder, packed_info);
+    lv_image_decoder_set_open_cb(decoder, packed_open);
+    lv_image_decoder_set_close_cb(decoder, packed_close);
+}
+
+void packed_image_get_stats(packed_image_stats_t *out) {
+    lv_mutex_lock(&cache_lock);
+    *out = stats;
+    out->evictions = store.evictions;
+    out->cached_bytes = store.cached_bytes;
+    lv_mutex_unlock(&cache_lock);
+}
@@ -0,0 +1,33 @@
+// LVGL image decoder for the RLE-packed images in images_packed.c, with a
+// cache of decoded images.
+//
+// LVGL's own image cache is off (LV_CACHE_DEF_SIZE 0), so LVGL opens an
+// image for every draw. This decoder answers those opens from its own
+// cache: a packed image is decoded once into a draw buffer and kept until
+// the cache needs the room or a slot. Only images no draw is holding are
+// evicted, least recently used first; the slots are an icon_store, as
+// icon_cache's are, and an image that does not fit is decoded for the draw
+// that wants it and freed after it.
+
+#ifndef PACKED_IMAGE_H
+#define PACKED_IMAGE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "icon_store.h"
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;         // decodes
+    uint32_t evictions;
+    uint32_t uncached;       // decodes that did not fit and were freed after the draw
+    uint32_t decode_us;      // total time spent decoding
+    uint32_t cached_bytes;
+} packed_image_stats_t;
+
+// Registers the decoder ahead of LVGL's; cache_bytes bounds the decoded
+// images kept. Call after lv_init().
+void packed_image_init(uint32_t cache_bytes);
+void packed_image_get_stats(packed_image_stats_t *stats);
+
+#endif
@@ -0,0 +1,225 @@
+// Read-ahead cache for files on the SD card, see sd_cache.h.
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "sd_cache.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <time.h>
+
+static uint32_t micros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+}
+#endif
+
+typedef struct {
+    uint32_t key;   // path hash, 0 while the window is empty
+    uint32_t size;  // of the file, with key tells files apart
+    uint32_t start;
+    uint32_t len;
+    uint32_t used;  // clock at the last hit
+    uint8_t *data;
+} window_t;
+
+struct sd_file {
+    int fd;  // -1 while the handle is free
+    uint32_t key;
+    uint32_t size;
+    uint32_t pos;
+    uint32_t fd_pos;  // where the next read() on fd starts
+};
+
+static char root[SD_CACHE_PATH_LEN];
+static sd_file_t files[SD_CACHE_FILES];
+static window_t *windows;
+static uint32_t window_count;
+static uint32_t window_size;
+static uint32_t clock_now = 0;
+static sd_cache_stats_t stats;
+
+// FNV-1a; 0 marks an empty window
+static uint32_t hash(const char *path) {
+    uint32_t h = 2166136261u;
+    while (*path)
+        h = (h ^ (uint8_t)*path++) * 16777619u;
+    return h ? h : 1;
+}
+
+// From the card at pos, timed and counted
+static int32_t card_read(sd_file_t *file, uint32_t pos, void *buf, uint32_t len) {
+    uint32_t start = micros();
+    ssize_t n = -1;
+    if (file->fd_pos == pos || lseek(file->fd, pos, SEEK_SET) == (off_t)pos)
+        n = read(file->fd, buf, len);
+    stats.card_us += micros() - start;
+    stats.card_reads++;
+    if (n < 0) {
+        file->fd_pos = UINT32_MAX;  // unknown, seek again
+        return -1;
+    }
+    stats.card_bytes += n;
+    file->fd_pos = pos + n;
+    return (int32_t)n;
+}
+
+static window_t *find(const sd_file_t *file, uint32_t pos) {
+    for (uint32_t i = 0; i < window_count; i++) {
+        window_t *w = &windows[i];
+        if (w->key == file->key && w->size == file->size && pos >= w->start && pos < w->start + w->len)
+            return w;
+    }
+    return NULL;
+}
+
+// Fills the least recently used window from the sector pos is in
+static window_t *fill(sd_file_t *file, uint32_t pos) {
+    window_t *victim = &windows[0];
+    for (uint32_t i = 1; i < window_count && victim->key; i++) {
+        if (!windows[i].key || windows[i].used < victim->used)
+            victim = &windows[i];
+    }
+    uint32_t start = pos & ~(uint32_t)(SD_CACHE_SECTOR - 1);
+    victim->key = 0;
+    int32_t n = card_read(file, start, victim->data, window_size);
+    stats.misses++;
+    if (n <= (int32_t)(pos - start))
+        return NULL;
+    victim->key = file->key;
+    victim->size = file->size;
+    victim->start = start;
+    victim->len = n;
+    return victim;
+}
+
+bool sd_cache_begin(const char *path, uint32_t count, uint32_t size) {
+    if (strlen(path) >= sizeof(root) || !count || size < SD_CACHE_SECTOR)
+        return false;
+    strcpy(root, path);
+    for (int i = 0; i < SD_CACHE_FILES; i++)
+        files[i].fd = -1;
+    if (windows)
+        free(windows[0].data);
+    free(windows);
+    windows = (window_t *)calloc(count, sizeof(window_t));
+    uint8_t *arena = (uint8_t *)malloc(count * size);
+    if (!windows || !arena) {
+        free(windows);
+        free(arena);
+        windows = NULL;
+        window_count = 0;
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++)
+        windows[i].data = arena + i * size;
+    window_count = count;
+    window_size = size;
+    return true;
+}
+
+sd_file_t *sd_open(const char *path) {
+    sd_file_t *file = NULL;
+    for (int i = 0; i < SD_CACHE_FILES && !file; i++) {
+        if (files[i].fd < 0)
+            file = &files[i];
+    }
+    char full[SD_CACHE_PATH_LEN];
+    if (!file || snprintf(full, sizeof(full), "%s%s", root, path) >= (int)sizeof(full))
+        return NULL;
+
+    int fd = open(full, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return NULL;
+    }
+    file->fd = fd;
+    file->key = hash(path);
+    file->size = (uint32_t)st.st_size;
+    file->pos = 0;
+    file->fd_pos = 0;
+    return file;
+}
+
+void sd_close(sd_file_t *file) {
+    close(file->fd);
+    file->fd = -1;
+}
+
+int32_t sd_read(sd_file_t *file, void *buf, uint32_t len) {
+    if (file->pos >= file->size)
+        return 0;
+    if (len > file->size - file->pos)
+        len = file->size - file->pos;
+
+    uint8_t *out = (uint8_t *)buf;
+    uint32_t done = 0;
+    bool missed = false;
+    while (done < len) {
+        window_t *w = find(file, file->pos);
+        if (!w && len - done >= window_size) {
+            int32_t n = card_read(file, file->pos, out + done, len - done);
+            stats.direct++;
+            if (n <= 0)
+                return n < 0 ? -1 : (int32_t)done;
+            done += n;
+            file->pos += n;
+            missed = true;
+            continue;
+        }
+        if (!w) {
+            w = fill(file, file->pos);
+            if (!w)
+                return done ? (int32_t)done : -1;
+            missed = true;
+        }
+        uint32_t offset = file->pos - w->start;
+        uint32_t n = w->len - offset;
+        if (n > len - done)
+            n = len - done;
+        memcpy(out + done, w->data + offset, n);
+        w->used = ++clock_now;
+        done += n;
+        file->pos += n;
+    }
+    if (!missed)
+        stats.hits++;
+    return (int32_t)done;
+}
+
+bool sd_seek(sd_file_t *file, uint32_t pos) {
+    if (pos > file->size)
+        return false;
+    file->pos = pos;
+    return true;
+}
+
+uint32_t sd_tell(const sd_file_t *file) {
+    return file->pos;
+}
+
+uint32_t sd_size(const sd_file_t *file) {
+    return file->size;
+}
+
+void sd_cache_drop() {
+    for (uint32_t i = 0; i < window_count; i++)
+        windows[i].key = 0;
+}
+
+void sd_cache_get_stats(sd_cache_stats_t *out) {
+    *out = stats;
+}
+
+void sd_cache_clear_stats() {
+    memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,58 @@
+// Read-ahead cache for files on the SD card.
+//
+// Files are read with POSIX open/read/lseek, so the same code runs on the
+// board, where sd_fs mounts the card's FAT volume into the VFS, and on the
+// host, where a directory stands in for the card (host/sd_bench.cpp).
+//
+// A card command costs far more than the bytes it moves, so reads are
+// served from a few windows of window_size bytes each. A miss fills a whole
+// window from the sector the read starts in: an image read row by row then
+// costs one card read per window instead of one per row (8 KB holds 12
+// rows of a 320-pixel RGB565 image). The windows belong to no file handle
+// and stay valid after a close; they are keyed by path and size, so opening
+// an image that was just drawn again costs no card access. The least
+// recently used window is refilled. A read of at least a window that
+// misses goes straight into the caller's buffer.
+//
+// Not thread-safe; sd_fs serializes the LVGL draw units that use it.
+
+#ifndef SD_CACHE_H
+#define SD_CACHE_H
+
+#include <stdint.h>
+
+#define SD_CACHE_FILES 8      // files open at once
+#define SD_CACHE_PATH_LEN 64  // root + path, terminator included
+#define SD_CACHE_SECTOR 512   // windows start on a sector
+
+typedef struct sd_file sd_file_t;
+
+typedef struct {
+    uint32_t hits;          // reads served from the windows alone
+    uint32_t misses;        // window fills
+    uint32_t direct;        // reads that went to the caller's buffer
+    uint32_t card_reads;    // read() calls, fills and direct
+    uint32_t card_bytes;
+    uint32_t card_us;       // time spent in them
+} sd_cache_stats_t;
+
+// Allocates the windows once; paths are taken relative to root ("/sd" on
+// the board)
+bool sd_cache_begin(const char *root, uint32_t windows, uint32_t window_size);
+
+// NULL when the file is missing or SD_CACHE_FILES are open
+sd_file_t *sd_open(const char *path);
+void sd_close(sd_file_t *file);
+
+// Bytes read, short at the end of the file; -1 on a card error
+int32_t sd_read(sd_file_t *file, void *buf, uint32_t len);
+bool sd_seek(sd_file_t *file, uint32_t pos);
+uint32_t sd_tell(const sd_file_t *file);
+uint32_t sd_size(const sd_file_t *file);
+
+// Forgets every window, as after a reset
+void sd_cache_drop();
+void sd_cache_get_stats(sd_cache_stats_t *stats);
+void sd_cache_clear_stats();
+
+#endif
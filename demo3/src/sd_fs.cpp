@@ -0,0 +1,79 @@
+// LVGL file system driver for the microSD slot, see sd_fs.h.
+
+#include <SD.h>
+#include "sd_cache.h"
+#include "sd_fs.h"
+
+static lv_fs_drv_t drv;
+// Draw units open images from their own threads
+static lv_mutex_t cache_lock;
+
+static void *fs_open(lv_fs_drv_t *d, const char *path, lv_fs_mode_t mode) {
+    LV_UNUSED(d);
+    if (mode != LV_FS_MODE_RD)
+        return NULL;
+    lv_mutex_lock(&cache_lock);
+    sd_file_t *file = sd_open(path);
+    lv_mutex_unlock(&cache_lock);
+    return file;
+}
+
+static lv_fs_res_t fs_close(lv_fs_drv_t *d, void *file) {
+    LV_UNUSED(d);
+    lv_mutex_lock(&cache_lock);
+    sd_close((sd_file_t *)file);
+    lv_mutex_unlock(&cache_lock);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_read(lv_fs_drv_t *d, void *file, void *buf, uint32_t btr, uint32_t *br) {
+    LV_UNUSED(d);
+    lv_mutex_lock(&cache_lock);
+    int32_t n = sd_read((sd_file_t *)file, buf, btr);
+    lv_mutex_unlock(&cache_lock);
+    *br = n < 0 ? 0 : n;
+    return n < 0 ? LV_FS_RES_HW_ERR : LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_seek(lv_fs_drv_t *d, void *file, uint32_t pos, lv_fs_whence_t whence) {
+    LV_UNUSED(d);
+    sd_file_t *f = (sd_file_t *)file;
+    if (whence == LV_FS_SEEK_CUR)
+        pos += sd_tell(f);
+    else if (whence == LV_FS_SEEK_END)
+        pos += sd_size(f);
+    return sd_seek(f, pos) ? LV_FS_RES_OK : LV_FS_RES_INV_PARAM;
+}
+
+static lv_fs_res_t fs_tell(lv_fs_drv_t *d, void *file, uint32_t *pos) {
+    LV_UNUSED(d);
+    *pos = sd_tell((sd_file_t *)file);
+    return LV_FS_RES_OK;
+}
+
+bool sd_fs_begin(SPIClass &spi, char letter) {
+    spi.begin(SD_FS_SCK, SD_FS_MISO, SD_FS_MOSI, SD_FS_CS);
+    if (!SD.begin(SD_FS_CS, spi, SD_FS_FREQUENCY, SD_FS_ROOT) || SD.cardType() == CARD_NONE) {
+        Serial.println("SD: no card");
+        return false;
+    }
+    if (!sd_cache_begin(SD_FS_ROOT, SD_FS_WINDOWS, SD_FS_WINDOW_SIZE)) {
+        Serial.println("SD: no memory for the read-ahead windows");
+        SD.end();
+        return false;
+    }
+    Serial.printf("SD: %lu MB card at %c:, %d x %d byte windows\n", (unsigned long)(SD.cardSize() >> 20), letter,
+                  SD_FS_WINDOWS, SD_FS_WINDOW_SIZE);
+
+    lv_mutex_init(&cache_lock);
+    // LVGL's own read cache (cache_size) stays off, the windows do that
+    lv_fs_drv_init(&drv);
+    drv.letter = letter;
+    drv.open_cb = fs_open;
+    drv.close_cb = fs_close;
+    drv.read_cb = fs_read;
+    drv.seek_cb = fs_seek;
+    drv.tell_cb = fs_tell;
+    lv_fs_drv_register(&drv);
+    return true;
+}
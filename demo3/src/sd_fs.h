@@ -0,0 +1,38 @@
+// LVGL file system driver for the microSD slot.
+//
+// Mounts the card's FAT volume at SD_FS_ROOT and registers it as drive
+// letter, so "S:/images/radar.bin" can be given to lv_image_set_src() and
+// friends; everything is read through sd_cache's windows. Read-only.
+//
+// On the CYD the slot is wired to the VSPI pins (SCK 18, MISO 19, MOSI 23,
+// CS 5). The touch controller uses the same peripheral on its own pins, and
+// the ESP32 can route it to only one set, so when main.cpp mounts the card
+// touch_input.cpp drives the touch pins by hand instead.
+
+#ifndef SD_FS_H
+#define SD_FS_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <lvgl.h>
+
+#define SD_FS_ROOT "/sd"
+#define SD_FS_SCK 18
+#define SD_FS_MISO 19
+#define SD_FS_MOSI 23
+#define SD_FS_CS 5
+#define SD_FS_FREQUENCY 20000000
+
+// Read-ahead windows, see sd_cache.h
+#ifndef SD_FS_WINDOWS
+#define SD_FS_WINDOWS 4
+#endif
+#ifndef SD_FS_WINDOW_SIZE
+#define SD_FS_WINDOW_SIZE 8192
+#endif
+
+// Starts spi on the card's pins, mounts it and registers the drive. Call
+// after lv_init(); false when there is no card or no memory for the windows.
+bool sd_fs_begin(SPIClass &spi, char letter);
+
+#endif
@@ -0,0 +1,131 @@
+// Strip-streaming decoder for .bin image files, see sd_image.h.
+
+#include <lvgl_private.h>  // lv_image_decoder_dsc_t and lv_draw_buf_t fields
+#include "sd_image.h"
+
+typedef struct {
+    lv_fs_file_t file;
+    lv_draw_buf_t *strip;
+    uint32_t stride;  // bytes per row in the file
+} stream_t;
+
+static bool supported(const lv_image_header_t *header) {
+    switch (header->cf) {
+    case LV_COLOR_FORMAT_RGB565:
+    case LV_COLOR_FORMAT_RGB565_SWAPPED:
+    case LV_COLOR_FORMAT_ARGB8565:
+    case LV_COLOR_FORMAT_RGB888:
+    case LV_COLOR_FORMAT_XRGB8888:
+    case LV_COLOR_FORMAT_ARGB8888:
+    case LV_COLOR_FORMAT_L8:
+    case LV_COLOR_FORMAT_A8:
+    case LV_COLOR_FORMAT_AL88:
+        return header->magic == LV_IMAGE_HEADER_MAGIC && !(header->flags & LV_IMAGE_FLAGS_COMPRESSED) &&
+               header->w && header->h;
+    default:
+        return false;
+    }
+}
+
+static bool is_bin_file(const lv_image_decoder_dsc_t *dsc) {
+    return dsc->src_type == LV_IMAGE_SRC_FILE && !strcmp(lv_fs_get_ext((const char *)dsc->src), "bin");
+}
+
+static uint32_t file_stride(const lv_image_header_t *header) {
+    return header->stride ? header->stride : header->w * lv_color_format_get_bpp((lv_color_format_t)header->cf) / 8;
+}
+
+static lv_result_t stream_info(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc, lv_image_header_t *header) {
+    LV_UNUSED(decoder);
+    if (!is_bin_file(dsc))
+        return LV_RESULT_INVALID;
+    lv_fs_file_t file;
+    if (lv_fs_open(&file, (const char *)dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK)
+        return LV_RESULT_INVALID;
+    uint32_t n = 0;
+    lv_fs_res_t res = lv_fs_read(&file, header, sizeof(*header), &n);
+    lv_fs_close(&file);
+    return res == LV_FS_RES_OK && n == sizeof(*header) && supported(header) ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+static lv_result_t stream_open(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+    stream_t *stream = (stream_t *)lv_malloc_zeroed(sizeof(stream_t));
+    if (!stream)
+        return LV_RESULT_INVALID;
+    if (lv_fs_open(&stream->file, (const char *)dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        lv_free(stream);
+        return LV_RESULT_INVALID;
+    }
+    stream->stride = file_stride(&dsc->header);
+    stream->strip = lv_draw_buf_create(dsc->header.w, SD_IMAGE_STRIP_ROWS, (lv_color_format_t)dsc->header.cf,
+                                       LV_STRIDE_AUTO);
+    if (!stream->strip) {
+        lv_fs_close(&stream->file);
+        lv_free(stream);
+        return LV_RESULT_INVALID;
+    }
+    // No decoded image: the draw asks for it a strip at a time
+    dsc->decoded = NULL;
+    dsc->user_data = stream;
+    return LV_RESULT_OK;
+}
+
+// The next strip of full_area, below the one in decoded_area
+static lv_result_t stream_get_area(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc,
+                                   const lv_area_t *full_area, lv_area_t *decoded_area) {
+    LV_UNUSED(decoder);
+    stream_t *stream = (stream_t *)dsc->user_data;
+    int32_t y1 = decoded_area->y1 == LV_COORD_MIN ? full_area->y1 : decoded_area->y2 + 1;
+    if (y1 > full_area->y2)
+        return LV_RESULT_INVALID;
+    int32_t y2 = LV_MIN(y1 + SD_IMAGE_STRIP_ROWS - 1, full_area->y2);
+    int32_t w = lv_area_get_width(full_area);
+    lv_color_format_t cf = (lv_color_format_t)dsc->header.cf;
+    uint32_t row_bytes = w * lv_color_format_get_bpp(cf) / 8;
+
+    lv_draw_buf_t *strip = lv_draw_buf_reshape(stream->strip, cf, w, y2 - y1 + 1, LV_STRIDE_AUTO);
+    if (!strip)
+        return LV_RESULT_INVALID;
+    uint32_t offset = sizeof(lv_image_header_t) + y1 * stream->stride + full_area->x1 * lv_color_format_get_bpp(cf) / 8;
+    uint32_t n = 0;
+    if (row_bytes == stream->stride && strip->header.stride == stream->stride) {
+        // Whole rows, back to back in the file and in the strip
+        uint32_t bytes = (y2 - y1 + 1) * stream->stride;
+        if (lv_fs_seek(&stream->file, offset, LV_FS_SEEK_SET) != LV_FS_RES_OK ||
+            lv_fs_read(&stream->file, strip->data, bytes, &n) != LV_FS_RES_OK || n != bytes)
+            return LV_RESULT_INVALID;
+    } else {
+        for (int32_t y = y1; y <= y2; y++, offset += stream->stride) {
+            uint8_t *row = strip->data + (y - y1) * strip->header.stride;
+            if (lv_fs_seek(&stream->file, offset, LV_FS_SEEK_SET) != LV_FS_RES_OK ||
+                lv_fs_read(&stream->file, row, row_bytes, &n) != LV_FS_RES_OK || n != row_bytes)
+                return LV_RESULT_INVALID;
+        }
+    }
+
+    decoded_area->x1 = full_area->x1;
+    decoded_area->x2 = full_area->x2;
+    decoded_area->y1 = y1;
+    decoded_area->y2 = y2;
+    dsc->decoded = strip;
+    return LV_RESULT_OK;
+}
+
+static void stream_close(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+    stream_t *stream = (stream_t *)dsc->user_data;
+    lv_fs_close(&stream->file);
+    lv_draw_buf_destroy(stream->strip);
+    lv_free(stream);
+}
+
+void sd_image_init() {
+    // Decoders created later are asked first, so this one sees the .bin
+    // files before LVGL's bin decoder
+    lv_image_decoder_t *decoder = lv_image_decoder_create();
+    lv_image_decoder_set_info_cb(decoder, stream_info);
+    lv_image_decoder_set_open_cb(decoder, stream_open);
+    lv_image_decoder_set_get_area_cb(decoder, stream_get_area);
+    lv_image_decoder_set_close_cb(decoder, stream_close);
+}
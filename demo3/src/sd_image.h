@@ -0,0 +1,25 @@
+// LVGL image decoder that streams .bin images from a file in strips.
+//
+// LVGL's bin decoder reads a file image one row per lv_fs_read() and draws
+// it row by row. This decoder answers the same files ahead of it: a draw
+// gets the rows it needs SD_IMAGE_STRIP_ROWS at a time, read straight into
+// a strip buffer in the image's own format, one read per strip when the
+// draw wants whole rows. Nothing is decoded in full and nothing is kept
+// between draws; the file system's cache (sd_fs) makes a redraw cheap.
+//
+// Takes uncompressed images of 8 bits per pixel and more with a single
+// plane (RGB565, RGB888, XRGB8888, ARGB8888, L8, A8, ...); the others are
+// left to LVGL's bin decoder. The images are written by tools/sd_images.py.
+
+#ifndef SD_IMAGE_H
+#define SD_IMAGE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#define SD_IMAGE_STRIP_ROWS 8  // rows per read and per draw
+
+// Registers the decoder ahead of LVGL's. Call after lv_init().
+void sd_image_init();
+
+#endif
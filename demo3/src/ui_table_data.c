@@ -0,0 +1,69 @@
+/* Generated by tools/ui_table.py from src/ui/screens.c, do not edit. */
+
+#include "ui_table.h"
+#include "ui/actions.h"
+#include "ui/fonts.h"
+
+/* Screens: 1, ops: 157 bytes, style sets: 7 in 134 bytes */
+static const uint8_t ops[] = {
+    0x01,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x05,0x01,0x00,0x02,0x00,0x06,0x00,0x00,0x0b,0x02,0x04,0x03,0x01,0x04,0x05,0x00,
+    0x05,0x00,0x05,0x06,0x00,0x07,0x00,0x02,0x01,0x03,0x02,0x04,0x08,0x00,0x09,0x00,0x05,0x0a,0x00,0x0b,0x00,0x08,0x0c,0x00,
+    0x06,0x01,0x00,0x07,0x00,0x00,0x02,0x01,0x03,0x03,0x04,0x0e,0x00,0x0f,0x00,0x05,0x10,0x00,0x11,0x00,0x06,0x02,0x00,0x07,
+    0x01,0x00,0x02,0x01,0x03,0x04,0x04,0x08,0x00,0x12,0x00,0x05,0x0a,0x00,0x13,0x00,0x08,0x0c,0x00,0x06,0x03,0x00,0x07,0x02,
+    0x00,0x02,0x01,0x03,0x05,0x04,0x05,0x00,0x14,0x00,0x05,0x15,0x00,0x16,0x00,0x06,0x04,0x00,0x07,0x03,0x00,0x02,0x01,0x03,
+    0x06,0x04,0x17,0x00,0x05,0x00,0x05,0x18,0x00,0x11,0x00,0x06,0x05,0x00,0x07,0x04,0x00,0x02,0x00,0x03,0x07,0x04,0x09,0x00,
+    0x19,0x00,0x05,0x1a,0x00,0x1b,0x00,0x06,0x06,0x00,0x0c,0x0d,0x00,
+};
+
+static const uint8_t styles[] = {
+    0x00,0x04,0x00,0x01,0x8f,0x93,0x91,0x01,0x00,0x03,0x00,0x02,0x00,0x04,0x00,0x03,0x01,0xa6,0xcd,0xec,0x00,0x03,0x04,0x01,
+    0xff,0xff,0xff,0x05,0x00,0x0d,0x00,0x06,0x02,0x00,0x00,0x03,0x04,0x01,0xe4,0xff,0xff,0x06,0x02,0x01,0x05,0x00,0x0d,0x00,
+    0x00,0x03,0x04,0x01,0xe4,0xff,0xff,0x05,0x00,0x0d,0x00,0x06,0x02,0x02,0x00,0x03,0x04,0x01,0x14,0x53,0x6a,0x06,0x02,0x03,
+    0x05,0x00,0x0d,0x00,0x00,0x01,0x04,0x01,0xe4,0xff,0xff,0x00,0x0c,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x09,0x00,0x00,
+    0x00,0x0a,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x0d,0x00,0x1c,0x00,0x00,0x01,0x6f,0x8f,0xa8,0x0e,0x00,
+    0x1d,0x00,0x02,0x00,0x1e,0x00,0x04,0x01,0xff,0xff,0xff,0x06,0x02,0x01,
+};
+
+static const uint16_t style_sets[] = {
+    0, 20, 34, 48, 62, 76, 83,
+};
+
+/* Built on first use, see ui_table.cpp */
+static lv_style_t shared_styles[7];
+
+static const int32_t nums[] = {
+    0, 320, 240, LV_BORDER_SIDE_NONE, LV_GRAD_DIR_VER, 8,
+    96, 92, 6, 104, 87, 32,
+    LV_LABEL_LONG_CLIP, LV_TEXT_ALIGN_CENTER, 7, 142, 82, 16,
+    169, 23, 203, 85, 28, 117,
+    192, 36, 205, 200, LV_LAYOUT_GRID, 255,
+    LV_GRAD_DIR_NONE,
+};
+
+static const lv_style_prop_t props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_BORDER_SIDE, LV_STYLE_BG_GRAD_DIR, LV_STYLE_BG_GRAD_COLOR, LV_STYLE_TEXT_COLOR, LV_STYLE_TEXT_ALIGN,
+    LV_STYLE_TEXT_FONT, LV_STYLE_PAD_LEFT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_BOTTOM, LV_STYLE_BORDER_WIDTH,
+    LV_STYLE_RADIUS, LV_STYLE_LAYOUT, LV_STYLE_BG_OPA,
+};
+
+static const lv_style_selector_t selectors[] = {
+    LV_PART_MAIN | LV_STATE_DEFAULT,
+};
+
+static const char *const strings[] = {
+    "123°F", "Feels Like", "139°F", "12:24pm",
+    "SEVEN DAY FORECAST",
+};
+
+static const lv_font_t *const fonts[] = {
+    &lv_font_montserrat_28, &lv_font_montserrat_14, &lv_font_montserrat_16, &lv_font_montserrat_20,
+};
+
+static const uint16_t screens[] = {
+    0,
+};
+
+const ui_table_t ui_table = {
+    ops, styles, style_sets, shared_styles, 7,
+    nums, props, selectors, strings, fonts, NULL, NULL, screens, 1,
+};
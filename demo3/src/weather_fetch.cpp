@@ -0,0 +1,213 @@
+// Background weather fetch, see weather_fetch.h.
+
+#include <atomic>
+#include <HTTPClient.h>
+#include <WiFi.h>
+#include "weather_fetch.h"
+
+static const char *fetch_url;
+static const char *icon_url;
+static weather_model_t *models;
+static bool fetch_hourly;
+static uint32_t fetch_interval_ms;
+
+// models[front] is the LVGL thread's. The task only writes models[front ^ 1],
+// and only while ready is false; take() flips front before clearing ready.
+static uint8_t front = 0;
+static std::atomic<bool> ready(false);
+
+// The task's own; static so the stack does not have to hold them
+static weather_parser_t parser;
+static char chunk[WEATHER_FETCH_CHUNK];
+
+#ifdef DEMO_WEATHER_STATS
+static uint32_t heap_low;
+
+static void sample_heap() {
+    uint32_t free_heap = ESP.getFreeHeap();
+    if (free_heap < heap_low)
+        heap_low = free_heap;
+}
+#else
+static void sample_heap() {}
+#endif
+
+static bool fetch(weather_model_t *model) {
+#ifdef DEMO_WEATHER_STATS
+    uint32_t heap_before = ESP.getFreeHeap();
+    uint32_t start = micros(), parse_us = 0;
+    heap_low = heap_before;
+#endif
+    uint32_t bytes = 0;
+    HTTPClient http;
+    http.useHTTP10(true);  // no chunked transfer coding, the body comes as it is
+    http.setTimeout(WEATHER_FETCH_TIMEOUT_MS);
+    http.setConnectTimeout(WEATHER_FETCH_TIMEOUT_MS);
+    if (!http.begin(fetch_url)) {
+        Serial.println("Weather: bad URL");
+        return false;
+    }
+    int status = http.GET();
+    sample_heap();
+    if (status != HTTP_CODE_OK) {
+        Serial.printf("Weather: GET failed (%d)\n", status);
+        http.end();
+        return false;
+    }
+
+    // Without a Content-Length the body ends when the server closes
+    WiFiClient *stream = http.getStreamPtr();
+    int32_t remaining = http.getSize();
+    weather_parse_begin(&parser, model, fetch_hourly);
+    uint32_t last_data = millis();
+    while (remaining != 0 && !json_stream_done(&parser.json)) {
+        size_t available = stream->available();
+        if (!available) {
+            if (!stream->connected() || millis() - last_data > WEATHER_FETCH_TIMEOUT_MS)
+                break;
+            vTaskDelay(1);
+            continue;
+        }
+        if (available > sizeof(chunk))
+            available = sizeof(chunk);
+        if (remaining > 0 && available > (size_t)remaining)
+            available = remaining;
+        size_t n = stream->readBytes(chunk, available);
+        last_data = millis();
+        bytes += n;
+        if (remaining > 0)
+            remaining -= n;
+        sample_heap();
+#ifdef DEMO_WEATHER_STATS
+        uint32_t parse_start = micros();
+#endif
+        bool ok = weather_parse_feed(&parser, chunk, n);
+#ifdef DEMO_WEATHER_STATS
+        parse_us += micros() - parse_start;
+#endif
+        if (!ok) {
+            Serial.printf("Weather: not JSON at byte %lu\n", (unsigned long)parser.json.offset);
+            break;
+        }
+    }
+    http.end();
+
+    bool complete = weather_parse_end(&parser);
+    if (!complete)
+        Serial.printf("Weather: response incomplete after %lu bytes\n", (unsigned long)bytes);
+#ifdef DEMO_WEATHER_STATS
+    uint32_t total_us = micros() - start;
+    Serial.printf("Weather: %lu bytes, %lu rows in %lu ms, parse %lu us (%lu KB/s); heap peak %lu bytes, parser %u "
+                  "bytes, stack %u bytes unused\n",
+                  (unsigned long)bytes, (unsigned long)model->count, (unsigned long)(total_us / 1000),
+                  (unsigned long)parse_us, (unsigned long)(parse_us ? (uint64_t)bytes * 1000 / parse_us : 0),
+                  (unsigned long)(heap_before - heap_low), (unsigned)sizeof(parser),
+                  (unsigned)uxTaskGetStackHighWaterMark(NULL));
+#endif
+    return complete;
+}
+
+// One icon into memory of its own; the server has to give its length
+static bool fetch_icon(uint8_t icon) {
+#ifdef DEMO_WEATHER_STATS
+    uint32_t start = micros();
+#endif
+    char url[160];
+    snprintf(url, sizeof(url), "%s%s", icon_url, weather_icon_name(icon));
+    HTTPClient http;
+    http.useHTTP10(true);
+    http.setTimeout(WEATHER_FETCH_TIMEOUT_MS);
+    http.setConnectTimeout(WEATHER_FETCH_TIMEOUT_MS);
+    if (!http.begin(url))
+        return false;
+    int status = http.GET();
+    int32_t size = http.getSize();
+    if (status != HTTP_CODE_OK || size <= 0 || size > WEATHER_ICON_MAX_BYTES) {
+        Serial.printf("Weather: icon %s failed (%d, %ld bytes)\n", weather_icon_name(icon), status, (long)size);
+        http.end();
+        return false;
+    }
+
+    uint8_t *data = (uint8_t *)malloc(size);
+    WiFiClient *stream = http.getStreamPtr();
+    int32_t got = 0;
+    uint32_t last_data = millis();
+    while (data && got < size) {
+        size_t available = stream->available();
+        if (!available) {
+            if (!stream->connected() || millis() - last_data > WEATHER_FETCH_TIMEOUT_MS)
+                break;
+            vTaskDelay(1);
+            continue;
+        }
+        if ((int32_t)available > size - got)
+            available = size - got;
+        got += stream->readBytes(data + got, available);
+        last_data = millis();
+    }
+    http.end();
+    if (got < size) {
+        Serial.printf("Weather: icon %s incomplete after %ld bytes\n", weather_icon_name(icon), (long)got);
+        free(data);
+        return false;
+    }
+    weather_icon_store(icon, data, size);
+#ifdef DEMO_WEATHER_STATS
+    Serial.printf("Weather: icon %s, %ld bytes in %lu ms\n", weather_icon_name(icon), (long)size,
+                  (unsigned long)((micros() - start) / 1000));
+#endif
+    return true;
+}
+
+// Each missing icon of the model's rows once; model->rows[].icon are still
+// WMO codes
+static void fetch_icons(const weather_model_t *model) {
+    if (!*icon_url)
+        return;
+    uint32_t tried = 0;
+    for (uint16_t row = 0; row < model->count; row++) {
+        uint8_t icon = weather_icon_of(model->rows[row].icon);
+        if (weather_icon_loaded(icon) || (tried & 1u << icon))
+            continue;
+        tried |= 1u << icon;
+        fetch_icon(icon);
+    }
+}
+
+static void fetch_task(void *arg) {
+    for (;;) {
+        // Wait for the network, and for the LVGL thread to take the last forecast
+        if (WiFi.status() != WL_CONNECTED || ready.load(std::memory_order_acquire)) {
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            continue;
+        }
+        bool ok = fetch(&models[front ^ 1]);
+        if (ok) {
+            fetch_icons(&models[front ^ 1]);
+            ready.store(true, std::memory_order_release);
+        }
+        vTaskDelay(pdMS_TO_TICKS(ok ? fetch_interval_ms : WEATHER_FETCH_RETRY_MS));
+    }
+}
+
+bool weather_fetch_begin(const char *ssid, const char *password, const char *url, const char *icons_url,
+                         weather_model_t *two_models, bool hourly, uint32_t interval_ms) {
+    fetch_url = url;
+    icon_url = icons_url;
+    models = two_models;
+    fetch_hourly = hourly;
+    fetch_interval_ms = interval_ms;
+
+    WiFi.mode(WIFI_STA);
+    WiFi.begin(ssid, password);
+    return xTaskCreatePinnedToCore(fetch_task, "weather", WEATHER_FETCH_STACK, NULL, 1, NULL,
+                                   xPortGetCoreID() ^ 1) == pdPASS;
+}
+
+weather_model_t *weather_fetch_take() {
+    if (!ready.load(std::memory_order_acquire))
+        return NULL;
+    front ^= 1;
+    ready.store(false, std::memory_order_release);
+    return &models[front];
+}
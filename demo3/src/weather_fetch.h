@@ -0,0 +1,41 @@
+// Background weather fetch.
+//
+// A task on the other core joins WiFi, GETs the forecast URL every interval
+// and streams the response body through weather_json into the back one of
+// two models, WEATHER_FETCH_CHUNK bytes at a time as they arrive. A model
+// that parsed completely is handed to the LVGL thread by
+// weather_fetch_take(), which makes it the front model; until then the task
+// writes to neither, so the rows the forecast list shows are never changed
+// under it. A failed or cut-off fetch is dropped, the screen keeps the
+// forecast it has and the task tries again after WEATHER_FETCH_RETRY_MS.
+// Before a forecast is handed over, the task downloads the icons of its
+// rows that it does not have yet (weather_icons.h).
+//
+// With -D DEMO_WEATHER_STATS each fetch reports its size, transfer and
+// parse time, parse throughput, how much heap it took at most and the
+// task's unused stack on Serial, and each icon download its size and time.
+
+#ifndef WEATHER_FETCH_H
+#define WEATHER_FETCH_H
+
+#include <Arduino.h>
+#include "weather_json.h"
+#include "weather_icons.h"
+
+#define WEATHER_FETCH_CHUNK 512          // bytes read from the socket at a time
+#define WEATHER_FETCH_TIMEOUT_MS 10000   // connect, headers, or silence in the body
+#define WEATHER_FETCH_RETRY_MS 30000     // after a failed fetch
+#define WEATHER_FETCH_STACK 6144
+
+// models is two models with rows of the same capacity; the task fills
+// models[1] first. hourly takes the rows from the hourly arrays. Icons are
+// downloaded from icon_url followed by the icon's name; none with "".
+bool weather_fetch_begin(const char *ssid, const char *password, const char *url, const char *icon_url,
+                         weather_model_t *models, bool hourly, uint32_t interval_ms);
+
+// From the LVGL thread: the model of a fetch that completed since the last
+// call, else NULL. It stays valid, and the caller's, until the next call
+// that returns a model.
+weather_model_t *weather_fetch_take();
+
+#endif
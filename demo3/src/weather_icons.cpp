@@ -0,0 +1,61 @@
+// Downloaded forecast icons, see weather_icons.h.
+
+#include <atomic>
+#include "weather_icons.h"
+
+static const char *const names[WEATHER_ICONS] = {
+    "clear", "partly_cloudy", "cloudy", "fog", "drizzle", "rain", "showers", "snow", "thunder",
+};
+
+// The fetch task fills in image, then sets loaded; after that neither
+// changes
+static lv_image_dsc_t images[WEATHER_ICONS];
+static std::atomic<bool> loaded[WEATHER_ICONS];
+
+uint8_t weather_icon_of(uint8_t code) {
+    switch (code) {
+    case 0:
+        return WEATHER_ICON_CLEAR;
+    case 1:
+    case 2:
+        return WEATHER_ICON_PARTLY_CLOUDY;
+    case 45:
+    case 48:
+        return WEATHER_ICON_FOG;
+    case 51 ... 57:
+        return WEATHER_ICON_DRIZZLE;
+    case 61 ... 67:
+        return WEATHER_ICON_RAIN;
+    case 71 ... 77:
+    case 85:
+    case 86:
+        return WEATHER_ICON_SNOW;
+    case 80 ... 82:
+        return WEATHER_ICON_SHOWERS;
+    case 95 ... 99:
+        return WEATHER_ICON_THUNDER;
+    default:
+        return WEATHER_ICON_CLOUDY;
+    }
+}
+
+const char *weather_icon_name(uint8_t icon) {
+    return icon < WEATHER_ICONS ? names[icon] : "";
+}
+
+bool weather_icon_loaded(uint8_t icon) {
+    return loaded[icon].load(std::memory_order_acquire);
+}
+
+void weather_icon_store(uint8_t icon, uint8_t *data, uint32_t size) {
+    lv_image_dsc_t *image = &images[icon];
+    image->header.magic = LV_IMAGE_HEADER_MAGIC;
+    image->header.cf = LV_COLOR_FORMAT_RAW;  // PNG or JPEG, icon_cache tells
+    image->data = data;
+    image->data_size = size;
+    loaded[icon].store(true, std::memory_order_release);
+}
+
+const lv_image_dsc_t *weather_icon_src(uint8_t icon) {
+    return weather_icon_loaded(icon) ? &images[icon] : NULL;
+}
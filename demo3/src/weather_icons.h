@@ -0,0 +1,47 @@
+// Forecast icons by kind of weather, downloaded.
+//
+// The WMO weather codes of a forecast fall into WEATHER_ICONS kinds of
+// weather, one icon each. weather_fetch downloads the icons a new forecast
+// needs from the icon URL followed by the kind's name, PNG or JPEG, before
+// it hands the forecast over. Each file is kept as it came, a few hundred
+// bytes, for as long as the firmware runs: icon_cache decodes it when a row
+// is drawn and keeps the pixels only while it has room. A kind whose
+// download failed is tried again with the next forecast.
+
+#ifndef WEATHER_ICONS_H
+#define WEATHER_ICONS_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#define WEATHER_ICON_MAX_BYTES 8192  // larger downloads are refused
+
+enum {
+    WEATHER_ICON_CLEAR,
+    WEATHER_ICON_PARTLY_CLOUDY,
+    WEATHER_ICON_CLOUDY,
+    WEATHER_ICON_FOG,
+    WEATHER_ICON_DRIZZLE,
+    WEATHER_ICON_RAIN,
+    WEATHER_ICON_SHOWERS,
+    WEATHER_ICON_SNOW,
+    WEATHER_ICON_THUNDER,
+    WEATHER_ICONS
+};
+
+// Kind of weather of a WMO code; unknown codes are cloudy
+uint8_t weather_icon_of(uint8_t code);
+
+// "partly_cloudy", as the file is named on the server
+const char *weather_icon_name(uint8_t icon);
+
+// Fetch task: whether the icon is there; store hands over data, from
+// malloc(), for good
+bool weather_icon_loaded(uint8_t icon);
+void weather_icon_store(uint8_t icon, uint8_t *data, uint32_t size);
+
+// LVGL thread: the downloaded file as an image source (cf
+// LV_COLOR_FORMAT_RAW), NULL until it is there
+const lv_image_dsc_t *weather_icon_src(uint8_t icon);
+
+#endif
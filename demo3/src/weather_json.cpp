@@ -0,0 +1,207 @@
+// Weather forecast from an Open-Meteo JSON response, see weather_json.h.
+
+#include <stdio.h>
+#include <string.h>
+#include "weather_json.h"
+
+enum { CURRENT_TEMP = 1, CURRENT_FEELS_LIKE = 2, CURRENT_TIME = 4, CURRENT_CODE = 8, CURRENT_ALL = 15 };
+enum { ROW_WHEN, ROW_TEMP, ROW_PRECIP, ROW_ICON };
+
+typedef struct {
+    const char *key;
+    uint8_t field;
+} field_t;
+
+static const field_t current_fields[] = {
+    {"temperature_2m", CURRENT_TEMP},
+    {"apparent_temperature", CURRENT_FEELS_LIKE},
+    {"time", CURRENT_TIME},
+    {"weather_code", CURRENT_CODE},
+};
+static const field_t daily_fields[] = {
+    {"time", ROW_WHEN},
+    {"temperature_2m_max", ROW_TEMP},
+    {"precipitation_probability_max", ROW_PRECIP},
+    {"weather_code", ROW_ICON},
+};
+static const field_t hourly_fields[] = {
+    {"time", ROW_WHEN},
+    {"temperature_2m", ROW_TEMP},
+    {"precipitation_probability", ROW_PRECIP},
+    {"weather_code", ROW_ICON},
+};
+
+static int find_field(const field_t *fields, size_t count, const char *key) {
+    for (size_t i = 0; i < count; i++) {
+        if (!strcmp(fields[i].key, key))
+            return fields[i].field;
+    }
+    return -1;
+}
+
+// Number rounded to an integer. Not strtod(): newlib's allocates.
+static bool to_int(const char *text, int32_t *out) {
+    bool negative = *text == '-';
+    if (negative)
+        text++;
+    if (*text < '0' || *text > '9')
+        return false;
+    int32_t value = 0;
+    while (*text >= '0' && *text <= '9') {
+        if (value > 1000000)
+            return false;
+        value = value * 10 + (*text++ - '0');
+    }
+    if (*text == '.') {
+        text++;
+        if (*text >= '5' && *text <= '9')
+            value++;
+        while (*text >= '0' && *text <= '9')
+            text++;
+    }
+    if (*text)
+        return false;  // exponents are not expected here
+    *out = negative ? -value : value;
+    return true;
+}
+
+// Two digits at text, -1 when they are not
+static int two_digits(const char *text) {
+    if (text[0] < '0' || text[0] > '9' || text[1] < '0' || text[1] > '9')
+        return -1;
+    return (text[0] - '0') * 10 + (text[1] - '0');
+}
+
+// "2026-10-19T12:15" as "12:15pm"
+static bool format_clock(const char *iso, char *out, size_t size) {
+    if (strlen(iso) < 16 || iso[10] != 'T')
+        return false;
+    int hour = two_digits(iso + 11), minute = two_digits(iso + 14);
+    if (hour < 0 || hour > 23 || minute < 0 || minute > 59)
+        return false;
+    snprintf(out, size, "%d:%02d%s", hour % 12 ? hour % 12 : 12, minute, hour < 12 ? "am" : "pm");
+    return true;
+}
+
+// "2026-10-19" as "Mon" (Sakamoto's weekday formula)
+static bool format_weekday(const char *iso, char *out, size_t size) {
+    static const char *const names[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+    static const uint8_t month_offset[] = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
+    if (strlen(iso) < 10 || iso[4] != '-' || iso[7] != '-')
+        return false;
+    int century = two_digits(iso), year = two_digits(iso + 2);
+    int month = two_digits(iso + 5), day = two_digits(iso + 8);
+    if (century < 0 || year < 0 || month < 1 || month > 12 || day < 1)
+        return false;
+    year += century * 100;
+    if (month < 3)
+        year--;
+    int weekday = (year + year / 4 - year / 100 + year / 400 + month_offset[month - 1] + day) % 7;
+    snprintf(out, size, "%s", names[weekday]);
+    return true;
+}
+
+static void current_value(weather_parser_t *parser, const char *key, json_type_t type, const char *text) {
+    weather_model_t *model = parser->model;
+    int field = find_field(current_fields, sizeof(current_fields) / sizeof(current_fields[0]), key);
+    int32_t value;
+    bool ok;
+    switch (field) {
+    case CURRENT_TIME:
+        ok = type == JSON_STRING && format_clock(text, model->time, sizeof(model->time));
+        break;
+    case CURRENT_TEMP:
+    case CURRENT_FEELS_LIKE:
+        ok = type == JSON_NUMBER && to_int(text, &value);
+        if (ok && field == CURRENT_TEMP)
+            model->temp = (int16_t)value;
+        else if (ok)
+            model->feels_like = (int16_t)value;
+        break;
+    case CURRENT_CODE:
+        ok = type == JSON_NUMBER && to_int(text, &value) && value >= 0 && value < 256;
+        if (ok)
+            model->conditions = (uint8_t)value;
+        break;
+    default:
+        return;
+    }
+    if (ok)
+        parser->seen |= field;
+}
+
+static void row_value(weather_parser_t *parser, const char *key, uint16_t index, json_type_t type, const char *text) {
+    weather_model_t *model = parser->model;
+    if (index >= model->capacity)
+        return;
+    int field = parser->hourly ? find_field(hourly_fields, sizeof(hourly_fields) / sizeof(hourly_fields[0]), key)
+                               : find_field(daily_fields, sizeof(daily_fields) / sizeof(daily_fields[0]), key);
+    if (field < 0)
+        return;
+
+    forecast_row_t *row = &model->rows[index];
+    int32_t value;
+    if (field == ROW_WHEN) {
+        // The hourly times are "2026-10-19T14:00"; "14:00" fits the row
+        if (type != JSON_STRING)
+            return;
+        if (!parser->hourly) {
+            if (!format_weekday(text, row->when, sizeof(row->when)))
+                return;
+        } else if (strlen(text) >= 16 && text[10] == 'T') {
+            snprintf(row->when, sizeof(row->when), "%s", text + 11);
+        } else {
+            return;
+        }
+    } else if (type != JSON_NUMBER || !to_int(text, &value)) {
+        return;  // null where the model has no value for the period
+    } else if (field == ROW_TEMP) {
+        row->temp = (int16_t)value;
+    } else if (field == ROW_PRECIP) {
+        row->precip = (uint8_t)(value < 0 ? 0 : value > 100 ? 100 : value);
+    } else if (value >= 0 && value < 256) {
+        row->icon = (uint8_t)value;
+    }
+    if (index >= model->count)
+        model->count = index + 1;
+}
+
+// Only "current" members and the elements of the "daily" / "hourly" arrays
+// are wanted, always two and three levels down
+static void on_value(void *ctx, const json_stream_t *js, json_type_t type, const char *text) {
+    weather_parser_t *parser = (weather_parser_t *)ctx;
+    uint8_t depth = json_stream_depth(js);
+    const char *section = json_stream_key(js, 0);
+    if (!section || json_stream_truncated(js))
+        return;
+
+    if (depth == 2 && !strcmp(section, "current")) {
+        current_value(parser, json_stream_key(js, 1), type, text);
+    } else if (depth == 3 && !strcmp(section, parser->hourly ? "hourly" : "daily")) {
+        const char *key = json_stream_key(js, 1);
+        int32_t index = json_stream_index(js, 2);
+        if (key && index >= 0)
+            row_value(parser, key, (uint16_t)index, type, text);
+    }
+}
+
+void weather_parse_begin(weather_parser_t *parser, weather_model_t *model, bool hourly) {
+    json_stream_begin(&parser->json, on_value, parser);
+    parser->model = model;
+    parser->hourly = hourly;
+    parser->seen = 0;
+    model->temp = 0;
+    model->feels_like = 0;
+    model->time[0] = 0;
+    model->conditions = 0;
+    model->count = 0;
+    memset(model->rows, 0, model->capacity * sizeof(model->rows[0]));
+}
+
+bool weather_parse_feed(weather_parser_t *parser, const char *data, size_t len) {
+    return json_stream_feed(&parser->json, data, len);
+}
+
+bool weather_parse_end(weather_parser_t *parser) {
+    return json_stream_done(&parser->json) && parser->seen == CURRENT_ALL && parser->model->count > 0;
+}
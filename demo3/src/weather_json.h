@@ -0,0 +1,49 @@
+// Weather forecast from an Open-Meteo JSON response.
+//
+// The response is read through json_stream as it arrives; the values the
+// screen shows go straight into a weather_model_t and everything else is
+// skipped, so the document is never held in memory. The request has to ask
+// for these fields, in °F and local time:
+//
+//   current=temperature_2m,apparent_temperature,weather_code
+//   daily=weather_code,temperature_2m_max,precipitation_probability_max
+//   hourly=temperature_2m,precipitation_probability,weather_code
+//   temperature_unit=fahrenheit&timezone=auto
+//
+// Rows come from the daily arrays ("Mon") or the hourly ones ("14:00"),
+// one per array element up to the model's capacity. A row's icon is the
+// WMO weather code of its period; so is the model's conditions.
+
+#ifndef WEATHER_JSON_H
+#define WEATHER_JSON_H
+
+#include "forecast_row.h"
+#include "json_stream.h"
+
+typedef struct {
+    int16_t temp;        // °F
+    int16_t feels_like;  // °F
+    char time[8];        // observation time, "12:15pm"
+    uint8_t conditions;  // WMO weather code
+    forecast_row_t *rows;
+    uint16_t capacity;
+    uint16_t count;
+} weather_model_t;
+
+typedef struct {
+    json_stream_t json;
+    weather_model_t *model;
+    bool hourly;
+    uint8_t seen;  // current fields found
+} weather_parser_t;
+
+// Empties model, keeping its rows array and capacity
+void weather_parse_begin(weather_parser_t *parser, weather_model_t *model, bool hourly);
+
+// false once the response can no longer be read
+bool weather_parse_feed(weather_parser_t *parser, const char *data, size_t len);
+
+// The whole document was read and it had the current conditions and rows
+bool weather_parse_end(weather_parser_t *parser);
+
+#endif
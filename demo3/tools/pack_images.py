@@ -0,0 +1,329 @@
+"""Packs the raw LVGL image arrays in assets/ into src/images_packed.c.
+
+Every assets/*.c is a C array as written by LVGL's image converter. The
+pixels are RLE-compressed in LVGL's own layout (lv_image_compressed_t
+header, then the lv_rle stream with one pixel per block), so the output is
+what LVGLImage.py --compress RLE would write: src/packed_image.cpp decodes
+and caches it, and with LV_USE_RLE LVGL's bin decoder can read it as well.
+Fully transparent pixels get colour 0 first, which only helps the runs.
+
+Images listed in FLATTEN are also written pre-composited onto the
+background their widget sits on, as opaque RGB565. The background is read
+from the generated src/ui/screens.c: the widget must be a direct child of
+its screen, nothing created before it may overlap it, and the screen must
+be a solid colour or a plain vertical/horizontal gradient. The result
+matches what LVGL would blend pixel for pixel, but LVGL only copies it and
+no longer has to draw the background underneath.
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and
+rewrites the output only when an asset is newer. Standalone:
+
+    python3 tools/pack_images.py [--force]
+
+prints raw and packed size per image.
+"""
+
+import glob
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821, PlatformIO pre-build hook; SCons leaves __file__ unset
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    env = None
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ASSETS = os.path.join(PROJECT_DIR, "assets")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "images_packed.c")
+SCRIPT = os.path.join(PROJECT_DIR, "tools", "pack_images.py")
+SCREENS = os.path.join(PROJECT_DIR, "src", "ui", "screens.c")
+
+# (asset, widget showing it in screens.c, name of the flattened image)
+FLATTEN = [
+    ("image_partly_cloudy", "current_conditions_image", "image_partly_cloudy_flat"),
+]
+
+# Bytes per RLE block, as lv_bin_decoder picks them: RGB565A8 runs over
+# its two planes in 2-byte units
+BLOCK_SIZE = {
+    "LV_COLOR_FORMAT_RGB565A8": 2,
+    "LV_COLOR_FORMAT_RGB565": 2,
+    "LV_COLOR_FORMAT_RGB888": 3,
+    "LV_COLOR_FORMAT_ARGB8888": 4,
+    "LV_COLOR_FORMAT_XRGB8888": 4,
+    "LV_COLOR_FORMAT_A8": 1,
+    "LV_COLOR_FORMAT_L8": 1,
+}
+
+COMPRESS_RLE = 1  # LV_IMAGE_COMPRESS_RLE
+MAX_RUN = 127
+
+
+def parse_asset(path):
+    text = open(path).read()
+    name = re.search(r"const lv_image_dsc_t (\w+) =", text).group(1)
+    body = text[text.index(name + "_map[] = {"):]
+    body = body[:body.index("};")]
+    data = bytes(int(b, 16) for b in re.findall(r"0x([0-9a-fA-F]{2})", body))
+
+    def field(key):
+        return re.search(r"\.header\.%s = (\w+)," % key, text).group(1)
+
+    image = {
+        "name": name,
+        "cf": field("cf"),
+        "w": int(field("w")),
+        "h": int(field("h")),
+        "stride": int(field("stride")),
+        "data": data,
+    }
+    if image["cf"] not in BLOCK_SIZE:
+        sys.exit("%s: colour format %s is not supported" % (path, image["cf"]))
+    return image
+
+
+def clear_transparent(image):
+    """RGB565A8: colour 0 under alpha 0, so transparent areas form runs."""
+    if image["cf"] != "LV_COLOR_FORMAT_RGB565A8":
+        return image["data"]
+    data = bytearray(image["data"])
+    w, h, stride = image["w"], image["h"], image["stride"]
+    alpha = stride * h
+    for y in range(h):
+        for x in range(w):
+            if data[alpha + y * (stride // 2) + x] == 0:
+                data[y * stride + 2 * x] = 0
+                data[y * stride + 2 * x + 1] = 0
+    return bytes(data)
+
+
+def screen_of(screens, widget, path):
+    """Position and size of a screen-level widget, its screen's style calls and earlier siblings."""
+    for func in re.finditer(r"void create_screen_\w+\(\) \{\n(.*?)\n\}\n", screens, re.S):
+        body = func.group(1)
+        children = re.findall(r"\n {8}\{\n(.*?)\n {8}\}", body, re.S)
+        for i, child in enumerate(children):
+            if not re.search(r"^ {12}// %s$" % widget, child, re.M):
+                continue
+            styles = body[:body.index("\n    {")]
+            return rect_of(child, widget, path), styles, [rect_of(c, widget, path) for c in children[:i]]
+    sys.exit("%s: %s is not a screen-level widget in %s" % (path, widget, SCREENS))
+
+
+def rect_of(block, widget, path):
+    pos = re.search(r"lv_obj_set_pos\(obj, (-?\d+), (-?\d+)\)", block)
+    size = re.search(r"lv_obj_set_size\(obj, (\d+), (\d+)\)", block)
+    if not pos or not size:
+        sys.exit("%s: no fixed position and size near %s in %s" % (path, widget, SCREENS))
+    return [int(v) for v in pos.groups() + size.groups()]
+
+
+def screen_style(styles, prop):
+    m = re.search(r"lv_obj_set_style_%s\(obj, (.*?), LV_PART_MAIN \| LV_STATE_DEFAULT\)" % prop, styles)
+    return m.group(1) if m else None
+
+
+def hex_color(value):
+    v = int(re.match(r"lv_color_hex\(0x([0-9a-fA-F]+)\)", value).group(1), 16)
+    return (v >> 16) & 0xFF, (v >> 8) & 0xFF, v & 0xFF
+
+
+def to_rgb565(c):
+    return ((c[0] & 0xF8) << 8) | ((c[1] & 0xFC) << 3) | (c[2] >> 3)
+
+
+def background(styles, path):
+    """Returns f(x, y) giving the RGB565 colour of the screen at x, y, as LVGL fills it."""
+    for prop in ("bg_opa", "bg_main_stop", "bg_grad_stop", "bg_image_src", "bg_dither_mode"):
+        value = screen_style(styles, prop)
+        if value is not None and not (prop == "bg_opa" and value == "255"):
+            sys.exit("%s: screen style %s = %s can't be flattened" % (path, prop, value))
+    main = hex_color(screen_style(styles, "bg_color") or "lv_color_hex(0xffffffff)")
+    direction = screen_style(styles, "bg_grad_dir") or "LV_GRAD_DIR_NONE"
+    if direction == "LV_GRAD_DIR_NONE":
+        return lambda x, y: to_rgb565(main)
+    if direction not in ("LV_GRAD_DIR_VER", "LV_GRAD_DIR_HOR"):
+        sys.exit("%s: screen gradient %s can't be flattened" % (path, direction))
+    grad = hex_color(screen_style(styles, "bg_grad_color"))
+    w, h = [int(v) for v in re.search(r"lv_obj_set_size\(obj, (\d+), (\d+)\)", styles).groups()]
+
+    def color(x, y):
+        # lv_gradient_color_calculate() with the default stops 0 and 255
+        rng, frac = (h, y) if direction == "LV_GRAD_DIR_VER" else (w, x)
+        end = (255 * rng) >> 8
+        if frac <= 0:
+            return to_rgb565(main)
+        if frac >= end:
+            return to_rgb565(grad)
+        mix = frac * 255 // end
+        return to_rgb565([((b * mix + a * (255 - mix)) * 0x8081) >> 23 for a, b in zip(main, grad)])
+    return color
+
+
+def blend_rgb565(fg, bg, alpha):
+    """lv_color_16_16_mix(), the RGB565 blend of LVGL's software renderer."""
+    if alpha == 255:
+        return fg
+    if alpha == 0:
+        return bg
+    mix = (alpha + 4) >> 3
+    fg = (fg | fg << 16) & 0x7E0F81F
+    bg = (bg | bg << 16) & 0x7E0F81F
+    result = ((((fg - bg) * mix) >> 5) + bg) & 0x7E0F81F
+    return (result >> 16 | result) & 0xFFFF
+
+
+def flatten(image, widget, name, path):
+    if image["cf"] != "LV_COLOR_FORMAT_RGB565A8":
+        sys.exit("%s: only RGB565A8 images can be flattened" % path)
+    screens = open(SCREENS).read()
+    (wx, wy, ww, wh), styles, below = screen_of(screens, widget, path)
+    w, h, stride = image["w"], image["h"], image["stride"]
+    # lv_image centres its source in the widget (inner_align CENTER); C division
+    x0, y0 = wx + int((ww - w) / 2), wy + int((wh - h) / 2)
+    for bx, by, bw, bh in below:
+        if bx < x0 + w and x0 < bx + bw and by < y0 + h and y0 < by + bh:
+            sys.exit("%s: a widget under %s overlaps it, the background isn't known" % (path, widget))
+    bg = background(styles, path)
+
+    data = image["data"]
+    alpha = stride * h
+    out = bytearray()
+    for y in range(h):
+        for x in range(w):
+            fg = data[y * stride + 2 * x] | data[y * stride + 2 * x + 1] << 8
+            pixel = blend_rgb565(fg, bg(x0 + x, y0 + y), data[alpha + y * (stride // 2) + x])
+            out += pixel.to_bytes(2, "little")
+    return {"name": name, "cf": "LV_COLOR_FORMAT_RGB565", "w": w, "h": h, "stride": 2 * w, "data": bytes(out),
+            "source": path}
+
+
+def rle_compress(data, block):
+    """lv_rle: 0x80 | n, then n literal blocks; or n, then one block repeated n times."""
+    blocks = [data[i:i + block] for i in range(0, len(data), block)]
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(0x80 | len(chunk))
+            for b in chunk:
+                out.extend(b)
+
+    i = 0
+    while i < len(blocks):
+        run = 1
+        while i + run < len(blocks) and run < MAX_RUN and blocks[i + run] == blocks[i]:
+            run += 1
+        if run > 1:
+            flush_literal()
+            out.append(run)
+            out += blocks[i]
+        else:
+            literal.append(blocks[i])
+        i += run
+    flush_literal()
+    return bytes(out)
+
+
+def rle_decompress(data, block):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        ctrl = data[i]
+        i += 1
+        n = (ctrl & 0x7F) * block
+        if ctrl & 0x80:
+            out += data[i:i + n]
+            i += n
+        else:
+            out += data[i:i + block] * (ctrl & 0x7F)
+            i += block
+    return bytes(out)
+
+
+def c_bytes(data, indent="    ", per_line=24):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ",".join("0x%02x" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def emit(images):
+    out = ["/* Generated by tools/pack_images.py from assets/*.c, do not edit. */",
+           "",
+           "#include \"lvgl.h\"",
+           ""]
+    for image in images:
+        name = image["name"]
+        header = bytes(COMPRESS_RLE.to_bytes(4, "little")
+                       + len(image["packed"]).to_bytes(4, "little")
+                       + len(image["data"]).to_bytes(4, "little"))
+        out += ["/* %dx%d %s, %d bytes raw */" % (image["w"], image["h"], image["cf"][len("LV_COLOR_FORMAT_"):],
+                                                  len(image["data"])),
+                "static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t %s_map[] = {" % name,
+                "    /* lv_image_compressed_t: method, compressed size, decompressed size */",
+                c_bytes(header, per_line=12),
+                c_bytes(image["packed"]),
+                "};",
+                "",
+                "const lv_image_dsc_t %s = {" % name,
+                "  .header.magic = LV_IMAGE_HEADER_MAGIC,",
+                "  .header.cf = %s," % image["cf"],
+                "  .header.flags = LV_IMAGE_FLAGS_COMPRESSED,",
+                "  .header.w = %d," % image["w"],
+                "  .header.h = %d," % image["h"],
+                "  .header.stride = %d," % image["stride"],
+                "  .header.reserved_2 = 0,",
+                "  .data_size = sizeof(%s_map)," % name,
+                "  .data = %s_map," % name,
+                "  .reserved = NULL,",
+                "};",
+                ""]
+    return "\n".join(out)
+
+
+def pack(force=False):
+    assets = sorted(glob.glob(os.path.join(ASSETS, "*.c")))
+    if not assets:
+        return
+    if (not force and os.path.exists(OUTPUT)
+            and os.path.getmtime(OUTPUT) >= max(os.path.getmtime(p) for p in assets + [SCRIPT, SCREENS])):
+        return
+
+    sources = []
+    for path in assets:
+        image = parse_asset(path)
+        sources.append(image)
+        for asset, widget, name in FLATTEN:
+            if image["name"] == asset:
+                sources.append(flatten(image, widget, name, path))
+
+    images = []
+    raw_total = packed_total = 0
+    for image in sources:
+        path = image.get("source", image["name"])
+        block = BLOCK_SIZE[image["cf"]]
+        pixels = clear_transparent(image)
+        image["packed"] = rle_compress(pixels, block)
+        if rle_decompress(image["packed"], block) != pixels:
+            sys.exit("%s: RLE round trip failed" % path)
+        images.append(image)
+        packed = len(image["packed"]) + 12
+        raw_total += len(image["data"])
+        packed_total += packed
+        print("pack_images: %-24s %7d -> %6d bytes" % (image["name"], len(image["data"]), packed))
+
+    with open(OUTPUT, "w") as f:
+        f.write(emit(images))
+    print("pack_images: %d images, %d -> %d bytes of flash, %d saved"
+          % (len(images), raw_total, packed_total, raw_total - packed_total))
+
+
+if env is not None:
+    pack()
+elif __name__ == "__main__":
+    pack(force="--force" in sys.argv)
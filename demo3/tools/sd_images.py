@@ -0,0 +1,77 @@
+"""Writes the images in assets/ as LVGL .bin files for the microSD card.
+
+Every assets/*.c image, and every image pack_images.py flattens, goes to
+images/<name>.bin uncompressed: the 12-byte lv_image_header_t, then the
+rows as the C array has them. src/sd_image.cpp draws the single-plane ones
+(the flattened RGB565 images) in strips; LVGL's bin decoder takes the
+others. images/bench.bin is a full-screen RGB565 image tiled from the first
+flattened one, for -D DEMO_SD_BENCH and host/sd_bench.
+
+    python3 tools/sd_images.py [output directory, default sdcard/]
+
+Copy what is in the output directory to the root of a FAT32 card.
+"""
+
+import glob
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import pack_images  # noqa: E402
+
+PROJECT_DIR = pack_images.PROJECT_DIR
+BENCH_SIZE = (320, 240)
+
+# lv_color_format_t
+COLOR_FORMAT = {
+    "LV_COLOR_FORMAT_L8": 0x06,
+    "LV_COLOR_FORMAT_A8": 0x0E,
+    "LV_COLOR_FORMAT_RGB888": 0x0F,
+    "LV_COLOR_FORMAT_ARGB8888": 0x10,
+    "LV_COLOR_FORMAT_XRGB8888": 0x11,
+    "LV_COLOR_FORMAT_RGB565": 0x12,
+    "LV_COLOR_FORMAT_RGB565A8": 0x14,
+}
+HEADER_MAGIC = 0x19  # LV_IMAGE_HEADER_MAGIC
+
+
+def bin_image(image):
+    header = struct.pack("<BBHHHHH", HEADER_MAGIC, COLOR_FORMAT[image["cf"]], 0, image["w"], image["h"],
+                         image["stride"], 0)
+    return header + image["data"]
+
+
+def tiled(image, w, h):
+    """RGB565 image of w x h pixels with image repeated across it."""
+    src, sw, sh, stride = image["data"], image["w"], image["h"], image["stride"]
+    out = bytearray()
+    for y in range(h):
+        row = src[(y % sh) * stride:(y % sh) * stride + 2 * sw]
+        out += (row * (w // sw + 1))[:2 * w]
+    return {"name": "bench", "cf": "LV_COLOR_FORMAT_RGB565", "w": w, "h": h, "stride": 2 * w, "data": bytes(out)}
+
+
+def main():
+    out_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(PROJECT_DIR, "sdcard")
+    images = []
+    for path in sorted(glob.glob(os.path.join(pack_images.ASSETS, "*.c"))):
+        image = pack_images.parse_asset(path)
+        images.append(image)
+        for asset, widget, name in pack_images.FLATTEN:
+            if image["name"] == asset:
+                images.append(pack_images.flatten(image, widget, name, path))
+    flat = [image for image in images if image["cf"] == "LV_COLOR_FORMAT_RGB565"]
+    if flat:
+        images.append(tiled(flat[0], *BENCH_SIZE))
+
+    os.makedirs(os.path.join(out_dir, "images"), exist_ok=True)
+    for image in images:
+        path = os.path.join(out_dir, "images", image["name"] + ".bin")
+        with open(path, "wb") as f:
+            f.write(bin_image(image))
+        print("sd_images: %-40s %4dx%-4d %7d bytes" % (path, image["w"], image["h"], os.path.getsize(path)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,197 @@
+"""Local stand-in for the Open-Meteo forecast API, for -D DEMO_WEATHER.
+
+Answers every GET with one of the recorded responses in tools/weather/,
+taking them in turn, so each fetch the firmware makes changes the screen.
+The responses are sent over HTTP/1.0 with a Content-Length, as the firmware
+asks for, and can be cut into small writes with pauses in between to play
+a slow link: the parser then sees numbers, strings and escapes split across
+reads. --cut sends only the start of every other response and closes the
+connection, which the firmware has to drop while keeping the forecast it
+shows.
+
+GET /icons/<name> answers with the forecast icon of that kind of weather
+(src/weather_icons.cpp): tools/weather/icons/<name>.png or .jpg when there
+is one, else assets/icon_<name>.c as a PNG, else the partly cloudy icon,
+which is the only one the project has so far.
+
+    python3 tools/weather_server.py [--port 8080] [--chunk 64 --delay 20]
+                                    [--cut 3000] [responses.json ...]
+
+Point DEMO_WEATHER_URL at this machine. To record a new response, fetch the
+firmware's URL from the real service with its host and port swapped:
+
+    curl -o tools/weather/name.json 'https://api.open-meteo.com/v1/forecast?...'
+"""
+
+import argparse
+import glob
+import itertools
+import os
+import re
+import struct
+import sys
+import time
+import zlib
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import pack_images  # noqa: E402
+
+PROJECT_DIR = pack_images.PROJECT_DIR
+RESPONSES = os.path.join(PROJECT_DIR, "tools", "weather")
+ICONS = os.path.join(RESPONSES, "icons")
+DEFAULT_ICON = "partly_cloudy"
+
+# What src/weather_json.cpp reads; a request without them gets no rows
+REQUIRED = {
+    "current": {"temperature_2m", "apparent_temperature", "weather_code"},
+    "daily": {"weather_code", "temperature_2m_max", "precipitation_probability_max"},
+    "hourly": {"temperature_2m", "precipitation_probability", "weather_code"},
+}
+
+
+def check_query(query):
+    """Warnings for a request that does not ask for what the firmware reads."""
+    params = parse_qs(query)
+    warnings = []
+    for section, fields in REQUIRED.items():
+        asked = set(",".join(params.get(section, [])).split(","))
+        missing = sorted(fields - asked)
+        if missing:
+            warnings.append("%s= lacks %s" % (section, ",".join(missing)))
+    if params.get("temperature_unit") != ["fahrenheit"]:
+        warnings.append("temperatures are not asked for in fahrenheit")
+    return warnings
+
+
+def png(w, h, rgba):
+    """8-bit RGBA PNG, rows unfiltered."""
+
+    def chunk(kind, data):
+        return struct.pack(">I", len(data)) + kind + data + struct.pack(">I", zlib.crc32(kind + data))
+
+    rows = b"".join(b"\0" + rgba[y * w * 4 : (y + 1) * w * 4] for y in range(h))
+    return (
+        b"\x89PNG\r\n\x1a\n"
+        + chunk(b"IHDR", struct.pack(">IIBBBBB", w, h, 8, 6, 0, 0, 0))
+        + chunk(b"IDAT", zlib.compress(rows, 9))
+        + chunk(b"IEND", b"")
+    )
+
+
+def asset_png(image):
+    """PNG of an RGB565 or RGB565A8 image from pack_images.parse_asset()."""
+    if image["cf"] not in ("LV_COLOR_FORMAT_RGB565", "LV_COLOR_FORMAT_RGB565A8"):
+        sys.exit("%s: colour format %s is not supported" % (image["name"], image["cf"]))
+    w, h, stride, data = image["w"], image["h"], image["stride"], image["data"]
+    rgba = bytearray()
+    for y in range(h):
+        for x in range(w):
+            c = data[y * stride + 2 * x] | data[y * stride + 2 * x + 1] << 8
+            r, g, b = c >> 11, (c >> 5) & 0x3F, c & 0x1F
+            a = data[stride * h + y * (stride // 2) + x] if image["cf"].endswith("A8") else 255
+            rgba += bytes((r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2, a))
+    return png(w, h, bytes(rgba))
+
+
+def load_icon(name):
+    """Body, content type and where it came from, of the icon called name."""
+    for ext, content_type in ((".png", "image/png"), (".jpg", "image/jpeg")):
+        path = os.path.join(ICONS, name + ext)
+        if os.path.exists(path):
+            with open(path, "rb") as f:
+                return f.read(), content_type, path
+    for asset in (name, DEFAULT_ICON):
+        path = os.path.join(pack_images.ASSETS, "icon_%s.c" % asset)
+        if os.path.exists(path):
+            return asset_png(pack_images.parse_asset(path)), "image/png", path
+    return None, None, None
+
+
+def make_handler(options, responses):
+    turn = itertools.count()
+
+    class Handler(BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.0"
+
+        def send_icon(self, name):
+            body, content_type, source = load_icon(name) if re.fullmatch(r"[a-z_]+", name) else (None,) * 3
+            if body is None:
+                self.send_error(404)
+                return
+            self.send_response(200)
+            self.send_header("Content-Type", content_type)
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+            self.log_message("icon %s: %d bytes from %s", name, len(body), os.path.relpath(source, PROJECT_DIR))
+
+        def do_GET(self):
+            if self.path.startswith("/icons/"):
+                self.send_icon(self.path[len("/icons/") :])
+                return
+            n = next(turn)
+            name, body = responses[n % len(responses)]
+            url = urlparse(self.path)
+            for warning in check_query(url.query):
+                self.log_message("warning: %s", warning)
+
+            cut = options.cut and n % 2 == 1
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+
+            sent = body[: options.cut] if cut else body
+            step = options.chunk or len(sent)
+            start = time.monotonic()
+            try:
+                for i in range(0, len(sent), step):
+                    self.wfile.write(sent[i : i + step])
+                    self.wfile.flush()
+                    if options.delay and i + step < len(sent):
+                        time.sleep(options.delay / 1000)
+            except (BrokenPipeError, ConnectionResetError):
+                self.log_message("%s: client went away", name)
+                return
+            self.log_message(
+                "%s: %d of %d bytes in %.0f ms%s",
+                name,
+                len(sent),
+                len(body),
+                (time.monotonic() - start) * 1000,
+                ", cut" if cut else "",
+            )
+
+    return Handler
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("responses", nargs="*", help="recorded responses, default tools/weather/*.json")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--chunk", type=int, default=0, help="bytes per write, 0 for one write")
+    parser.add_argument("--delay", type=int, default=0, help="ms between writes")
+    parser.add_argument("--cut", type=int, default=0, help="send only this many bytes of every other response")
+    options = parser.parse_args()
+
+    paths = options.responses or sorted(glob.glob(os.path.join(RESPONSES, "*.json")))
+    if not paths:
+        sys.exit("no recorded responses in %s" % RESPONSES)
+    responses = []
+    for path in paths:
+        with open(path, "rb") as f:
+            responses.append((os.path.basename(path), f.read()))
+        print("%s: %d bytes" % (path, len(responses[-1][1])))
+
+    server = ThreadingHTTPServer(("", options.port), make_handler(options, responses))
+    print("serving on port %d" % options.port)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
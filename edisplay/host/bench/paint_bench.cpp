@@ -0,0 +1,135 @@
+// Microbenchmarks of the GUI_Paint primitives on a 7in5_V2 frame buffer
+// (800x480, 1 bit per pixel, 48000 bytes) and on a 2-bit 4-gray buffer.
+
+#include <benchmark/benchmark.h>
+
+#include "GUI_Paint.h"
+#include "GUI_FontCache.h"
+#include "utility/EPD_7in5_V2.h"
+
+#define BENCH_WIDTH     EPD_7IN5_V2_WIDTH
+#define BENCH_HEIGHT    EPD_7IN5_V2_HEIGHT
+#define BENCH_BYTES     (BENCH_WIDTH / 8 * BENCH_HEIGHT)
+
+static UBYTE Frame[BENCH_BYTES * 2];     // room for the 4-gray layout
+
+static void SelectFrame(UWORD Rotate, UBYTE Scale)
+{
+    Paint_NewImage(Frame, BENCH_WIDTH, BENCH_HEIGHT, Rotate, WHITE);
+    Paint_SelectImage(Frame);
+    Paint_SetScale(Scale);
+}
+
+static void BM_Paint_Clear(benchmark::State &state)
+{
+    SelectFrame(ROTATE_0, 2);
+    for (auto _ : state) {
+        Paint_Clear(WHITE);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * BENCH_BYTES);
+}
+BENCHMARK(BM_Paint_Clear);
+
+static void BM_Paint_SetPixel(benchmark::State &state)
+{
+    UBYTE Scale = (UBYTE)state.range(1);
+    UWORD Ink = Scale == 4 ? GRAY1 : BLACK;
+    UWORD Paper = Scale == 4 ? GRAY4 : WHITE;
+    SelectFrame((UWORD)state.range(0), Scale);
+    for (auto _ : state) {
+        for (UWORD y = 0; y < Paint.Height; y++)
+            for (UWORD x = 0; x < Paint.Width; x++)
+                Paint_SetPixel(x, y, ((x ^ y) & 1) ? Ink : Paper);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * BENCH_WIDTH * BENCH_HEIGHT);
+}
+BENCHMARK(BM_Paint_SetPixel)->ArgNames({"rotate", "scale"})
+    ->Args({ROTATE_0, 2})->Args({ROTATE_90, 2})->Args({ROTATE_0, 4});
+
+static void BM_Paint_DrawLine(benchmark::State &state)
+{
+    LINE_STYLE Style = state.range(0) ? LINE_STYLE_DOTTED : LINE_STYLE_SOLID;
+    SelectFrame(ROTATE_0, 2);
+    for (auto _ : state) {
+        Paint_DrawLine(0, 0, BENCH_WIDTH - 1, BENCH_HEIGHT - 1, BLACK, DOT_PIXEL_1X1, Style);
+        Paint_DrawLine(0, 240, BENCH_WIDTH - 1, 240, BLACK, DOT_PIXEL_2X2, Style);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Paint_DrawLine)->ArgName("dotted")->Arg(0)->Arg(1);
+
+static void BM_Paint_FillRectangle(benchmark::State &state)
+{
+    UWORD Size = (UWORD)state.range(0);
+    SelectFrame(ROTATE_0, 2);
+    for (auto _ : state) {
+        Paint_DrawRectangle(10, 10, 10 + Size, 10 + Size, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * Size * Size);
+}
+BENCHMARK(BM_Paint_FillRectangle)->ArgName("size")->Arg(16)->Arg(128)->Arg(400);
+
+static void BM_Paint_Circle(benchmark::State &state)
+{
+    DRAW_FILL Fill = state.range(0) ? DRAW_FILL_FULL : DRAW_FILL_EMPTY;
+    SelectFrame(ROTATE_0, 2);
+    for (auto _ : state) {
+        Paint_DrawCircle(400, 240, 200, BLACK, DOT_PIXEL_1X1, Fill);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Paint_Circle)->ArgName("filled")->Arg(0)->Arg(1);
+
+// Stock tables against the packed fonts (GUI_FontCache.h), with the glyph
+// cache warm and, to time the decode, emptied before every string
+static void BM_Paint_DrawString(benchmark::State &state)
+{
+    static const FONT_PACK *Packs[] = { &Font8_Pack, &Font12_Pack, &Font16_Pack, &Font20_Pack, &Font24_Pack };
+    static const uint8_t *Tables[] = { Font8_Table, Font12_Table, Font16_Table, Font20_Table, Font24_Table };
+    static const char *Sources[] = { "stock", "packed", "packed, cold cache" };
+    static const char Text[] = "Sunny 21C  wind 12 km/h";
+    int Source = (int)state.range(1);
+    const FONT_PACK *Pack = Packs[state.range(0)];
+    sFONT Font = { Source ? NULL : Tables[state.range(0)], Pack->Width, Pack->Height, Pack };
+    uint32_t Bytes = Source ? GUI_FontCache_PackBytes(Pack) : Pack->Count * Pack->Height * ((Pack->Width + 7) / 8);
+
+    SelectFrame(ROTATE_0, 2);
+    GUI_FontCache_Clear();
+    for (auto _ : state) {
+        if (Source == 2)
+            GUI_FontCache_Clear();
+        Paint_DrawString_EN(10, 10, Text, &Font, BLACK, WHITE);
+        benchmark::ClobberMemory();
+    }
+    state.SetLabel(std::to_string(Font.Height) + " px " + Sources[Source] + ", " + std::to_string(Bytes) +
+                   " bytes of flash");
+    state.SetItemsProcessed(state.iterations() * (sizeof(Text) - 1));
+}
+BENCHMARK(BM_Paint_DrawString)->ArgNames({"font", "src"})->ArgsProduct({{0, 1, 2, 3, 4}, {0, 1, 2}});
+
+static void BM_Paint_DrawNum(benchmark::State &state)
+{
+    SelectFrame(ROTATE_0, 2);
+    for (auto _ : state) {
+        Paint_DrawNum(10, 100, 1234567, &Font24, BLACK, WHITE);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Paint_DrawNum);
+
+static void BM_Paint_DrawBitMap(benchmark::State &state)
+{
+    static UBYTE Source[BENCH_BYTES];
+    for (size_t i = 0; i < sizeof(Source); i++)
+        Source[i] = (UBYTE)(i * 37);
+    SelectFrame(ROTATE_0, 2);
+    for (auto _ : state) {
+        Paint_DrawBitMap(Source);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * BENCH_BYTES);
+}
+BENCHMARK(BM_Paint_DrawBitMap);
@@ -0,0 +1,149 @@
+// Microbenchmarks of the driver transfer paths over the mock HAL.
+//
+// Wall time is the CPU cost of the drivers' bit-banged SPI on the host, a
+// proxy for the GPIO work on the ESP32. The counters report what one
+// iteration put on the bus: command and data bytes, chip-select cycles and
+// pin writes, plus the virtual time the driver spent in delays and BUSY.
+
+#include <benchmark/benchmark.h>
+
+#include "DEV_Config.h"
+#include "MockHal.h"
+#include "utility/EPD_2in13d.h"
+#include "utility/EPD_2in9_V2.h"
+#include "utility/EPD_4in2.h"
+#include "utility/EPD_7in5_V2.h"
+
+static UBYTE Frame[EPD_7IN5_V2_WIDTH / 8 * EPD_7IN5_V2_HEIGHT];
+
+// Nominal controller busy times, the refresh itself is not modelled here
+static uint32_t UcBusyMs(uint8_t Cmd)
+{
+    return Cmd == 0x04 ? 40 : 0;            // power on
+}
+
+static uint32_t SsdBusyMs(uint8_t Cmd)
+{
+    return Cmd == 0x12 ? 10 : 0;            // SW reset
+}
+
+static void Setup(uint8_t BusyLevel, MOCKHAL_BUSY_FN BusyFn)
+{
+    MockHal_Reset();
+    MockHal_SetBusyLevel(BusyLevel);
+    MockHal_SetBusyFn(BusyFn);
+    for (size_t i = 0; i < sizeof(Frame); i++)
+        Frame[i] = (UBYTE)(i * 13);
+}
+
+static void Report(benchmark::State &state, const MOCKHAL_STATS *Before, uint32_t StartMs)
+{
+    const MOCKHAL_STATS *s = MockHal_Stats();
+    double n = (double)state.iterations();
+    if (n == 0)
+        return;
+    state.counters["cmds"] = (s->Commands - Before->Commands) / n;
+    state.counters["data"] = (s->DataBytes - Before->DataBytes) / n;
+    state.counters["cs"] = (s->CsCycles - Before->CsCycles) / n;
+    state.counters["pins"] = (s->PinWrites - Before->PinWrites) / n;
+    state.counters["virt_ms"] = (MockHal_Clock() - StartMs) / n;
+    state.SetBytesProcessed((int64_t)(s->DataBytes - Before->DataBytes));
+    if (s->BusyFlips)
+        state.SkipWithError("BUSY polarity of the benchmark is wrong");
+}
+
+#define RUN(state, body)                                    \
+    do {                                                    \
+        MOCKHAL_STATS Before = *MockHal_Stats();            \
+        uint32_t StartMs = MockHal_Clock();                 \
+        for (auto _ : state) {                              \
+            body;                                           \
+        }                                                   \
+        Report(state, &Before, StartMs);                    \
+    } while (0)
+
+/**
+ * Bus primitives of DEV_Config
+**/
+static void BM_DEV_SPI_WriteByte(benchmark::State &state)
+{
+    UDOUBLE Len = (UDOUBLE)state.range(0);
+    Setup(0, NULL);
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    RUN(state, for (UDOUBLE i = 0; i < Len; i++) DEV_SPI_WriteByte(Frame[i]));
+}
+BENCHMARK(BM_DEV_SPI_WriteByte)->ArgName("len")->Arg(16)->Arg(4096);
+
+static void BM_DEV_SPI_Write_nByte(benchmark::State &state)
+{
+    UDOUBLE Len = (UDOUBLE)state.range(0);
+    Setup(0, NULL);
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    RUN(state, DEV_SPI_Write_nByte(Frame, Len));
+}
+BENCHMARK(BM_DEV_SPI_Write_nByte)->ArgName("len")->Arg(16)->Arg(4096);
+
+/**
+ * 7in5_V2 (UC8179, BUSY low)
+**/
+static void BM_EPD_7IN5_V2_Init(benchmark::State &state)
+{
+    Setup(0, UcBusyMs);
+    RUN(state, EPD_7IN5_V2_Init());
+}
+BENCHMARK(BM_EPD_7IN5_V2_Init);
+
+static void BM_EPD_7IN5_V2_Display(benchmark::State &state)
+{
+    Setup(0, UcBusyMs);
+    EPD_7IN5_V2_Init();
+    RUN(state, EPD_7IN5_V2_Display(Frame));
+}
+BENCHMARK(BM_EPD_7IN5_V2_Display)->Unit(benchmark::kMillisecond);
+
+static void BM_EPD_7IN5_V2_Display_Part(benchmark::State &state)
+{
+    Setup(0, UcBusyMs);
+    EPD_7IN5_V2_Init_Part();
+    RUN(state, EPD_7IN5_V2_Display_Part(Frame, 200, 120, 600, 360));
+}
+BENCHMARK(BM_EPD_7IN5_V2_Display_Part)->Unit(benchmark::kMillisecond);
+
+/**
+ * 2in9_V2 (SSD1680, BUSY high)
+**/
+static void BM_EPD_2IN9_V2_Display(benchmark::State &state)
+{
+    Setup(1, SsdBusyMs);
+    EPD_2IN9_V2_Init();
+    RUN(state, EPD_2IN9_V2_Display(Frame));
+}
+BENCHMARK(BM_EPD_2IN9_V2_Display);
+
+static void BM_EPD_2IN9_V2_Display_Partial(benchmark::State &state)
+{
+    Setup(1, SsdBusyMs);
+    EPD_2IN9_V2_Init();
+    EPD_2IN9_V2_Display_Base(Frame);
+    RUN(state, EPD_2IN9_V2_Display_Partial(Frame));
+}
+BENCHMARK(BM_EPD_2IN9_V2_Display_Partial);
+
+/**
+ * LUT-driven UC81xx panels, BUSY low behind 0x71
+**/
+static void BM_EPD_4IN2_4GrayDisplay(benchmark::State &state)
+{
+    Setup(0, UcBusyMs);
+    EPD_4IN2_Init_4Gray();
+    RUN(state, EPD_4IN2_4GrayDisplay(Frame));
+}
+BENCHMARK(BM_EPD_4IN2_4GrayDisplay);
+
+static void BM_EPD_2IN13D_DisplayPart(benchmark::State &state)
+{
+    Setup(0, UcBusyMs);
+    EPD_2IN13D_Init();
+    RUN(state, EPD_2IN13D_DisplayPart(Frame));
+}
+BENCHMARK(BM_EPD_2IN13D_DisplayPart);
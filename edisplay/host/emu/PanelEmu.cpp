@@ -0,0 +1,541 @@
+// Virtual e-paper panel, see PanelEmu.h.
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "MockHal.h"
+#include "PanelEmu.h"
+#include "Png.h"
+
+const EMU_PANEL EMU_PANEL_7IN5_V2 = {
+    "7in5_V2 (UC8179)", EMU_UC8179, 800, 480,
+    4000000, 500,
+    5000, 1500, 400, 4000,      // full, fast, partial, 4-gray
+    40, 20, 0,                  // power on, power off, -
+};
+
+const EMU_PANEL EMU_PANEL_2IN9_V2 = {
+    "2in9_V2 (SSD1680)", EMU_SSD1680, 128, 296,
+    4000000, 500,
+    3000, 1500, 300, 3000,
+    20, 20, 10,                 // analog on/off sequence, -, SW reset
+};
+
+#define EMU_MAX_VIOLATIONS  256
+
+static struct {
+    const EMU_PANEL *Panel;
+    uint32_t RowBytes;
+
+    uint8_t Cmd;
+    uint32_t Param;             // data bytes since the command
+    uint8_t Buf[16];
+    bool Flagged;               // one violation per command at most
+    uint32_t BusyUntil;
+    uint32_t PendingBusyMs;     // handed to MockHal by OnBusy()
+    bool Asleep;
+    uint8_t Plane;
+
+    // UC8179
+    bool Powered;
+    bool Partial;
+    bool TempForced;
+    uint8_t ForcedTemp;
+    uint8_t Ddx;                // 0x50 DDX[0]: 1 inverts the new data
+    uint16_t Px0, Px1, Py0, Py1;
+    uint32_t RamPtr;
+
+    // SSD1680
+    uint8_t Entry;
+    uint8_t Update;
+    uint16_t Xs, Xe, Ys, Ye, Xc, Yc;
+
+    MOCKHAL_STATS Mark;         // bus counters at the previous refresh
+    uint32_t MarkMs;
+    size_t MarkViolations;
+    uint32_t LostViolations;
+} Emu;
+
+static std::string Prefix;              // PNG path prefix, empty: none
+static std::vector<uint8_t> Ram[2];     // UC: 0x10 old / 0x13 new, SSD: 0x24 BW / 0x26 red
+static std::vector<uint8_t> Image;
+static std::vector<EMU_REFRESH> Refreshes;
+static std::vector<EMU_VIOLATION> Violations;
+
+static void Violate(const char *What)
+{
+    if (Emu.Flagged)
+        return;
+    Emu.Flagged = true;
+    if (Violations.size() >= EMU_MAX_VIOLATIONS) {
+        Emu.LostViolations++;
+        return;
+    }
+    EMU_VIOLATION v = { MockHal_Clock(), Emu.Cmd, What };
+    Violations.push_back(v);
+}
+
+static void Defaults(void)
+{
+    const EMU_PANEL *p = Emu.Panel;
+    Emu.Asleep = false;
+    Emu.BusyUntil = 0;
+    Emu.Plane = 0;
+
+    Emu.Powered = false;
+    Emu.Partial = false;
+    Emu.TempForced = false;
+    Emu.ForcedTemp = 0;
+    Emu.Ddx = 1;                // 0x50 resets to 0x31
+    Emu.Px0 = 0;
+    Emu.Px1 = p->Width - 1;
+    Emu.Py0 = 0;
+    Emu.Py1 = p->Height - 1;
+    Emu.RamPtr = 0;
+
+    Emu.Entry = 0x03;
+    Emu.Update = 0xFF;
+    Emu.Xs = 0;
+    Emu.Xe = 0x15;              // 176 sources
+    Emu.Ys = 0;
+    Emu.Ye = 0x127;             // 296 gates
+    Emu.Xc = 0;
+    Emu.Yc = 0;
+}
+
+/**
+ * Refresh: update the image, record the timing
+**/
+static void Refresh(const char *Kind, uint16_t X0, uint16_t Y0, uint16_t X1, uint16_t Y1, uint32_t BusyMs)
+{
+    const EMU_PANEL *p = Emu.Panel;
+    const MOCKHAL_STATS *s = MockHal_Stats();
+    EMU_REFRESH r;
+
+    r.Index = (uint32_t)Refreshes.size();
+    r.Kind = Kind;
+    r.X0 = X0;
+    r.Y0 = Y0;
+    r.X1 = X1;
+    r.Y1 = Y1;
+    r.Commands = s->Commands - Emu.Mark.Commands + 1;     // this command is not counted yet
+    r.DataBytes = s->DataBytes - Emu.Mark.DataBytes;
+    r.CsCycles = s->CsCycles - Emu.Mark.CsCycles;
+    r.WireMs = (r.Commands + r.DataBytes) * 8000.0 / p->SpiHz + r.CsCycles * (p->CsOverheadNs / 1e6);
+    r.BusyMs = BusyMs;
+    r.HostMs = MockHal_Clock() - Emu.MarkMs;
+    r.Changed = 0;
+
+    bool Gray = strcmp(Kind, "4-gray") == 0;
+    for (uint32_t y = Y0; y <= Y1; y++) {
+        for (uint32_t x = X0; x <= X1; x++) {
+            size_t i = y * Emu.RowBytes + x / 8;
+            uint8_t Mask = 0x80 >> (x & 7);
+            uint8_t Bit0 = (Ram[0][i] & Mask) ? 1 : 0;
+            uint8_t Bit1 = (Ram[1][i] & Mask) ? 1 : 0;
+            uint8_t Px;
+            if (p->Controller == EMU_UC8179) {
+                static const uint8_t Levels[4] = { 255, 170, 85, 0 };
+                Px = Gray ? Levels[(Bit0 << 1) | Bit1] : ((Bit1 ^ Emu.Ddx) ? 0 : 255);
+            } else {
+                Px = Bit0 ? 255 : 0;
+            }
+            uint8_t &Dst = Image[y * p->Width + x];
+            if (Dst != Px) {
+                Dst = Px;
+                r.Changed++;
+            }
+        }
+    }
+
+    r.Violations = (uint32_t)(Violations.size() - Emu.MarkViolations);
+    Refreshes.push_back(r);
+
+    Emu.Mark = *s;
+    Emu.Mark.Commands++;
+    Emu.MarkMs = MockHal_Clock();
+    Emu.MarkViolations = Violations.size();
+    Emu.PendingBusyMs = BusyMs;
+
+    if (!Prefix.empty()) {
+        char Path[512];
+        snprintf(Path, sizeof(Path), "%s-%02u-%s.png", Prefix.c_str(), (unsigned)r.Index, Kind);
+        if (!Png_WriteGray(Path, &Image[0], p->Width, p->Height))
+            fprintf(stderr, "panel emulator: cannot write %s\n", Path);
+    }
+}
+
+/**
+ * UC8179
+**/
+static void UcCommand(uint8_t Cmd)
+{
+    const EMU_PANEL *p = Emu.Panel;
+    switch (Cmd) {
+    case 0x04:
+        Emu.Powered = true;
+        Emu.PendingBusyMs = p->PowerOnMs;
+        break;
+    case 0x02:
+        Emu.Powered = false;
+        Emu.PendingBusyMs = p->PowerOffMs;
+        break;
+    case 0x10:
+    case 0x13:
+        Emu.Plane = Cmd == 0x10 ? 0 : 1;
+        Emu.RamPtr = 0;
+        break;
+    case 0x91:
+        Emu.Partial = true;
+        break;
+    case 0x92:
+        Emu.Partial = false;
+        break;
+    case 0x12: {
+        const char *Kind = "full";
+        uint16_t Ms = p->FullMs;
+        if (Emu.Partial) {
+            Kind = "partial";
+            Ms = p->PartialMs;
+        } else if (Emu.TempForced && Emu.ForcedTemp == 0x5F) {
+            Kind = "4-gray";
+            Ms = p->GrayMs;
+        } else if (Emu.TempForced && Emu.ForcedTemp == 0x5A) {
+            Kind = "fast";
+            Ms = p->FastMs;
+        }
+        if (!Emu.Powered) {
+            Violate("refresh with the booster off");
+            return;
+        }
+        if (Emu.Partial)
+            Refresh(Kind, Emu.Px0, Emu.Py0, Emu.Px1, Emu.Py1, Ms);
+        else
+            Refresh(Kind, 0, 0, p->Width - 1, p->Height - 1, Ms);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+static void UcRamWrite(uint8_t Value)
+{
+    uint32_t Row, Rows, RowBytes, X0, Y0;
+    if (Emu.Partial) {
+        X0 = Emu.Px0 / 8;
+        Y0 = Emu.Py0;
+        RowBytes = (Emu.Px1 - Emu.Px0 + 1) / 8;
+        Rows = Emu.Py1 - Emu.Py0 + 1;
+    } else {
+        X0 = 0;
+        Y0 = 0;
+        RowBytes = Emu.RowBytes;
+        Rows = Emu.Panel->Height;
+    }
+    Row = Emu.RamPtr / RowBytes;
+    if (Row >= Rows) {
+        Violate("RAM write past the window");
+        return;
+    }
+    Ram[Emu.Plane][(Y0 + Row) * Emu.RowBytes + X0 + Emu.RamPtr % RowBytes] = Value;
+    Emu.RamPtr++;
+}
+
+static void UcData(uint8_t Value, uint32_t Param)
+{
+    const EMU_PANEL *p = Emu.Panel;
+    if (Param < sizeof(Emu.Buf))
+        Emu.Buf[Param] = Value;
+
+    switch (Emu.Cmd) {
+    case 0x10:
+    case 0x13:
+        UcRamWrite(Value);
+        break;
+    case 0x07:
+        if (Value == 0xA5)
+            Emu.Asleep = true;
+        break;
+    case 0x50:
+        if (Param == 0)
+            Emu.Ddx = Value & 0x01;
+        break;
+    case 0x61:
+        if (Param == 3) {
+            uint16_t W = (uint16_t)((Emu.Buf[0] << 8) | Emu.Buf[1]);
+            uint16_t H = (uint16_t)((Emu.Buf[2] << 8) | Emu.Buf[3]);
+            if (W != p->Width || H != p->Height)
+                Violate("resolution does not match the panel");
+        }
+        break;
+    case 0x90:
+        if (Param == 7) {
+            uint16_t X0 = (uint16_t)((Emu.Buf[0] << 8) | Emu.Buf[1]) & ~7;
+            uint16_t X1 = (uint16_t)((Emu.Buf[2] << 8) | Emu.Buf[3]) | 7;
+            uint16_t Y0 = (uint16_t)((Emu.Buf[4] << 8) | Emu.Buf[5]);
+            uint16_t Y1 = (uint16_t)((Emu.Buf[6] << 8) | Emu.Buf[7]);
+            if (X0 > X1 || Y0 > Y1 || X1 >= p->Width || Y1 >= p->Height) {
+                Violate("partial window outside the panel");
+                X1 = X1 < p->Width ? X1 : p->Width - 1;
+                Y1 = Y1 < p->Height ? Y1 : p->Height - 1;
+                X0 = X0 <= X1 ? X0 : X1 & ~7;
+                Y0 = Y0 <= Y1 ? Y0 : Y1;
+            }
+            Emu.Px0 = X0;
+            Emu.Px1 = X1;
+            Emu.Py0 = Y0;
+            Emu.Py1 = Y1;
+        }
+        break;
+    case 0xE0:
+        Emu.TempForced = (Value & 0x02) != 0;
+        break;
+    case 0xE5:
+        Emu.ForcedTemp = Value;
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * SSD1680
+**/
+static bool StepCounter(uint16_t &Counter, uint16_t Start, uint16_t End, bool Increment, uint16_t Mask)
+{
+    if (Counter == End) {
+        Counter = Start;
+        return true;
+    }
+    Counter = (uint16_t)((Increment ? Counter + 1 : Counter - 1) & Mask);
+    return false;
+}
+
+static void SsdRamWrite(uint8_t Value)
+{
+    if (Emu.Xc < Emu.RowBytes && Emu.Yc < Emu.Panel->Height)
+        Ram[Emu.Plane][Emu.Yc * Emu.RowBytes + Emu.Xc] = Value;
+
+    bool XInc = Emu.Entry & 0x01, YInc = Emu.Entry & 0x02;
+    if (!(Emu.Entry & 0x04)) {
+        if (StepCounter(Emu.Xc, Emu.Xs, Emu.Xe, XInc, 0x3F))
+            StepCounter(Emu.Yc, Emu.Ys, Emu.Ye, YInc, 0x1FF);
+    } else {
+        if (StepCounter(Emu.Yc, Emu.Ys, Emu.Ye, YInc, 0x1FF))
+            StepCounter(Emu.Xc, Emu.Xs, Emu.Xe, XInc, 0x3F);
+    }
+}
+
+static void SsdCommand(uint8_t Cmd)
+{
+    const EMU_PANEL *p = Emu.Panel;
+    switch (Cmd) {
+    case 0x12:
+        Defaults();
+        Emu.PendingBusyMs = p->SwResetMs;
+        break;
+    case 0x24:
+    case 0x26:
+        Emu.Plane = Cmd == 0x24 ? 0 : 1;
+        break;
+    case 0x20:
+        if (!(Emu.Update & 0x04)) {
+            Emu.PendingBusyMs = p->PowerOnMs;       // clock/analog/LUT load only
+        } else if (Emu.Update & 0x08) {
+            Refresh("partial", 0, 0, p->Width - 1, p->Height - 1, p->PartialMs);
+        } else {
+            Refresh("full", 0, 0, p->Width - 1, p->Height - 1, p->FullMs);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void SsdData(uint8_t Value, uint32_t Param)
+{
+    const EMU_PANEL *p = Emu.Panel;
+    if (Param < sizeof(Emu.Buf))
+        Emu.Buf[Param] = Value;
+
+    switch (Emu.Cmd) {
+    case 0x24:
+    case 0x26:
+        SsdRamWrite(Value);
+        break;
+    case 0x01:
+        if (Param == 1 && (uint16_t)((Emu.Buf[0] | (Emu.Buf[1] & 0x01) << 8) + 1) != p->Height)
+            Violate("gate count does not match the panel");
+        break;
+    case 0x10:
+        if (Value & 0x03)
+            Emu.Asleep = true;
+        break;
+    case 0x11:
+        Emu.Entry = Value & 0x07;
+        break;
+    case 0x22:
+        Emu.Update = Value;
+        break;
+    case 0x44:
+        if (Param == 0)
+            Emu.Xs = Value & 0x3F;
+        else if (Param == 1)
+            Emu.Xe = Value & 0x3F;
+        break;
+    case 0x45:
+        if (Param == 1)
+            Emu.Ys = (uint16_t)((Emu.Buf[0] | Emu.Buf[1] << 8) & 0x1FF);
+        else if (Param == 3)
+            Emu.Ye = (uint16_t)((Emu.Buf[2] | Emu.Buf[3] << 8) & 0x1FF);
+        break;
+    case 0x4E:
+        Emu.Xc = Value & 0x3F;
+        break;
+    case 0x4F:
+        if (Param == 1)
+            Emu.Yc = (uint16_t)((Emu.Buf[0] | Emu.Buf[1] << 8) & 0x1FF);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * MockHal hooks
+**/
+static void OnByte(const MOCKHAL_BYTE *b)
+{
+    bool Uc = Emu.Panel->Controller == EMU_UC8179;
+
+    if (!b->IsData) {
+        Emu.Cmd = b->Value;
+        Emu.Param = 0;
+        Emu.Flagged = false;
+        Emu.PendingBusyMs = 0;
+        if (Emu.Asleep) {
+            Violate("command in deep sleep");
+            return;
+        }
+        if (b->Ms < Emu.BusyUntil && !(Uc && b->Value == 0x71))
+            Violate("command while busy");
+        if (Uc)
+            UcCommand(b->Value);
+        else
+            SsdCommand(b->Value);
+        return;
+    }
+
+    if (Emu.Asleep) {
+        Violate("data in deep sleep");
+        return;
+    }
+    if (b->Ms < Emu.BusyUntil)
+        Violate("data while busy");
+    if (Uc)
+        UcData(b->Value, Emu.Param);
+    else
+        SsdData(b->Value, Emu.Param);
+    Emu.Param++;
+}
+
+static uint32_t OnBusy(uint8_t Cmd)
+{
+    (void)Cmd;
+    uint32_t Ms = Emu.PendingBusyMs;
+    Emu.PendingBusyMs = 0;
+    if (Ms)
+        Emu.BusyUntil = MockHal_Clock() + Ms;
+    return Ms;
+}
+
+static void OnReset(void)
+{
+    Defaults();     // registers only, RAM and image survive a reset
+}
+
+void PanelEmu_Attach(const EMU_PANEL *Panel, const char *OutPrefix)
+{
+    memset(&Emu, 0, sizeof(Emu));
+    Emu.Panel = Panel;
+    Prefix = OutPrefix ? OutPrefix : "";
+    Emu.RowBytes = (Panel->Width + 7) / 8;
+    Defaults();
+
+    for (int i = 0; i < 2; i++)
+        Ram[i].assign((size_t)Emu.RowBytes * Panel->Height, 0x00);
+    Image.assign((size_t)Panel->Width * Panel->Height, 255);
+    Refreshes.clear();
+    Violations.clear();
+
+    MockHal_Reset();
+    MockHal_SetBusyLevel(Panel->Controller == EMU_UC8179 ? 0 : 1);
+    MockHal_SetByteFn(OnByte);
+    MockHal_SetBusyFn(OnBusy);
+    MockHal_SetResetFn(OnReset);
+}
+
+void PanelEmu_Detach(void)
+{
+    MockHal_SetByteFn(NULL);
+    MockHal_SetBusyFn(NULL);
+    MockHal_SetResetFn(NULL);
+}
+
+const uint8_t *PanelEmu_Image(void)
+{
+    return Image.empty() ? NULL : &Image[0];
+}
+
+const EMU_REFRESH *PanelEmu_Refreshes(size_t *Count)
+{
+    *Count = Refreshes.size();
+    return Refreshes.empty() ? NULL : &Refreshes[0];
+}
+
+const EMU_VIOLATION *PanelEmu_Violations(size_t *Count)
+{
+    *Count = Violations.size();
+    return Violations.empty() ? NULL : &Violations[0];
+}
+
+void PanelEmu_Report(FILE *Out)
+{
+    const EMU_PANEL *p = Emu.Panel;
+    double Wire = 0;
+    uint32_t Busy = 0;
+
+    fprintf(Out, "%s: SPI %.1f MHz, %u ns per CS cycle\n", p->Name, p->SpiHz / 1e6, p->CsOverheadNs);
+    fprintf(Out, "   #  kind     area                 cmds    data     cs   wire ms  busy ms  host ms  changed  viol\n");
+    for (size_t i = 0; i < Refreshes.size(); i++) {
+        const EMU_REFRESH *r = &Refreshes[i];
+        char Area[32];
+        snprintf(Area, sizeof(Area), "%u,%u-%u,%u", r->X0, r->Y0, r->X1, r->Y1);
+        fprintf(Out, "  %2u  %-7s  %-17s %6lu %7lu %6lu %9.1f %8lu %8lu %8lu %5lu\n",
+                (unsigned)r->Index, r->Kind, Area, (unsigned long)r->Commands,
+                (unsigned long)r->DataBytes, (unsigned long)r->CsCycles, r->WireMs,
+                (unsigned long)r->BusyMs, (unsigned long)r->HostMs,
+                (unsigned long)r->Changed, (unsigned long)r->Violations);
+        Wire += r->WireMs;
+        Busy += r->BusyMs;
+    }
+    fprintf(Out, "  total: %u refreshes, wire %.1f ms, busy %lu ms\n",
+            (unsigned)Refreshes.size(), Wire, (unsigned long)Busy);
+
+    for (size_t i = 0; i < Violations.size(); i++)
+        fprintf(Out, "  violation at %lu ms, cmd 0x%02X: %s\n",
+                (unsigned long)Violations[i].Ms, Violations[i].Cmd, Violations[i].What);
+    if (Emu.LostViolations)
+        fprintf(Out, "  ... %lu more violations\n", (unsigned long)Emu.LostViolations);
+}
+
+bool PanelEmu_WriteReport(const char *Path)
+{
+    FILE *f = fopen(Path, "w");
+    if (!f)
+        return false;
+    PanelEmu_Report(f);
+    return fclose(f) == 0;
+}
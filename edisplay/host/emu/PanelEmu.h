@@ -0,0 +1,87 @@
+// Virtual e-paper panel on top of MockHal.
+//
+// Decodes the command stream the drivers put on the mock SPI bus for two
+// controller families and keeps the panel image, a timing model and a list
+// of protocol violations:
+//
+//   UC8179 (7in5_V2):  0x10/0x13 RAM, 0x91/0x90/0x92 partial window,
+//                      0x04/0x02 power, 0x12 refresh, 0x50 data polarity,
+//                      0xE0/0xE5 forced temperature (fast / 4-gray)
+//   SSD1680 (2in9_V2): 0x24/0x26 RAM, 0x11 entry mode, 0x44/0x45 window,
+//                      0x4E/0x4F counters, 0x22 + 0x20 update, 0x12 reset
+//
+// Timing: wire time is the bytes since the previous refresh at SpiHz plus
+// CsOverheadNs per chip-select cycle, busy time is the nominal duration of
+// the controller operation. Both are modelled, the driver's own delays show
+// up separately as the virtual time MockHal spent between refreshes.
+//
+// Violations: bytes sent while BUSY is asserted (except the UC81xx 0x71
+// status poll) or while in deep sleep, a UC8179 refresh with the booster
+// off, RAM writes past the window, partial windows outside the panel and
+// a gate count that does not match the panel.
+//
+// Each refresh records an EMU_REFRESH and, with an output prefix set,
+// writes <prefix>-NN-<kind>.png.
+
+#ifndef _PANEL_EMU_H_
+#define _PANEL_EMU_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+typedef enum {
+    EMU_UC8179 = 0,
+    EMU_SSD1680,
+} EMU_CONTROLLER;
+
+typedef struct {
+    const char *Name;
+    EMU_CONTROLLER Controller;
+    uint16_t Width;
+    uint16_t Height;
+    uint32_t SpiHz;
+    uint16_t CsOverheadNs;      // CS/DC setup and hold per chip-select cycle
+    uint16_t FullMs;            // nominal busy times
+    uint16_t FastMs;
+    uint16_t PartialMs;
+    uint16_t GrayMs;
+    uint16_t PowerOnMs;         // UC: 0x04, SSD: 0x22 sequence without display
+    uint16_t PowerOffMs;
+    uint16_t SwResetMs;
+} EMU_PANEL;
+
+typedef struct {
+    uint32_t Index;
+    const char *Kind;           // full, fast, partial, 4-gray
+    uint16_t X0, Y0, X1, Y1;    // refreshed area, inclusive
+    uint32_t Commands;          // bus traffic since the previous refresh
+    uint32_t DataBytes;
+    uint32_t CsCycles;
+    double WireMs;
+    uint32_t BusyMs;
+    uint32_t HostMs;            // virtual time since the previous refresh
+    uint32_t Changed;           // pixels that changed on the panel
+    uint32_t Violations;        // new since the previous refresh
+} EMU_REFRESH;
+
+typedef struct {
+    uint32_t Ms;
+    uint8_t Cmd;
+    const char *What;
+} EMU_VIOLATION;
+
+extern const EMU_PANEL EMU_PANEL_7IN5_V2;
+extern const EMU_PANEL EMU_PANEL_2IN9_V2;
+
+// Resets MockHal and hooks the emulator into it. OutPrefix NULL: no PNGs.
+void PanelEmu_Attach(const EMU_PANEL *Panel, const char *OutPrefix);
+void PanelEmu_Detach(void);
+
+const uint8_t *PanelEmu_Image(void);        // 8-bit gray, 0 black, 255 white
+const EMU_REFRESH *PanelEmu_Refreshes(size_t *Count);
+const EMU_VIOLATION *PanelEmu_Violations(size_t *Count);
+void PanelEmu_Report(FILE *Out);
+bool PanelEmu_WriteReport(const char *Path);
+
+#endif
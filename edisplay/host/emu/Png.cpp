@@ -0,0 +1,96 @@
+// Minimal PNG writer, see Png.h.
+
+#include <stdio.h>
+#include <vector>
+
+#include "Png.h"
+
+static uint32_t Crc32(uint32_t Crc, const uint8_t *Data, size_t Len)
+{
+    static uint32_t Table[256];
+    if (!Table[1]) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            Table[n] = c;
+        }
+    }
+    Crc = ~Crc;
+    for (size_t i = 0; i < Len; i++)
+        Crc = Table[(Crc ^ Data[i]) & 0xFF] ^ (Crc >> 8);
+    return ~Crc;
+}
+
+static void Put32(std::vector<uint8_t> &Out, uint32_t Value)
+{
+    Out.push_back((uint8_t)(Value >> 24));
+    Out.push_back((uint8_t)(Value >> 16));
+    Out.push_back((uint8_t)(Value >> 8));
+    Out.push_back((uint8_t)Value);
+}
+
+static void Chunk(std::vector<uint8_t> &Out, const char *Type, const std::vector<uint8_t> &Data)
+{
+    Put32(Out, (uint32_t)Data.size());
+    size_t Start = Out.size();
+    Out.insert(Out.end(), Type, Type + 4);
+    Out.insert(Out.end(), Data.begin(), Data.end());
+    Put32(Out, Crc32(0, &Out[Start], Out.size() - Start));
+}
+
+bool Png_WriteGray(const char *Path, const uint8_t *Pixels, uint32_t Width, uint32_t Height)
+{
+    static const uint8_t Signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    std::vector<uint8_t> Out(Signature, Signature + 8);
+    std::vector<uint8_t> Data;
+
+    Put32(Data, Width);
+    Put32(Data, Height);
+    Data.push_back(8);      // bit depth
+    Data.push_back(0);      // grayscale
+    Data.push_back(0);      // deflate
+    Data.push_back(0);      // adaptive filtering
+    Data.push_back(0);      // no interlace
+    Chunk(Out, "IHDR", Data);
+
+    // Scanlines with filter type 0, wrapped in stored deflate blocks
+    std::vector<uint8_t> Raw;
+    Raw.reserve((size_t)(Width + 1) * Height);
+    for (uint32_t y = 0; y < Height; y++) {
+        Raw.push_back(0);
+        Raw.insert(Raw.end(), Pixels + (size_t)y * Width, Pixels + (size_t)(y + 1) * Width);
+    }
+
+    uint32_t A = 1, B = 0;
+    for (size_t i = 0; i < Raw.size(); i++) {
+        A = (A + Raw[i]) % 65521;
+        B = (B + A) % 65521;
+    }
+
+    Data.clear();
+    Data.push_back(0x78);
+    Data.push_back(0x01);
+    size_t Pos = 0;
+    do {
+        size_t Len = Raw.size() - Pos < 65535 ? Raw.size() - Pos : 65535;
+        Data.push_back(Pos + Len == Raw.size() ? 1 : 0);
+        Data.push_back((uint8_t)Len);
+        Data.push_back((uint8_t)(Len >> 8));
+        Data.push_back((uint8_t)~Len);
+        Data.push_back((uint8_t)(~Len >> 8));
+        Data.insert(Data.end(), Raw.begin() + Pos, Raw.begin() + Pos + Len);
+        Pos += Len;
+    } while (Pos < Raw.size());
+    Put32(Data, (B << 16) | A);
+    Chunk(Out, "IDAT", Data);
+
+    Data.clear();
+    Chunk(Out, "IEND", Data);
+
+    FILE *f = fopen(Path, "wb");
+    if (!f)
+        return false;
+    bool Ok = fwrite(&Out[0], 1, Out.size(), f) == Out.size();
+    return fclose(f) == 0 && Ok;
+}
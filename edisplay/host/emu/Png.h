@@ -0,0 +1,11 @@
+// Minimal PNG writer for the panel emulator: 8-bit grayscale, stored
+// (uncompressed) deflate blocks, no dependency on zlib.
+
+#ifndef _EMU_PNG_H_
+#define _EMU_PNG_H_
+
+#include <stdint.h>
+
+bool Png_WriteGray(const char *Path, const uint8_t *Pixels, uint32_t Width, uint32_t Height);
+
+#endif
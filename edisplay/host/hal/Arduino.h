@@ -0,0 +1,54 @@
+// Host replacement for the Arduino core header, backed by MockHal.
+
+#ifndef _MOCK_ARDUINO_H_
+#define _MOCK_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "MockHal.h"
+
+#define HIGH            0x1
+#define LOW             0x0
+#define INPUT           0x01
+#define OUTPUT          0x03
+#define INPUT_PULLUP    0x05
+
+#define PROGMEM
+#define pgm_read_byte(addr)     (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)     (*(const uint16_t *)(addr))
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+void pinMode(uint8_t Pin, uint8_t Mode);
+void digitalWrite(uint8_t Pin, uint8_t Level);
+int digitalRead(uint8_t Pin);
+void delay(uint32_t Ms);
+void delayMicroseconds(uint32_t Us);
+unsigned long millis(void);
+unsigned long micros(void);
+void yield(void);
+
+class HardwareSerial {
+public:
+    void begin(unsigned long Baud);
+    size_t print(const char *Text);
+    size_t print(char C);
+    size_t print(int Value);
+    size_t print(unsigned int Value);
+    size_t print(long Value);
+    size_t print(unsigned long Value);
+    size_t print(double Value);
+    size_t println(void);
+    size_t println(const char *Text);
+    size_t println(int Value);
+    size_t printf(const char *Format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+extern HardwareSerial Serial;
+
+#endif
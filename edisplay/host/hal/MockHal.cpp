@@ -0,0 +1,273 @@
+// Mock Arduino HAL, see MockHal.h.
+
+#include <stdarg.h>
+#include <vector>
+
+#include "Arduino.h"
+#include "SPI.h"
+#include "DEV_Config.h"
+
+HardwareSerial Serial;
+SPIClass SPI;
+
+static struct {
+    uint8_t Level[MOCKHAL_PIN_COUNT];
+    uint8_t Mode[MOCKHAL_PIN_COUNT];
+    uint32_t Clock;
+    uint32_t BusyUntil;
+    uint8_t BusyLevel;
+    uint32_t IdleSpins;
+
+    uint8_t Shift;          // bits clocked in since CS went low
+    uint8_t BitCount;
+    uint8_t ReadByte;       // byte being clocked out on MOSI
+    uint8_t LastCmd;
+
+    MOCKHAL_BUSY_FN BusyFn;
+    MOCKHAL_READ_FN ReadFn;
+    MOCKHAL_BYTE_FN ByteFn;
+    MOCKHAL_RESET_FN ResetFn;
+    bool Trace;
+    bool SerialEcho;
+    MOCKHAL_STATS Stats;
+} Hal;
+
+static std::vector<MOCKHAL_BYTE> TraceLog;
+
+void MockHal_Reset(void)
+{
+    memset(Hal.Level, 0, sizeof(Hal.Level));
+    memset(Hal.Mode, 0, sizeof(Hal.Mode));
+    Hal.Level[EPD_CS_PIN] = 1;
+    Hal.Level[EPD_RST_PIN] = 1;
+    Hal.Clock = 0;
+    Hal.BusyUntil = 0;
+    Hal.BusyLevel = 0;
+    Hal.IdleSpins = 0;
+    Hal.Shift = 0;
+    Hal.BitCount = 0;
+    Hal.ReadByte = 0;
+    Hal.LastCmd = 0;
+    Hal.BusyFn = NULL;
+    Hal.ReadFn = NULL;
+    Hal.ByteFn = NULL;
+    Hal.ResetFn = NULL;
+    Hal.Trace = false;
+    Hal.SerialEcho = false;
+    memset(&Hal.Stats, 0, sizeof(Hal.Stats));
+    TraceLog.clear();
+}
+
+void MockHal_SetBusyLevel(uint8_t Level) { Hal.BusyLevel = Level ? 1 : 0; }
+void MockHal_SetBusyFn(MOCKHAL_BUSY_FN Fn) { Hal.BusyFn = Fn; }
+void MockHal_SetReadFn(MOCKHAL_READ_FN Fn) { Hal.ReadFn = Fn; }
+void MockHal_SetByteFn(MOCKHAL_BYTE_FN Fn) { Hal.ByteFn = Fn; }
+void MockHal_SetResetFn(MOCKHAL_RESET_FN Fn) { Hal.ResetFn = Fn; }
+void MockHal_SetTrace(bool Enable) { Hal.Trace = Enable; }
+void MockHal_SetSerialEcho(bool Enable) { Hal.SerialEcho = Enable; }
+
+uint32_t MockHal_Clock(void) { return Hal.Clock; }
+void MockHal_Advance(uint32_t Ms) { Hal.Clock += Ms; }
+uint8_t MockHal_BusyLevel(void) { return Hal.BusyLevel; }
+const MOCKHAL_STATS *MockHal_Stats(void) { return &Hal.Stats; }
+
+uint8_t MockHal_PinLevel(uint8_t Pin)
+{
+    return Pin < MOCKHAL_PIN_COUNT ? Hal.Level[Pin] : 0;
+}
+
+const MOCKHAL_BYTE *MockHal_Trace(size_t *Count)
+{
+    *Count = TraceLog.size();
+    return TraceLog.empty() ? NULL : &TraceLog[0];
+}
+
+/**
+ * Controller side of the bus
+**/
+static void ByteDone(uint8_t Value)
+{
+    MOCKHAL_BYTE b;
+    b.Value = Value;
+    b.IsData = Hal.Level[EPD_DC_PIN];
+    b.Ms = Hal.Clock;
+
+    if (Hal.Trace)
+        TraceLog.push_back(b);
+    if (Hal.ByteFn)
+        Hal.ByteFn(&b);
+
+    if (b.IsData) {
+        Hal.Stats.DataBytes++;
+        Hal.IdleSpins = 0;
+    } else {
+        Hal.Stats.Commands++;
+        if (Value != Hal.LastCmd)
+            Hal.IdleSpins = 0;
+        Hal.LastCmd = Value;
+        uint32_t Ms = Hal.BusyFn ? Hal.BusyFn(Value) : 0;
+        if (Ms)
+            Hal.BusyUntil = Hal.Clock + Ms;
+    }
+}
+
+static bool Busy(void)
+{
+    return Hal.Clock < Hal.BusyUntil;
+}
+
+static uint8_t ReadBusy(void)
+{
+    if (Busy()) {
+        Hal.Stats.BusyReads++;
+        Hal.Clock++;
+        return Hal.BusyLevel;
+    }
+    if (++Hal.IdleSpins >= MOCKHAL_SPIN_LIMIT) {
+        Hal.BusyLevel ^= 1;
+        Hal.IdleSpins = 0;
+        Hal.Stats.BusyFlips++;
+    }
+    return Hal.BusyLevel ^ 1;
+}
+
+/**
+ * Arduino API
+**/
+void pinMode(uint8_t Pin, uint8_t Mode)
+{
+    if (Pin < MOCKHAL_PIN_COUNT)
+        Hal.Mode[Pin] = Mode;
+    if (Pin == EPD_MOSI_PIN && Mode == INPUT) {
+        Hal.ReadByte = Hal.ReadFn ? Hal.ReadFn(Hal.LastCmd) : 0x00;
+        Hal.BitCount = 0;
+    }
+}
+
+void digitalWrite(uint8_t Pin, uint8_t Level)
+{
+    if (Pin >= MOCKHAL_PIN_COUNT)
+        return;
+    uint8_t Old = Hal.Level[Pin];
+    Level = Level ? 1 : 0;
+    Hal.Level[Pin] = Level;
+    Hal.Stats.PinWrites++;
+
+    if (Pin == EPD_CS_PIN && Old && !Level) {
+        Hal.Stats.CsCycles++;
+        Hal.BitCount = 0;
+        Hal.Shift = 0;
+    } else if (Pin == EPD_RST_PIN && Old && !Level) {
+        Hal.Stats.Resets++;
+        Hal.BusyUntil = 0;
+        Hal.IdleSpins = 0;
+        if (Hal.ResetFn)
+            Hal.ResetFn();
+    } else if (Pin == EPD_SCK_PIN && !Old && Level && !Hal.Level[EPD_CS_PIN]) {
+        Hal.Stats.SckEdges++;
+        if (Hal.Mode[EPD_MOSI_PIN] == INPUT) {
+            if (++Hal.BitCount == 8) {
+                Hal.Stats.ReadBytes++;
+                Hal.BitCount = 0;
+            }
+            return;
+        }
+        Hal.Shift = (uint8_t)((Hal.Shift << 1) | Hal.Level[EPD_MOSI_PIN]);
+        if (++Hal.BitCount == 8) {
+            ByteDone(Hal.Shift);
+            Hal.BitCount = 0;
+            Hal.Shift = 0;
+        }
+    }
+}
+
+int digitalRead(uint8_t Pin)
+{
+    Hal.Stats.PinReads++;
+    if (Pin == EPD_BUSY_PIN)
+        return ReadBusy();
+    if (Pin == EPD_MOSI_PIN && Hal.Mode[EPD_MOSI_PIN] == INPUT)
+        return (Hal.ReadByte >> (7 - Hal.BitCount)) & 1;
+    return Pin < MOCKHAL_PIN_COUNT ? Hal.Level[Pin] : 0;
+}
+
+void delay(uint32_t Ms)
+{
+    Hal.Clock += Ms;
+    Hal.Stats.DelayMs += Ms;
+}
+
+void delayMicroseconds(uint32_t Us)
+{
+    (void)Us;
+}
+
+unsigned long millis(void)
+{
+    return Hal.Clock;
+}
+
+unsigned long micros(void)
+{
+    return (unsigned long)Hal.Clock * 1000u;
+}
+
+void yield(void)
+{
+}
+
+uint8_t SPIClass::transfer(uint8_t Data)
+{
+    if (!Hal.Level[EPD_CS_PIN]) {
+        Hal.Stats.SckEdges += 8;
+        ByteDone(Data);
+    }
+    return 0;
+}
+
+/**
+ * Serial: counted, printed only when echo is on
+**/
+static size_t SerialWrite(const char *Text, size_t Len)
+{
+    Hal.Stats.SerialBytes += Len;
+    if (Hal.SerialEcho)
+        fwrite(Text, 1, Len, stdout);
+    return Len;
+}
+
+static size_t SerialFormat(const char *Format, ...)
+{
+    char Buf[128];
+    va_list Args;
+    va_start(Args, Format);
+    int Len = vsnprintf(Buf, sizeof(Buf), Format, Args);
+    va_end(Args);
+    if (Len < 0)
+        return 0;
+    return SerialWrite(Buf, (size_t)Len < sizeof(Buf) ? (size_t)Len : sizeof(Buf) - 1);
+}
+
+void HardwareSerial::begin(unsigned long Baud) { (void)Baud; }
+size_t HardwareSerial::print(const char *Text) { return SerialWrite(Text, strlen(Text)); }
+size_t HardwareSerial::print(char C) { return SerialWrite(&C, 1); }
+size_t HardwareSerial::print(int Value) { return SerialFormat("%d", Value); }
+size_t HardwareSerial::print(unsigned int Value) { return SerialFormat("%u", Value); }
+size_t HardwareSerial::print(long Value) { return SerialFormat("%ld", Value); }
+size_t HardwareSerial::print(unsigned long Value) { return SerialFormat("%lu", Value); }
+size_t HardwareSerial::print(double Value) { return SerialFormat("%.2f", Value); }
+size_t HardwareSerial::println(void) { return SerialWrite("\r\n", 2); }
+size_t HardwareSerial::println(const char *Text) { return print(Text) + println(); }
+size_t HardwareSerial::println(int Value) { return print(Value) + println(); }
+
+size_t HardwareSerial::printf(const char *Format, ...)
+{
+    char Buf[256];
+    va_list Args;
+    va_start(Args, Format);
+    int Len = vsnprintf(Buf, sizeof(Buf), Format, Args);
+    va_end(Args);
+    if (Len < 0)
+        return 0;
+    return SerialWrite(Buf, (size_t)Len < sizeof(Buf) ? (size_t)Len : sizeof(Buf) - 1);
+}
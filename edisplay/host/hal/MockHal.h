@@ -0,0 +1,68 @@
+// Mock Arduino HAL for host builds of lib/waveshare.
+//
+// Stands in for the ESP32 core behind DEV_Config.h: pins keep their level,
+// the bit-banged SPI on SCK/MOSI is decoded back into command and data bytes
+// (DC low / high) and counted per chip-select cycle, BUSY is driven from a
+// per-command duration and delay()/millis() run on a virtual clock. Nothing
+// waits for real time, a full-screen refresh costs only the CPU work of the
+// driver itself.
+//
+// BUSY: the pin reads the busy level for the duration returned by the busy
+// callback after each command, the idle level otherwise. Every read of a busy
+// pin costs 1 ms of virtual time so that spin loops without a delay end. A
+// driver that keeps polling an idle pin waits for the other level: after
+// MOCKHAL_SPIN_LIMIT such reads the polarity is flipped and counted in
+// BusyFlips, so drivers of either polarity run without configuration.
+
+#ifndef _MOCK_HAL_H_
+#define _MOCK_HAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MOCKHAL_PIN_COUNT   40
+#define MOCKHAL_SPIN_LIMIT  16
+
+typedef struct {
+    uint8_t Value;
+    uint8_t IsData;             // DC level while the byte was shifted
+    uint32_t Ms;                // virtual time at the last bit
+} MOCKHAL_BYTE;
+
+typedef struct {
+    uint32_t PinWrites;
+    uint32_t PinReads;
+    uint32_t SckEdges;
+    uint32_t CsCycles;
+    uint32_t Commands;
+    uint32_t DataBytes;
+    uint32_t ReadBytes;
+    uint32_t Resets;            // RST pulled low
+    uint32_t BusyReads;         // reads of BUSY while the controller works
+    uint32_t BusyFlips;         // BUSY polarity corrected after a spin
+    uint32_t DelayMs;           // sum of delay() calls
+    uint32_t SerialBytes;
+} MOCKHAL_STATS;
+
+typedef uint32_t (*MOCKHAL_BUSY_FN)(uint8_t Cmd);     // ms BUSY stays asserted
+typedef uint8_t (*MOCKHAL_READ_FN)(uint8_t Cmd);      // byte returned by DEV_SPI_ReadByte()
+typedef void (*MOCKHAL_BYTE_FN)(const MOCKHAL_BYTE *Byte);    // before the busy callback
+typedef void (*MOCKHAL_RESET_FN)(void);                         // RST pulled low
+
+void MockHal_Reset(void);
+void MockHal_SetBusyLevel(uint8_t Level);
+void MockHal_SetBusyFn(MOCKHAL_BUSY_FN Fn);
+void MockHal_SetReadFn(MOCKHAL_READ_FN Fn);
+void MockHal_SetByteFn(MOCKHAL_BYTE_FN Fn);
+void MockHal_SetResetFn(MOCKHAL_RESET_FN Fn);
+void MockHal_SetTrace(bool Enable);
+void MockHal_SetSerialEcho(bool Enable);
+
+uint32_t MockHal_Clock(void);
+void MockHal_Advance(uint32_t Ms);
+uint8_t MockHal_PinLevel(uint8_t Pin);
+uint8_t MockHal_BusyLevel(void);
+const MOCKHAL_STATS *MockHal_Stats(void);
+const MOCKHAL_BYTE *MockHal_Trace(size_t *Count);
+
+#endif
@@ -0,0 +1,37 @@
+// Host replacement for the Arduino SPI library. Transfers are recorded like
+// the bit-banged ones, with CS and DC taken from the current pin levels.
+
+#ifndef _MOCK_SPI_H_
+#define _MOCK_SPI_H_
+
+#include "Arduino.h"
+
+#define MSBFIRST        1
+#define LSBFIRST        0
+#define SPI_MODE0       0x00
+#define SPI_CLOCK_DIV4  0x00
+
+class SPISettings {
+public:
+    SPISettings() {}
+    SPISettings(uint32_t Clock, uint8_t BitOrder, uint8_t DataMode)
+    {
+        (void)Clock; (void)BitOrder; (void)DataMode;
+    }
+};
+
+class SPIClass {
+public:
+    void begin(void) {}
+    void end(void) {}
+    void beginTransaction(SPISettings Settings) { (void)Settings; }
+    void endTransaction(void) {}
+    void setBitOrder(uint8_t Order) { (void)Order; }
+    void setDataMode(uint8_t Mode) { (void)Mode; }
+    void setClockDivider(uint32_t Div) { (void)Div; }
+    uint8_t transfer(uint8_t Data);
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,9 @@
+// Host replacement for the Arduino Wire library. utility/Debug.h only needs
+// it for Serial, nothing in lib/waveshare talks I2C.
+
+#ifndef _MOCK_WIRE_H_
+#define _MOCK_WIRE_H_
+
+#include "Arduino.h"
+
+#endif
@@ -0,0 +1,209 @@
+// Host simulation of the LUT registry and upload cache (lib/waveshare/EPD_Lut).
+//
+// Replays the LUT traffic of the LUT-driven drivers over a mixed workload and
+// compares it with the previous byte-by-byte uploads: payload bytes on the
+// wire and chip-select cycles. The waveforms have the block layout of the
+// drivers they stand for; their contents do not matter for the counts.
+// Exits non-zero when the cache sends a stale or a redundant waveform.
+//
+//   g++ -std=c++11 -I../lib/waveshare lut_sim.cpp ../lib/waveshare/EPD_Lut.cpp -o lut_sim
+
+#include <stdio.h>
+#include <string.h>
+
+#include "EPD_Lut.h"
+
+static uint8_t g_lut[256];                  // stand-in LUT contents
+static const EPD_LUT_WAVEFORM *g_expected;  // what the controller must hold after a load
+static uint32_t g_commands = 0;
+static uint32_t g_payload = 0;
+
+static void SimSendCommand(uint8_t Reg)
+{
+    (void)Reg;
+    g_commands++;
+}
+
+static void SimSendBurst(const uint8_t *Data, uint16_t Len)
+{
+    (void)Data;
+    g_payload += Len;
+}
+
+static const EPD_LUT_IO SimIo = { SimSendCommand, SimSendBurst };
+
+static int g_failures = 0;
+
+static void Expect(bool Condition, const char *What)
+{
+    if (!Condition) {
+        printf("  !! %s\n", What);
+        g_failures++;
+    }
+}
+
+/**
+ * Block layouts of the drivers
+**/
+static const EPD_LUT_BLOCK UC_FULL_BLOCKS[] = {
+    {0x20, g_lut, 44}, {0x21, g_lut, 42}, {0x22, g_lut, 42}, {0x23, g_lut, 42}, {0x24, g_lut, 42},
+};
+static const EPD_LUT_BLOCK UC_PART_BLOCKS[] = {
+    {0x20, g_lut, 44}, {0x21, g_lut, 42}, {0x22, g_lut, 42}, {0x23, g_lut, 42}, {0x24, g_lut, 42},
+};
+static const EPD_LUT_BLOCK UC_4GRAY_BLOCKS[] = {
+    {0x20, g_lut, 42}, {0x21, g_lut, 42}, {0x22, g_lut, 42}, {0x23, g_lut, 42}, {0x24, g_lut, 42}, {0x25, g_lut, 42},
+};
+static const EPD_LUT_BLOCK SSD_PART_BLOCKS[] = {
+    {0x32, g_lut, 105}, {0x03, g_lut, 1}, {0x04, g_lut, 3}, {0x2C, g_lut, 1},
+};
+static const EPD_LUT_BLOCK SSD_4GRAY_BLOCKS[] = {
+    {0x32, g_lut, 105}, {0x03, g_lut, 1}, {0x04, g_lut, 3}, {0x2C, g_lut, 1},
+};
+
+static const EPD_LUT_WAVEFORM WF_2IN13D_FULL = EPD_LUT_WAVEFORM_DEF("2in13d-full", UC_FULL_BLOCKS);
+static const EPD_LUT_WAVEFORM WF_2IN13D_PART = EPD_LUT_WAVEFORM_DEF("2in13d-partial", UC_PART_BLOCKS);
+static const EPD_LUT_WAVEFORM WF_4IN2_4GRAY = EPD_LUT_WAVEFORM_DEF("4in2-4gray", UC_4GRAY_BLOCKS);
+static const EPD_LUT_WAVEFORM WF_13IN3K_PART = EPD_LUT_WAVEFORM_DEF("13in3k-partial", SSD_PART_BLOCKS);
+static const EPD_LUT_WAVEFORM WF_13IN3K_4GRAY = EPD_LUT_WAVEFORM_DEF("13in3k-4gray", SSD_4GRAY_BLOCKS);
+
+/**
+ * Application waveform: 2 frames per phase instead of 25
+**/
+static const uint8_t FAST_VCOM[44] = { 0x00, 0x02, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t FAST_WW[42]   = { 0x00, 0x02, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t FAST_BW[42]   = { 0x80, 0x02, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t FAST_WB[42]   = { 0x40, 0x02, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t FAST_BB[42]   = { 0x00, 0x02, 0x00, 0x00, 0x00, 0x01 };
+static const EPD_LUT_BLOCK FAST_PART_BLOCKS[] = {
+    {0x20, FAST_VCOM, 44}, {0x21, FAST_WW, 42}, {0x22, FAST_BW, 42}, {0x23, FAST_WB, 42}, {0x24, FAST_BB, 42},
+};
+static const EPD_LUT_WAVEFORM WF_FAST_PART = EPD_LUT_WAVEFORM_DEF("fast-partial-2f", FAST_PART_BLOCKS);
+
+typedef struct {
+    EPD_LUT_SLOT Slot;
+    uint32_t NaiveBytes;    // byte-by-byte driver: every load is sent ...
+    uint32_t NaiveCs;       // ... with one chip-select cycle per byte
+} Controller;
+
+static void Reset(Controller *c)
+{
+    EPD_Lut_Invalidate(&c->Slot);
+}
+
+static void Load(Controller *c, const EPD_LUT_WAVEFORM *Waveform)
+{
+    uint32_t Size = EPD_Lut_Size(Waveform);
+    uint32_t Before = g_payload;
+    bool Sent;
+
+    c->NaiveBytes += Size;
+    c->NaiveCs += Size;
+    g_expected = Waveform;
+    Sent = EPD_Lut_Load(&c->Slot, Waveform, &SimIo);
+
+    Expect(c->Slot.Resident == g_expected, "wrong waveform resident after load");
+    Expect(Sent == (g_payload != Before), "load result does not match the traffic");
+}
+
+static void Report(const char *Name, const Controller *c)
+{
+    const EPD_LUT_SLOT *s = &c->Slot;
+    printf("  %-34s uploads %3lu  skipped %3lu\n", Name,
+           (unsigned long)s->Uploads, (unsigned long)s->Skipped);
+    printf("  %-34s bytes %6lu -> %6lu (saved %lu, %.0f%%)\n", "",
+           (unsigned long)c->NaiveBytes, (unsigned long)s->BytesSent, (unsigned long)s->BytesSaved,
+           c->NaiveBytes ? 100.0 * s->BytesSaved / c->NaiveBytes : 0.0);
+    printf("  %-34s CS cycles %6lu -> %6lu\n", "",
+           (unsigned long)c->NaiveCs, (unsigned long)s->Bursts);
+    Expect(s->BytesSent + s->BytesSaved == c->NaiveBytes, "bytes sent and saved do not add up");
+}
+
+// 2in13d/2in9d: Display() loads the full LUT, DisplayPart() the partial one,
+// no reset in between; deep sleep + Init every 25 updates.
+static void MixedPartialFull(void)
+{
+    Controller c;
+    memset(&c, 0, sizeof(c));
+
+    printf("\n2in13d: 200 updates, every 10th full, deep sleep every 25\n");
+    for (int i = 0; i < 200; i++) {
+        if (i % 25 == 0)
+            Reset(&c);
+        Load(&c, (i % 10 == 0) ? &WF_2IN13D_FULL : &WF_2IN13D_PART);
+    }
+    Report("full/partial", &c);
+    Expect(c.Slot.Uploads == 2 * 20 + 4, "unexpected upload count");
+}
+
+// 4in2/2in7: 4GrayDisplay() reloads the gray LUT on every frame.
+static void RepeatedGray(void)
+{
+    Controller c;
+    memset(&c, 0, sizeof(c));
+
+    printf("\n4in2: Init_4Gray, then 30 gray frames\n");
+    Reset(&c);
+    for (int i = 0; i < 30; i++)
+        Load(&c, &WF_4IN2_4GRAY);
+    Report("4-gray", &c);
+    Expect(c.Slot.Uploads == 1, "gray LUT uploaded more than once");
+}
+
+// 13in3k: every mode switch goes through Init_Part / Init_4GRAY and so a
+// reset, nothing can be skipped; the bursts still remove the per-byte CS.
+static void ModeSwitchAfterReset(void)
+{
+    Controller c;
+    memset(&c, 0, sizeof(c));
+
+    printf("\n13in3k: 20 mode switches, each through a reset\n");
+    for (int i = 0; i < 20; i++) {
+        Reset(&c);
+        Load(&c, (i & 1) ? &WF_13IN3K_4GRAY : &WF_13IN3K_PART);
+    }
+    Report("partial/4-gray", &c);
+    Expect(c.Slot.Skipped == 0, "load skipped across a reset");
+}
+
+static void Registry(void)
+{
+    Controller c;
+    memset(&c, 0, sizeof(c));
+
+    printf("\nregistry: custom 2-frame partial\n");
+    Expect(EPD_Lut_Register(&WF_FAST_PART), "registration failed");
+    Expect(!EPD_Lut_Register(&WF_FAST_PART), "duplicate name accepted");
+    Expect(EPD_Lut_Find("fast-partial-2f") == &WF_FAST_PART, "registered waveform not found");
+    Expect(EPD_Lut_Find("missing") == NULL, "unknown name found");
+
+    Reset(&c);
+    for (int i = 0; i < 10; i++)
+        Load(&c, i < 5 ? &WF_2IN13D_PART : EPD_Lut_Find("fast-partial-2f"));
+    Report("default then custom partial", &c);
+    Expect(c.Slot.Uploads == 2, "switch to the custom waveform not uploaded once");
+
+    // Fill the registry to its limit
+    static EPD_LUT_WAVEFORM Extra[EPD_LUT_MAX_WAVEFORMS];
+    static char Names[EPD_LUT_MAX_WAVEFORMS][8];
+    int Accepted = 0;
+    for (int i = 0; i < EPD_LUT_MAX_WAVEFORMS; i++) {
+        snprintf(Names[i], sizeof(Names[i]), "wf%d", i);
+        Extra[i] = WF_FAST_PART;
+        Extra[i].Name = Names[i];
+        Accepted += EPD_Lut_Register(&Extra[i]) ? 1 : 0;
+    }
+    printf("  registry holds %d waveforms\n", Accepted + 1);
+    Expect(Accepted == EPD_LUT_MAX_WAVEFORMS - 1, "registry limit not enforced");
+}
+
+int main()
+{
+    MixedPartialFull();
+    RepeatedGray();
+    ModeSwitchAfterReset();
+    Registry();
+
+    printf("\n%s (%d problems)\n", g_failures ? "FAILED" : "ok", g_failures);
+    return g_failures ? 1 : 0;
+}
@@ -0,0 +1,282 @@
+// Soak test of the pooled allocator (src/mem_pool) on the host.
+//
+// Drives the three pools, at their firmware sizes, with a model of what
+// the firmware allocates: a main screen of long-lived widgets, popups of
+// 40-120 widgets that are built, have their label texts resized for a few
+// frames and are deleted children first, and per frame a few draw layers
+// and glyph buffers next to the draw buffer and a two-image decode cache.
+// Now and then a popup widget outlives its popup and replaces one on the
+// main screen, so the long-lived set keeps moving.
+//
+// Every block is filled with its own byte and checked when it is freed,
+// and the regions are walked at each report. Fragmentation and the largest
+// free block are sampled whenever a popup has just been deleted, when only
+// the long-lived blocks are left. Exits non-zero on a damaged block or
+// region, on an allocation that had to spill to the heap, when the largest
+// free block at a sample can't take the workload's biggest request, or when
+// the mean fragmentation of the second half of the run exceeds the first
+// half's by more than 5 points.
+//
+//   g++ -std=c++11 -I../src mem_soak.cpp ../src/mem_pool.cpp -o mem_soak
+//   build/mem_soak [operations, default 5000000]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "mem_pool.h"
+
+struct Block {
+    void *P;
+    uint32_t Size;
+    uint8_t Fill;
+};
+
+static uint32_t g_seed = 1;
+static uint64_t g_ops = 0;
+static int g_failures = 0;
+
+static uint32_t Rand(uint32_t N)
+{
+    g_seed = g_seed * 1664525 + 1013904223;
+    return (g_seed >> 8) % N;
+}
+
+static uint32_t Range(uint32_t Lo, uint32_t Hi)
+{
+    return Lo + Rand(Hi - Lo + 1);
+}
+
+/**
+ * Checked blocks
+**/
+static Block Alloc(mem_pool_id_t Pool, uint32_t Size)
+{
+    Block b;
+    b.P = mem_pool_alloc(Pool, Size);
+    b.Size = Size;
+    b.Fill = (uint8_t)Rand(256);
+    g_ops++;
+    if (!b.P) {
+        printf("allocation of %u bytes failed\n", Size);
+        exit(2);
+    }
+    memset(b.P, b.Fill, Size);
+    return b;
+}
+
+static bool Intact(const Block &b)
+{
+    const uint8_t *p = (const uint8_t *)b.P;
+    for (uint32_t i = 0; i < b.Size; i++) {
+        if (p[i] != b.Fill)
+            return false;
+    }
+    return true;
+}
+
+static void Free(const Block &b)
+{
+    if (!Intact(b)) {
+        printf("block of %u bytes overwritten at op %llu\n", b.Size, (unsigned long long)g_ops);
+        g_failures++;
+    }
+    mem_pool_free(b.P);
+    g_ops++;
+}
+
+// Label text changes: lv_label_set_text() reallocs
+static void Resize(Block &b, uint32_t Size)
+{
+    if (!Intact(b)) {
+        printf("block of %u bytes overwritten at op %llu\n", b.Size, (unsigned long long)g_ops);
+        g_failures++;
+    }
+    b.P = mem_pool_realloc(MEM_POOL_WIDGETS, b.P, Size);
+    g_ops++;
+    if (!b.P) {
+        printf("realloc to %u bytes failed\n", Size);
+        exit(2);
+    }
+    uint32_t kept = Size < b.Size ? Size : b.Size;
+    if (!Intact({b.P, kept, b.Fill})) {
+        printf("realloc lost the contents at op %llu\n", (unsigned long long)g_ops);
+        g_failures++;
+    }
+    b.Size = Size;
+    memset(b.P, b.Fill, Size);
+}
+
+/**
+ * Workload
+**/
+static uint32_t WidgetSize()
+{
+    switch (Rand(4)) {
+    case 0:
+        return Range(64, 112);      // lv_obj_t and the widget structs
+    case 1:
+        return Range(16, 48);       // style and event list entries
+    case 2:
+        return Range(8, 64);        // label texts
+    default:
+        return Range(120, 240);     // spec attributes, button matrix maps
+    }
+}
+
+static std::vector<Block> g_images;     // decode cache, two entries
+
+static void Frame()
+{
+    std::vector<Block> layers, glyphs;
+    for (uint32_t i = Range(0, 2); i > 0; i--)
+        layers.push_back(Alloc(MEM_POOL_TRANSIENT, Range(256, 2400)));
+    for (uint32_t i = Range(0, 12); i > 0; i--)
+        glyphs.push_back(Alloc(MEM_POOL_TRANSIENT, Range(16, 160)));
+
+    // One frame in ten decodes an image and drops the oldest one
+    if (Rand(10) == 0) {
+        if (g_images.size() == 2) {
+            Free(g_images[0]);
+            g_images.erase(g_images.begin());
+        }
+        g_images.push_back(Alloc(MEM_POOL_TRANSIENT, Range(600, 2400)));
+    }
+
+    // Glyphs go in whatever order the cache evicts them, layers last in first out
+    while (!glyphs.empty()) {
+        size_t i = Rand((uint32_t)glyphs.size());
+        Free(glyphs[i]);
+        glyphs[i] = glyphs.back();
+        glyphs.pop_back();
+    }
+    for (size_t i = layers.size(); i > 0; i--)
+        Free(layers[i - 1]);
+}
+
+/**
+ * Report
+**/
+static const char *PoolNames[MEM_POOL_COUNT] = { "widgets", "transient", "frame" };
+
+static void Report()
+{
+    for (int id = 0; id < MEM_POOL_COUNT; id++) {
+        mem_pool_stats_t s;
+        mem_pool_get_stats((mem_pool_id_t)id, &s);
+        printf("%10llu %-9s %6u %6u %6u %4u %6u %5u%% %6u\n", (unsigned long long)g_ops, PoolNames[id], s.used,
+               s.peak, s.free_bytes, s.free_blocks, s.largest_free, mem_pool_fragmentation(&s), s.spills);
+    }
+    if (!mem_pool_check()) {
+        printf("region walk failed at op %llu\n", (unsigned long long)g_ops);
+        g_failures++;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t ops = argc > 1 ? strtoull(argv[1], NULL, 10) : 5000000;
+    const uint32_t imageSize = 800 / 8 * 480;   // EPD_7IN5_V2 frame
+    const uint32_t drawBufSize = 800 * 20;      // main.cpp's buffer_pixels, L8
+
+    if (!mem_pool_reserve(MEM_POOL_WIDGETS, MEM_POOL_WIDGETS_SIZE) ||
+        !mem_pool_reserve(MEM_POOL_TRANSIENT, MEM_POOL_TRANSIENT_SIZE) ||
+        !mem_pool_reserve(MEM_POOL_FRAME, MEM_POOL_FIT(imageSize)) ||
+        !mem_pool_reserve(MEM_POOL_FRAME, MEM_POOL_FIT(imageSize))) {
+        printf("reserving the pools failed\n");
+        return 2;
+    }
+
+    Block frames[2] = { Alloc(MEM_POOL_FRAME, imageSize), Alloc(MEM_POOL_FRAME, imageSize) };
+    Block drawBuf = Alloc(MEM_POOL_TRANSIENT, drawBufSize);
+    std::vector<Block> screen;
+    for (int i = 0; i < 150; i++)
+        screen.push_back(Alloc(MEM_POOL_WIDGETS, WidgetSize()));
+
+    printf("%10s %-9s %6s %6s %6s %4s %6s %6s %6s\n", "ops", "pool", "used", "peak", "free", "blks", "larg.",
+           "frag", "spills");
+    Report();
+
+    // Per half of the run, for widgets and transient
+    const uint32_t biggest[2] = { 240, 2400 };
+    uint64_t fragSum[2][2] = { { 0, 0 }, { 0, 0 } };
+    uint32_t samples[2] = { 0, 0 };
+    uint32_t smallest[2] = { UINT32_MAX, UINT32_MAX };
+    uint64_t nextReport = ops / 10;
+    uint32_t popups = 0;
+    while (g_ops < ops) {
+        std::vector<Block> popup;
+        for (uint32_t i = Range(40, 120); i > 0; i--)
+            popup.push_back(Alloc(MEM_POOL_WIDGETS, WidgetSize()));
+
+        for (uint32_t f = Range(1, 8); f > 0; f--) {
+            for (uint32_t i = Range(0, 6); i > 0; i--)
+                Resize(popup[Rand((uint32_t)popup.size())], Range(8, 96));
+            Frame();
+        }
+
+        // One popup in four leaves a widget on the main screen in place of another
+        if (Rand(4) == 0) {
+            size_t i = Rand((uint32_t)screen.size());
+            Free(screen[i]);
+            screen[i] = popup.back();
+            popup.pop_back();
+        }
+        for (size_t i = popup.size(); i > 0; i--)
+            Free(popup[i - 1]);
+        popups++;
+
+        int half = g_ops * 2 < ops ? 0 : 1;
+        for (int id = 0; id < 2; id++) {
+            mem_pool_stats_t s;
+            mem_pool_get_stats((mem_pool_id_t)id, &s);
+            fragSum[half][id] += mem_pool_fragmentation(&s);
+            if (s.largest_free < smallest[id])
+                smallest[id] = s.largest_free;
+        }
+        samples[half]++;
+
+        if (g_ops >= nextReport) {
+            Report();
+            nextReport += ops / 10;
+        }
+    }
+
+    for (size_t i = 0; i < screen.size(); i++)
+        Free(screen[i]);
+    for (size_t i = 0; i < g_images.size(); i++)
+        Free(g_images[i]);
+    Free(drawBuf);
+    Free(frames[0]);
+    Free(frames[1]);
+    Report();
+
+    printf("\n%u popups, between them:\n", popups);
+    for (int id = 0; id < 2; id++) {
+        double first = samples[0] ? (double)fragSum[0][id] / samples[0] : 0;
+        double second = samples[1] ? (double)fragSum[1][id] / samples[1] : 0;
+        printf("%-9s mean fragmentation %4.1f%% then %4.1f%%, smallest largest free block %u\n", PoolNames[id], first,
+               second, smallest[id]);
+        if (second > first + 5) {
+            printf("%s: fragmentation still growing\n", PoolNames[id]);
+            g_failures++;
+        }
+        if (smallest[id] < biggest[id] + 8) {
+            printf("%s: the largest free block got too small for a %u byte request\n", PoolNames[id], biggest[id]);
+            g_failures++;
+        }
+    }
+    for (int id = 0; id < MEM_POOL_COUNT; id++) {
+        mem_pool_stats_t s;
+        mem_pool_get_stats((mem_pool_id_t)id, &s);
+        if (s.spills || s.used || s.free_blocks != (uint32_t)(id == MEM_POOL_FRAME ? 2 : 1)) {
+            printf("%s: %u spills, %u bytes still used, %u free blocks\n", PoolNames[id], s.spills, s.used,
+                   s.free_blocks);
+            g_failures++;
+        }
+    }
+
+    printf("\n%s (%d problems)\n", g_failures ? "FAILED" : "ok", g_failures);
+    return g_failures ? 1 : 0;
+}
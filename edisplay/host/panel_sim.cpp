@@ -0,0 +1,150 @@
+// Runs the 7in5_V2 and 2in9_V2 drivers against the virtual panels in emu/
+// and writes a PNG per refresh plus a timing report per panel.
+//
+// The scenes are drawn with GUI_Paint; after each refresh the panel image is
+// compared with the frame buffer the driver was given. The 7in5_V2 run ends
+// with a refresh sent into deep sleep, which the emulator must flag. Exits
+// non-zero on an image mismatch or an unexpected violation.
+//
+//   build/panel_sim [output directory]
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include "GUI_Paint.h"
+#include "utility/EPD_2in9_V2.h"
+#include "utility/EPD_7in5_V2.h"
+#include "MockHal.h"
+#include "PanelEmu.h"
+
+static int g_failures = 0;
+
+static void Expect(bool Condition, const char *What)
+{
+    if (!Condition) {
+        printf("  !! %s\n", What);
+        g_failures++;
+    }
+}
+
+// Frame buffer pixels (1 = white) against the emulated panel
+static uint32_t Mismatches(const UBYTE *Frame, UWORD FrameWidth, UWORD X0, UWORD Y0, UWORD W, UWORD H, UWORD PanelWidth)
+{
+    const uint8_t *Panel = PanelEmu_Image();
+    UWORD RowBytes = (FrameWidth + 7) / 8;
+    uint32_t Bad = 0;
+    for (UWORD y = 0; y < H; y++) {
+        for (UWORD x = 0; x < W; x++) {
+            bool White = Frame[y * RowBytes + x / 8] & (0x80 >> (x & 7));
+            if ((Panel[(Y0 + y) * PanelWidth + X0 + x] != 0) != White)
+                Bad++;
+        }
+    }
+    return Bad;
+}
+
+static void Scene(UBYTE *Frame, UWORD Width, UWORD Height, UWORD Rotate, int Step)
+{
+    char Text[32];
+    Paint_NewImage(Frame, Width, Height, Rotate, WHITE);
+    Paint_SelectImage(Frame);
+    Paint_Clear(WHITE);
+    Paint_DrawRectangle(4, 4, 120, 60, BLACK, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    Paint_DrawCircle(150 + Step * 8, 64, 30, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    snprintf(Text, sizeof(Text), "update %d", Step);
+    Paint_DrawString_EN(10, 80, Text, &Font16, BLACK, WHITE);
+    Paint_DrawLine(0, Paint.Height - 1, Paint.Width - 1, 0, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+}
+
+static size_t ViolationCount(void)
+{
+    size_t Count;
+    PanelEmu_Violations(&Count);
+    return Count;
+}
+
+static void Run7in5V2(const std::string &Dir)
+{
+    static UBYTE Frame[EPD_7IN5_V2_WIDTH / 8 * EPD_7IN5_V2_HEIGHT];
+    static UBYTE Sent[sizeof(Frame)];
+    static UBYTE Window[400 / 8 * 240];
+
+    PanelEmu_Attach(&EMU_PANEL_7IN5_V2, (Dir + "/7in5_V2").c_str());
+
+    EPD_7IN5_V2_Init();
+    EPD_7IN5_V2_Clear();
+
+    Scene(Frame, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, ROTATE_0, 0);
+    memcpy(Sent, Frame, sizeof(Frame));
+    EPD_7IN5_V2_Display(Frame);     // inverts Frame in place
+    Expect(Mismatches(Sent, EPD_7IN5_V2_WIDTH, 0, 0, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, EPD_7IN5_V2_WIDTH) == 0,
+           "7in5_V2 full refresh does not show the frame");
+
+    EPD_7IN5_V2_Init_Part();
+    for (int Step = 1; Step <= 3; Step++) {
+        Scene(Window, 400, 240, ROTATE_0, Step);
+        EPD_7IN5_V2_Display_Part(Window, 200, 120, 600, 360);
+        Expect(Mismatches(Window, 400, 200, 120, 400, 240, EPD_7IN5_V2_WIDTH) == 0,
+               "7in5_V2 partial window does not show the frame");
+    }
+
+    EPD_7IN5_V2_Init_Fast();
+    Scene(Frame, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, ROTATE_0, 4);
+    memcpy(Sent, Frame, sizeof(Frame));
+    EPD_7IN5_V2_Display(Frame);
+    Expect(Mismatches(Sent, EPD_7IN5_V2_WIDTH, 0, 0, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, EPD_7IN5_V2_WIDTH) == 0,
+           "7in5_V2 fast refresh does not show the frame");
+
+    EPD_7IN5_V2_Sleep();
+    Expect(ViolationCount() == 0, "violations in the regular 7in5_V2 sequence");
+
+    // Refresh without waking the panel first
+    EPD_7IN5_V2_Display(Frame);
+    Expect(ViolationCount() > 0, "refresh in deep sleep not flagged");
+
+    printf("\n");
+    PanelEmu_Report(stdout);
+    PanelEmu_WriteReport((Dir + "/7in5_V2-timing.txt").c_str());
+    PanelEmu_Detach();
+}
+
+static void Run2in9V2(const std::string &Dir)
+{
+    static UBYTE Frame[EPD_2IN9_V2_WIDTH / 8 * EPD_2IN9_V2_HEIGHT];
+
+    PanelEmu_Attach(&EMU_PANEL_2IN9_V2, (Dir + "/2in9_V2").c_str());
+
+    EPD_2IN9_V2_Init();
+    Scene(Frame, EPD_2IN9_V2_WIDTH, EPD_2IN9_V2_HEIGHT, ROTATE_90, 0);
+    EPD_2IN9_V2_Display_Base(Frame);
+    Expect(Mismatches(Frame, EPD_2IN9_V2_WIDTH, 0, 0, EPD_2IN9_V2_WIDTH, EPD_2IN9_V2_HEIGHT, EPD_2IN9_V2_WIDTH) == 0,
+           "2in9_V2 full refresh does not show the frame");
+
+    for (int Step = 1; Step <= 3; Step++) {
+        Scene(Frame, EPD_2IN9_V2_WIDTH, EPD_2IN9_V2_HEIGHT, ROTATE_90, Step);
+        EPD_2IN9_V2_Display_Partial(Frame);
+        Expect(Mismatches(Frame, EPD_2IN9_V2_WIDTH, 0, 0, EPD_2IN9_V2_WIDTH, EPD_2IN9_V2_HEIGHT, EPD_2IN9_V2_WIDTH) == 0,
+               "2in9_V2 partial refresh does not show the frame");
+    }
+
+    EPD_2IN9_V2_Sleep();
+    Expect(ViolationCount() == 0, "violations in the regular 2in9_V2 sequence");
+
+    printf("\n");
+    PanelEmu_Report(stdout);
+    PanelEmu_WriteReport((Dir + "/2in9_V2-timing.txt").c_str());
+    PanelEmu_Detach();
+}
+
+int main(int argc, char **argv)
+{
+    std::string Dir = argc > 1 ? argv[1] : ".";
+
+    Run7in5V2(Dir);
+    Run2in9V2(Dir);
+
+    printf("\nPNGs and timing reports in %s\n", Dir.c_str());
+    printf("%s (%d problems)\n", g_failures ? "FAILED" : "ok", g_failures);
+    return g_failures ? 1 : 0;
+}
@@ -0,0 +1,256 @@
+// Host simulation of the panel power-state manager (lib/waveshare/EPD_Power).
+//
+// A fake UC81xx controller keeps track of its registers, booster and deep
+// sleep, and drives BUSY with the nominal timings of the profile. On top of
+// it the simulation prints the wake latency per state, the idle energy per
+// state over a range of idle times, and three update workloads run with the
+// old "init + sleep around every refresh" policy, an always-powered panel
+// and the manager. Refresh time itself is left out, it is the same for all.
+// Exits non-zero when the manager leaves the controller in a wrong state.
+//
+//   g++ -std=c++11 -I../lib/waveshare power_sim.cpp ../lib/waveshare/EPD_Power.cpp -o power_sim
+
+#include <stdio.h>
+#include <string.h>
+
+#include "EPD_Power.h"
+
+/**
+ * Fake controller
+**/
+static uint32_t g_clock = 0;            // virtual milliseconds
+static uint32_t g_busyUntil = 0;
+static bool g_asleep = false;           // 0x07/0xA5 received, only a reset helps
+static bool g_configured = false;       // panel setting written since the last reset
+static bool g_booster = false;
+static uint8_t g_command = 0;
+static const EPD_PWR_PROFILE *g_profile;
+
+static void SimSendCommand(uint8_t Reg)
+{
+    if (g_asleep)
+        return;
+    g_command = Reg;
+    if (Reg == 0x04) {
+        g_booster = true;
+        g_busyUntil = g_clock + g_profile->PowerOnMs;
+    } else if (Reg == 0x02) {
+        g_booster = false;
+        g_busyUntil = g_clock + g_profile->PowerOffMs;
+    }
+}
+
+static void SimSendData(uint8_t Data)
+{
+    if (g_asleep)
+        return;
+    if (g_command == 0x00)
+        g_configured = true;
+    if (g_command == 0x07 && Data == 0xA5) {
+        g_asleep = true;
+        g_configured = false;
+        g_booster = false;
+    }
+}
+
+static uint8_t SimReadBusyPin(void)
+{
+    return g_clock < g_busyUntil ? 0 : 1;   // UC81xx: LOW while busy
+}
+
+static void SimSetReset(uint8_t Level)
+{
+    if (Level == 0) {
+        g_asleep = false;
+        g_configured = false;
+        g_booster = false;
+    }
+}
+
+static void SimDelay(uint16_t Ms)
+{
+    g_clock += Ms;
+}
+
+static uint32_t SimMillis(void)
+{
+    return g_clock;
+}
+
+static const EPD_PWR_IO SimIo = {
+    SimSendCommand, SimSendData, SimReadBusyPin, SimSetReset, SimDelay, SimMillis,
+};
+
+static int g_failures = 0;
+
+static void Expect(bool Condition, const char *What)
+{
+    if (!Condition) {
+        printf("  !! %s\n", What);
+        g_failures++;
+    }
+}
+
+static void FakeBoot(const EPD_PWR_PROFILE *Profile)
+{
+    g_profile = Profile;
+    g_clock = 0;
+    g_busyUntil = 0;
+    g_asleep = false;
+    g_configured = true;    // EPD_*_Init() ran in setup()
+    g_booster = true;
+}
+
+static void WakeLatency(const EPD_PWR_PROFILE *Profile)
+{
+    EPD_PWR Pwr;
+
+    printf("\n%s: wake latency\n", Profile->Name);
+    printf("  from         measured  nominal\n");
+    for (int s = EPD_PWR_OFF; s <= EPD_PWR_POWERED; s++) {
+        FakeBoot(Profile);
+        EPD_Power_Init(&Pwr, Profile, &SimIo, EPD_PWR_POWERED);
+        EPD_Power_Enter(&Pwr, (EPD_PWR_STATE)s);
+        if (s == EPD_PWR_OFF) {
+            g_configured = false;
+            g_booster = false;
+            Pwr.State = EPD_PWR_OFF;
+        }
+        Expect(s < EPD_PWR_STANDBY ? !g_booster : true, "booster still on after sleep");
+
+        uint32_t Start = g_clock;
+        EPD_Power_Acquire(&Pwr);
+        uint32_t Ms = g_clock - Start;
+
+        printf("  %-11s  %5lu ms  %4u ms\n", EPD_Power_StateName((EPD_PWR_STATE)s),
+               (unsigned long)Ms, EPD_Power_WakeMs(Profile, (EPD_PWR_STATE)s));
+        Expect(g_configured && g_booster && !g_asleep, "controller not ready after Acquire()");
+        Expect(Pwr.State == EPD_PWR_POWERED, "manager not in the powered state");
+    }
+    printf("  driver _Init() after deep sleep: %u ms nominal\n", Profile->DriverInitMs);
+    Expect(EPD_Power_WakeMs(Profile, EPD_PWR_DEEP_SLEEP) < Profile->DriverInitMs,
+           "cached init not faster than the driver init");
+}
+
+static void IdleEnergy(const EPD_PWR_PROFILE *Profile)
+{
+    static const uint32_t IdleMs[] = { 200, 1000, 3000, 10000, 30000, 60000, 300000, 3600000 };
+
+    printf("\n%s: energy of one idle period (uJ, incl. entering and waking)\n", Profile->Name);
+    printf("  idle         powered   standby  deep-sleep  chosen\n");
+    for (size_t i = 0; i < sizeof(IdleMs) / sizeof(IdleMs[0]); i++) {
+        EPD_PWR_STATE Best = EPD_Power_Choose(Profile, IdleMs[i], EPD_PWR_NO_LIMIT);
+        printf("  %7lu ms %9llu %9llu %11llu  %s\n", (unsigned long)IdleMs[i],
+               (unsigned long long)EPD_Power_IdleUj(Profile, EPD_PWR_POWERED, IdleMs[i]),
+               (unsigned long long)EPD_Power_IdleUj(Profile, EPD_PWR_STANDBY, IdleMs[i]),
+               (unsigned long long)EPD_Power_IdleUj(Profile, EPD_PWR_DEEP_SLEEP, IdleMs[i]),
+               EPD_Power_StateName(Best));
+    }
+    printf("  break-even powered->standby %lu ms, standby->deep-sleep %lu ms\n",
+           (unsigned long)EPD_Power_BreakEvenMs(Profile, EPD_PWR_POWERED, EPD_PWR_STANDBY),
+           (unsigned long)EPD_Power_BreakEvenMs(Profile, EPD_PWR_STANDBY, EPD_PWR_DEEP_SLEEP));
+    printf("  with a 50 ms wake budget, 1 h idle -> %s\n",
+           EPD_Power_StateName(EPD_Power_Choose(Profile, 3600000, 50)));
+}
+
+/**
+ * Workloads: gaps in ms between refreshes
+**/
+typedef struct {
+    const char *Name;
+    uint32_t Gaps[80];
+    int Count;
+} Workload;
+
+static void Burst(Workload *w)
+{
+    w->Name = "burst: 20 updates 3 s apart";
+    w->Count = 20;
+    for (int i = 0; i < w->Count; i++)
+        w->Gaps[i] = 3000;
+}
+
+static void Periodic(Workload *w)
+{
+    w->Name = "periodic: 24 updates 5 min apart";
+    w->Count = 24;
+    for (int i = 0; i < w->Count; i++)
+        w->Gaps[i] = 300000;
+}
+
+static void Mixed(Workload *w)
+{
+    w->Name = "mixed: 6 x (10 updates 2 s apart, 10 min idle)";
+    w->Count = 0;
+    for (int b = 0; b < 6; b++) {
+        for (int i = 0; i < 9; i++)
+            w->Gaps[w->Count++] = 2000;
+        w->Gaps[w->Count++] = 600000;
+    }
+}
+
+static uint64_t Uj(uint32_t Ua, uint32_t Ms)
+{
+    return (uint64_t)Ua * EPD_PWR_VOLTAGE_MV * Ms / 1000000u;
+}
+
+static void RunWorkload(const EPD_PWR_PROFILE *Profile, const Workload *w)
+{
+    uint64_t LegacyUj = 0, PoweredUj = 0;
+    uint32_t LegacyWake = 0, Total = 0;
+    EPD_PWR Pwr;
+
+    // Old main.cpp with the missing re-init added: _Init() + refresh + _Sleep()
+    for (int i = 0; i < w->Count; i++) {
+        LegacyUj += Uj(Profile->ActiveUa, Profile->DriverInitMs + Profile->PowerOffMs) +
+                    Uj(Profile->DeepSleepUa, w->Gaps[i]);
+        LegacyWake += Profile->DriverInitMs;
+        PoweredUj += Uj(Profile->PoweredUa, w->Gaps[i]);
+        Total += w->Gaps[i];
+    }
+
+    FakeBoot(Profile);
+    EPD_Power_Init(&Pwr, Profile, &SimIo, EPD_PWR_POWERED);
+    for (int i = 0; i < w->Count; i++) {
+        EPD_Power_Acquire(&Pwr);
+        Expect(g_configured && g_booster && !g_asleep, "refresh on a controller that is not ready");
+        EPD_Power_Release(&Pwr, 0);
+
+        // loop() polls every 100 ms until the next update is due
+        uint32_t Due = g_clock + w->Gaps[i];
+        while (g_clock < Due) {
+            g_clock = (Due - g_clock < 100) ? Due : g_clock + 100;
+            EPD_Power_Poll(&Pwr);
+        }
+    }
+
+    printf("\n%s: %s (%lu s)\n", Profile->Name, w->Name, (unsigned long)(Total / 1000));
+    printf("  policy            energy      wake total  wakes p/s/d\n");
+    printf("  init+sleep     %9.1f mJ  %7lu ms\n", LegacyUj / 1000.0, (unsigned long)LegacyWake);
+    printf("  always powered %9.1f mJ  %7d ms\n", PoweredUj / 1000.0, 0);
+    printf("  managed        %9.1f mJ  %7lu ms   %lu/%lu/%lu\n", EPD_Power_EnergyUj(&Pwr) / 1000.0,
+           (unsigned long)Pwr.WakeMs, (unsigned long)Pwr.Wakes[EPD_PWR_POWERED],
+           (unsigned long)Pwr.Wakes[EPD_PWR_STANDBY], (unsigned long)Pwr.Wakes[EPD_PWR_DEEP_SLEEP]);
+    Expect(Pwr.WakeMs <= LegacyWake, "managed wakes slower than init+sleep");
+}
+
+int main()
+{
+    const EPD_PWR_PROFILE *Profiles[] = { &EPD_PWR_PROFILE_7IN5_V2, &EPD_PWR_PROFILE_2IN9D };
+    Workload w;
+
+    for (size_t i = 0; i < sizeof(Profiles) / sizeof(Profiles[0]); i++) {
+        WakeLatency(Profiles[i]);
+        IdleEnergy(Profiles[i]);
+    }
+
+    Burst(&w);
+    RunWorkload(&EPD_PWR_PROFILE_7IN5_V2, &w);
+    Periodic(&w);
+    RunWorkload(&EPD_PWR_PROFILE_7IN5_V2, &w);
+    Mixed(&w);
+    RunWorkload(&EPD_PWR_PROFILE_7IN5_V2, &w);
+
+    printf("\n%s (%d problems)\n", g_failures ? "FAILED" : "ok", g_failures);
+    return g_failures ? 1 : 0;
+}
@@ -0,0 +1,243 @@
+// Turns profiler dumps from the firmware (src/profiler.cpp, -D PROFILER,
+// 'd' on Serial) into percentiles and a flame-style tree.
+//
+// The input can be a whole serial log; every "# profile" ... "# end" block
+// in it is reported. Per probe it prints the count, mean and p50/p90/p99/max
+// read off the histogram, then the probes as a tree of total and self time
+// against the recorded time. With --folded the self times come out as
+// folded stacks ("loop;lv_timer_handler;render 1234", microseconds) for
+// flamegraph.pl or speedscope instead. Exits non-zero when no block is found.
+//
+//   g++ -std=c++11 prof_report.cpp -o prof_report
+//   build/prof_report [--folded] [log file, default stdin]
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#define PROF_BUCKETS 124    // as in src/profiler.h
+
+struct Probe {
+    std::string Name;
+    int Parent;
+    uint32_t Count;
+    uint64_t Total;
+    uint32_t Max;
+    uint32_t Buckets[PROF_BUCKETS];
+};
+
+struct Profile {
+    double CpuMhz;
+    double RecordedMs;
+    std::vector<Probe> Probes;
+};
+
+/**
+ * Histogram
+**/
+// Bucket b covers [BucketLow(b), BucketHigh(b)) cycles, see prof_bucket()
+static double BucketLow(int Bucket)
+{
+    if (Bucket < 4)
+        return Bucket;
+    return ldexp(4 + Bucket % 4, Bucket / 4 - 1);
+}
+
+static double BucketHigh(int Bucket)
+{
+    if (Bucket < 4)
+        return Bucket + 1;
+    return ldexp(5 + Bucket % 4, Bucket / 4 - 1);
+}
+
+// Cycles at quantile Q, linear inside the bucket it falls in
+static double Percentile(const Probe &P, double Q)
+{
+    if (!P.Count)
+        return 0;
+    double Rank = Q * P.Count;
+    uint64_t Seen = 0;
+    for (int b = 0; b < PROF_BUCKETS; b++) {
+        if (!P.Buckets[b])
+            continue;
+        if (Seen + P.Buckets[b] >= Rank) {
+            double Low = BucketLow(b);
+            double Value = Low + (BucketHigh(b) - Low) * (Rank - Seen) / P.Buckets[b];
+            return Value < P.Max ? Value : P.Max;
+        }
+        Seen += P.Buckets[b];
+    }
+    return P.Max;
+}
+
+/**
+ * Parsing
+**/
+static bool ParseRow(const char *Line, Probe *P)
+{
+    char Name[64];
+    int Id, Consumed = 0;
+    unsigned long Count, Max;
+    unsigned long long Total;
+    if (sscanf(Line, "%d,%63[^,],%d,%lu,%llu,%lu,%n", &Id, Name, &P->Parent, &Count, &Total, &Max, &Consumed) < 6 || !Consumed)
+        return false;
+    P->Name = Name;
+    P->Count = Count;
+    P->Total = Total;
+    P->Max = Max;
+    memset(P->Buckets, 0, sizeof(P->Buckets));
+
+    const char *s = Line + Consumed;
+    unsigned Bucket;
+    unsigned long N;
+    int Used;
+    while (sscanf(s, " %u:%lu%n", &Bucket, &N, &Used) == 2) {
+        if (Bucket < PROF_BUCKETS)
+            P->Buckets[Bucket] = N;
+        s += Used;
+    }
+    return true;
+}
+
+static std::vector<Profile> ParseLog(FILE *In)
+{
+    std::vector<Profile> Profiles;
+    Profile *Open = NULL;
+    char Line[4096];
+    while (fgets(Line, sizeof(Line), In)) {
+        // Serial monitors may prefix timestamps; start at the marker
+        const char *Marker = strstr(Line, "# profile ");
+        if (Marker) {
+            Profiles.push_back(Profile());
+            Open = &Profiles.back();
+            Open->CpuMhz = 240;
+            Open->RecordedMs = 0;
+            const char *Mhz = strstr(Marker, "cpu_mhz=");
+            const char *Ms = strstr(Marker, "recorded_ms=");
+            if (Mhz)
+                Open->CpuMhz = atof(Mhz + 8);
+            if (Ms)
+                Open->RecordedMs = atof(Ms + 12);
+            continue;
+        }
+        if (!Open)
+            continue;
+        if (strstr(Line, "# end")) {
+            Open = NULL;
+            continue;
+        }
+        Probe P;
+        if (ParseRow(Line, &P))
+            Open->Probes.push_back(P);
+    }
+    return Profiles;
+}
+
+/**
+ * Reports
+**/
+static double ChildrenTotal(const Profile &Prof, int Id)
+{
+    double Sum = 0;
+    for (size_t i = 0; i < Prof.Probes.size(); i++) {
+        if (Prof.Probes[i].Parent == Id)
+            Sum += Prof.Probes[i].Total;
+    }
+    return Sum;
+}
+
+static void PrintTree(const Profile &Prof, int Parent, int Depth)
+{
+    double UsPerCycle = 1.0 / Prof.CpuMhz;
+    double Recorded = Prof.RecordedMs > 0 ? Prof.RecordedMs : 1;
+    for (size_t i = 0; i < Prof.Probes.size(); i++) {
+        const Probe &P = Prof.Probes[i];
+        if (P.Parent != Parent)
+            continue;
+        double TotalMs = P.Total * UsPerCycle / 1000;
+        double SelfCycles = P.Total - ChildrenTotal(Prof, (int)i);
+        double SelfMs = (SelfCycles > 0 ? SelfCycles : 0) * UsPerCycle / 1000;
+        double Share = 100 * TotalMs / Recorded;
+        int Bar = (int)(Share * 0.4 + 0.5);
+
+        printf("  %*s%-*s %10.1f ms %6.1f%%  self %10.1f ms  ", Depth * 2, "", 20 - Depth * 2, P.Name.c_str(),
+               TotalMs, Share, SelfMs);
+        for (int b = 0; b < Bar && b < 40; b++)
+            putchar('#');
+        putchar('\n');
+        PrintTree(Prof, (int)i, Depth + 1);
+    }
+}
+
+static void PrintProfile(const Profile &Prof)
+{
+    double UsPerCycle = 1.0 / Prof.CpuMhz;
+    printf("%.0f ms recorded at %.0f MHz\n\n", Prof.RecordedMs, Prof.CpuMhz);
+    printf("  %-20s %8s %10s %10s %10s %10s %10s\n", "probe", "count", "mean us", "p50 us", "p90 us", "p99 us", "max us");
+    for (size_t i = 0; i < Prof.Probes.size(); i++) {
+        const Probe &P = Prof.Probes[i];
+        double Mean = P.Count ? (double)P.Total / P.Count : 0;
+        printf("  %-20s %8lu %10.1f %10.1f %10.1f %10.1f %10.1f\n", P.Name.c_str(), (unsigned long)P.Count,
+               Mean * UsPerCycle, Percentile(P, 0.5) * UsPerCycle, Percentile(P, 0.9) * UsPerCycle,
+               Percentile(P, 0.99) * UsPerCycle, P.Max * UsPerCycle);
+    }
+    printf("\n  %-20s %13s %7s  %18s\n", "tree", "total", "share", "self");
+    PrintTree(Prof, -1, 0);
+}
+
+static std::string Stack(const Profile &Prof, int Id)
+{
+    std::string Path = Prof.Probes[Id].Name;
+    for (int p = Prof.Probes[Id].Parent, Guard = 0; p >= 0 && p < (int)Prof.Probes.size() && Guard < 16; p = Prof.Probes[p].Parent, Guard++)
+        Path = Prof.Probes[p].Name + ";" + Path;
+    return Path;
+}
+
+static void PrintFolded(const Profile &Prof)
+{
+    for (size_t i = 0; i < Prof.Probes.size(); i++) {
+        double SelfCycles = Prof.Probes[i].Total - ChildrenTotal(Prof, (int)i);
+        if (SelfCycles > 0)
+            printf("%s %.0f\n", Stack(Prof, (int)i).c_str(), SelfCycles / Prof.CpuMhz);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bool Folded = false;
+    const char *Path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--folded"))
+            Folded = true;
+        else
+            Path = argv[i];
+    }
+
+    FILE *In = Path ? fopen(Path, "r") : stdin;
+    if (!In) {
+        perror(Path);
+        return 1;
+    }
+    std::vector<Profile> Profiles = ParseLog(In);
+    if (In != stdin)
+        fclose(In);
+    if (Profiles.empty()) {
+        fprintf(stderr, "no \"# profile\" block in the input\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < Profiles.size(); i++) {
+        if (Folded) {
+            PrintFolded(Profiles[i]);
+            continue;
+        }
+        if (Profiles.size() > 1)
+            printf("%sDump %u: ", i ? "\n" : "", (unsigned)(i + 1));
+        PrintProfile(Profiles[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,173 @@
+// Host simulation of the SSD16xx waveform manager (lib/waveshare/EPD_Waveform).
+//
+// Feeds the manager a scripted temperature sensor and a sequence of frame and
+// partial refreshes, then prints the waveform chosen for each one together
+// with the expected refresh time and the load sequences that were skipped.
+// Exits non-zero when a decision breaks the manager's rules.
+//
+//   g++ -std=c++11 -I../lib/waveshare waveform_sim.cpp ../lib/waveshare/EPD_Waveform.cpp -o waveform_sim
+
+#include <stdio.h>
+#include <string.h>
+
+#include "EPD_Waveform.h"
+
+static int8_t g_sensor = 22;      // degC reported by the fake panel
+static bool g_floating = false;   // data line not driven, reads 0xFF
+static uint32_t g_clock = 0;      // virtual milliseconds
+static uint8_t g_lastCommand = 0;
+static uint8_t g_readIndex = 0;
+static uint32_t g_busyWaits = 0;
+static uint32_t g_bytes = 0;
+
+static void SimSendCommand(uint8_t Reg)
+{
+    g_lastCommand = Reg;
+    g_readIndex = 0;
+    g_bytes++;
+}
+
+static void SimSendData(uint8_t Data)
+{
+    (void)Data;
+    g_bytes++;
+}
+
+static uint8_t SimReadData(void)
+{
+    if (g_lastCommand != 0x1B || g_floating)
+        return 0xFF;
+    return g_readIndex++ == 0 ? (uint8_t)g_sensor : 0x00;
+}
+
+static void SimReadBusy(void)
+{
+    g_busyWaits++;
+}
+
+static uint32_t SimMillis(void)
+{
+    return g_clock;
+}
+
+static const EPD_WF_IO SimIo = { SimSendCommand, SimSendData, SimReadData, SimReadBusy, SimMillis };
+
+static int g_failures = 0;
+
+static void Expect(bool Condition, const char *What)
+{
+    if (!Condition) {
+        printf("  !! %s\n", What);
+        g_failures++;
+    }
+}
+
+static void TemperatureSweep(const EPD_WF_PANEL *Panel)
+{
+    printf("\n%s: chosen waveform by temperature (frame / any, no ghosting)\n", Panel->Name);
+    printf("  temp  frame        ms    any          ms\n");
+    for (int t = -10; t <= 60; t += 5) {
+        int f = EPD_Waveform_Choose(Panel, (int8_t)t, 0, EPD_WF_ALLOW_FRAME);
+        int a = EPD_Waveform_Choose(Panel, (int8_t)t, 0, EPD_WF_ALLOW_ANY);
+        const EPD_WF_ENTRY *ef = &Panel->Table[f];
+        const EPD_WF_ENTRY *ea = &Panel->Table[a];
+        printf("  %4d  %-10s %5u    %-10s %5u\n", t,
+               EPD_Waveform_ModeName(ef->Mode), ef->RefreshMs,
+               EPD_Waveform_ModeName(ea->Mode), ea->RefreshMs);
+        Expect(ef->Mode != EPD_WF_PARTIAL, "partial chosen for a frame update");
+        if (ef->Mode != EPD_WF_FULL)
+            Expect(t >= ef->TempMin && t <= ef->TempMax, "waveform outside its temperature window");
+    }
+    Expect(Panel->Table[EPD_Waveform_Choose(Panel, EPD_WF_TEMP_UNKNOWN, 0, EPD_WF_ALLOW_ANY)].Mode == EPD_WF_FULL,
+           "unknown temperature did not fall back to full");
+}
+
+static void RefreshSequence(const EPD_WF_PANEL *Panel)
+{
+    EPD_WF_STATE wf;
+    uint32_t TotalMs = 0, FullMs = 0;
+
+    g_sensor = 22;
+    g_clock = 0;
+    EPD_Waveform_Init(&wf, Panel, &SimIo);
+
+    printf("\n%s: 30 updates, every 4th a whole frame, 20 s apart, panel warming 22 -> 37 degC\n", Panel->Name);
+    printf("   #  temp  ghost  mode         ms\n");
+    for (int i = 0; i < 30; i++) {
+        uint8_t Allow = (i % 4 == 0) ? EPD_WF_ALLOW_FRAME : EPD_WF_ALLOW_ANY;
+        uint8_t GhostBefore = wf.Ghost;
+
+        g_sensor = (int8_t)(22 + i / 2);
+        EPD_WF_MODE Mode = EPD_Waveform_Prepare(&wf, Allow);
+        Expect(wf.Ghost <= Panel->GhostBudget, "ghosting budget exceeded before refresh");
+
+        printf("  %2d  %4d  %5u  %-10s %5u\n", i, wf.Temperature, GhostBefore,
+               EPD_Waveform_ModeName(Mode), EPD_Waveform_RefreshMs(&wf));
+
+        TotalMs += EPD_Waveform_RefreshMs(&wf);
+        FullMs += Panel->Table[0].RefreshMs;
+        EPD_Waveform_Refreshed(&wf);
+        Expect(wf.Ghost <= Panel->GhostBudget, "ghosting budget exceeded after refresh");
+        g_clock += 20000;
+    }
+    printf("  refresh time %lu ms vs %lu ms always-full (%.1fx)\n",
+           (unsigned long)TotalMs, (unsigned long)FullMs, (double)FullMs / TotalMs);
+    printf("  temperature reads %lu, waveform loads %lu, loads skipped %lu\n",
+           (unsigned long)wf.TempReads, (unsigned long)wf.Loads, (unsigned long)wf.LoadsSkipped);
+}
+
+static void Residency(void)
+{
+    EPD_WF_STATE wf;
+
+    g_sensor = 25;
+    g_clock = 0;
+    EPD_Waveform_Init(&wf, &EPD_WF_PANEL_2IN13_V4, &SimIo);
+
+    printf("\nresidency: repeated fast frames, then a deep sleep\n");
+    EPD_Waveform_Prepare(&wf, EPD_WF_ALLOW(EPD_WF_FAST_1_5S));
+    EPD_Waveform_Refreshed(&wf);
+    EPD_Waveform_Prepare(&wf, EPD_WF_ALLOW(EPD_WF_FAST_1_5S));
+    EPD_Waveform_Refreshed(&wf);
+    Expect(wf.Loads == 1 && wf.LoadsSkipped == 1, "second fast frame reloaded the waveform");
+
+    EPD_Waveform_Invalidate(&wf);
+    EPD_Waveform_Prepare(&wf, EPD_WF_ALLOW(EPD_WF_FAST_1_5S));
+    Expect(wf.Loads == 2, "waveform not reloaded after deep sleep");
+    printf("  loads %lu, skipped %lu\n", (unsigned long)wf.Loads, (unsigned long)wf.LoadsSkipped);
+}
+
+static void SensorReads(void)
+{
+    EPD_WF_STATE wf;
+
+    g_clock = 0;
+    EPD_Waveform_Init(&wf, &EPD_WF_PANEL_4IN2_V2, &SimIo);
+
+    printf("\nsensor: -1 degC, then a floating data line\n");
+    g_sensor = -1;
+    int8_t Cold = EPD_Waveform_ReadTemperature(&wf, true);
+    Expect(Cold == -1, "-1 degC read as no temperature");
+
+    g_floating = true;
+    int8_t Floating = EPD_Waveform_ReadTemperature(&wf, true);
+    Expect(Floating == EPD_WF_TEMP_UNKNOWN, "floating data line read as a temperature");
+    g_floating = false;
+    printf("  -1 degC reads %d, floating line reads %d\n", Cold, Floating);
+}
+
+int main()
+{
+    const EPD_WF_PANEL *Panels[] = {
+        &EPD_WF_PANEL_4IN2_V2, &EPD_WF_PANEL_2IN13_V4, &EPD_WF_PANEL_2IN7_V2, &EPD_WF_PANEL_4IN26,
+    };
+
+    for (size_t i = 0; i < sizeof(Panels) / sizeof(Panels[0]); i++)
+        TemperatureSweep(Panels[i]);
+    RefreshSequence(&EPD_WF_PANEL_4IN2_V2);
+    Residency();
+    SensorReads();
+
+    printf("\n%s (%d problems)\n", g_failures ? "FAILED" : "ok", g_failures);
+    return g_failures ? 1 : 0;
+}
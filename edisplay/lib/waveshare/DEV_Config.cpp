@@ -77,11 +77,8 @@ UBYTE DEV_Module_Init(void)
 function:
 			SPI read and write
 ******************************************************************************/
-void DEV_SPI_WriteByte(UBYTE data)
+static void DEV_SPI_Shift(UBYTE data)
 {
-    //SPI.beginTransaction(spi_settings);
-    digitalWrite(EPD_CS_PIN, GPIO_PIN_RESET);
-
     for (int i = 0; i < 8; i++)
     {
         if ((data & 0x80) == 0) digitalWrite(EPD_MOSI_PIN, GPIO_PIN_RESET); 
@@ -91,7 +88,13 @@ void DEV_SPI_WriteByte(UBYTE data)
         digitalWrite(EPD_SCK_PIN, GPIO_PIN_SET);     
         digitalWrite(EPD_SCK_PIN, GPIO_PIN_RESET);
     }
+}
 
+void DEV_SPI_WriteByte(UBYTE data)
+{
+    //SPI.beginTransaction(spi_settings);
+    digitalWrite(EPD_CS_PIN, GPIO_PIN_RESET);
+    DEV_SPI_Shift(data);
     //SPI.transfer(data);
     digitalWrite(EPD_CS_PIN, GPIO_PIN_SET);
     //SPI.endTransaction();	
@@ -116,8 +119,13 @@ UBYTE DEV_SPI_ReadByte()
     return j;
 }
 
+/******************************************************************************
+function:	Burst write, CS stays low for the whole block
+******************************************************************************/
 void DEV_SPI_Write_nByte(UBYTE *pData, UDOUBLE len)
 {
-    for (int i = 0; i < len; i++)
-        DEV_SPI_WriteByte(pData[i]);
+    digitalWrite(EPD_CS_PIN, GPIO_PIN_RESET);
+    for (UDOUBLE i = 0; i < len; i++)
+        DEV_SPI_Shift(pData[i]);
+    digitalWrite(EPD_CS_PIN, GPIO_PIN_SET);
 }
@@ -0,0 +1,112 @@
+/*****************************************************************************
+* | File      	:   EPD_Lut.cpp
+* | Function    :   Waveform (LUT) registry and upload cache for LUT-driven panels
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+******************************************************************************/
+#include "EPD_Lut.h"
+
+#include <string.h>
+
+static const EPD_LUT_WAVEFORM *Registry[EPD_LUT_MAX_WAVEFORMS];
+static uint8_t RegistryCount = 0;
+
+/******************************************************************************
+function :	Total payload of a waveform
+parameter:
+******************************************************************************/
+uint32_t EPD_Lut_Size(const EPD_LUT_WAVEFORM *Waveform)
+{
+    uint32_t Size = 0;
+    for (uint8_t i = 0; i < Waveform->Count; i++)
+        Size += Waveform->Blocks[i].Len;
+    return Size;
+}
+
+/******************************************************************************
+function :	Make a waveform resident in the controller
+parameter:
+    Slot     : Residency of the controller
+    Waveform : Waveform to load
+    Io       : Controller access
+return   :  true when the LUT registers were written, false when it was resident
+******************************************************************************/
+bool EPD_Lut_Load(EPD_LUT_SLOT *Slot, const EPD_LUT_WAVEFORM *Waveform, const EPD_LUT_IO *Io)
+{
+    if (Slot->Resident == Waveform) {
+        Slot->Skipped++;
+        Slot->BytesSaved += EPD_Lut_Size(Waveform);
+        return false;
+    }
+
+    for (uint8_t i = 0; i < Waveform->Count; i++) {
+        const EPD_LUT_BLOCK *b = &Waveform->Blocks[i];
+        Io->SendCommand(b->Reg);
+        Io->SendBurst(b->Data, b->Len);
+        Slot->BytesSent += b->Len;
+        Slot->Bursts++;
+    }
+    Slot->Resident = Waveform;
+    Slot->Uploads++;
+    return true;
+}
+
+/******************************************************************************
+function :	Forget the resident waveform (hardware reset, deep sleep)
+parameter:
+******************************************************************************/
+void EPD_Lut_Invalidate(EPD_LUT_SLOT *Slot)
+{
+    Slot->Resident = NULL;
+}
+
+/******************************************************************************
+function :	Add an application waveform to the registry
+parameter:
+    Waveform : Must stay valid for the lifetime of the program
+return   :  false when the registry is full or the name is taken
+******************************************************************************/
+bool EPD_Lut_Register(const EPD_LUT_WAVEFORM *Waveform)
+{
+    if (RegistryCount >= EPD_LUT_MAX_WAVEFORMS || EPD_Lut_Find(Waveform->Name) != NULL)
+        return false;
+    Registry[RegistryCount++] = Waveform;
+    return true;
+}
+
+const EPD_LUT_WAVEFORM *EPD_Lut_Find(const char *Name)
+{
+    for (uint8_t i = 0; i < RegistryCount; i++) {
+        if (strcmp(Registry[i]->Name, Name) == 0)
+            return Registry[i];
+    }
+    return NULL;
+}
+
+#if defined(ARDUINO)
+#include "DEV_Config.h"
+
+static void LUT_DEV_SendCommand(uint8_t Reg)
+{
+    DEV_Digital_Write(EPD_DC_PIN, 0);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    DEV_SPI_WriteByte(Reg);
+    DEV_Digital_Write(EPD_CS_PIN, 1);
+}
+
+static void LUT_DEV_SendBurst(const uint8_t *Data, uint16_t Len)
+{
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    DEV_SPI_Write_nByte((UBYTE *)Data, Len);
+    DEV_Digital_Write(EPD_CS_PIN, 1);
+}
+
+const EPD_LUT_IO EPD_LUT_IO_DEV = {
+    LUT_DEV_SendCommand,
+    LUT_DEV_SendBurst,
+};
+#endif
@@ -0,0 +1,80 @@
+/*****************************************************************************
+* | File      	:   EPD_Lut.h
+* | Function    :   Waveform (LUT) registry and upload cache for LUT-driven panels
+* | Info        :
+*   Each controller gets an EPD_LUT_SLOT that remembers which waveform is
+*   resident in its LUT registers. Loading the resident waveform again is a
+*   no-op, everything else goes out as one burst per LUT register instead of
+*   one chip-select cycle per byte. Applications can register their own tuned
+*   waveforms (for example a 2-frame fast partial) and hand them to drivers
+*   that accept a waveform override.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+*   A hardware reset clears the LUT registers: drivers call
+*   EPD_Lut_Invalidate() from their _Reset().
+******************************************************************************/
+#ifndef _EPD_LUT_H_
+#define _EPD_LUT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EPD_LUT_MAX_WAVEFORMS   8
+
+/**
+ * One LUT register and its payload
+**/
+typedef struct {
+    uint8_t Reg;            // 0x20..0x25 on UC81xx, 0x32/0x03/0x04/0x2C on SSD16xx
+    const uint8_t *Data;
+    uint16_t Len;
+} EPD_LUT_BLOCK;
+
+typedef struct {
+    const char *Name;
+    const EPD_LUT_BLOCK *Blocks;
+    uint8_t Count;
+} EPD_LUT_WAVEFORM;
+
+/**
+ * Upload statistics and residency of one controller
+**/
+typedef struct {
+    const EPD_LUT_WAVEFORM *Resident;
+    uint32_t Uploads;
+    uint32_t Skipped;
+    uint32_t BytesSent;     // LUT payload bytes that went over the wire
+    uint32_t BytesSaved;    // ... and payload bytes a skipped upload did not send
+    uint32_t Bursts;        // chip-select cycles used for the payload
+} EPD_LUT_SLOT;
+
+typedef struct {
+    void (*SendCommand)(uint8_t Reg);
+    void (*SendBurst)(const uint8_t *Data, uint16_t Len);
+} EPD_LUT_IO;
+
+#if defined(ARDUINO)
+extern const EPD_LUT_IO EPD_LUT_IO_DEV;
+#endif
+
+#define EPD_LUT_WAVEFORM_DEF(_name, _blocks) \
+    { _name, _blocks, (uint8_t)(sizeof(_blocks) / sizeof((_blocks)[0])) }
+
+bool EPD_Lut_Load(EPD_LUT_SLOT *Slot, const EPD_LUT_WAVEFORM *Waveform, const EPD_LUT_IO *Io);
+void EPD_Lut_Invalidate(EPD_LUT_SLOT *Slot);
+uint32_t EPD_Lut_Size(const EPD_LUT_WAVEFORM *Waveform);
+
+bool EPD_Lut_Register(const EPD_LUT_WAVEFORM *Waveform);
+const EPD_LUT_WAVEFORM *EPD_Lut_Find(const char *Name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,395 @@
+/*****************************************************************************
+* | File      	:   EPD_Power.cpp
+* | Function    :   Power-state manager for UC81xx e-Paper controllers
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+*   The init sequences are the register writes of the drivers' _Init(), the
+*   sleep sequences those of their _Sleep().
+******************************************************************************/
+#include "EPD_Power.h"
+
+#include <stddef.h>
+
+#define BUSY    EPD_PWR_SEQ_BUSY
+#define END     EPD_PWR_SEQ_END
+
+/**
+ * Profiles
+**/
+static const uint8_t UC81XX_POWER_ON[] = { 0x04, BUSY | 0, END };
+static const uint8_t UC81XX_STANDBY[]  = { 0x02, BUSY | 0, END };
+static const uint8_t UC81XX_SLEEP[]    = {
+    0x50, 1, 0xF7,                  // border floating
+    0x02, BUSY | 0,                 // power off
+    0x07, 1, 0xA5,                  // deep sleep
+    END,
+};
+
+static const uint8_t INIT_7IN5_V2[] = {
+    0x01, 4, 0x07, 0x07, 0x3F, 0x3F,    // power setting, VGH/VGL 20V, VDH/VDL 15V
+    0x06, 4, 0x17, 0x17, 0x28, 0x17,    // booster soft start
+    0x04, BUSY | 0,                     // power on
+    0x00, 1, 0x1F,                      // panel setting, LUT from OTP
+    0x61, 4, 0x03, 0x20, 0x01, 0xE0,    // resolution 800x480
+    0x15, 1, 0x00,
+    0x50, 2, 0x10, 0x07,                // VCOM and data interval
+    0x60, 1, 0x22,                      // TCON
+    END,
+};
+const EPD_PWR_PROFILE EPD_PWR_PROFILE_7IN5_V2 = {
+    "7in5_V2", INIT_7IN5_V2, UC81XX_POWER_ON, UC81XX_STANDBY, UC81XX_SLEEP,
+    0, END,     // BUSY low while working, no status poll
+    2, 10,      // reset pulse
+    45, 40, 20, 190,
+    1, 40, 2500, 8000,
+};
+
+static const uint8_t INIT_2IN9D[] = {
+    0x04, BUSY | 0,                     // power on
+    0x00, 1, 0x1F,                      // panel setting, LUT from OTP
+    0x61, 3, 0x80, 0x01, 0x28,          // resolution 128x296
+    0x50, 1, 0x97,                      // VCOM and data interval
+    END,
+};
+const EPD_PWR_PROFILE EPD_PWR_PROFILE_2IN9D = {
+    "2in9d", INIT_2IN9D, UC81XX_POWER_ON, UC81XX_STANDBY, UC81XX_SLEEP,
+    0, 0x71,    // BUSY low while working, refreshed by GET_STATUS
+    2, 10,
+    45, 40, 20, 170,
+    1, 30, 1500, 5000,
+};
+
+/******************************************************************************
+function :	Nominal cost model
+******************************************************************************/
+static uint16_t StateUa(const EPD_PWR_PROFILE *Profile, EPD_PWR_STATE State)
+{
+    switch (State) {
+    case EPD_PWR_POWERED:   return Profile->PoweredUa;
+    case EPD_PWR_STANDBY:   return Profile->StandbyUa;
+    default:                return Profile->DeepSleepUa;
+    }
+}
+
+// uA x ms -> uJ at the supply voltage
+static uint64_t ToUj(uint32_t Ua, uint32_t Ms)
+{
+    return (uint64_t)Ua * EPD_PWR_VOLTAGE_MV * Ms / 1000000u;
+}
+
+uint16_t EPD_Power_WakeMs(const EPD_PWR_PROFILE *Profile, EPD_PWR_STATE From)
+{
+    switch (From) {
+    case EPD_PWR_POWERED:   return 0;
+    case EPD_PWR_STANDBY:   return Profile->PowerOnMs;
+    default:                return Profile->ResetLowMs + Profile->ResetHighMs + Profile->InitMs;
+    }
+}
+
+uint32_t EPD_Power_EnterUj(const EPD_PWR_PROFILE *Profile, EPD_PWR_STATE State)
+{
+    return State == EPD_PWR_POWERED ? 0 : (uint32_t)ToUj(Profile->ActiveUa, Profile->PowerOffMs);
+}
+
+uint32_t EPD_Power_WakeUj(const EPD_PWR_PROFILE *Profile, EPD_PWR_STATE From)
+{
+    return (uint32_t)ToUj(Profile->ActiveUa, EPD_Power_WakeMs(Profile, From));
+}
+
+/******************************************************************************
+function :	Energy of one idle period spent in a state, including getting
+            there and waking up again
+******************************************************************************/
+uint64_t EPD_Power_IdleUj(const EPD_PWR_PROFILE *Profile, EPD_PWR_STATE State, uint32_t IdleMs)
+{
+    return ToUj(StateUa(Profile, State), IdleMs) +
+           EPD_Power_EnterUj(Profile, State) + EPD_Power_WakeUj(Profile, State);
+}
+
+/******************************************************************************
+function :	Time in From after which moving on to To saves energy
+parameter:
+    From : Current, higher-power state
+    To   : Lower-power state
+******************************************************************************/
+uint32_t EPD_Power_BreakEvenMs(const EPD_PWR_PROFILE *Profile, EPD_PWR_STATE From, EPD_PWR_STATE To)
+{
+    uint32_t UaFrom = StateUa(Profile, From), UaTo = StateUa(Profile, To);
+    int64_t Extra = (int64_t)EPD_Power_EnterUj(Profile, To) + EPD_Power_WakeUj(Profile, To) -
+                    EPD_Power_WakeUj(Profile, From);
+
+    if (UaFrom <= UaTo)
+        return UINT32_MAX;
+    if (Extra <= 0)
+        return 0;
+    return (uint32_t)(Extra * 1000000 / ((int64_t)(UaFrom - UaTo) * EPD_PWR_VOLTAGE_MV));
+}
+
+/******************************************************************************
+function :	Idle state with the lowest energy for an expected idle time
+parameter:
+    IdleMs    : Expected time until the next refresh
+    MaxWakeMs : Wake latency the caller accepts, EPD_PWR_NO_LIMIT for any
+******************************************************************************/
+EPD_PWR_STATE EPD_Power_Choose(const EPD_PWR_PROFILE *Profile, uint32_t IdleMs, uint16_t MaxWakeMs)
+{
+    EPD_PWR_STATE Best = EPD_PWR_POWERED;
+    uint64_t BestUj = EPD_Power_IdleUj(Profile, EPD_PWR_POWERED, IdleMs);
+
+    for (int s = EPD_PWR_STANDBY; s >= EPD_PWR_DEEP_SLEEP; s--) {
+        EPD_PWR_STATE State = (EPD_PWR_STATE)s;
+        if (EPD_Power_WakeMs(Profile, State) > MaxWakeMs)
+            continue;
+        uint64_t Uj = EPD_Power_IdleUj(Profile, State, IdleMs);
+        if (Uj < BestUj) {
+            Best = State;
+            BestUj = Uj;
+        }
+    }
+    return Best;
+}
+
+/******************************************************************************
+function :	Controller access
+******************************************************************************/
+static void WaitBusy(const EPD_PWR *Pwr)
+{
+    const EPD_PWR_IO *Io = Pwr->Io;
+    const EPD_PWR_PROFILE *Profile = Pwr->Profile;
+
+    Io->Delay(1);   // BUSY follows the command after up to 200us
+    for (;;) {
+        if (Profile->BusyPollCmd != EPD_PWR_SEQ_END)
+            Io->SendCommand(Profile->BusyPollCmd);
+        if (Io->ReadBusyPin() != Profile->BusyLevel)
+            break;
+        Io->Delay(5);
+    }
+}
+
+static void RunSequence(const EPD_PWR *Pwr, const uint8_t *Seq)
+{
+    const EPD_PWR_IO *Io = Pwr->Io;
+
+    while (*Seq != EPD_PWR_SEQ_END) {
+        uint8_t Cmd = *Seq++;
+        uint8_t Len = *Seq++;
+
+        Io->SendCommand(Cmd);
+        for (uint8_t i = 0; i < (Len & EPD_PWR_SEQ_LEN_MASK); i++)
+            Io->SendData(*Seq++);
+        if (Len & EPD_PWR_SEQ_BUSY)
+            WaitBusy(Pwr);
+    }
+}
+
+/******************************************************************************
+function :	Bind the manager to a controller
+parameter:
+    State : Where the controller is now, EPD_PWR_POWERED after EPD_*_Init()
+******************************************************************************/
+void EPD_Power_Init(EPD_PWR *Pwr, const EPD_PWR_PROFILE *Profile, const EPD_PWR_IO *Io, EPD_PWR_STATE State)
+{
+    Pwr->Profile = Profile;
+    Pwr->Io = Io;
+    Pwr->State = State;
+    Pwr->Held = false;
+    Pwr->MaxWakeMs = EPD_PWR_NO_LIMIT;
+    Pwr->IdleEstimateMs = EPD_PWR_IDLE_UNKNOWN;
+    Pwr->ReleasedMs = Io->Millis();
+    Pwr->StateMs = Pwr->ReleasedMs;
+    Pwr->WakeMs = 0;
+    Pwr->TransitionUj = 0;
+    for (int i = 0; i < EPD_PWR_STATE_COUNT; i++) {
+        Pwr->ResidencyMs[i] = 0;
+        Pwr->Wakes[i] = 0;
+    }
+}
+
+/******************************************************************************
+function :	Power the controller for a refresh
+return   :  State it was woken from; after EPD_PWR_DEEP_SLEEP or EPD_PWR_OFF
+            all registers, including LUTs, were rewritten
+******************************************************************************/
+EPD_PWR_STATE EPD_Power_Acquire(EPD_PWR *Pwr)
+{
+    const EPD_PWR_IO *Io = Pwr->Io;
+    const EPD_PWR_PROFILE *Profile = Pwr->Profile;
+    EPD_PWR_STATE From = Pwr->State;
+    uint32_t Start = Io->Millis();
+
+    if (!Pwr->Held) {
+        // Follow a burst at once, let long gaps raise the estimate slowly
+        uint32_t Gap = Start - Pwr->ReleasedMs;
+        if (Pwr->IdleEstimateMs == EPD_PWR_IDLE_UNKNOWN || Gap < Pwr->IdleEstimateMs)
+            Pwr->IdleEstimateMs = Gap;
+        else
+            Pwr->IdleEstimateMs = (3 * Pwr->IdleEstimateMs + Gap) / 4;
+        Pwr->Held = true;
+    }
+
+    if (From == EPD_PWR_POWERED)
+        return From;
+
+    if (From == EPD_PWR_STANDBY) {
+        RunSequence(Pwr, Profile->PowerOnSeq);
+    } else {
+        Io->SetReset(0);
+        Io->Delay(Profile->ResetLowMs);
+        Io->SetReset(1);
+        Io->Delay(Profile->ResetHighMs);
+        RunSequence(Pwr, Profile->InitSeq);
+    }
+
+    uint32_t Now = Io->Millis();
+    Pwr->ResidencyMs[From] += Start - Pwr->StateMs;
+    Pwr->State = EPD_PWR_POWERED;
+    Pwr->StateMs = Now;
+    Pwr->Wakes[From]++;
+    Pwr->WakeMs += Now - Start;
+    Pwr->TransitionUj += (uint32_t)ToUj(Profile->ActiveUa, Now - Start);
+    return From;
+}
+
+/******************************************************************************
+function :	Move a powered or standby controller to a lower state
+******************************************************************************/
+void EPD_Power_Enter(EPD_PWR *Pwr, EPD_PWR_STATE State)
+{
+    const EPD_PWR_IO *Io = Pwr->Io;
+    uint32_t Start = Io->Millis();
+
+    if (State >= Pwr->State || State == EPD_PWR_OFF)
+        return;
+
+    RunSequence(Pwr, State == EPD_PWR_STANDBY ? Pwr->Profile->StandbySeq : Pwr->Profile->DeepSleepSeq);
+
+    uint32_t Now = Io->Millis();
+    Pwr->ResidencyMs[Pwr->State] += Start - Pwr->StateMs;
+    Pwr->TransitionUj += (uint32_t)ToUj(Pwr->Profile->ActiveUa, Now - Start);
+    Pwr->State = State;
+    Pwr->StateMs = Now;
+}
+
+/******************************************************************************
+function :	The refresh is done, pick the idle state
+parameter:
+    ExpectedIdleMs : Time until the next refresh if the caller knows it,
+                     0 uses the average of the observed gaps
+return   :  State the controller idles in
+******************************************************************************/
+EPD_PWR_STATE EPD_Power_Release(EPD_PWR *Pwr, uint32_t ExpectedIdleMs)
+{
+    uint32_t IdleMs = ExpectedIdleMs ? ExpectedIdleMs : Pwr->IdleEstimateMs;
+
+    Pwr->Held = false;
+    Pwr->ReleasedMs = Pwr->Io->Millis();
+
+    // Without any idea of the idle time stay powered, Poll() demotes later
+    if (IdleMs != EPD_PWR_IDLE_UNKNOWN)
+        EPD_Power_Enter(Pwr, EPD_Power_Choose(Pwr->Profile, IdleMs, Pwr->MaxWakeMs));
+    return Pwr->State;
+}
+
+/******************************************************************************
+function :	Demote an idle controller that outlasted the break-even time
+return   :  Current state
+******************************************************************************/
+EPD_PWR_STATE EPD_Power_Poll(EPD_PWR *Pwr)
+{
+    const EPD_PWR_PROFILE *Profile = Pwr->Profile;
+    uint32_t InState;
+
+    if (Pwr->Held || Pwr->State <= EPD_PWR_DEEP_SLEEP)
+        return Pwr->State;
+
+    InState = Pwr->Io->Millis() - Pwr->StateMs;
+    for (int s = Pwr->State - 1; s >= EPD_PWR_DEEP_SLEEP; s--) {
+        EPD_PWR_STATE To = (EPD_PWR_STATE)s;
+        if (EPD_Power_WakeMs(Profile, To) > Pwr->MaxWakeMs)
+            continue;
+        if (InState >= EPD_Power_BreakEvenMs(Profile, Pwr->State, To)) {
+            EPD_Power_Enter(Pwr, To);
+            break;
+        }
+    }
+    return Pwr->State;
+}
+
+/******************************************************************************
+function :	Energy spent since EPD_Power_Init(), nominal currents
+******************************************************************************/
+uint64_t EPD_Power_EnergyUj(const EPD_PWR *Pwr)
+{
+    uint64_t Uj = Pwr->TransitionUj;
+    uint32_t Live = Pwr->Io->Millis() - Pwr->StateMs;
+
+    for (int i = 0; i < EPD_PWR_STATE_COUNT; i++) {
+        uint32_t Ms = Pwr->ResidencyMs[i] + (i == Pwr->State ? Live : 0);
+        Uj += ToUj(StateUa(Pwr->Profile, (EPD_PWR_STATE)i), Ms);
+    }
+    return Uj;
+}
+
+const char *EPD_Power_StateName(EPD_PWR_STATE State)
+{
+    switch (State) {
+    case EPD_PWR_OFF:           return "off";
+    case EPD_PWR_DEEP_SLEEP:    return "deep-sleep";
+    case EPD_PWR_STANDBY:       return "standby";
+    case EPD_PWR_POWERED:       return "powered";
+    default:                    return "?";
+    }
+}
+
+#if defined(ARDUINO)
+#include "DEV_Config.h"
+
+static void PWR_DEV_SendCommand(uint8_t Reg)
+{
+    DEV_Digital_Write(EPD_DC_PIN, 0);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    DEV_SPI_WriteByte(Reg);
+    DEV_Digital_Write(EPD_CS_PIN, 1);
+}
+
+static void PWR_DEV_SendData(uint8_t Data)
+{
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    DEV_SPI_WriteByte(Data);
+    DEV_Digital_Write(EPD_CS_PIN, 1);
+}
+
+static uint8_t PWR_DEV_ReadBusyPin(void)
+{
+    return DEV_Digital_Read(EPD_BUSY_PIN);
+}
+
+static void PWR_DEV_SetReset(uint8_t Level)
+{
+    DEV_Digital_Write(EPD_RST_PIN, Level);
+}
+
+static void PWR_DEV_Delay(uint16_t Ms)
+{
+    DEV_Delay_ms(Ms);
+}
+
+static uint32_t PWR_DEV_Millis(void)
+{
+    return millis();
+}
+
+const EPD_PWR_IO EPD_PWR_IO_DEV = {
+    PWR_DEV_SendCommand,
+    PWR_DEV_SendData,
+    PWR_DEV_ReadBusyPin,
+    PWR_DEV_SetReset,
+    PWR_DEV_Delay,
+    PWR_DEV_Millis,
+};
+#endif
@@ -0,0 +1,129 @@
+/*****************************************************************************
+* | File      	:   EPD_Power.h
+* | Function    :   Power-state manager for UC81xx e-Paper controllers
+* | Info        :
+*   Tracks whether the controller is off, in deep sleep, in standby (booster
+*   off, registers kept) or powered (booster on). After a refresh it picks
+*   the idle state with the lowest expected energy for the coming idle time
+*   and demotes it later when the idle outlasts the break-even point. Waking
+*   from deep sleep uses a short reset pulse and replays the cached register
+*   sequence of the driver's _Init() without its fixed delays.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+*   Usage:
+*       EPD_7IN5_V2_Init();
+*       EPD_Power_Init(&pwr, &EPD_PWR_PROFILE_7IN5_V2, &EPD_PWR_IO_DEV, EPD_PWR_POWERED);
+*       ...
+*       EPD_Power_Acquire(&pwr);
+*       EPD_7IN5_V2_Display(Image);
+*       EPD_Power_Release(&pwr, 0);     // 0: use the observed update interval
+*       ...
+*       EPD_Power_Poll(&pwr);           // from loop()
+*
+*   The wake path bypasses the driver's _Reset(): panels with register LUTs
+*   must invalidate their EPD_LUT_SLOT when Acquire() reports a deep sleep.
+*   Timings and currents in the profiles are nominal datasheet magnitudes.
+******************************************************************************/
+#ifndef _EPD_POWER_H_
+#define _EPD_POWER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    EPD_PWR_OFF = 0,        // never initialized, needs the full sequence
+    EPD_PWR_DEEP_SLEEP,     // 0x07/0xA5, registers lost, reset to wake
+    EPD_PWR_STANDBY,        // 0x02, booster off, registers kept
+    EPD_PWR_POWERED,        // booster on, ready to refresh
+    EPD_PWR_STATE_COUNT,
+} EPD_PWR_STATE;
+
+/**
+ * Command sequences: Cmd, Len, Data[Len], ... EPD_PWR_SEQ_END.
+ * EPD_PWR_SEQ_BUSY in Len waits for the controller after the data.
+**/
+#define EPD_PWR_SEQ_END         0xFF
+#define EPD_PWR_SEQ_BUSY        0x80
+#define EPD_PWR_SEQ_LEN_MASK    0x7F
+
+#define EPD_PWR_IDLE_UNKNOWN    0           // no hint and no history yet
+#define EPD_PWR_NO_LIMIT        0xFFFF      // wake latency budget
+#define EPD_PWR_VOLTAGE_MV      3300
+
+typedef struct {
+    const char *Name;
+    const uint8_t *InitSeq;         // after reset, leaves the controller powered
+    const uint8_t *PowerOnSeq;      // standby -> powered
+    const uint8_t *StandbySeq;      // powered -> standby
+    const uint8_t *DeepSleepSeq;    // powered/standby -> deep sleep
+    uint8_t BusyLevel;              // BUSY pin level while the controller works
+    uint8_t BusyPollCmd;            // sent before each BUSY sample, EPD_PWR_SEQ_END: none
+    uint8_t ResetLowMs;             // minimal reset pulse
+    uint8_t ResetHighMs;
+    uint16_t InitMs;                // nominal InitSeq incl. its busy waits
+    uint16_t PowerOnMs;             // nominal booster start
+    uint16_t PowerOffMs;
+    uint16_t DriverInitMs;          // nominal EPD_*_Init() with its fixed delays
+    uint16_t DeepSleepUa;           // idle currents
+    uint16_t StandbyUa;
+    uint16_t PoweredUa;
+    uint16_t ActiveUa;              // while waking or changing state
+} EPD_PWR_PROFILE;
+
+typedef struct {
+    void (*SendCommand)(uint8_t Reg);
+    void (*SendData)(uint8_t Data);
+    uint8_t (*ReadBusyPin)(void);
+    void (*SetReset)(uint8_t Level);
+    void (*Delay)(uint16_t Ms);
+    uint32_t (*Millis)(void);
+} EPD_PWR_IO;
+
+typedef struct {
+    const EPD_PWR_PROFILE *Profile;
+    const EPD_PWR_IO *Io;
+    EPD_PWR_STATE State;
+    bool Held;                      // between Acquire() and Release()
+    uint16_t MaxWakeMs;             // latency budget for the idle choice
+    uint32_t IdleEstimateMs;        // expected gap between refreshes
+    uint32_t ReleasedMs;            // start of the current idle period
+    uint32_t StateMs;               // entry time of the current state
+    uint32_t ResidencyMs[EPD_PWR_STATE_COUNT];
+    uint32_t Wakes[EPD_PWR_STATE_COUNT];    // by state woken from
+    uint32_t WakeMs;                // total time spent waking
+    uint32_t TransitionUj;          // energy of wakes and state changes
+} EPD_PWR;
+
+extern const EPD_PWR_PROFILE EPD_PWR_PROFILE_7IN5_V2;
+extern const EPD_PWR_PROFILE EPD_PWR_PROFILE_2IN9D;
+
+#if defined(ARDUINO)
+extern const EPD_PWR_IO EPD_PWR_IO_DEV;
+#endif
+
+uint16_t EPD_Power_WakeMs(const EPD_PWR_PROFILE *Profile, EPD_PWR_STATE From);
+uint32_t EPD_Power_EnterUj(const EPD_PWR_PROFILE *Profile, EPD_PWR_STATE State);
+uint32_t EPD_Power_WakeUj(const EPD_PWR_PROFILE *Profile, EPD_PWR_STATE From);
+uint64_t EPD_Power_IdleUj(const EPD_PWR_PROFILE *Profile, EPD_PWR_STATE State, uint32_t IdleMs);
+uint32_t EPD_Power_BreakEvenMs(const EPD_PWR_PROFILE *Profile, EPD_PWR_STATE From, EPD_PWR_STATE To);
+EPD_PWR_STATE EPD_Power_Choose(const EPD_PWR_PROFILE *Profile, uint32_t IdleMs, uint16_t MaxWakeMs);
+
+void EPD_Power_Init(EPD_PWR *Pwr, const EPD_PWR_PROFILE *Profile, const EPD_PWR_IO *Io, EPD_PWR_STATE State);
+EPD_PWR_STATE EPD_Power_Acquire(EPD_PWR *Pwr);
+EPD_PWR_STATE EPD_Power_Release(EPD_PWR *Pwr, uint32_t ExpectedIdleMs);
+EPD_PWR_STATE EPD_Power_Poll(EPD_PWR *Pwr);
+void EPD_Power_Enter(EPD_PWR *Pwr, EPD_PWR_STATE State);
+uint64_t EPD_Power_EnergyUj(const EPD_PWR *Pwr);
+const char *EPD_Power_StateName(EPD_PWR_STATE State);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,278 @@
+/*****************************************************************************
+* | File      	:   EPD_Waveform.cpp
+* | Function    :   Temperature-aware waveform selection for SSD16xx panels
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+*   Nominal refresh times come from the Waveshare panel specifications, the
+*   forced temperatures from the drivers' _Init_Fast sequences.
+******************************************************************************/
+#include "EPD_Waveform.h"
+
+#include <stddef.h>
+
+#define ENTRY_COUNT(_table) ((uint8_t)(sizeof(_table) / sizeof((_table)[0])))
+
+/**
+ * Panel tables
+**/
+static const EPD_WF_ENTRY WF_4IN2_V2[] = {
+    // Mode             TempMin TempMax RefreshMs Ghost ForcedTemp
+    { EPD_WF_FULL,       0, 50, 4000, 0, EPD_WF_REAL_TEMP },
+    { EPD_WF_FAST_1_5S, 10, 40, 1500, 1, 0x6E },
+    { EPD_WF_FAST_1S,   15, 35, 1000, 2, 0x5A },
+    { EPD_WF_PARTIAL,    5, 45,  400, 1, EPD_WF_REAL_TEMP },
+};
+const EPD_WF_PANEL EPD_WF_PANEL_4IN2_V2 = { "4in2_V2", WF_4IN2_V2, ENTRY_COUNT(WF_4IN2_V2), 6 };
+
+static const EPD_WF_ENTRY WF_2IN13_V4[] = {
+    { EPD_WF_FULL,       0, 50, 2000, 0, EPD_WF_REAL_TEMP },
+    { EPD_WF_FAST_1_5S, 10, 40, 1500, 1, 0x64 },
+    { EPD_WF_PARTIAL,    5, 45,  300, 1, EPD_WF_REAL_TEMP },
+};
+const EPD_WF_PANEL EPD_WF_PANEL_2IN13_V4 = { "2in13_V4", WF_2IN13_V4, ENTRY_COUNT(WF_2IN13_V4), 5 };
+
+static const EPD_WF_ENTRY WF_2IN7_V2[] = {
+    { EPD_WF_FULL,       0, 50, 3000, 0, EPD_WF_REAL_TEMP },
+    { EPD_WF_FAST_1_5S, 10, 40, 1500, 1, 0x64 },
+    { EPD_WF_PARTIAL,    5, 45,  400, 1, EPD_WF_REAL_TEMP },
+};
+const EPD_WF_PANEL EPD_WF_PANEL_2IN7_V2 = { "2in7_V2", WF_2IN7_V2, ENTRY_COUNT(WF_2IN7_V2), 5 };
+
+static const EPD_WF_ENTRY WF_4IN26[] = {
+    { EPD_WF_FULL,       0, 50, 3500, 0, EPD_WF_REAL_TEMP },
+    { EPD_WF_FAST_1_5S, 10, 40, 1500, 1, 0x5A },
+    { EPD_WF_PARTIAL,    5, 45,  400, 1, EPD_WF_REAL_TEMP },
+};
+const EPD_WF_PANEL EPD_WF_PANEL_4IN26 = { "4in26", WF_4IN26, ENTRY_COUNT(WF_4IN26), 6 };
+
+/******************************************************************************
+function :	Pick the fastest usable waveform
+parameter:
+    Panel       : Waveform table of the panel
+    Temperature : Measured temperature, EPD_WF_TEMP_UNKNOWN when unavailable
+    Ghost       : Ghosting accumulated since the last full refresh
+    Allow       : EPD_WF_ALLOW() mask of the modes the caller can display
+return   :  Index into Panel->Table, the full waveform when nothing else fits
+******************************************************************************/
+int EPD_Waveform_Choose(const EPD_WF_PANEL *Panel, int8_t Temperature, uint8_t Ghost, uint8_t Allow)
+{
+    int Best = -1, Full = 0;
+
+    for (int i = 0; i < Panel->Count; i++) {
+        const EPD_WF_ENTRY *e = &Panel->Table[i];
+        if (e->Mode == EPD_WF_FULL)
+            Full = i;
+        if (!(Allow & EPD_WF_ALLOW(e->Mode)))
+            continue;
+        if (e->Mode != EPD_WF_FULL) {
+            // Without a reading only the sensor-driven full waveform is safe
+            if (Temperature == EPD_WF_TEMP_UNKNOWN)
+                continue;
+            if (Temperature < e->TempMin || Temperature > e->TempMax)
+                continue;
+            if (Ghost + e->Ghost > Panel->GhostBudget)
+                continue;
+        }
+        if (Best < 0 || e->RefreshMs < Panel->Table[Best].RefreshMs)
+            Best = i;
+    }
+    return Best >= 0 ? Best : Full;
+}
+
+/******************************************************************************
+function :	Bind the manager to a panel, the controller must be initialized
+parameter:
+******************************************************************************/
+void EPD_Waveform_Init(EPD_WF_STATE *State, const EPD_WF_PANEL *Panel, const EPD_WF_IO *Io)
+{
+    State->Panel = Panel;
+    State->Io = Io;
+    State->Temperature = EPD_WF_TEMP_UNKNOWN;
+    State->TempReadMs = 0;
+    State->Ghost = 0;
+    State->Chosen = 0;
+    State->Loads = 0;
+    State->LoadsSkipped = 0;
+    State->TempReads = 0;
+    EPD_Waveform_Invalidate(State);
+}
+
+/******************************************************************************
+function :	Forget the latched waveform (after reset, SWRESET or deep sleep)
+parameter:
+******************************************************************************/
+void EPD_Waveform_Invalidate(EPD_WF_STATE *State)
+{
+    State->Loaded = EPD_WF_NOT_LOADED;
+}
+
+/******************************************************************************
+function :	Read the on-panel temperature sensor, cached for EPD_WF_TEMP_CACHE_MS
+parameter:
+    Force : Ignore the cached value
+info:
+    0x18/0x80 selects the internal sensor, 0x22/0xB1 latches it together
+    with the matching LUT, 0x1B reads back the 12-bit value whose first byte
+    is the temperature in whole degrees. The low nibble of the second byte
+    is always 0, so 0xFF 0xFF only comes from a floating data line.
+******************************************************************************/
+int8_t EPD_Waveform_ReadTemperature(EPD_WF_STATE *State, bool Force)
+{
+    const EPD_WF_IO *Io = State->Io;
+    uint32_t Now = Io->Millis();
+
+    if (!Force && State->Temperature != EPD_WF_TEMP_UNKNOWN &&
+        Now - State->TempReadMs < EPD_WF_TEMP_CACHE_MS)
+        return State->Temperature;
+
+    Io->SendCommand(0x18);
+    Io->SendData(0x80);
+    Io->SendCommand(0x22);
+    Io->SendData(0xB1);
+    Io->SendCommand(0x20);
+    Io->ReadBusy();
+
+    Io->SendCommand(0x1B);
+    uint8_t High = Io->ReadData();
+    uint8_t Low = Io->ReadData(); // fraction, only checked for a floating line
+    int8_t Degrees = (int8_t)High;
+
+    // A floating data line or out of the sensor range: no reading
+    if ((High == 0xFF && Low == 0xFF) || Degrees < -40 || Degrees > 85)
+        Degrees = EPD_WF_TEMP_UNKNOWN;
+
+    State->Temperature = Degrees;
+    State->TempReadMs = Now;
+    State->Loaded = EPD_WF_REAL_TEMP;
+    State->TempReads++;
+    return Degrees;
+}
+
+/******************************************************************************
+function :	Choose the waveform for the next refresh and latch it if needed
+parameter:
+    Allow : EPD_WF_ALLOW() mask of the modes the caller can display
+return   :  Mode the caller has to display with
+******************************************************************************/
+EPD_WF_MODE EPD_Waveform_Prepare(EPD_WF_STATE *State, uint8_t Allow)
+{
+    const EPD_WF_IO *Io = State->Io;
+    int8_t Temperature = EPD_Waveform_ReadTemperature(State, false);
+
+    State->Chosen = EPD_Waveform_Choose(State->Panel, Temperature, State->Ghost, Allow);
+    const EPD_WF_ENTRY *e = &State->Panel->Table[State->Chosen];
+
+    // Full (0xF7) and partial (0xFF) updates reload the sensor themselves,
+    // only the forced-temperature waveforms have to be latched up front.
+    if (e->ForcedTemp == EPD_WF_REAL_TEMP)
+        return e->Mode;
+
+    if (State->Loaded == e->ForcedTemp) {
+        State->LoadsSkipped++;
+        return e->Mode;
+    }
+
+    Io->SendCommand(0x1A); // Write to temperature register
+    Io->SendData(e->ForcedTemp);
+    Io->SendData(0x00);
+    Io->SendCommand(0x22); // Load temperature value
+    Io->SendData(0x91);
+    Io->SendCommand(0x20);
+    Io->ReadBusy();
+
+    State->Loaded = e->ForcedTemp;
+    State->Loads++;
+    return e->Mode;
+}
+
+/******************************************************************************
+function :	Account for the refresh that was just displayed
+parameter:
+******************************************************************************/
+void EPD_Waveform_Refreshed(EPD_WF_STATE *State)
+{
+    const EPD_WF_ENTRY *e = &State->Panel->Table[State->Chosen];
+
+    if (e->Mode == EPD_WF_FULL) {
+        State->Ghost = 0;
+    } else {
+        uint16_t Ghost = State->Ghost + e->Ghost;
+        State->Ghost = Ghost > 0xFF ? 0xFF : (uint8_t)Ghost;
+    }
+
+    if (e->ForcedTemp == EPD_WF_REAL_TEMP)
+        State->Loaded = EPD_WF_REAL_TEMP;
+}
+
+EPD_WF_MODE EPD_Waveform_Mode(const EPD_WF_STATE *State)
+{
+    return State->Panel->Table[State->Chosen].Mode;
+}
+
+uint16_t EPD_Waveform_RefreshMs(const EPD_WF_STATE *State)
+{
+    return State->Panel->Table[State->Chosen].RefreshMs;
+}
+
+const char *EPD_Waveform_ModeName(EPD_WF_MODE Mode)
+{
+    switch (Mode) {
+    case EPD_WF_FULL:       return "full";
+    case EPD_WF_FAST_1_5S:  return "fast-1.5s";
+    case EPD_WF_FAST_1S:    return "fast-1s";
+    case EPD_WF_PARTIAL:    return "partial";
+    default:                return "?";
+    }
+}
+
+#if defined(ARDUINO)
+#include "DEV_Config.h"
+
+/**
+ * Default binding to the Waveshare pins, same framing as the drivers
+**/
+static void WF_DEV_SendCommand(uint8_t Reg)
+{
+    DEV_Digital_Write(EPD_DC_PIN, 0);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    DEV_SPI_WriteByte(Reg);
+    DEV_Digital_Write(EPD_CS_PIN, 1);
+}
+
+static void WF_DEV_SendData(uint8_t Data)
+{
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    DEV_SPI_WriteByte(Data);
+    DEV_Digital_Write(EPD_CS_PIN, 1);
+}
+
+static uint8_t WF_DEV_ReadData(void)
+{
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    return DEV_SPI_ReadByte();
+}
+
+static void WF_DEV_ReadBusy(void)
+{
+    while (DEV_Digital_Read(EPD_BUSY_PIN) == 1) {      //LOW: idle, HIGH: busy
+        DEV_Delay_ms(10);
+    }
+}
+
+static uint32_t WF_DEV_Millis(void)
+{
+    return millis();
+}
+
+const EPD_WF_IO EPD_WF_IO_DEV = {
+    WF_DEV_SendCommand,
+    WF_DEV_SendData,
+    WF_DEV_ReadData,
+    WF_DEV_ReadBusy,
+    WF_DEV_Millis,
+};
+#endif
@@ -0,0 +1,125 @@
+/*****************************************************************************
+* | File      	:   EPD_Waveform.h
+* | Function    :   Temperature-aware waveform selection for SSD16xx panels
+* | Info        :
+*   The SSD16xx controllers pick their OTP waveform from the value held in
+*   the temperature register. The "_Init_Fast" variants of the drivers force
+*   a fake temperature into 0x1A to get a shorter waveform; this module reads
+*   the real on-panel sensor instead, then chooses per refresh the fastest
+*   waveform whose temperature window is valid and that still fits into the
+*   ghosting budget. Waveforms already latched in the controller are not
+*   loaded again.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+*   Usage:
+*       EPD_Waveform_Init(&wf, &EPD_WF_PANEL_4IN2_V2, &EPD_WF_IO_DEV);
+*       switch (EPD_Waveform_Prepare(&wf, EPD_WF_ALLOW_FRAME)) {
+*       case EPD_WF_FULL:    EPD_4IN2_V2_Display(Image);      break;
+*       default:             EPD_4IN2_V2_Display_Fast(Image); break;
+*       }
+*       EPD_Waveform_Refreshed(&wf);
+*
+*   Call EPD_Waveform_Invalidate() after every hardware reset or deep sleep,
+*   the controller forgets the latched waveform then.
+******************************************************************************/
+#ifndef _EPD_WAVEFORM_H_
+#define _EPD_WAVEFORM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Waveform kinds, ordered from the slowest/cleanest to the fastest
+**/
+typedef enum {
+    EPD_WF_FULL = 0,        // OTP waveform at the measured temperature
+    EPD_WF_FAST_1_5S,       // OTP waveform selected by a forced temperature
+    EPD_WF_FAST_1S,         // shorter forced-temperature waveform
+    EPD_WF_PARTIAL,         // differential update of the changed pixels only
+    EPD_WF_MODE_COUNT,
+} EPD_WF_MODE;
+
+#define EPD_WF_ALLOW(_mode)     (1u << (_mode))
+#define EPD_WF_ALLOW_FRAME      (EPD_WF_ALLOW(EPD_WF_FULL) | EPD_WF_ALLOW(EPD_WF_FAST_1_5S) | EPD_WF_ALLOW(EPD_WF_FAST_1S))
+#define EPD_WF_ALLOW_ANY        (EPD_WF_ALLOW_FRAME | EPD_WF_ALLOW(EPD_WF_PARTIAL))
+
+#define EPD_WF_TEMP_UNKNOWN     (-128)
+#define EPD_WF_TEMP_CACHE_MS    60000   // the panel warms up slowly, one read a minute is plenty
+#define EPD_WF_NOT_LOADED       0xFF    // nothing latched since the last reset
+#define EPD_WF_REAL_TEMP        0x00    // latched waveform follows the sensor
+
+/**
+ * One waveform a panel supports
+**/
+typedef struct {
+    EPD_WF_MODE Mode;
+    int8_t TempMin;         // valid window in degC, inclusive
+    int8_t TempMax;
+    uint16_t RefreshMs;     // nominal duration of the update
+    uint8_t Ghost;          // ghosting units one refresh leaves behind
+    uint8_t ForcedTemp;     // value written to 0x1A, EPD_WF_REAL_TEMP uses the sensor
+} EPD_WF_ENTRY;
+
+typedef struct {
+    const char *Name;
+    const EPD_WF_ENTRY *Table;
+    uint8_t Count;
+    uint8_t GhostBudget;    // a full refresh is forced before this is exceeded
+} EPD_WF_PANEL;
+
+/**
+ * Controller access, so the selection logic also runs on the host
+**/
+typedef struct {
+    void (*SendCommand)(uint8_t Reg);
+    void (*SendData)(uint8_t Data);
+    uint8_t (*ReadData)(void);
+    void (*ReadBusy)(void);
+    uint32_t (*Millis)(void);
+} EPD_WF_IO;
+
+typedef struct {
+    const EPD_WF_PANEL *Panel;
+    const EPD_WF_IO *Io;
+    int8_t Temperature;
+    uint32_t TempReadMs;
+    uint8_t Ghost;          // accumulated since the last full refresh
+    uint8_t Loaded;         // 0x1A value latched in the controller
+    uint8_t Chosen;         // index into Panel->Table
+    uint32_t Loads;         // waveform load sequences sent
+    uint32_t LoadsSkipped;  // ... and avoided because it was already latched
+    uint32_t TempReads;
+} EPD_WF_STATE;
+
+extern const EPD_WF_PANEL EPD_WF_PANEL_4IN2_V2;
+extern const EPD_WF_PANEL EPD_WF_PANEL_2IN13_V4;
+extern const EPD_WF_PANEL EPD_WF_PANEL_2IN7_V2;
+extern const EPD_WF_PANEL EPD_WF_PANEL_4IN26;
+
+#if defined(ARDUINO)
+extern const EPD_WF_IO EPD_WF_IO_DEV;
+#endif
+
+int EPD_Waveform_Choose(const EPD_WF_PANEL *Panel, int8_t Temperature, uint8_t Ghost, uint8_t Allow);
+
+void EPD_Waveform_Init(EPD_WF_STATE *State, const EPD_WF_PANEL *Panel, const EPD_WF_IO *Io);
+void EPD_Waveform_Invalidate(EPD_WF_STATE *State);
+int8_t EPD_Waveform_ReadTemperature(EPD_WF_STATE *State, bool Force);
+EPD_WF_MODE EPD_Waveform_Prepare(EPD_WF_STATE *State, uint8_t Allow);
+void EPD_Waveform_Refreshed(EPD_WF_STATE *State);
+
+EPD_WF_MODE EPD_Waveform_Mode(const EPD_WF_STATE *State);
+uint16_t EPD_Waveform_RefreshMs(const EPD_WF_STATE *State);
+const char *EPD_Waveform_ModeName(EPD_WF_MODE Mode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
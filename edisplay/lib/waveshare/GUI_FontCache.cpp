@@ -0,0 +1,156 @@
+/*****************************************************************************
+* | File      	:   GUI_FontCache.cpp
+* | Function    :   Packed GUI_Paint fonts and a cache of expanded glyphs
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+*   The glyph records are written by tools/pack_fonts.py, which decodes
+*   them the same way to check them against the stock tables.
+******************************************************************************/
+#include "GUI_FontCache.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#define GLYPH_BYTES     (MAX_HEIGHT_FONT * MAX_WIDTH_FONT / 8)
+
+typedef struct {
+    const FONT_PACK *Pack;      // NULL while the slot is empty
+    uint16_t Glyph;
+    uint32_t Used;              // Clock at the last hit
+    uint8_t Bitmap[GLYPH_BYTES];
+} FONT_CACHE_SLOT;
+
+static FONT_CACHE_SLOT Slots[FONT_CACHE_SLOTS];
+static uint32_t Clock;
+static FONT_CACHE_STATS Stats;
+
+/******************************************************************************
+function :	Decoding
+******************************************************************************/
+// Count bits from bit Pos of Bits, MSB first; Count <= 32
+static uint32_t ReadBits(const uint8_t *Bits, uint32_t Pos, uint8_t Count)
+{
+    const uint8_t *p = Bits + (Pos >> 3);
+    uint8_t Skip = Pos & 7;
+    uint8_t Bytes = (Skip + Count + 7) >> 3;
+    uint64_t Acc = 0;
+    for (uint8_t i = 0; i < Bytes; i++)
+        Acc = Acc << 8 | p[i];
+    Acc >>= Bytes * 8 - Skip - Count;
+    return (uint32_t)(Acc & (((uint64_t)1 << Count) - 1));
+}
+
+// Zero runs back to the bit stream; false when it would overflow Out
+static bool ZeroRunsDecode(const uint8_t *In, const uint8_t *End, uint8_t *Out, uint32_t OutSize)
+{
+    uint32_t n = 0;
+    while (In < End) {
+        uint8_t Ctrl = *In++;
+        uint8_t Len = Ctrl & ~FONT_PACK_ZERO_RUN;
+        if (n + Len > OutSize || (!(Ctrl & FONT_PACK_ZERO_RUN) && In + Len > End))
+            return false;
+        if (Ctrl & FONT_PACK_ZERO_RUN) {
+            memset(Out + n, 0, Len);
+        } else {
+            memcpy(Out + n, In, Len);
+            In += Len;
+        }
+        n += Len;
+    }
+    return true;
+}
+
+static bool Expand(const FONT_PACK *Pack, uint16_t Glyph, uint8_t *Out)
+{
+    static uint8_t Runs[GLYPH_BYTES];
+    const uint8_t *Record = Pack->Data + Pack->Offset[Glyph];
+    const uint8_t *End = Pack->Data + Pack->Offset[Glyph + 1];
+    uint16_t Stride = (Pack->Width + 7) / 8;
+
+    memset(Out, 0, Stride * Pack->Height);
+    if (End - Record < 4)
+        return false;
+    uint8_t X = Record[0], Y = Record[1], W = Record[2] & ~FONT_PACK_DELTA, H = Record[3];
+    bool Delta = (Record[2] & FONT_PACK_DELTA) != 0;
+    if (!W)
+        return true;
+    if (X + W > Pack->Width || Y + H > Pack->Height)
+        return false;
+
+    const uint8_t *Bits = Record + 4;
+    uint32_t Size = ((uint32_t)W * H + 7) / 8;
+    if (Delta) {
+        memset(Runs, 0, Size);
+        if (!ZeroRunsDecode(Bits, End, Runs, Size))
+            return false;
+        Bits = Runs;
+    } else if ((uint32_t)(End - Bits) < Size) {
+        return false;
+    }
+
+    uint32_t Prev = 0;
+    for (uint8_t y = 0; y < H; y++) {
+        uint32_t Row = ReadBits(Bits, (uint32_t)y * W, W);
+        if (Delta) {
+            Row ^= Prev;
+            Prev = Row;
+        }
+        // Row to its place in a 32-bit line, then the line's first Stride bytes
+        uint32_t Line = Row << (32 - X - W);
+        uint8_t *p = Out + (Y + y) * Stride;
+        for (uint16_t i = 0; i < Stride; i++)
+            p[i] = (uint8_t)(Line >> (24 - 8 * i));
+    }
+    return true;
+}
+
+/******************************************************************************
+function :	Cache
+******************************************************************************/
+const uint8_t *GUI_FontCache_Get(const FONT_PACK *Pack, uint16_t Glyph)
+{
+    if (Glyph >= Pack->Count || Pack->Width > MAX_WIDTH_FONT || Pack->Height > MAX_HEIGHT_FONT)
+        return NULL;
+
+    FONT_CACHE_SLOT *Victim = &Slots[0];
+    for (int i = 0; i < FONT_CACHE_SLOTS; i++) {
+        FONT_CACHE_SLOT *Slot = &Slots[i];
+        if (Slot->Pack == Pack && Slot->Glyph == Glyph) {
+            Slot->Used = ++Clock;
+            Stats.Hits++;
+            return Slot->Bitmap;
+        }
+        if (Slot->Used < Victim->Used)
+            Victim = Slot;
+    }
+
+    Stats.Misses++;
+    if (!Expand(Pack, Glyph, Victim->Bitmap)) {
+        Victim->Pack = NULL;
+        Victim->Used = 0;
+        return NULL;
+    }
+    Victim->Pack = Pack;
+    Victim->Glyph = Glyph;
+    Victim->Used = ++Clock;
+    return Victim->Bitmap;
+}
+
+void GUI_FontCache_Clear(void)
+{
+    memset(Slots, 0, sizeof(Slots));
+    Clock = 0;
+}
+
+void GUI_FontCache_GetStats(FONT_CACHE_STATS *Out)
+{
+    *Out = Stats;
+}
+
+uint32_t GUI_FontCache_PackBytes(const FONT_PACK *Pack)
+{
+    return Pack->Offset[Pack->Count] + (Pack->Count + 1) * sizeof(uint16_t) + (Pack->Codes ? 3 * Pack->Count : 0);
+}
@@ -0,0 +1,64 @@
+/*****************************************************************************
+* | File      	:   GUI_FontCache.h
+* | Function    :   Packed GUI_Paint fonts and a cache of expanded glyphs
+* | Info        :
+*   A FONT_PACK (fonts.h) holds a font's glyphs cut to the box of their set
+*   pixels; tools/pack_fonts.py writes them to fonts_packed.c. Paint_DrawChar()
+*   and Paint_DrawString_CN() take an sFONT / cFONT whose table is NULL and
+*   whose Pack is set, and get each glyph from GUI_FontCache_Get() in the
+*   layout of the stock tables, so they draw it with the same loop.
+*
+*   The cache holds FONT_CACHE_SLOTS expanded glyphs and replaces the least
+*   recently used one; a hit costs a scan of the slots, a miss the decode of
+*   one glyph.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+*   Glyph record, at Data + Offset[n]:
+*       X, Y          top left of the box in the glyph's cell
+*       W | DELTA     box width, 0 for a glyph without pixels (no bits follow)
+*       H             box height
+*       bits          the box's W x H pixels row after row, MSB first, not
+*                     padded between rows
+*   With FONT_PACK_DELTA every row is XORed with the one above it and the
+*   bytes are zero-run coded: FONT_PACK_ZERO_RUN | n stands for n zero bytes,
+*   n < 0x80 for the n bytes that follow.
+******************************************************************************/
+#ifndef _GUI_FONTCACHE_H_
+#define _GUI_FONTCACHE_H_
+
+#include <stdint.h>
+#include "fonts.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Expanded glyphs kept in RAM, MAX_HEIGHT_FONT * MAX_WIDTH_FONT / 8 bytes each
+#ifndef FONT_CACHE_SLOTS
+#define FONT_CACHE_SLOTS        16
+#endif
+
+#define FONT_PACK_DELTA         0x80
+#define FONT_PACK_ZERO_RUN      0x80
+
+typedef struct {
+    uint32_t Hits;
+    uint32_t Misses;
+} FONT_CACHE_STATS;
+
+// Glyph n of the pack, rows of (Width + 7) / 8 bytes as in the stock
+// tables; NULL past the last glyph. Valid until the next call.
+const uint8_t *GUI_FontCache_Get(const FONT_PACK *Pack, uint16_t Glyph);
+
+void GUI_FontCache_Clear(void);
+void GUI_FontCache_GetStats(FONT_CACHE_STATS *Stats);
+// Flash bytes of the pack: records, index and CN codes
+uint32_t GUI_FontCache_PackBytes(const FONT_PACK *Pack);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
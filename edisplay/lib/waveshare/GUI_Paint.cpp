@@ -76,6 +76,7 @@
 *
 ******************************************************************************/
 #include "GUI_Paint.h"
+#include "GUI_FontCache.h"
 #include "DEV_Config.h"
 #include "utility/Debug.h"
 #include <stdint.h>
@@ -527,8 +528,18 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
         return;
     }
 
-    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
-    const unsigned char *ptr = &Font->table[Char_Offset];
+    const unsigned char *ptr;
+    if (Font->table == NULL) {
+        // Packed font: the glyph expanded to the same layout, see GUI_FontCache.h
+        ptr = GUI_FontCache_Get(Font->Pack, (UWORD)(Acsii_Char - ' '));
+        if (ptr == NULL) {
+            Debug("Paint_DrawChar No glyph for the character\r\n");
+            return;
+        }
+    } else {
+        uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
+        ptr = &Font->table[Char_Offset];
+    }
 
     for (Page = 0; Page < Font->Height; Page ++ ) {
         for (Column = 0; Column < Font->Width; Column ++ ) {
@@ -600,6 +611,25 @@ void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
 }
 
 
+// Entry Num of a stock or packed (GUI_FontCache.h) CN font against the
+// first Len bytes of p_text
+static bool Paint_MatchCN(cFONT *font, int Num, const char *p_text, int Len)
+{
+    const unsigned char *index = font->table ? font->table[Num].index : font->Pack->Codes + 3 * Num;
+    for (int k = 0; k < Len; k++) {
+        if (p_text[k] != index[k])
+            return false;
+    }
+    return true;
+}
+
+static const char *Paint_GlyphCN(cFONT *font, int Num)
+{
+    if (font->table)
+        return &font->table[Num].matrix[0];
+    return (const char *)GUI_FontCache_Get(font->Pack, (UWORD)Num);
+}
+
 /******************************************************************************
 function: Display the string
 parameter:
@@ -622,8 +652,10 @@ void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT
     while (*p_text != 0) {
         if(*p_text <= 0x7F) {  //ASCII < 126
             for(Num = 0; Num < font->size; Num++) {
-                if(*p_text== font->table[Num].index[0]) {
-                    const char* ptr = &font->table[Num].matrix[0];
+                if(Paint_MatchCN(font, Num, p_text, 1)) {
+                    const char* ptr = Paint_GlyphCN(font, Num);
+                    if (ptr == NULL)
+                        break;
 
                     for (j = 0; j < font->Height; j++) {
                         for (i = 0; i < font->Width; i++) {
@@ -658,10 +690,10 @@ void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT
             x += font->ASCII_Width;
         } else {        //Chinese
             for(Num = 0; Num < font->size; Num++) {
-                if ((*p_text == font->table[Num].index[0]) && \
-                    (*(p_text + 1) == font->table[Num].index[1]) && \
-                    (*(p_text + 2) == font->table[Num].index[2])) {
-                    const char* ptr = &font->table[Num].matrix[0];
+                if (Paint_MatchCN(font, Num, p_text, 3)) {
+                    const char* ptr = Paint_GlyphCN(font, Num);
+                    if (ptr == NULL)
+                        break;
 
                     for (j = 0; j < font->Height; j++) {
                         for (i = 0; i < font->Width; i++) {
@@ -1375,10 +1375,12 @@ const uint8_t Font12_Table[] =
 	0x00, //        
 };
 
+#if !FONT_PACKED
 sFONT Font12 = {
   Font12_Table,
   7, /* Width */
   12, /* Height */
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
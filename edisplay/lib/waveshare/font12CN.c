@@ -108,6 +108,7 @@ const CH_CN Font12CN_Table[] =
 0xE0,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
 };
 
+#if !FONT_PACKED
 cFONT Font12CN = {
   Font12CN_Table,
   sizeof(Font12CN_Table)/sizeof(CH_CN),  /*size of table*/
@@ -115,5 +116,6 @@ cFONT Font12CN = {
   16, /* Width */
   21, /* Height */
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
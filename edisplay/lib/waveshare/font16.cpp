@@ -1755,10 +1755,12 @@ const uint8_t Font16_Table[] =
 	0x00, 0x00, //            
 };
 
+#if !FONT_PACKED
 sFONT Font16 = {
   Font16_Table,
   11, /* Width */
   16, /* Height */
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -2133,10 +2133,12 @@ const uint8_t Font20_Table[] =
 };
 
 
+#if !FONT_PACKED
 sFONT Font20 = {
   Font20_Table,
   14, /* Width */
   20, /* Height */
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -2511,10 +2511,12 @@ const uint8_t Font24_Table [] =
 	0x00, 0x00, 0x00, //                  
 };
 
+#if !FONT_PACKED
 sFONT Font24 = {
   Font24_Table,
   17, /* Width */
   24, /* Height */
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
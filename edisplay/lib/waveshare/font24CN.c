@@ -453,6 +453,7 @@ const CH_CN Font24CN_Table[]  =
 
 };
 
+#if !FONT_PACKED
 cFONT Font24CN = {
   Font24CN_Table,
   sizeof(Font24CN_Table)/sizeof(CH_CN),  /*size of table*/
@@ -460,6 +461,7 @@ cFONT Font24CN = {
   32, /* Width */
   41, /* Height */
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
@@ -995,10 +995,12 @@ const uint8_t Font8_Table[] =
 	0x00, //      
 };
 
+#if !FONT_PACKED
 sFONT Font8 = {
   Font8_Table,
   5, /* Width */
   8, /* Height */
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
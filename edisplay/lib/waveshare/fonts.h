@@ -52,12 +52,31 @@
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
 // #include <avr/pgmspace.h>
+
+/* 1: the fonts below are the packed ones in fonts_packed.c (tools/pack_fonts.py),
+   0: the expanded tables of the font*.c* files, for comparison */
+#ifndef FONT_PACKED
+#define FONT_PACKED 1
+#endif
+
+//Packed glyphs, see GUI_FontCache.h
+typedef struct
+{
+  const uint8_t *Data;      // glyph records
+  const uint16_t *Offset;   // Count + 1 offsets into Data
+  const uint8_t *Codes;     // cFONT: the 3-byte CH_CN index per glyph, else NULL
+  uint16_t Count;
+  uint16_t Width;
+  uint16_t Height;
+} FONT_PACK;
+
 //ASCII
 typedef struct _tFont
 {    
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const FONT_PACK *Pack;    // used instead of table when table is NULL
   
 } sFONT;
 
@@ -75,6 +94,7 @@ typedef struct
   uint16_t ASCII_Width;
   uint16_t Width;
   uint16_t Height;
+  const FONT_PACK *Pack;    // used instead of table when table is NULL
   
 }cFONT;
 
@@ -86,6 +106,22 @@ extern sFONT Font8;
 
 extern cFONT Font12CN;
 extern cFONT Font24CN;
+
+extern const uint8_t Font24_Table[];
+extern const uint8_t Font20_Table[];
+extern const uint8_t Font16_Table[];
+extern const uint8_t Font12_Table[];
+extern const uint8_t Font8_Table[];
+extern const CH_CN Font12CN_Table[];
+extern const CH_CN Font24CN_Table[];
+
+extern const FONT_PACK Font24_Pack;
+extern const FONT_PACK Font20_Pack;
+extern const FONT_PACK Font16_Pack;
+extern const FONT_PACK Font12_Pack;
+extern const FONT_PACK Font8_Pack;
+extern const FONT_PACK Font12CN_Pack;
+extern const FONT_PACK Font24CN_Pack;
 // extern const unsigned char Font16_Table[];
 
 #ifdef __cplusplus
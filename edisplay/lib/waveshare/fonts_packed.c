@@ -0,0 +1,1394 @@
+/* Generated by tools/pack_fonts.py from lib/waveshare/font*.c*, do not edit. */
+
+#include <stddef.h>
+#include "fonts.h"
+
+/* 5x8, 95 glyphs, 760 bytes stock, 847 packed */
+static const uint8_t Font8_Data[] = {
+    /* ' ' */
+    0x00,0x00,0x00,0x00,
+    /* '!' */
+    0x02,0x00,0x01,0x06,0xf4,
+    /* '"' */
+    0x01,0x00,0x03,0x02,0xb4,
+    /* '#' */
+    0x00,0x00,0x05,0x07,0x2a,0xbe,0xaf,0xaa,0x80,
+    /* '$' */
+    0x01,0x00,0x03,0x07,0x4f,0x33,0x90,
+    /* '%' */
+    0x01,0x00,0x04,0x06,0x44,0x3c,0x22,
+    /* '&' */
+    0x01,0x01,0x04,0x05,0x74,0xca,0xf0,
+    /* ''' */
+    0x02,0x00,0x01,0x03,0xe0,
+    /* '(' */
+    0x02,0x00,0x02,0x07,0x6a,0xa4,
+    /* ')' */
+    0x01,0x00,0x02,0x07,0x95,0x58,
+    /* '*' */
+    0x01,0x00,0x03,0x04,0x5d,0x50,
+    /* '+' */
+    0x00,0x01,0x05,0x05,0x21,0x3e,0x42,0x00,
+    /* ',' */
+    0x02,0x04,0x02,0x03,0x68,
+    /* '-' */
+    0x01,0x03,0x03,0x01,0xe0,
+    /* '.' */
+    0x02,0x05,0x01,0x01,0x80,
+    /* '/' */
+    0x00,0x00,0x04,0x07,0x12,0x22,0x44,0x80,
+    /* '0' */
+    0x01,0x00,0x03,0x06,0x56,0xda,0x80,
+    /* '1' */
+    0x00,0x00,0x05,0x06,0x61,0x08,0x42,0x7c,
+    /* '2' */
+    0x01,0x00,0x03,0x06,0x55,0x29,0xc0,
+    /* '3' */
+    0x01,0x00,0x03,0x06,0x54,0xa3,0x80,
+    /* '4' */
+    0x01,0x00,0x04,0x06,0x26,0xaf,0x27,
+    /* '5' */
+    0x01,0x00,0x03,0x06,0xf3,0x1a,0x80,
+    /* '6' */
+    0x01,0x00,0x03,0x06,0x73,0x5b,0x80,
+    /* '7' */
+    0x01,0x00,0x03,0x06,0xf4,0xa4,0x80,
+    /* '8' */
+    0x01,0x00,0x03,0x06,0x55,0x5a,0x80,
+    /* '9' */
+    0x01,0x00,0x03,0x06,0x76,0xb3,0x80,
+    /* ':' */
+    0x02,0x02,0x01,0x04,0x90,
+    /* ';' */
+    0x02,0x02,0x02,0x04,0x46,
+    /* '<' */
+    0x00,0x01,0x04,0x05,0x12,0xc2,0x10,
+    /* '=' */
+    0x01,0x01,0x03,0x03,0xe3,0x80,
+    /* '>' */
+    0x01,0x01,0x04,0x05,0x84,0x34,0x80,
+    /* '?' */
+    0x01,0x00,0x03,0x06,0x54,0xa0,0x80,
+    /* '@' */
+    0x01,0x00,0x04,0x07,0x69,0x9b,0x98,0x70,
+    /* 'A' */
+    0x00,0x00,0x05,0x06,0x61,0x14,0xe8,0xec,
+    /* 'B' */
+    0x00,0x00,0x05,0x06,0xf2,0x5c,0x94,0xf8,
+    /* 'C' */
+    0x01,0x00,0x03,0x06,0xf6,0x48,0xc0,
+    /* 'D' */
+    0x00,0x00,0x05,0x06,0xf2,0x52,0x94,0xf8,
+    /* 'E' */
+    0x00,0x00,0x05,0x06,0xfa,0x58,0x84,0xfc,
+    /* 'F' */
+    0x00,0x00,0x05,0x06,0xfa,0x58,0x84,0x70,
+    /* 'G' */
+    0x01,0x00,0x04,0x06,0xe8,0x8b,0xa6,
+    /* 'H' */
+    0x00,0x00,0x05,0x06,0xea,0x5e,0x94,0xf4,
+    /* 'I' */
+    0x01,0x00,0x03,0x06,0xe9,0x25,0xc0,
+    /* 'J' */
+    0x01,0x00,0x04,0x06,0x72,0x2a,0xa4,
+    /* 'K' */
+    0x00,0x00,0x05,0x06,0xda,0x98,0xe5,0x6c,
+    /* 'L' */
+    0x00,0x00,0x05,0x06,0xe2,0x10,0x84,0xfc,
+    /* 'M' */
+    0x00,0x00,0x05,0x06,0xde,0xf7,0x58,0xec,
+    /* 'N' */
+    0x00,0x00,0x05,0x06,0xdb,0x5a,0xb5,0xf4,
+    /* 'O' */
+    0x01,0x00,0x04,0x06,0x69,0x99,0x96,
+    /* 'P' */
+    0x00,0x00,0x05,0x06,0xf2,0x52,0xe4,0x70,
+    /* 'Q' */
+    0x01,0x00,0x04,0x07,0x69,0x99,0x96,0x30,
+    /* 'R' */
+    0x00,0x00,0x05,0x06,0xf2,0x52,0xe4,0xf4,
+    /* 'S' */
+    0x01,0x00,0x03,0x06,0xf5,0x1b,0xc0,
+    /* 'T' */
+    0x00,0x00,0x05,0x06,0xfd,0x48,0x42,0x38,
+    /* 'U' */
+    0x00,0x00,0x05,0x06,0xda,0x52,0x94,0x98,
+    /* 'V' */
+    0x00,0x00,0x05,0x06,0xdc,0x52,0xa5,0x18,
+    /* 'W' */
+    0x00,0x00,0x05,0x06,0xdc,0x6b,0x5a,0xa8,
+    /* 'X' */
+    0x00,0x00,0x05,0x06,0xda,0x88,0x45,0x6c,
+    /* 'Y' */
+    0x00,0x00,0x05,0x06,0xdc,0x54,0x42,0x38,
+    /* 'Z' */
+    0x01,0x00,0x04,0x06,0xf9,0x24,0x9f,
+    /* '[' */
+    0x02,0x00,0x02,0x07,0xea,0xac,
+    /* '\' */
+    0x00,0x00,0x04,0x07,0x84,0x42,0x22,0x10,
+    /* ']' */
+    0x01,0x00,0x02,0x07,0xd5,0x5c,
+    /* '^' */
+    0x01,0x00,0x03,0x03,0x4a,0x80,
+    /* '_' */
+    0x00,0x07,0x05,0x01,0xf8,
+    /* '`' */
+    0x02,0x00,0x02,0x02,0x90,
+    /* 'a' */
+    0x01,0x02,0x04,0x04,0x62,0xef,
+    /* 'b' */
+    0x00,0x00,0x05,0x06,0xc2,0x1c,0x94,0xf8,
+    /* 'c' */
+    0x01,0x02,0x03,0x04,0xf2,0x70,
+    /* 'd' */
+    0x01,0x00,0x04,0x06,0x31,0x79,0x97,
+    /* 'e' */
+    0x01,0x02,0x03,0x04,0xfe,0x30,
+    /* 'f' */
+    0x01,0x00,0x03,0x06,0x2b,0xa5,0xc0,
+    /* 'g' */
+    0x01,0x02,0x04,0x06,0x79,0x97,0x16,
+    /* 'h' */
+    0x00,0x00,0x05,0x06,0xc2,0x1c,0x94,0xf4,
+    /* 'i' */
+    0x01,0x00,0x03,0x06,0x43,0x25,0xc0,
+    /* 'j' */
+    0x01,0x00,0x03,0x08,0x43,0x92,0x4f,
+    /* 'k' */
+    0x00,0x00,0x05,0x06,0xc2,0x16,0xe5,0x6c,
+    /* 'l' */
+    0x01,0x00,0x03,0x06,0xc9,0x25,0xc0,
+    /* 'm' */
+    0x00,0x02,0x05,0x04,0xd5,0x6b,0x50,
+    /* 'n' */
+    0x00,0x02,0x05,0x04,0xf2,0x53,0x90,
+    /* 'o' */
+    0x01,0x02,0x04,0x04,0x69,0x96,
+    /* 'p' */
+    0x00,0x02,0x05,0x06,0xf2,0x52,0xe4,0x70,
+    /* 'q' */
+    0x01,0x02,0x04,0x06,0x79,0x97,0x13,
+    /* 'r' */
+    0x01,0x02,0x04,0x04,0xf4,0x4e,
+    /* 's' */
+    0x01,0x02,0x03,0x04,0x68,0xe0,
+    /* 't' */
+    0x00,0x01,0x05,0x05,0x47,0x90,0x93,0x00,
+    /* 'u' */
+    0x00,0x02,0x05,0x04,0xda,0x52,0x70,
+    /* 'v' */
+    0x00,0x02,0x05,0x04,0xca,0x4c,0x60,
+    /* 'w' */
+    0x00,0x02,0x05,0x04,0xdd,0x6a,0xa0,
+    /* 'x' */
+    0x01,0x02,0x04,0x04,0x96,0x69,
+    /* 'y' */
+    0x00,0x02,0x05,0x06,0xda,0x94,0x42,0x30,
+    /* 'z' */
+    0x01,0x02,0x04,0x04,0xfa,0x5f,
+    /* '{' */
+    0x01,0x00,0x03,0x07,0x29,0x64,0x88,
+    /* '|' */
+    0x02,0x00,0x01,0x07,0xfe,
+    /* '}' */
+    0x01,0x00,0x03,0x07,0x89,0x34,0xa0,
+    /* '~' */
+    0x01,0x03,0x04,0x02,0x5a,
+};
+
+static const uint16_t Font8_Offset[] = {
+    0,4,9,14,23,30,37,44,49,55,61,67,75,80,85,90,
+    98,105,113,120,127,134,141,148,155,162,169,174,179,186,192,199,
+    206,214,222,230,237,245,253,261,268,276,283,290,298,306,314,322,
+    329,337,345,353,360,368,376,384,392,400,408,415,421,429,435,441,
+    446,451,457,465,471,478,484,491,498,506,513,520,528,535,542,549,
+    555,563,570,576,582,590,597,604,611,617,625,631,638,643,650,655,
+};
+
+const FONT_PACK Font8_Pack = {
+  Font8_Data,
+  Font8_Offset,
+  NULL,
+  95, /* Count */
+  5, /* Width */
+  8, /* Height */
+};
+
+#if FONT_PACKED
+/* The stock table is smaller */
+sFONT Font8 = {
+  Font8_Table,
+  5, /* Width */
+  8, /* Height */
+  NULL,
+};
+#endif
+
+/* 7x12, 95 glyphs, 1140 bytes stock, 1033 packed */
+static const uint8_t Font12_Data[] = {
+    /* ' ' */
+    0x00,0x00,0x00,0x00,
+    /* '!' */
+    0x03,0x01,0x01,0x08,0xf9,
+    /* '"' */
+    0x01,0x01,0x05,0x03,0xdc,0xa4,
+    /* '#' */
+    0x01,0x01,0x05,0x09,0x29,0x55,0xf5,0x7d,0x54,0xa0,
+    /* '$' */
+    0x01,0x01,0x04,0x09,0x27,0x88,0x79,0xe2,0x20,
+    /* '%' */
+    0x01,0x01,0x05,0x08,0x45,0x10,0x3e,0x08,0xa2,
+    /* '&' */
+    0x01,0x03,0x05,0x06,0x32,0x11,0x59,0x34,
+    /* ''' */
+    0x03,0x01,0x01,0x04,0xf0,
+    /* '(' */
+    0x03,0x01,0x02,0x0a,0x5a,0xaa,0x50,
+    /* ')' */
+    0x02,0x01,0x02,0x0a,0xa5,0x55,0xa0,
+    /* '*' */
+    0x01,0x01,0x05,0x05,0x27,0xc8,0xa5,0x00,
+    /* '+' */
+    0x00,0x02,0x07,0x07,0x10,0x20,0x47,0xf1,0x02,0x04,0x00,
+    /* ',' */
+    0x02,0x07,0x03,0x04,0x6b,0x40,
+    /* '-' */
+    0x01,0x05,0x05,0x01,0xf8,
+    /* '.' */
+    0x02,0x07,0x02,0x02,0xf0,
+    /* '/' */
+    0x01,0x01,0x05,0x09,0x08,0x44,0x22,0x11,0x08,0x80,
+    /* '0' */
+    0x01,0x01,0x05,0x08,0x74,0x63,0x18,0xc6,0x2e,
+    /* '1' */
+    0x01,0x01,0x05,0x08,0x61,0x08,0x42,0x10,0x9f,
+    /* '2' */
+    0x01,0x01,0x05,0x08,0x74,0x42,0x22,0x22,0x3f,
+    /* '3' */
+    0x01,0x01,0x05,0x08,0x74,0x42,0x60,0x86,0x2e,
+    /* '4' */
+    0x01,0x01,0x06,0x08,0x18,0xa2,0x92,0x8b,0xf0,0x87,
+    /* '5' */
+    0x01,0x01,0x05,0x08,0x7a,0x10,0xe0,0x86,0x2e,
+    /* '6' */
+    0x01,0x01,0x05,0x08,0x3a,0x21,0xe8,0xc6,0x2e,
+    /* '7' */
+    0x01,0x01,0x05,0x08,0xfc,0x42,0x21,0x08,0x84,
+    /* '8' */
+    0x01,0x01,0x05,0x08,0x74,0x62,0xe8,0xc6,0x2e,
+    /* '9' */
+    0x01,0x01,0x05,0x08,0x74,0x63,0x17,0x84,0x5c,
+    /* ':' */
+    0x02,0x03,0x02,0x06,0xf0,0xf0,
+    /* ';' */
+    0x02,0x03,0x03,0x07,0x6c,0x07,0xa0,
+    /* '<' */
+    0x00,0x02,0x06,0x07,0x0c,0x46,0x20,0x60,0x40,0xc0,
+    /* '=' */
+    0x01,0x04,0x05,0x03,0xf8,0x3e,
+    /* '>' */
+    0x00,0x02,0x06,0x07,0xc0,0x81,0x81,0x18,0x8c,0x00,
+    /* '?' */
+    0x02,0x02,0x04,0x07,0x69,0x12,0x40,0xc0,
+    /* '@' */
+    0x01,0x00,0x05,0x0a,0x74,0x63,0x3a,0xd6,0x70,0x8b,0x80,
+    /* 'A' */
+    0x00,0x01,0x07,0x08,0x30,0x20,0xa1,0x42,0x8f,0x91,0x77,
+    /* 'B' */
+    0x00,0x01,0x06,0x08,0xf9,0x14,0x5e,0x45,0x14,0x7e,
+    /* 'C' */
+    0x01,0x01,0x05,0x08,0x7c,0x61,0x08,0x42,0x2e,
+    /* 'D' */
+    0x00,0x01,0x06,0x08,0xf1,0x24,0x51,0x45,0x14,0xbc,
+    /* 'E' */
+    0x00,0x01,0x06,0x08,0xfd,0x15,0x1c,0x51,0x04,0x7f,
+    /* 'F' */
+    0x01,0x01,0x06,0x08,0xfd,0x15,0x1c,0x51,0x04,0x38,
+    /* 'G' */
+    0x01,0x01,0x06,0x08,0x7a,0x28,0x20,0x9e,0x28,0x9c,
+    /* 'H' */
+    0x00,0x01,0x07,0x08,0xee,0x89,0x13,0xe4,0x48,0x91,0x77,
+    /* 'I' */
+    0x01,0x01,0x05,0x08,0xf9,0x08,0x42,0x10,0x9f,
+    /* 'J' */
+    0x01,0x01,0x05,0x08,0x78,0x84,0x29,0x4a,0x4c,
+    /* 'K' */
+    0x00,0x01,0x07,0x08,0xee,0x89,0x22,0x87,0x09,0x11,0x73,
+    /* 'L' */
+    0x01,0x01,0x05,0x08,0xe2,0x10,0x84,0x25,0x3f,
+    /* 'M' */
+    0x00,0x01,0x07,0x08,0xee,0xd9,0xb2,0xa5,0x48,0x91,0x77,
+    /* 'N' */
+    0x00,0x01,0x07,0x08,0xee,0xc9,0x92,0xa5,0x4a,0x93,0x76,
+    /* 'O' */
+    0x01,0x01,0x05,0x08,0x74,0x63,0x18,0xc6,0x2e,
+    /* 'P' */
+    0x01,0x01,0x05,0x08,0xf2,0x52,0x97,0x21,0x1c,
+    /* 'Q' */
+    0x01,0x01,0x05,0x09,0x74,0x63,0x18,0xc6,0x2e,0x38,
+    /* 'R' */
+    0x00,0x01,0x07,0x08,0xf8,0x89,0x12,0x27,0x89,0x11,0x71,
+    /* 'S' */
+    0x01,0x01,0x05,0x08,0x6c,0xe0,0xe0,0x87,0x36,
+    /* 'T' */
+    0x00,0x01,0x07,0x08,0xff,0x24,0x40,0x81,0x02,0x04,0x1c,
+    /* 'U' */
+    0x00,0x01,0x87,0x08,0x02,0xef,0x54,0x84,0x01,0x3e,
+    /* 'V' */
+    0x00,0x01,0x07,0x08,0xee,0x89,0x11,0x42,0x85,0x04,0x08,
+    /* 'W' */
+    0x00,0x01,0x07,0x08,0xee,0x89,0x12,0xa5,0x4a,0x95,0x14,
+    /* 'X' */
+    0x00,0x01,0x07,0x08,0xc6,0x88,0xa0,0x81,0x05,0x11,0x63,
+    /* 'Y' */
+    0x00,0x01,0x07,0x08,0xee,0x88,0xa1,0x41,0x02,0x04,0x1c,
+    /* 'Z' */
+    0x01,0x01,0x05,0x08,0xfc,0x44,0x42,0x22,0x3f,
+    /* '[' */
+    0x02,0x01,0x03,0x0a,0xf2,0x49,0x24,0x9c,
+    /* '\' */
+    0x01,0x01,0x04,0x09,0x84,0x44,0x22,0x11,0x10,
+    /* ']' */
+    0x02,0x01,0x03,0x0a,0xe4,0x92,0x49,0x3c,
+    /* '^' */
+    0x01,0x01,0x05,0x04,0x21,0x15,0x10,
+    /* '_' */
+    0x00,0x0b,0x07,0x01,0xfe,
+    /* '`' */
+    0x03,0x01,0x02,0x02,0x90,
+    /* 'a' */
+    0x01,0x03,0x06,0x06,0x72,0x27,0xa2,0x89,0xf0,
+    /* 'b' */
+    0x00,0x01,0x06,0x08,0xc1,0x05,0x99,0x45,0x14,0x7e,
+    /* 'c' */
+    0x01,0x03,0x05,0x06,0x7c,0x61,0x08,0xb8,
+    /* 'd' */
+    0x01,0x01,0x06,0x08,0x18,0x26,0xa6,0x8a,0x28,0x9f,
+    /* 'e' */
+    0x01,0x03,0x05,0x06,0x74,0x7f,0x08,0x3c,
+    /* 'f' */
+    0x01,0x01,0x05,0x08,0x3a,0x3e,0x84,0x21,0x1f,
+    /* 'g' */
+    0x01,0x03,0x06,0x08,0x6e,0x68,0xa2,0x89,0xe0,0x9c,
+    /* 'h' */
+    0x00,0x01,0x07,0x08,0xc0,0x81,0x63,0x24,0x48,0x91,0x77,
+    /* 'i' */
+    0x01,0x01,0x05,0x08,0x20,0x38,0x42,0x10,0x9f,
+    /* 'j' */
+    0x01,0x01,0x04,0x0a,0x20,0xf1,0x11,0x11,0x1e,
+    /* 'k' */
+    0x00,0x01,0x06,0x08,0xc1,0x05,0xd2,0x71,0x44,0xb7,
+    /* 'l' */
+    0x01,0x01,0x05,0x08,0x61,0x08,0x42,0x10,0x9f,
+    /* 'm' */
+    0x00,0x03,0x07,0x06,0xe8,0xa9,0x52,0xa5,0x5f,0xc0,
+    /* 'n' */
+    0x00,0x03,0x07,0x06,0xd8,0xc9,0x12,0x24,0x5d,0xc0,
+    /* 'o' */
+    0x01,0x03,0x05,0x06,0x74,0x63,0x18,0xb8,
+    /* 'p' */
+    0x00,0x03,0x06,0x08,0xd9,0x94,0x51,0x45,0xe4,0x38,
+    /* 'q' */
+    0x01,0x03,0x06,0x08,0x6e,0x68,0xa2,0x89,0xe0,0x87,
+    /* 'r' */
+    0x01,0x03,0x05,0x06,0xdb,0x10,0x84,0x7c,
+    /* 's' */
+    0x01,0x03,0x05,0x06,0x7c,0x5c,0x18,0xf8,
+    /* 't' */
+    0x01,0x02,0x06,0x07,0x43,0xe4,0x10,0x41,0x13,0x80,
+    /* 'u' */
+    0x00,0x03,0x07,0x06,0xcc,0x89,0x12,0x24,0xc6,0xc0,
+    /* 'v' */
+    0x00,0x03,0x07,0x06,0xee,0x89,0x11,0x42,0x82,0x00,
+    /* 'w' */
+    0x00,0x03,0x07,0x06,0xee,0x89,0x52,0xa5,0x45,0x00,
+    /* 'x' */
+    0x00,0x03,0x06,0x06,0xcd,0x23,0x0c,0x4b,0x30,
+    /* 'y' */
+    0x00,0x03,0x07,0x08,0xee,0x88,0x91,0x41,0x82,0x04,0x3c,
+    /* 'z' */
+    0x01,0x03,0x05,0x06,0xfc,0x88,0x88,0xfc,
+    /* '{' */
+    0x02,0x01,0x03,0x0a,0x29,0x25,0x12,0x44,
+    /* '|' */
+    0x03,0x01,0x01,0x09,0xff,0x80,
+    /* '}' */
+    0x02,0x01,0x03,0x0a,0x89,0x24,0x52,0x50,
+    /* '~' */
+    0x01,0x05,0x05,0x02,0x4d,0x80,
+};
+
+static const uint16_t Font12_Offset[] = {
+    0,4,9,15,25,34,43,51,56,63,70,78,89,95,100,105,
+    115,124,133,142,151,161,170,179,188,197,206,212,219,229,235,245,
+    253,264,275,285,294,304,314,324,334,345,354,363,374,383,394,405,
+    414,423,433,444,453,464,474,485,496,507,518,527,535,544,552,559,
+    564,569,578,588,596,606,614,623,633,644,653,662,672,681,691,701,
+    709,719,729,737,745,755,765,775,785,794,805,813,821,827,835,841,
+};
+
+const FONT_PACK Font12_Pack = {
+  Font12_Data,
+  Font12_Offset,
+  NULL,
+  95, /* Count */
+  7, /* Width */
+  12, /* Height */
+};
+
+#if FONT_PACKED
+sFONT Font12 = {
+  NULL,
+  7, /* Width */
+  12, /* Height */
+  &Font12_Pack,
+};
+#endif
+
+/* 11x16, 95 glyphs, 3040 bytes stock, 1365 packed */
+static const uint8_t Font16_Data[] = {
+    /* ' ' */
+    0x00,0x00,0x00,0x00,
+    /* '!' */
+    0x04,0x01,0x02,0x0a,0xff,0xff,0x30,
+    /* '"' */
+    0x03,0x02,0x07,0x05,0xef,0xdd,0x12,0x24,0x40,
+    /* '#' */
+    0x02,0x01,0x88,0x0b,0x01,0x36,0x83,0x04,0xc9,0x93,0x93,0x93,0x83,
+    /* '$' */
+    0x02,0x00,0x07,0x0d,0x10,0xff,0x1e,0x3e,0x0f,0x0f,0x07,0xc7,0x8f,0xf0,0x81,0x00,
+    /* '%' */
+    0x02,0x01,0x08,0x0a,0x60,0x90,0x90,0x63,0x1e,0x78,0xc6,0x09,0x09,0x06,
+    /* '&' */
+    0x02,0x02,0x07,0x09,0x3c,0xc1,0x83,0x03,0x0e,0xf7,0x66,0x76,
+    /* ''' */
+    0x05,0x02,0x03,0x05,0xfd,0x24,
+    /* '(' */
+    0x04,0x01,0x04,0x0c,0x33,0x6e,0xcc,0xcc,0xe6,0x33,
+    /* ')' */
+    0x03,0x01,0x04,0x0c,0xcc,0x63,0x33,0x33,0x36,0xec,
+    /* '*' */
+    0x02,0x01,0x08,0x07,0x18,0x18,0xff,0xff,0x3c,0x7e,0x66,
+    /* '+' */
+    0x02,0x03,0x07,0x07,0x10,0x20,0x47,0xf1,0x02,0x04,0x00,
+    /* ',' */
+    0x04,0x09,0x03,0x05,0x6b,0x48,
+    /* '-' */
+    0x02,0x06,0x07,0x01,0xfe,
+    /* '.' */
+    0x04,0x09,0x02,0x02,0xf0,
+    /* '/' */
+    0x02,0x00,0x08,0x0d,0x03,0x03,0x06,0x06,0x0c,0x0c,0x18,0x30,0x30,0x60,0x60,0xc0,0xc0,
+    /* '0' */
+    0x02,0x01,0x87,0x0a,0x03,0x38,0xaa,0xa8,0x84,0x02,0xaa,0xa8,
+    /* '1' */
+    0x02,0x01,0x88,0x0a,0x03,0x18,0xe0,0xe0,0x86,0x01,0xe7,
+    /* '2' */
+    0x02,0x01,0x07,0x0a,0x3c,0xcf,0x1e,0x30,0xc3,0x0c,0x30,0xc1,0xfc,
+    /* '3' */
+    0x01,0x01,0x08,0x0a,0x7e,0xc3,0x03,0x06,0x3e,0x07,0x03,0x03,0xc3,0x7e,
+    /* '4' */
+    0x02,0x01,0x07,0x0a,0x1c,0x38,0xf1,0x66,0xc9,0xb3,0x7f,0x0c,0x7c,
+    /* '5' */
+    0x02,0x01,0x07,0x0a,0x7e,0xc1,0x83,0x07,0xc8,0xc1,0x83,0x86,0xf8,
+    /* '6' */
+    0x02,0x01,0x07,0x0a,0x1e,0xe1,0x86,0x0d,0xdc,0xf1,0xe3,0x66,0x78,
+    /* '7' */
+    0x01,0x01,0x07,0x0a,0xff,0x0c,0x18,0x60,0xc1,0x83,0x0c,0x18,0x30,
+    /* '8' */
+    0x02,0x01,0x07,0x0a,0x7d,0x8f,0x1e,0x37,0xd8,0xf1,0xe3,0xc6,0xf8,
+    /* '9' */
+    0x02,0x01,0x07,0x0a,0x79,0x9b,0x1e,0x3c,0xee,0xc1,0x86,0x1d,0xe0,
+    /* ':' */
+    0x04,0x04,0x02,0x07,0xf0,0x3c,
+    /* ';' */
+    0x04,0x04,0x04,0x09,0x33,0x00,0x06,0x48,0x80,
+    /* '<' */
+    0x01,0x02,0x09,0x09,0x01,0x83,0x02,0x06,0x0c,0x01,0x80,0x20,0x0c,0x01,0x80,
+    /* '=' */
+    0x01,0x05,0x09,0x03,0xff,0x80,0x3f,0xe0,
+    /* '>' */
+    0x01,0x02,0x09,0x09,0xc0,0x18,0x02,0x00,0xc0,0x18,0x30,0x20,0x60,0xc0,0x00,
+    /* '?' */
+    0x02,0x02,0x07,0x09,0x7d,0x8f,0x18,0x31,0xc6,0x0c,0x00,0x30,
+    /* '@' */
+    0x02,0x01,0x06,0x0b,0x39,0x18,0x61,0x9e,0x9a,0x67,0x81,0x13,0x80,
+    /* 'A' */
+    0x01,0x02,0x0a,0x09,0x7e,0x07,0x81,0x20,0xcc,0x33,0x0f,0xc6,0x19,0x86,0xf3,0xc0,
+    /* 'B' */
+    0x01,0x02,0x08,0x09,0xfe,0x63,0x63,0x63,0x7e,0x63,0x63,0x63,0xfe,
+    /* 'C' */
+    0x01,0x02,0x09,0x09,0x3e,0xb0,0xf0,0x38,0x0c,0x06,0x03,0x02,0xc2,0x3e,0x00,
+    /* 'D' */
+    0x01,0x02,0x89,0x09,0x04,0xfe,0x4e,0x80,0xa0,0x84,0x03,0x05,0x9d,0x00,
+    /* 'E' */
+    0x01,0x02,0x08,0x09,0xff,0x61,0x61,0x64,0x7c,0x64,0x61,0x61,0xff,
+    /* 'F' */
+    0x01,0x02,0x09,0x09,0xff,0xb0,0x58,0x2c,0x87,0xc3,0x21,0x80,0xc0,0xf8,0x00,
+    /* 'G' */
+    0x01,0x02,0x09,0x09,0x3d,0x31,0xb0,0x58,0x0c,0x06,0x7f,0x0c,0xc6,0x3e,0x00,
+    /* 'H' */
+    0x01,0x02,0x09,0x09,0xf7,0xb1,0x98,0xcc,0x67,0xf3,0x19,0x8c,0xc6,0xf7,0x80,
+    /* 'I' */
+    0x02,0x02,0x88,0x09,0x02,0xff,0xe7,0x86,0x01,0xe7,
+    /* 'J' */
+    0x01,0x02,0x09,0x09,0x3f,0x83,0x01,0x80,0xc0,0x66,0x33,0x19,0x8c,0x7c,0x00,
+    /* 'K' */
+    0x01,0x02,0x09,0x09,0xf7,0xb1,0x99,0x8d,0x87,0x83,0xe1,0x98,0xc6,0xf3,0x80,
+    /* 'L' */
+    0x01,0x02,0x89,0x09,0x02,0xfc,0x66,0x84,0x01,0x04,0x82,0x02,0xcf,0x00,
+    /* 'M' */
+    0x00,0x02,0x0b,0x09,0xe0,0xec,0x19,0xc7,0x3d,0xe6,0xac,0xdd,0x99,0x33,0x06,0xfb,0xe0,
+    /* 'N' */
+    0x01,0x02,0x09,0x09,0xe7,0xb1,0x9c,0xcf,0x66,0xb3,0x79,0x9c,0xc6,0xf3,0x00,
+    /* 'O' */
+    0x01,0x02,0x09,0x09,0x3e,0x31,0xb0,0x78,0x3c,0x1e,0x0f,0x06,0xc6,0x3e,0x00,
+    /* 'P' */
+    0x01,0x02,0x08,0x09,0xfe,0x63,0x63,0x63,0x63,0x7e,0x60,0x60,0xfc,
+    /* 'Q' */
+    0x01,0x02,0x09,0x0b,0x3e,0x31,0xb0,0x78,0x3c,0x1e,0x0f,0x06,0xc6,0x3e,0x0c,0xcf,0xc0,
+    /* 'R' */
+    0x01,0x02,0x0a,0x09,0xfe,0x18,0xc6,0x31,0x8c,0x7c,0x19,0x86,0x31,0x8c,0xf9,0xc0,
+    /* 'S' */
+    0x02,0x02,0x07,0x09,0x7f,0x8f,0x1f,0x07,0xc1,0xf1,0xe3,0xfc,
+    /* 'T' */
+    0x01,0x02,0x08,0x09,0xff,0x99,0x99,0x99,0x18,0x18,0x18,0x18,0x7e,
+    /* 'U' */
+    0x01,0x02,0x89,0x09,0x03,0xf7,0xca,0x40,0x86,0x02,0x5d,0x00,
+    /* 'V' */
+    0x01,0x02,0x09,0x09,0xf7,0xb1,0x98,0xc6,0xc3,0x61,0xb0,0x50,0x38,0x1c,0x00,
+    /* 'W' */
+    0x00,0x02,0x0b,0x09,0xfb,0xec,0x19,0x93,0x37,0x66,0xec,0x55,0x0e,0xe1,0xdc,0x31,0x80,
+    /* 'X' */
+    0x01,0x02,0x09,0x09,0xf7,0xb1,0x8d,0x83,0x81,0xc0,0xe0,0xd8,0xc6,0xf7,0x80,
+    /* 'Y' */
+    0x01,0x02,0x8a,0x09,0x06,0xf3,0xe4,0x95,0x28,0xb4,0x12,0x84,0x02,0x33,0x00,
+    /* 'Z' */
+    0x02,0x02,0x07,0x09,0xff,0x0e,0x30,0xc1,0x06,0x18,0xe1,0xfe,
+    /* '[' */
+    0x05,0x01,0x84,0x0c,0x01,0xf3,0x84,0x01,0x03,
+    /* '\' */
+    0x02,0x00,0x08,0x0d,0xc0,0xc0,0x60,0x60,0x30,0x30,0x18,0x0c,0x0c,0x06,0x06,0x03,0x03,
+    /* ']' */
+    0x03,0x01,0x84,0x0c,0x01,0xfc,0x84,0x01,0x0c,
+    /* '^' */
+    0x02,0x00,0x07,0x06,0x10,0x50,0xa2,0x28,0x30,0x40,
+    /* '_' */
+    0x00,0x0f,0x0b,0x01,0xff,0xe0,
+    /* '`' */
+    0x04,0x00,0x03,0x03,0x88,0x80,
+    /* 'a' */
+    0x02,0x04,0x08,0x07,0x7c,0x06,0x06,0x7e,0xc6,0xce,0x77,
+    /* 'b' */
+    0x01,0x01,0x09,0x0a,0xe0,0x30,0x18,0x0d,0xc7,0x33,0x0d,0x86,0xc3,0x73,0x77,0x00,
+    /* 'c' */
+    0x01,0x04,0x08,0x07,0x3d,0x63,0xc1,0xc0,0xc1,0x63,0x3e,
+    /* 'd' */
+    0x01,0x01,0x09,0x0a,0x07,0x01,0x80,0xc7,0x66,0x76,0x1b,0x0d,0x86,0x67,0x1d,0xc0,
+    /* 'e' */
+    0x01,0x04,0x09,0x07,0x3e,0x31,0xb0,0x7f,0xfc,0x03,0x0c,0xfc,
+    /* 'f' */
+    0x02,0x01,0x89,0x0a,0x06,0x1f,0x97,0xc0,0x19,0xcc,0xe0,0x84,0x02,0x67,0x00,
+    /* 'g' */
+    0x01,0x04,0x09,0x0a,0x3b,0xb3,0xb0,0xd8,0x6c,0x33,0x38,0xec,0x06,0x03,0x1f,0x00,
+    /* 'h' */
+    0x01,0x01,0x09,0x0a,0xe0,0x30,0x18,0x0d,0xc7,0x33,0x19,0x8c,0xc6,0x63,0x7b,0xc0,
+    /* 'i' */
+    0x02,0x01,0x88,0x0a,0x05,0x18,0x00,0x18,0x78,0x60,0x84,0x01,0xe7,
+    /* 'j' */
+    0x02,0x01,0x86,0x0d,0x04,0x18,0x01,0xbf,0xf0,0x85,0x01,0xf4,
+    /* 'k' */
+    0x01,0x01,0x09,0x0a,0xe0,0x30,0x18,0x0d,0xe6,0xc3,0xc1,0xe0,0xd8,0x66,0x77,0xc0,
+    /* 'l' */
+    0x02,0x01,0x88,0x0a,0x02,0x78,0x60,0x87,0x01,0xe7,
+    /* 'm' */
+    0x01,0x04,0x8a,0x07,0x03,0xff,0x24,0xa0,0x84,0x02,0x08,0x04,
+    /* 'n' */
+    0x01,0x04,0x09,0x07,0xee,0x39,0x98,0xcc,0x66,0x33,0x1b,0xde,
+    /* 'o' */
+    0x01,0x04,0x09,0x07,0x3e,0x31,0xb0,0x78,0x3c,0x1b,0x18,0xf8,
+    /* 'p' */
+    0x01,0x04,0x09,0x0a,0xee,0x39,0x98,0x6c,0x36,0x1b,0x99,0xb8,0xc0,0x60,0x7c,0x00,
+    /* 'q' */
+    0x01,0x04,0x09,0x0a,0x3b,0xb3,0xb0,0xd8,0x6c,0x33,0x38,0xec,0x06,0x03,0x07,0xc0,
+    /* 'r' */
+    0x01,0x04,0x09,0x07,0xf7,0x1c,0xcc,0x06,0x03,0x01,0x83,0xf8,
+    /* 's' */
+    0x02,0x04,0x07,0x07,0x7f,0x8f,0xc3,0xe0,0xf8,0xff,0x00,
+    /* 't' */
+    0x01,0x01,0x08,0x0a,0x30,0x30,0x30,0xfe,0x30,0x30,0x30,0x30,0x31,0x1e,
+    /* 'u' */
+    0x01,0x04,0x89,0x07,0x02,0xe7,0x42,0x84,0x02,0x21,0x72,
+    /* 'v' */
+    0x01,0x04,0x09,0x07,0xf7,0xb1,0x98,0xc6,0xc3,0x60,0xe0,0x70,
+    /* 'w' */
+    0x00,0x04,0x0b,0x07,0xf1,0xec,0x19,0x93,0x37,0x63,0xb8,0x77,0x0c,0x60,
+    /* 'x' */
+    0x01,0x04,0x09,0x07,0xf7,0x9b,0x07,0x03,0x81,0xc1,0xb3,0xde,
+    /* 'y' */
+    0x01,0x04,0x0a,0x0a,0xf3,0xd8,0x63,0x30,0xcc,0x16,0x07,0x80,0xc0,0x30,0x18,0x1f,0x00,
+    /* 'z' */
+    0x02,0x04,0x07,0x07,0xff,0x0c,0x31,0xc6,0x18,0x7f,0x80,
+    /* '{' */
+    0x03,0x01,0x04,0x0c,0x36,0x66,0x66,0xc6,0x66,0x63,
+    /* '|' */
+    0x05,0x01,0x02,0x0c,0xff,0xff,0xff,
+    /* '}' */
+    0x04,0x01,0x04,0x0c,0xc6,0x66,0x66,0x36,0x66,0x6c,
+    /* '~' */
+    0x02,0x05,0x07,0x03,0x61,0x24,0x30,
+};
+
+static const uint16_t Font16_Offset[] = {
+    0,4,11,20,33,49,63,75,81,91,101,112,123,129,134,139,
+    156,168,179,192,206,219,232,245,258,271,284,290,299,314,322,337,
+    349,362,378,391,406,420,433,448,463,478,488,503,518,532,549,564,
+    579,592,609,625,637,650,662,677,694,709,724,736,745,762,771,781,
+    787,793,804,820,831,847,859,874,890,906,919,931,947,957,969,981,
+    993,1009,1025,1037,1048,1062,1073,1085,1099,1111,1128,1139,1149,1156,1166,1173,
+};
+
+const FONT_PACK Font16_Pack = {
+  Font16_Data,
+  Font16_Offset,
+  NULL,
+  95, /* Count */
+  11, /* Width */
+  16, /* Height */
+};
+
+#if FONT_PACKED
+sFONT Font16 = {
+  NULL,
+  11, /* Width */
+  16, /* Height */
+  &Font16_Pack,
+};
+#endif
+
+/* 14x20, 95 glyphs, 3800 bytes stock, 1738 packed */
+static const uint8_t Font20_Data[] = {
+    /* ' ' */
+    0x00,0x00,0x00,0x00,
+    /* '!' */
+    0x05,0x01,0x03,0x0d,0xff,0xff,0xfa,0x40,0x7e,
+    /* '"' */
+    0x03,0x02,0x08,0x06,0xe7,0xe7,0xe7,0x42,0x42,0x42,
+    /* '#' */
+    0x02,0x00,0x8a,0x10,0x01,0x33,0x85,0x09,0x33,0x30,0x03,0x33,0x00,0x33,0x30,0x03,0x33,0x85,
+    /* '$' */
+    0x03,0x00,0x08,0x10,0x18,0x18,0x3f,0x7f,0xc3,0xc0,0xf8,0x7e,0x07,0xc3,0xc3,0xfe,0xfc,0x18,0x18,0x18,
+    /* '%' */
+    0x02,0x01,0x09,0x0d,0x70,0x44,0x22,0x11,0x07,0x18,0x3c,0xf9,0xe0,0xc7,0x04,0x42,0x21,0x10,0x70,
+    /* '&' */
+    0x03,0x03,0x09,0x0b,0x1f,0x3f,0x98,0x0c,0x03,0x03,0xcf,0xff,0x9e,0xc6,0x7f,0xcf,0x60,
+    /* ''' */
+    0x06,0x02,0x03,0x06,0xff,0xa4,0x80,
+    /* '(' */
+    0x06,0x01,0x04,0x10,0x33,0x66,0x6c,0xcc,0xcc,0xc6,0x66,0x33,
+    /* ')' */
+    0x04,0x01,0x04,0x10,0xcc,0x66,0x63,0x33,0x33,0x36,0x66,0xcc,
+    /* '*' */
+    0x03,0x01,0x08,0x09,0x18,0x18,0x18,0xdb,0xff,0x3c,0x3c,0x7e,0x66,
+    /* '+' */
+    0x02,0x03,0x8a,0x0a,0x01,0x0c,0x84,0x04,0xf3,0xc0,0x0f,0x3c,0x84,
+    /* ',' */
+    0x05,0x0b,0x04,0x06,0x76,0x6c,0xc8,
+    /* '-' */
+    0x02,0x07,0x09,0x02,0xff,0xff,0xc0,
+    /* '.' */
+    0x06,0x0b,0x03,0x03,0xff,0x80,
+    /* '/' */
+    0x03,0x00,0x08,0x10,0x03,0x03,0x06,0x06,0x06,0x0c,0x0c,0x18,0x18,0x30,0x30,0x60,0x60,0x60,0xc0,0xc0,
+    /* '0' */
+    0x02,0x01,0x89,0x0d,0x05,0x3e,0x20,0x87,0x14,0x50,0x86,0x04,0x28,0xa3,0x84,0x10,
+    /* '1' */
+    0x03,0x01,0x88,0x0d,0x04,0x18,0xe0,0x00,0xe0,0x87,0x02,0xe7,0x00,
+    /* '2' */
+    0x02,0x01,0x09,0x0d,0x3e,0x3f,0xb8,0xf8,0x30,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1f,0xff,0xf8,
+    /* '3' */
+    0x01,0x01,0x0a,0x0d,0x1f,0x1f,0xe6,0x1c,0x03,0x01,0xc3,0xe0,0xf8,0x07,0x00,0xc0,0x3c,0x1f,0xfe,0x7f,0x00,
+    /* '4' */
+    0x02,0x01,0x09,0x0d,0x07,0x07,0x83,0xc3,0x63,0x31,0x99,0x8d,0x86,0xff,0xff,0xc0,0xc1,0xf0,0xf8,
+    /* '5' */
+    0x02,0x01,0x09,0x0d,0x7f,0x3f,0x98,0x0c,0x07,0xe3,0xf9,0x8e,0x03,0x01,0x80,0xf0,0xff,0xe7,0xe0,
+    /* '6' */
+    0x02,0x01,0x09,0x0d,0x0f,0x9f,0xde,0x0c,0x0e,0x06,0xf3,0xfd,0xc7,0xc1,0xe0,0xd8,0xef,0xe1,0xe0,
+    /* '7' */
+    0x02,0x01,0x09,0x0d,0xff,0xff,0xf0,0x60,0x30,0x30,0x18,0x0c,0x0c,0x06,0x03,0x03,0x01,0x80,0xc0,
+    /* '8' */
+    0x02,0x01,0x09,0x0d,0x3e,0x3f,0xb8,0xf8,0x3e,0x3b,0xf9,0xfd,0xc7,0xc1,0xe0,0xf8,0xef,0xe3,0xe0,
+    /* '9' */
+    0x02,0x01,0x09,0x0d,0x3c,0x3f,0xb8,0xd8,0x3c,0x1f,0x1d,0xfe,0x7b,0x03,0x81,0x83,0xdf,0xcf,0x80,
+    /* ':' */
+    0x06,0x05,0x03,0x09,0xff,0x80,0x3f,0xe0,
+    /* ';' */
+    0x05,0x05,0x05,0x0b,0x39,0xce,0x00,0x01,0xcc,0xc6,0x20,
+    /* '<' */
+    0x01,0x03,0x0b,0x0b,0x00,0x60,0x3c,0x1e,0x07,0x03,0x81,0xe0,0x0e,0x00,0x70,0x07,0x80,0x3c,0x01,0x80,
+    /* '=' */
+    0x01,0x05,0x0b,0x06,0xff,0xff,0xfc,0x00,0x00,0x0f,0xff,0xff,0xc0,
+    /* '>' */
+    0x02,0x03,0x0b,0x0b,0xc0,0x1e,0x00,0xf0,0x07,0x00,0x38,0x03,0xc0,0xe0,0x70,0x3c,0x1e,0x03,0x00,0x00,
+    /* '?' */
+    0x03,0x02,0x08,0x0c,0x7c,0xfe,0xc3,0xc3,0x03,0x0e,0x1c,0x18,0x00,0x00,0x38,0x38,
+    /* '@' */
+    0x03,0x01,0x07,0x0e,0x1c,0xc9,0x0c,0x18,0x31,0xe4,0xc9,0x93,0x1e,0x02,0x04,0x27,0x80,
+    /* 'A' */
+    0x01,0x02,0x0c,0x0c,0x3f,0x03,0xf0,0x07,0x00,0xd8,0x0d,0x81,0x98,0x18,0xc3,0xfc,0x3f,0xc6,0x06,0xf0,0xff,0x0f,
+    /* 'B' */
+    0x02,0x02,0x0a,0x0c,0xfe,0x3f,0xc6,0x19,0x86,0x63,0x9f,0xc7,0xf9,0x87,0x60,0xd8,0x3f,0xff,0xfe,
+    /* 'C' */
+    0x02,0x02,0x0a,0x0c,0x1e,0xcf,0xf7,0x1f,0x83,0xc0,0x30,0x0c,0x03,0x00,0xe0,0xdc,0x73,0xf8,0x7c,
+    /* 'D' */
+    0x01,0x02,0x8b,0x0c,0x07,0xff,0x00,0x12,0x79,0x00,0x90,0x08,0x85,0x05,0x80,0x26,0x79,0x00,0x40,
+    /* 'E' */
+    0x02,0x02,0x0a,0x0c,0xff,0xff,0xf6,0x0d,0x83,0x66,0x1f,0x87,0xe1,0x98,0x60,0xd8,0x3f,0xff,0xff,
+    /* 'F' */
+    0x02,0x02,0x0a,0x0c,0xff,0xff,0xf6,0x0d,0x83,0x66,0x1f,0x87,0xe1,0x98,0x60,0x18,0x0f,0xc3,0xf0,
+    /* 'G' */
+    0x02,0x02,0x0b,0x0c,0x1e,0xcf,0xf9,0x87,0x60,0x6c,0x01,0x80,0x31,0xfe,0x3f,0xc0,0xcc,0x19,0xff,0x0f,0x80,
+    /* 'H' */
+    0x02,0x02,0x0a,0x0c,0xf3,0xfc,0xf6,0x19,0x86,0x61,0x9f,0xe7,0xf9,0x86,0x61,0x98,0x6f,0x3f,0xcf,
+    /* 'I' */
+    0x03,0x02,0x88,0x0c,0x03,0xff,0x00,0xe7,0x87,0x02,0xe7,0x00,
+    /* 'J' */
+    0x02,0x02,0x8b,0x0c,0x05,0x0f,0xe0,0x00,0x39,0x80,0x83,0x01,0x30,0x84,0x04,0x40,0xf2,0x60,0x80,
+    /* 'K' */
+    0x02,0x02,0x0b,0x0c,0xfb,0xff,0x7d,0x8e,0x33,0x06,0xc0,0xf8,0x1d,0x83,0x18,0x63,0x0c,0x33,0xe7,0xfc,0x70,
+    /* 'L' */
+    0x02,0x02,0x8a,0x0c,0x04,0xfc,0x00,0x0c,0xc0,0x85,0x01,0x03,0x82,0x03,0x0c,0xf0,0x00,
+    /* 'M' */
+    0x01,0x02,0x0c,0x0c,0xf0,0xff,0x0f,0x70,0xe7,0x9e,0x69,0x66,0xf6,0x6f,0x66,0x66,0x66,0x66,0x06,0xf9,0xff,0x9f,
+    /* 'N' */
+    0x02,0x02,0x0a,0x0c,0xe7,0xfd,0xf7,0x19,0xe6,0x79,0x9b,0x66,0xd9,0x9e,0x67,0x98,0xef,0xbb,0xe6,
+    /* 'O' */
+    0x02,0x02,0x8a,0x0c,0x06,0x1e,0x08,0x44,0xca,0x49,0x21,0x84,0x05,0x21,0x24,0x94,0xc8,0x84,
+    /* 'P' */
+    0x02,0x02,0x0a,0x0c,0xff,0x3f,0xe6,0x1d,0x83,0x60,0xd8,0x77,0xf9,0xfc,0x60,0x18,0x0f,0xc3,0xf0,
+    /* 'Q' */
+    0x02,0x02,0x8a,0x0f,0x06,0x1e,0x08,0x44,0xca,0x49,0x21,0x84,0x09,0x21,0x24,0x94,0xc8,0x84,0x00,0xc8,0x40,0xc4,
+    /* 'R' */
+    0x02,0x02,0x0b,0x0c,0xff,0x1f,0xf1,0x87,0x30,0x66,0x1c,0xff,0x1f,0xc3,0x1c,0x61,0x8c,0x3b,0xe3,0xfc,0x30,
+    /* 'S' */
+    0x02,0x02,0x0a,0x0c,0x3e,0xdf,0xfe,0x1f,0x03,0xe0,0x1f,0x81,0xf8,0x07,0xc0,0xf8,0x7f,0xfb,0x7c,
+    /* 'T' */
+    0x02,0x02,0x8a,0x0c,0x04,0xff,0xc0,0x03,0x30,0x82,0x02,0x30,0x30,0x84,0x03,0x03,0x30,0x00,
+    /* 'U' */
+    0x02,0x02,0x8a,0x0c,0x04,0xf3,0xc0,0x09,0x24,0x87,0x04,0x04,0x84,0xc8,0x84,
+    /* 'V' */
+    0x01,0x02,0x8b,0x0c,0x0a,0xf1,0xe0,0x02,0x44,0x80,0x05,0x14,0x00,0x0a,0xa0,0x82,0x02,0x02,0xa0,0x83,
+    /* 'W' */
+    0x01,0x02,0x8d,0x0c,0x06,0xf8,0xf8,0x00,0x26,0x32,0x0e,0x84,0x05,0x2a,0x08,0x02,0x15,0x40,0x83,0x02,0x11,0x00,
+    /* 'X' */
+    0x01,0x02,0x0b,0x0c,0xf1,0xfe,0x3d,0x83,0x18,0xc1,0xb0,0x1c,0x03,0x80,0xd8,0x31,0x8c,0x1b,0xc7,0xf8,0xf0,
+    /* 'Y' */
+    0x02,0x02,0x0a,0x0c,0xf3,0xfc,0xf6,0x18,0xcc,0x1e,0x07,0x80,0xc0,0x30,0x0c,0x03,0x03,0xf0,0xfc,
+    /* 'Z' */
+    0x03,0x02,0x08,0x0c,0xff,0xff,0xc3,0xc6,0x0c,0x18,0x18,0x30,0x63,0xc3,0xff,0xff,
+    /* '[' */
+    0x06,0x01,0x84,0x10,0x02,0xf0,0x30,0x85,0x01,0x30,
+    /* '\' */
+    0x03,0x00,0x08,0x10,0xc0,0xc0,0x60,0x60,0x60,0x30,0x30,0x18,0x18,0x0c,0x0c,0x06,0x06,0x06,0x03,0x03,
+    /* ']' */
+    0x04,0x01,0x84,0x10,0x02,0xf0,0xc0,0x85,0x01,0xc0,
+    /* '^' */
+    0x02,0x01,0x09,0x06,0x08,0x0e,0x0d,0x8c,0x6c,0x1c,0x04,
+    /* '_' */
+    0x00,0x12,0x0e,0x02,0xff,0xff,0xff,0xf0,
+    /* '`' */
+    0x05,0x01,0x04,0x03,0x86,0x10,
+    /* 'a' */
+    0x02,0x05,0x0a,0x09,0x3f,0x1f,0xe0,0x18,0xfe,0x7f,0xb8,0x6c,0x3b,0xff,0x7d,0xc0,
+    /* 'b' */
+    0x01,0x01,0x8b,0x0d,0x03,0xe0,0x00,0x02,0x83,0x05,0xf0,0x21,0x83,0xc0,0x85,0x83,0x04,0x42,0xc7,0x81,0x0c,
+    /* 'c' */
+    0x02,0x05,0x0a,0x09,0x1e,0xdf,0xf6,0x0f,0x03,0xc0,0x30,0x0e,0x0d,0xff,0x3f,0x00,
+    /* 'd' */
+    0x02,0x01,0x0b,0x0d,0x01,0xc0,0x38,0x03,0x00,0x61,0xec,0xff,0x98,0x76,0x06,0xc0,0xd8,0x1b,0x87,0x3f,0xf1,0xee,
+    /* 'e' */
+    0x02,0x05,0x0a,0x09,0x1e,0x1f,0xe6,0x1b,0xff,0xff,0xf0,0x06,0x0d,0xff,0x1f,0x00,
+    /* 'f' */
+    0x03,0x01,0x89,0x0d,0x08,0x1f,0x90,0x03,0xe0,0x0c,0xf0,0x03,0x3c,0x84,0x03,0x19,0xe0,0x00,
+    /* 'g' */
+    0x02,0x05,0x0b,0x0d,0x1e,0xef,0xfd,0x87,0x60,0x6c,0x0d,0x81,0x98,0x73,0xfe,0x1e,0xc0,0x18,0x07,0x1f,0xc3,0xf0,
+    /* 'h' */
+    0x02,0x01,0x8a,0x0d,0x03,0xe0,0x00,0x08,0x82,0x05,0x0f,0x04,0x20,0xe0,0x40,0x83,0x02,0x02,0x49,0x82,
+    /* 'i' */
+    0x03,0x01,0x88,0x0d,0x07,0x18,0x00,0x18,0x00,0xf8,0x00,0xe0,0x84,0x02,0xe7,0x00,
+    /* 'j' */
+    0x02,0x01,0x88,0x11,0x07,0x0c,0x00,0x0c,0x00,0x7f,0x00,0x7c,0x87,0x03,0x04,0xf9,0x02,
+    /* 'k' */
+    0x02,0x01,0x0a,0x0d,0xe0,0x38,0x06,0x01,0x80,0x6f,0x9b,0xe6,0xc1,0xe0,0x78,0x1b,0x06,0x63,0x9f,0xe7,0xc0,
+    /* 'l' */
+    0x03,0x01,0x88,0x0d,0x03,0xf8,0x00,0xe0,0x88,0x02,0xe7,0x00,
+    /* 'm' */
+    0x01,0x05,0x8c,0x09,0x05,0xfd,0xc0,0x22,0x99,0x80,0x85,0x02,0x09,0x11,0x82,
+    /* 'n' */
+    0x02,0x05,0x8a,0x09,0x05,0xef,0x04,0x28,0xe0,0x40,0x83,0x02,0x02,0x49,0x82,
+    /* 'o' */
+    0x02,0x05,0x0a,0x09,0x1e,0x1f,0xe6,0x1b,0x03,0xc0,0xf0,0x36,0x19,0xfe,0x1e,0x00,
+    /* 'p' */
+    0x01,0x05,0x0b,0x0d,0xef,0x1f,0xf9,0xc3,0x30,0x36,0x06,0xc0,0xdc,0x33,0xfe,0x6f,0x0c,0x01,0x80,0x7c,0x0f,0x80,
+    /* 'q' */
+    0x02,0x05,0x0b,0x0d,0x1e,0xef,0xfd,0x87,0x60,0x6c,0x0d,0x81,0x98,0x73,0xfe,0x1e,0xc0,0x18,0x03,0x01,0xf0,0x3e,
+    /* 'r' */
+    0x02,0x05,0x0a,0x09,0xf3,0xbd,0xf3,0xcc,0xe0,0x30,0x0c,0x03,0x03,0xfc,0xff,0x00,
+    /* 's' */
+    0x03,0x05,0x08,0x09,0x3f,0xff,0xc3,0xf0,0x7e,0x0f,0xc3,0xff,0xfc,
+    /* 't' */
+    0x02,0x02,0x8a,0x0c,0x01,0x30,0x82,0x05,0x03,0x3e,0x00,0x33,0xe0,0x84,0x03,0x30,0xf0,0x83,
+    /* 'u' */
+    0x02,0x05,0x8a,0x09,0x04,0xe3,0x80,0x08,0x20,0x84,0x04,0x20,0x71,0x42,0x00,
+    /* 'v' */
+    0x01,0x05,0x0b,0x09,0xf1,0xfe,0x3d,0x83,0x18,0xc3,0x18,0x36,0x06,0xc0,0x70,0x0e,0x00,
+    /* 'w' */
+    0x01,0x05,0x0b,0x09,0xf1,0xfe,0x3d,0x93,0x32,0x66,0xfc,0x77,0x0e,0xe1,0x8c,0x31,0x80,
+    /* 'x' */
+    0x02,0x05,0x0a,0x09,0xf3,0xfc,0xf3,0x30,0x78,0x0c,0x07,0x83,0x33,0xcf,0xf3,0xc0,
+    /* 'y' */
+    0x01,0x05,0x0b,0x0d,0xf1,0xfe,0x3d,0x83,0x18,0xc3,0x18,0x36,0x07,0xc0,0x70,0x0c,0x01,0x80,0x60,0x7f,0x0f,0xe0,
+    /* 'z' */
+    0x03,0x05,0x08,0x09,0xff,0xff,0xc6,0x0c,0x18,0x30,0x63,0xff,0xff,
+    /* '{' */
+    0x04,0x01,0x06,0x10,0x1c,0xf3,0x0c,0x30,0xc3,0x1c,0xe1,0xc3,0x0c,0x30,0xc3,0xc7,
+    /* '|' */
+    0x06,0x01,0x82,0x10,0x01,0xc0,0x83,
+    /* '}' */
+    0x03,0x01,0x06,0x10,0xe3,0xc3,0x0c,0x30,0xc3,0x0e,0x1c,0xe3,0x0c,0x30,0xcf,0x38,
+    /* '~' */
+    0x02,0x06,0x0a,0x04,0x38,0x3f,0x3c,0xfc,0x1e,
+};
+
+static const uint16_t Font20_Offset[] = {
+    0,4,13,23,41,61,80,97,104,116,128,141,154,161,168,174,
+    194,210,223,242,263,282,301,320,339,358,377,385,396,416,429,449,
+    465,482,504,523,542,561,580,599,620,639,651,670,691,708,730,749,
+    767,786,808,829,848,866,881,901,923,944,963,979,989,1009,1019,1030,
+    1038,1044,1060,1081,1097,1119,1135,1153,1175,1195,1211,1228,1249,1261,1276,1291,
+    1307,1329,1351,1367,1380,1398,1413,1430,1447,1463,1485,1498,1514,1521,1537,1546,
+};
+
+const FONT_PACK Font20_Pack = {
+  Font20_Data,
+  Font20_Offset,
+  NULL,
+  95, /* Count */
+  14, /* Width */
+  20, /* Height */
+};
+
+#if FONT_PACKED
+sFONT Font20 = {
+  NULL,
+  14, /* Width */
+  20, /* Height */
+  &Font20_Pack,
+};
+#endif
+
+/* 17x24, 95 glyphs, 6840 bytes stock, 2130 packed */
+static const uint8_t Font24_Data[] = {
+    /* ' ' */
+    0x00,0x00,0x00,0x00,
+    /* '!' */
+    0x06,0x02,0x03,0x0f,0xff,0xff,0xff,0xe9,0x01,0xf8,
+    /* '"' */
+    0x04,0x03,0x88,0x07,0x01,0xe7,0x82,0x01,0xa5,0x83,
+    /* '#' */
+    0x02,0x02,0x8b,0x10,0x02,0x19,0x80,0x84,0x0b,0x01,0xcc,0xc0,0x07,0x33,0x2a,0x99,0x9c,0x00,0x66,0x70,0x85,
+    /* '$' */
+    0x03,0x01,0x89,0x13,0x12,0x0c,0x00,0x0c,0x68,0x4b,0xc0,0x00,0x8f,0x38,0x43,0x1c,0x71,0x84,0x00,0x20,0xe4,0x85,0xa4,0x84,
+    /* '%' */
+    0x03,0x02,0x0a,0x0f,0x3c,0x1f,0x8e,0x73,0x0c,0xc3,0x39,0xc7,0xfc,0xfc,0xff,0x8e,0x73,0x0c,0xc3,0x39,0xc7,0xe0,0xf0,
+    /* '&' */
+    0x03,0x04,0x0b,0x0d,0x1f,0x87,0xf1,0x8c,0x30,0x06,0x00,0x60,0x0e,0x03,0xe7,0xef,0xf8,0xf3,0x0e,0x3f,0xf3,0xee,
+    /* ''' */
+    0x06,0x03,0x03,0x07,0xff,0xa4,0x90,
+    /* '(' */
+    0x07,0x02,0x86,0x12,0x05,0x0c,0x42,0x50,0x08,0x09,0x84,0x05,0x90,0x04,0x80,0x24,0x40,
+    /* ')' */
+    0x03,0x02,0x06,0x12,0xc3,0x87,0x1c,0x38,0xe1,0xc7,0x1c,0x71,0xc7,0x38,0xe7,0x9c,0xe3,0x00,
+    /* '*' */
+    0x03,0x02,0x0a,0x0a,0x0c,0x03,0x00,0xc3,0xb7,0xff,0xcf,0xc1,0xe0,0x78,0x33,0x0c,0xc0,
+    /* '+' */
+    0x02,0x04,0x8c,0x0c,0x01,0x06,0x86,0x05,0x0f,0x9f,0x00,0x0f,0x9f,0x86,
+    /* ',' */
+    0x06,0x0e,0x05,0x07,0x39,0x9c,0xc6,0x63,0x00,
+    /* '-' */
+    0x03,0x09,0x0a,0x02,0xff,0xff,0xf0,
+    /* '.' */
+    0x06,0x0e,0x04,0x03,0xff,0xf0,
+    /* '/' */
+    0x03,0x00,0x0a,0x14,0x00,0xc0,0x30,0x1c,0x06,0x03,0x80,0xc0,0x30,0x18,0x06,0x03,0x00,0xc0,0x60,0x18,0x0c,0x03,0x01,0xc0,
+    0x60,0x38,0x0c,0x03,0x00,
+    /* '0' */
+    0x03,0x02,0x8a,0x0f,0x07,0x1e,0x08,0x45,0xe8,0x00,0xa1,0x40,0x86,0x06,0x02,0x85,0x00,0x17,0xa2,0x10,
+    /* '1' */
+    0x03,0x02,0x8a,0x0f,0x06,0x04,0x0e,0x0c,0x00,0x40,0xe0,0x8a,0x03,0x3c,0xf0,0x00,
+    /* '2' */
+    0x02,0x02,0x0b,0x0f,0x1f,0x0f,0xfb,0x83,0x60,0x3c,0x06,0x00,0xc0,0x30,0x0c,0x07,0x01,0xc0,0x60,0x18,0x06,0x01,0xff,0xff,
+    0xf8,
+    /* '3' */
+    0x03,0x02,0x0a,0x0f,0x1e,0x1f,0xc6,0x38,0x06,0x01,0x80,0xc1,0xe0,0x7c,0x03,0x80,0x30,0x0c,0x03,0xc1,0xff,0xe7,0xe0,
+    /* '4' */
+    0x02,0x02,0x0b,0x0f,0x03,0x80,0xf0,0x1e,0x06,0xc1,0x98,0x33,0x0c,0x61,0x8c,0x61,0x98,0x33,0xff,0xff,0xf0,0x18,0x1f,0xc3,
+    0xf8,
+    /* '5' */
+    0x02,0x02,0x8b,0x0f,0x04,0x7f,0xc0,0x00,0x7f,0x83,0x06,0x1e,0x04,0x30,0x78,0x70,0xa0,0x83,0x05,0x0c,0x0a,0x7e,0x30,0x30,
+    /* '6' */
+    0x03,0x02,0x0a,0x0f,0x07,0xc7,0xf3,0x81,0xc0,0x60,0x30,0x0d,0xe3,0xfe,0xe1,0xb0,0x3c,0x0f,0x03,0x61,0xdf,0xe1,0xf0,
+    /* '7' */
+    0x03,0x02,0x0a,0x0f,0xff,0xff,0xfc,0x0f,0x07,0x01,0x80,0x60,0x38,0x0c,0x03,0x01,0xc0,0x60,0x18,0x0e,0x03,0x00,0xc0,
+    /* '8' */
+    0x03,0x02,0x0a,0x0f,0x3f,0x1f,0xee,0x1f,0x03,0xc0,0xd8,0x63,0xf0,0xfc,0x61,0xb0,0x3c,0x0f,0x03,0xe1,0xdf,0xe3,0xf0,
+    /* '9' */
+    0x03,0x02,0x0a,0x0f,0x3e,0x1f,0xee,0x1b,0x03,0xc0,0xf0,0x36,0x1d,0xff,0x1e,0xc0,0x30,0x18,0x0e,0x07,0x3f,0x8f,0x80,
+    /* ':' */
+    0x06,0x06,0x04,0x0b,0xff,0xf0,0x00,0x00,0xff,0xf0,
+    /* ';' */
+    0x06,0x06,0x06,0x0d,0x3c,0xf3,0xc0,0x00,0x00,0x0e,0x71,0x86,0x30,0x80,
+    /* '<' */
+    0x00,0x04,0x0e,0x0d,0x00,0x1c,0x00,0xf0,0x0f,0x00,0xf0,0x0f,0x00,0xf0,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,
+    0x0f,0x00,0x1c,
+    /* '=' */
+    0x01,0x07,0x0d,0x06,0xff,0xff,0xff,0xc0,0x00,0x00,0x0f,0xff,0xff,0xfc,
+    /* '>' */
+    0x01,0x04,0x0e,0x0d,0xe0,0x03,0xc0,0x03,0xc0,0x03,0xc0,0x03,0xc0,0x03,0xc0,0x03,0xc0,0x3c,0x03,0xc0,0x3c,0x03,0xc0,0x3c,
+    0x00,0xe0,0x00,
+    /* '?' */
+    0x03,0x03,0x09,0x0e,0x3e,0x3f,0xb0,0xf8,0x3c,0x18,0x1c,0x1c,0x3c,0x1c,0x0c,0x00,0x00,0x03,0x81,0xc0,
+    /* '@' */
+    0x03,0x02,0x0a,0x11,0x1f,0x0f,0xe7,0x1d,0x83,0xc3,0xf1,0xfc,0xef,0x33,0xcc,0xf3,0x3c,0x7f,0x0f,0xc0,0x18,0x07,0x0c,0xff,
+    0x1f,0x00,
+    /* 'A' */
+    0x00,0x03,0x10,0x0e,0x1f,0x80,0x1f,0xc0,0x01,0xc0,0x03,0x60,0x03,0x60,0x06,0x30,0x06,0x30,0x0c,0x30,0x0f,0xf8,0x1f,0xf8,
+    0x18,0x0c,0x30,0x0c,0xfc,0x7f,0xfc,0x7f,
+    /* 'B' */
+    0x01,0x03,0x0d,0x0e,0xff,0xc7,0xff,0x0c,0x1c,0x60,0x63,0x03,0x18,0x38,0xff,0x87,0xfe,0x30,0x39,0x80,0xcc,0x06,0x60,0x3f,
+    0xff,0x7f,0xf0,
+    /* 'C' */
+    0x02,0x03,0x8c,0x0e,0x09,0x0f,0xb3,0x04,0x4f,0x81,0x04,0xa0,0x00,0x03,0x86,0x06,0xa0,0x31,0x04,0x4f,0x93,0x02,
+    /* 'D' */
+    0x01,0x03,0x8d,0x0e,0x09,0xff,0x80,0x03,0x33,0xe4,0x00,0x80,0x02,0x80,0x88,0x06,0x0a,0x00,0x8c,0xf9,0x00,0x10,
+    /* 'E' */
+    0x01,0x03,0x0c,0x0e,0xff,0xff,0xff,0x30,0x33,0x03,0x33,0x33,0x30,0x3f,0x03,0xf0,0x33,0x03,0x33,0x30,0x33,0x03,0xff,0xff,
+    0xff,
+    /* 'F' */
+    0x02,0x03,0x0c,0x0e,0xff,0xff,0xff,0x30,0x33,0x03,0x33,0x33,0x30,0x3f,0x03,0xf0,0x33,0x03,0x30,0x30,0x03,0x00,0xff,0x0f,
+    0xf0,
+    /* 'G' */
+    0x02,0x03,0x0d,0x0e,0x0f,0xb1,0xff,0x9c,0x1c,0xc0,0x6c,0x03,0x60,0x03,0x00,0x18,0x7f,0xc3,0xfe,0x01,0xb8,0x0c,0xe0,0xe3,
+    0xff,0x07,0xe0,
+    /* 'H' */
+    0x01,0x03,0x8e,0x0e,0x06,0xfc,0xfc,0x00,0x0c,0xcc,0xc0,0x85,0x01,0xfc,0x82,0x02,0x0f,0xc0,0x85,0x02,0xcc,0xcc,0x82,
+    /* 'I' */
+    0x03,0x03,0x8a,0x0e,0x04,0xff,0xc0,0x0f,0x3c,0x8b,0x03,0xf3,0xc0,0x00,
+    /* 'J' */
+    0x02,0x03,0x8d,0x0e,0x05,0x1f,0xf8,0x00,0x07,0xce,0x86,0x01,0x18,0x86,0x05,0x02,0x83,0xe0,0x60,0xc0,
+    /* 'K' */
+    0x01,0x03,0x0f,0x0e,0xfe,0x7d,0xfc,0xf8,0xc1,0x81,0x86,0x03,0x18,0x06,0x60,0x0d,0xc0,0x1f,0xc0,0x39,0xc0,0x61,0xc0,0xc1,
+    0x81,0x83,0x8f,0xe3,0xff,0xc7,0xc0,
+    /* 'L' */
+    0x01,0x03,0x8d,0x0e,0x01,0xff,0x82,0x02,0x39,0xc0,0x89,0x01,0x18,0x84,0x02,0x0e,0x7e,0x82,
+    /* 'M' */
+    0x00,0x03,0x10,0x0e,0xf0,0x0f,0xf8,0x1f,0x38,0x1c,0x3c,0x3c,0x3c,0x3c,0x36,0x6c,0x36,0x6c,0x33,0xcc,0x33,0xcc,0x31,0x8c,
+    0x30,0x0c,0x30,0x0c,0xfe,0x7f,0xfe,0x7f,
+    /* 'N' */
+    0x01,0x03,0x0e,0x0e,0xf1,0xff,0xc7,0xf3,0x83,0x0f,0x0c,0x3e,0x30,0xd8,0xc3,0x73,0x0c,0xec,0x31,0xb0,0xc7,0xc3,0x0f,0x0c,
+    0x1c,0xfe,0x33,0xf8,0xc0,
+    /* 'O' */
+    0x02,0x03,0x8c,0x0e,0x09,0x0f,0x03,0x0c,0x4f,0x21,0x08,0x80,0x12,0x04,0x84,0x08,0x02,0x04,0x80,0x11,0x08,0x4f,0x23,0x0c,
+    /* 'P' */
+    0x02,0x03,0x8c,0x0e,0x06,0xff,0xc0,0x02,0xcf,0x90,0x04,0x84,0x05,0x50,0xf8,0x00,0x60,0xf8,0x83,0x01,0xcf,0x82,
+    /* 'Q' */
+    0x02,0x03,0x8c,0x11,0x09,0x0f,0x03,0x0c,0x4f,0x21,0x08,0x80,0x12,0x04,0x84,0x0d,0x02,0x04,0x80,0x11,0x08,0x4f,0x22,0x0c,
+    0x00,0x32,0x0c,0x0f,0x10,
+    /* 'R' */
+    0x01,0x03,0x0e,0x0e,0xff,0xc3,0xff,0x83,0x07,0x0c,0x0c,0x30,0x30,0xc1,0xc3,0xfe,0x0f,0xe0,0x31,0xc0,0xc3,0x83,0x06,0x0c,
+    0x1c,0xfe,0x3f,0xf8,0x70,
+    /* 'S' */
+    0x03,0x03,0x0a,0x0e,0x3e,0xdf,0xfe,0x1f,0x03,0xc0,0xfc,0x07,0xe0,0x7e,0x03,0xf0,0x3c,0x0f,0x87,0xff,0xb7,0xc0,
+    /* 'T' */
+    0x02,0x03,0x8c,0x0e,0x05,0xff,0xf0,0x00,0x39,0xc0,0x84,0x02,0xc0,0x30,0x87,0x03,0x39,0xc0,0x00,
+    /* 'U' */
+    0x01,0x03,0x8e,0x0e,0x06,0xfc,0xfc,0x00,0x0c,0xcc,0xc0,0x8d,0x06,0x0a,0x14,0x07,0x80,0x61,0x80,
+    /* 'V' */
+    0x01,0x03,0x8f,0x0e,0x08,0xfe,0xfe,0x00,0x03,0x3b,0x99,0x41,0x40,0x83,0x02,0x05,0x14,0x82,0x02,0x0a,0xa0,0x84,0x01,0x2a,
+    0x83,0x02,0x50,0x00,
+    /* 'W' */
+    0x00,0x03,0x91,0x0e,0x07,0xfe,0x3f,0x80,0x00,0x33,0x8e,0x60,0x82,0x04,0x08,0x01,0x4a,0x50,0x82,0x02,0x05,0x40,0x82,0x04,
+    0x02,0x88,0x04,0x11,0x83,0x01,0x22,0x83,
+    /* 'X' */
+    0x01,0x03,0x0e,0x0e,0xfc,0xff,0xf3,0xf3,0x03,0x06,0x18,0x0c,0xc0,0x1e,0x00,0x30,0x00,0xc0,0x07,0x80,0x33,0x01,0x86,0x0c,
+    0x0c,0xfc,0xff,0xf3,0xf0,
+    /* 'Y' */
+    0x01,0x03,0x8e,0x0e,0x09,0xf8,0xfc,0x00,0x0c,0x8c,0xca,0x14,0x14,0xa0,0x82,0x03,0xb4,0x01,0x20,0x87,0x02,0x1c,0xe0,0x82,
+    /* 'Z' */
+    0x02,0x03,0x0b,0x0e,0x7f,0xef,0xfd,0x81,0xb0,0x66,0x18,0xc6,0x01,0x80,0x60,0x18,0x66,0x0d,0x81,0xe0,0x3f,0xff,0xff,0xc0,
+    /* '[' */
+    0x07,0x02,0x85,0x12,0x02,0xf8,0x0e,0x88,0x02,0x38,0x00,
+    /* '\' */
+    0x03,0x00,0x0a,0x14,0xc0,0x30,0x0e,0x01,0x80,0x70,0x0c,0x03,0x00,0x60,0x18,0x03,0x00,0xc0,0x18,0x06,0x00,0xc0,0x30,0x0e,
+    0x01,0x80,0x70,0x0c,0x03,
+    /* ']' */
+    0x04,0x02,0x85,0x12,0x02,0xf8,0x38,0x88,0x02,0xe0,0x00,
+    /* '^' */
+    0x03,0x01,0x0b,0x08,0x04,0x01,0xc0,0x7c,0x1d,0xc3,0x18,0xc1,0xb0,0x1c,0x01,
+    /* '_' */
+    0x00,0x16,0x10,0x02,0xff,0xff,0xff,0xff,
+    /* '`' */
+    0x06,0x01,0x05,0x04,0xc7,0x0e,0x30,
+    /* 'a' */
+    0x02,0x06,0x0c,0x0b,0x3f,0x07,0xf8,0x00,0xc0,0x0c,0x1f,0xc7,0xfc,0xe0,0xcc,0x0c,0xc1,0xc7,0xff,0x3e,0xf0,
+    /* 'b' */
+    0x01,0x02,0x8d,0x0f,0x01,0xf0,0x82,0x01,0x30,0x83,0x06,0x7c,0x04,0x18,0x1f,0x01,0x05,0x87,0x05,0x82,0xe3,0xe0,0x20,0xc0,
+    /* 'c' */
+    0x02,0x06,0x0c,0x0b,0x0f,0xb3,0xff,0x70,0x7e,0x03,0xc0,0x3c,0x00,0xc0,0x0e,0x03,0x70,0x73,0xfe,0x0f,0xc0,
+    /* 'd' */
+    0x02,0x02,0x8d,0x0f,0x02,0x01,0xe0,0x82,0x09,0x60,0x00,0x01,0xf0,0x30,0x40,0x7c,0x14,0x10,0x86,0x06,0x0a,0x08,0x0f,0x8d,
+    0x82,0x00,
+    /* 'e' */
+    0x02,0x06,0x0c,0x0b,0x1f,0x87,0xfe,0x60,0x6c,0x03,0xff,0xff,0xff,0xc0,0x0c,0x00,0x60,0x37,0xff,0x1f,0xc0,
+    /* 'f' */
+    0x02,0x02,0x8c,0x0f,0x0b,0x07,0xf0,0x80,0x17,0xf0,0x00,0xe7,0xe0,0x00,0xe7,0xe0,0x88,0x02,0x0e,0x7c,0x82,
+    /* 'g' */
+    0x02,0x06,0x8d,0x10,0x06,0x1f,0x7b,0x04,0x07,0xc7,0x41,0x87,0x06,0xa0,0x80,0xf8,0x18,0x20,0x3e,0x83,0x04,0x40,0xfc,0x80,
+    0x18,
+    /* 'h' */
+    0x01,0x02,0x8e,0x0f,0x01,0xf0,0x82,0x01,0x0c,0x83,0x07,0x07,0xc0,0x20,0x80,0x79,0x02,0x10,0x88,0x03,0x03,0x33,0x30,0x82,
+    /* 'i' */
+    0x02,0x02,0x8c,0x0f,0x01,0x06,0x82,0x01,0x06,0x82,0x01,0x7e,0x82,0x01,0x78,0x89,0x02,0x0f,0x9f,0x82,
+    /* 'j' */
+    0x03,0x02,0x89,0x14,0x08,0x06,0x00,0x01,0x80,0x0f,0xf8,0x03,0xf8,0x8b,0x04,0x01,0x3f,0x20,0x60,
+    /* 'k' */
+    0x02,0x02,0x0c,0x0f,0xf0,0x0f,0x00,0x30,0x03,0x00,0x33,0xe3,0x3e,0x33,0x03,0x60,0x3e,0x03,0xc0,0x3e,0x03,0x70,0x33,0x8f,
+    0x1f,0xf1,0xf0,
+    /* 'l' */
+    0x02,0x02,0x8c,0x0f,0x01,0x7e,0x82,0x01,0x78,0x8f,0x02,0x0f,0x9f,0x82,
+    /* 'm' */
+    0x00,0x06,0x90,0x0b,0x08,0xf7,0x78,0x08,0x84,0xc6,0x30,0x08,0x40,0x8a,0x02,0xcc,0x63,0x82,
+    /* 'n' */
+    0x01,0x06,0x8e,0x0b,0x07,0xf7,0xc0,0x20,0x8c,0x79,0x02,0x10,0x88,0x03,0x03,0x33,0x30,0x82,
+    /* 'o' */
+    0x02,0x06,0x0c,0x0b,0x0f,0x03,0xfc,0x70,0xee,0x07,0xc0,0x3c,0x03,0xc0,0x3e,0x07,0x70,0xe3,0xfc,0x0f,0x00,
+    /* 'p' */
+    0x01,0x06,0x8d,0x10,0x07,0xf7,0xc0,0x41,0xb1,0xf0,0x10,0x50,0x86,0x07,0x08,0x28,0x3e,0x02,0x0c,0x0f,0x80,0x82,0x02,0x03,
+    0x38,0x82,
+    /* 'q' */
+    0x02,0x06,0x8d,0x10,0x06,0x1f,0x7b,0x04,0x07,0xc7,0x41,0x87,0x06,0xa0,0x80,0xf8,0x18,0x20,0x3e,0x84,0x03,0x0e,0x60,0x00,
+    /* 'r' */
+    0x02,0x06,0x8c,0x0b,0x07,0xf9,0xe0,0x21,0xe4,0xc0,0x33,0x04,0x86,0x02,0x0e,0x7c,0x82,
+    /* 's' */
+    0x03,0x06,0x0a,0x0b,0x3f,0xdf,0xfc,0x0f,0x03,0xfc,0x1f,0xe0,0x7f,0x03,0xc1,0xff,0xef,0xf0,
+    /* 't' */
+    0x02,0x02,0x8c,0x0f,0x01,0x30,0x85,0x05,0xcf,0xc0,0x00,0xcf,0xc0,0x88,0x04,0x72,0xf8,0x10,0x30,
+    /* 'u' */
+    0x01,0x06,0x8e,0x0b,0x05,0xf0,0xf0,0x00,0x0c,0x0c,0x8a,0x05,0x40,0xbe,0x31,0x04,0x00,
+    /* 'v' */
+    0x01,0x06,0x8e,0x0b,0x0c,0xf8,0x7c,0x00,0x0c,0x84,0xc0,0x00,0x28,0x50,0x00,0x01,0x4a,0x82,0x03,0x03,0x00,0x21,0x83,
+    /* 'w' */
+    0x01,0x06,0x8d,0x0b,0x06,0xf0,0x78,0x00,0x24,0x92,0x0a,0x82,0x03,0x29,0x28,0x22,0x82,0x02,0x05,0x21,0x83,
+    /* 'x' */
+    0x02,0x06,0x0c,0x0b,0xf9,0xff,0x9f,0x30,0xc1,0x98,0x0f,0x00,0x60,0x0f,0x01,0x98,0x30,0xcf,0x9f,0xf9,0xf0,
+    /* 'y' */
+    0x01,0x06,0x8f,0x10,0x0b,0xfc,0x3e,0x00,0x03,0x30,0x99,0x41,0x40,0x00,0x02,0x8a,0x82,0x09,0x05,0x50,0x01,0x00,0x08,0x80,
+    0x08,0x00,0x14,0x83,0x03,0xa0,0x1e,0x60,0x82,
+    /* 'z' */
+    0x03,0x06,0x0a,0x0b,0xff,0xff,0xfc,0x1b,0x0c,0x06,0x03,0x01,0x80,0xc3,0x60,0xff,0xff,0xfc,
+    /* '{' */
+    0x05,0x02,0x86,0x12,0x03,0x1c,0x80,0xc0,0x83,0x03,0x42,0x49,0x10,0x83,0x02,0x0c,0x80,
+    /* '|' */
+    0x07,0x02,0x82,0x12,0x01,0xc0,0x84,
+    /* '}' */
+    0x05,0x02,0x86,0x12,0x02,0xe0,0x4c,0x84,0x03,0x08,0x92,0x42,0x83,0x02,0xc0,0x40,
+    /* '~' */
+    0x02,0x08,0x0b,0x05,0x38,0x0f,0x8f,0xbb,0xe3,0xe0,0x38,
+};
+
+static const uint16_t Font24_Offset[] = {
+    0,4,14,24,45,69,92,114,121,138,156,173,187,196,203,209,
+    238,258,274,299,322,347,371,394,417,440,463,473,487,514,528,555,
+    575,601,633,660,682,704,729,754,781,804,818,838,869,887,919,948,
+    972,994,1023,1052,1074,1093,1112,1140,1172,1201,1225,1249,1260,1289,1300,1315,
+    1323,1330,1351,1375,1396,1422,1443,1464,1489,1513,1533,1552,1579,1593,1611,1629,
+    1650,1676,1700,1717,1735,1754,1771,1794,1815,1836,1869,1887,1904,1911,1927,1938,
+};
+
+const FONT_PACK Font24_Pack = {
+  Font24_Data,
+  Font24_Offset,
+  NULL,
+  95, /* Count */
+  17, /* Width */
+  24, /* Height */
+};
+
+#if FONT_PACKED
+sFONT Font24 = {
+  NULL,
+  17, /* Width */
+  24, /* Height */
+  &Font24_Pack,
+};
+#endif
+
+/* 16x21, 9 glyphs, 1503 bytes stock, 280 packed */
+static const uint8_t Font12CN_Data[] = {
+    /* "你" */
+    0x00,0x04,0x10,0x0f,0x1d,0xc0,0x1d,0x80,0x3b,0xff,0x3b,0x07,0x3f,0x77,0x7e,0x76,0xf8,0x70,0xfb,0xfe,0xfb,0xfe,0x3f,0x77,
+    0x3f,0x77,0x3e,0x73,0x38,0x70,0x38,0x70,0x3b,0xe0,
+    /* "好" */
+    0x00,0x04,0x10,0x0f,0x30,0x00,0x73,0xff,0x70,0x0f,0xfe,0x1e,0x7e,0x3c,0x6e,0x38,0xee,0x30,0xef,0xff,0xfc,0x30,0x7c,0x30,
+    0x38,0x30,0x3e,0x30,0x7e,0x30,0xe0,0x30,0xc1,0xf0,
+    /* "树" */
+    0x00,0x04,0x10,0x0f,0x30,0x0e,0x30,0x0e,0x3f,0xee,0x30,0xee,0xfc,0xff,0x76,0xce,0x77,0xfe,0x7b,0xfe,0xff,0xfe,0xf3,0xde,
+    0xf3,0xce,0x37,0xee,0x3e,0x6e,0x3c,0x0e,0x30,0x3e,
+    /* "莓" */
+    0x00,0x04,0x10,0x0f,0x06,0x70,0xff,0xff,0x3e,0x70,0x38,0x00,0x7f,0xff,0xe0,0x00,0xff,0xfc,0x3b,0x8c,0x39,0xcc,0xff,0xff,
+    0x73,0x9c,0x71,0xdc,0x7f,0xff,0x00,0x1c,0x01,0xf8,
+    /* "派" */
+    0x00,0x04,0x10,0x0e,0xe0,0x1f,0xff,0xf0,0x3e,0x00,0x0e,0x1f,0xcf,0xfb,0xff,0xf8,0x3f,0xff,0x0f,0xff,0x7f,0xd8,0x7f,0xdc,
+    0x6f,0xce,0xed,0xff,0xfd,0xf7,0xf9,0xc0,
+    /* "a" */
+    0x00,0x08,0x09,0x09,0x3e,0x33,0x81,0xe1,0xf7,0xff,0x1f,0x9f,0xcf,0x7f,0x80,
+    /* "b" */
+    0x01,0x04,0x89,0x0d,0x01,0xe0,0x83,0x04,0x01,0xe0,0x48,0x52,0x84,0x03,0x02,0x90,0x90,
+    /* "c" */
+    0x00,0x08,0x08,0x09,0x3f,0x73,0xf0,0xe0,0xe0,0xe0,0xf0,0x73,0x3f,
+    /* "A" */
+    0x00,0x05,0x8b,0x0c,0x03,0x0e,0x02,0x20,0x82,0x09,0x02,0x48,0x00,0x12,0x80,0x72,0x0e,0x12,0x24,0x83,
+};
+
+static const uint16_t Font12CN_Offset[] = {
+    0,34,68,102,136,168,183,200,213,233,
+};
+
+static const uint8_t Font12CN_Codes[] = {
+    0xe4,0xbd,0xa0,  /* "你" */
+    0xe5,0xa5,0xbd,  /* "好" */
+    0xe6,0xa0,0x91,  /* "树" */
+    0xe8,0x8e,0x93,  /* "莓" */
+    0xe6,0xb4,0xbe,  /* "派" */
+    0x61,0x00,0x00,  /* "a" */
+    0x62,0x00,0x00,  /* "b" */
+    0x63,0x00,0x00,  /* "c" */
+    0x41,0x00,0x00,  /* "A" */
+};
+
+const FONT_PACK Font12CN_Pack = {
+  Font12CN_Data,
+  Font12CN_Offset,
+  Font12CN_Codes,
+  9, /* Count */
+  16, /* Width */
+  21, /* Height */
+};
+
+#if FONT_PACKED
+cFONT Font12CN = {
+  NULL,
+  9,  /*size of table*/
+  11, /* ASCII Width */
+  16, /* Width */
+  21, /* Height */
+  &Font12CN_Pack,
+};
+#endif
+
+/* 32x41, 27 glyphs, 4509 bytes stock, 2478 packed */
+static const uint8_t Font24CN_Data[] = {
+    /* "你" */
+    0x00,0x07,0xa0,0x1d,0x03,0x01,0xc1,0xc0,0x82,0x06,0x22,0x20,0x00,0x02,0x00,0x20,0x82,0x02,0x24,0x40,0x83,0x04,0x7f,0xff,
+    0x04,0x48,0x84,0x0b,0xff,0xf0,0x08,0x91,0x00,0x11,0x00,0x22,0x1e,0x00,0x10,0x82,0x0a,0x20,0x00,0x24,0x00,0x02,0x20,0x18,
+    0x00,0x20,0x40,0x82,0x06,0x1c,0x00,0x07,0x80,0x70,0x80,0x82,0x0a,0x80,0x10,0x08,0x00,0x88,0x80,0x00,0x80,0x00,0x60,0x82,
+    0x03,0x44,0x00,0x11,0x85,0x03,0x22,0x00,0x22,0x85,0x0d,0x01,0x00,0x40,0x00,0x10,0x00,0x04,0x00,0x01,0x00,0x78,0x00,0x0e,
+    0x86,0x01,0x22,0x82,0x02,0x07,0xc0,0x83,0x02,0x04,0x00,
+    /* "好" */
+    0x00,0x06,0xa0,0x1e,0x01,0x0f,0x88,0x03,0x07,0xff,0xfe,0x85,0x04,0x07,0xff,0xc0,0x11,0x82,0x05,0xc2,0xe1,0xf8,0x01,0x0c,
+    0x82,0x06,0x02,0x10,0xe1,0x80,0x04,0x20,0x82,0x03,0x08,0x40,0x22,0x82,0x01,0x80,0x8d,0x05,0x07,0xf0,0xff,0x44,0x80,0x83,
+    0x03,0x0f,0xf0,0xff,0x84,0x02,0x45,0x10,0x82,0x01,0x22,0x83,0x01,0x10,0x83,0x02,0x08,0x20,0x83,0x01,0x20,0x83,0x01,0x10,
+    0x82,0x02,0x08,0x08,0x82,0x02,0x11,0x84,0x82,0x02,0x22,0x44,0x82,0x02,0x44,0x38,0x82,0x08,0x88,0x03,0xf0,0x00,0x90,0x02,
+    0x01,0x00,
+    /* "微" */
+    0x00,0x06,0xa0,0x1f,0x06,0x03,0x07,0x01,0xe0,0x04,0x80,0x83,0x0a,0x80,0x00,0x20,0x08,0xf0,0x78,0x00,0x11,0x00,0x02,0x84,
+    0x02,0x40,0x22,0x82,0x02,0x7f,0x44,0x83,0x09,0x80,0x00,0x04,0x61,0x0f,0x08,0x80,0x00,0x90,0x83,0x0b,0x60,0xff,0x80,0x02,
+    0x08,0x00,0x70,0x00,0x11,0x00,0x10,0x82,0x10,0x7f,0xe0,0x20,0x20,0x00,0x0c,0x40,0x00,0x7f,0xf0,0x00,0x40,0x00,0x02,0x04,
+    0x80,0x84,0x04,0x7f,0xe0,0x00,0x20,0x83,0x04,0xc0,0x07,0x01,0x08,0x82,0x01,0x0e,0x83,0x01,0x11,0x83,0x15,0x02,0x08,0x00,
+    0x01,0x06,0x04,0x00,0x88,0x0c,0x40,0x00,0x01,0x18,0x22,0x01,0x10,0xe0,0x91,0x01,0x20,0x11,0x82,0x03,0xc0,0x12,0x08,
+    /* "软" */
+    0x00,0x05,0xa0,0x20,0x06,0x03,0xc0,0x78,0x00,0x04,0x40,0x88,0x04,0x88,0x00,0x08,0x80,0x82,0x04,0xf0,0xff,0x0f,0xff,0x84,
+    0x04,0xe1,0xfc,0x3f,0xe0,0x83,0x06,0x01,0x01,0xe4,0x4f,0x20,0x22,0x82,0x0d,0x02,0x00,0x08,0x80,0x40,0x00,0x08,0x00,0x04,
+    0x44,0x07,0x00,0x78,0x82,0x04,0x01,0x00,0x06,0x1e,0x84,0x04,0x11,0x00,0x7e,0x1e,0x89,0x01,0x80,0x86,0x01,0x20,0x82,0x12,
+    0x1f,0x00,0x40,0x0e,0x00,0x44,0x00,0xf0,0x0f,0x02,0x20,0x06,0x10,0x88,0x10,0xf8,0x01,0x01,0x82,0x0b,0x02,0x10,0x08,0x00,
+    0x04,0x20,0x84,0x00,0x18,0x40,0x43,0x82,0x06,0x80,0x20,0x00,0x13,0x00,0x11,
+    /* "雅" */
+    0x00,0x06,0xa0,0x1f,0x82,0x01,0x77,0x83,0x0c,0x88,0x00,0x7f,0xfc,0x08,0x80,0x00,0x01,0x14,0x40,0x7e,0x3c,0x83,0x08,0x02,
+    0x22,0x40,0x3c,0x04,0x3e,0x7f,0x04,0x84,0x05,0x08,0x7c,0x7f,0x40,0x10,0x83,0x01,0x20,0x83,0x01,0x20,0x82,0x02,0x08,0x1c,
+    0x82,0x04,0x0e,0x3c,0x7c,0x7e,0x84,0x05,0x7c,0x3c,0x7c,0x7e,0x04,0x87,0x01,0x08,0x87,0x05,0x10,0x00,0x7c,0x7e,0x02,0x83,
+    0x05,0x20,0x00,0x7c,0x7e,0x44,0x83,0x01,0x88,0x87,0x01,0x90,0x83,0x05,0x60,0x00,0x7c,0x7f,0x02,0x83,0x06,0x1c,0x00,0x7f,
+    0xff,0x00,0x40,0x82,
+    /* "黑" */
+    0x00,0x08,0xa0,0x1d,0x04,0x1f,0xff,0xff,0xfc,0x84,0x13,0x01,0xfc,0x3f,0xc0,0x00,0xc0,0x07,0x00,0x01,0x20,0x00,0x80,0x01,
+    0x10,0x08,0x80,0x00,0x08,0x10,0x82,0x02,0x80,0x01,0x82,0x02,0x48,0x02,0x82,0x07,0x30,0x1c,0x00,0x01,0xfc,0x3f,0xc0,0x84,
+    0x05,0x01,0xfc,0x3f,0xc0,0x1e,0x82,0x01,0x3c,0x84,0x04,0x3f,0xfc,0x3f,0xfc,0x84,0x04,0x3f,0xfc,0x3f,0xfc,0x88,0x04,0xff,
+    0xfc,0x3f,0xff,0x84,0x1c,0xff,0xff,0xff,0xff,0x1c,0x38,0x70,0x70,0x22,0x40,0x88,0x88,0x02,0x04,0x80,0x84,0x40,0x40,0x44,
+    0x42,0x84,0x02,0x00,0x21,0x08,0x22,0x24,0x11,
+    /* "此" */
+    0x00,0x07,0xa0,0x1c,0x81,0x02,0x78,0x3c,0x94,0x02,0x0c,0x3c,0x82,0x01,0x12,0x83,0x01,0x21,0x83,0x05,0xc7,0x00,0x07,0xc1,
+    0x08,0x82,0x06,0x02,0x10,0x00,0x07,0xc0,0x60,0x82,0x02,0x01,0x80,0x82,0x01,0x02,0x98,0x01,0x0e,0x83,0x01,0x01,0x85,0x02,
+    0x01,0xc0,0x82,0x01,0x06,0x82,0x03,0x03,0x80,0xc0,0x82,0x0b,0x0f,0x02,0x11,0xc0,0xf0,0x21,0xe0,0x0f,0x00,0x10,0x02,
+    /* "字" */
+    0x00,0x05,0xa0,0x1f,0x81,0x02,0x03,0x80,0x82,0x01,0x04,0x83,0x02,0x04,0x40,0x83,0x01,0x20,0x82,0x01,0x02,0x82,0x04,0x7f,
+    0xfe,0x1f,0xfe,0x84,0x04,0x07,0xff,0xff,0xe0,0x8c,0x05,0x03,0xff,0xff,0xc0,0x78,0x82,0x04,0x1e,0x03,0xff,0xf0,0x83,0x02,
+    0x30,0xc0,0x82,0x01,0x41,0x82,0x02,0x01,0x86,0x83,0x01,0x18,0x85,0x04,0xff,0xfe,0x1f,0xff,0x84,0x04,0xff,0xfe,0x1f,0xff,
+    0x95,0x01,0x02,0x84,0x01,0x20,0x82,0x01,0xfc,0x84,0x02,0x40,0x00,
+    /* "体" */
+    0x00,0x07,0xa0,0x1e,0x03,0x03,0xc0,0x3c,0x89,0x02,0x04,0x40,0x8a,0x04,0x08,0x7f,0xc3,0xff,0x84,0x04,0x10,0xfe,0x01,0xff,
+    0x82,0x03,0x01,0x00,0x20,0x84,0x01,0x02,0x82,0x01,0x40,0x82,0x06,0x80,0x00,0x04,0x40,0x00,0x80,0x82,0x06,0x40,0x10,0x08,
+    0x82,0x00,0x20,0x82,0x03,0x20,0xc0,0x11,0x84,0x1e,0x01,0x10,0x00,0x22,0x00,0x88,0x00,0x40,0x00,0x04,0x00,0x84,0x00,0x42,
+    0x00,0x0f,0xc3,0xe1,0x00,0x10,0x00,0x10,0x00,0x27,0xc3,0xc9,0x00,0xc0,0x00,0x06,0x90,
+    /* "下" */
+    0x00,0x08,0xa0,0x1c,0x04,0xff,0xff,0xff,0xff,0x84,0x04,0xff,0xf0,0x7f,0xff,0x96,0x01,0x60,0x83,0x01,0x18,0x83,0x01,0x04,
+    0x83,0x01,0x43,0x83,0x02,0x20,0x80,0x82,0x02,0x18,0x60,0x82,0x02,0x04,0x10,0x82,0x02,0x03,0x08,0x83,0x01,0x84,0x83,0x01,
+    0x44,0x83,0x01,0x38,0xa4,
+    /* "对" */
+    0x00,0x07,0xa0,0x1c,0x83,0x01,0x78,0x88,0x02,0x7f,0xfc,0x86,0x02,0x7f,0xc0,0x83,0x04,0x03,0xff,0x87,0x30,0x83,0x06,0x48,
+    0x03,0xff,0x87,0x44,0x04,0x82,0x02,0x02,0x40,0x82,0x07,0x20,0x00,0xc0,0x00,0x11,0x01,0x20,0x82,0x12,0x89,0x10,0x00,0x08,
+    0x00,0x08,0x00,0x04,0x00,0x80,0x00,0x02,0x10,0x44,0x00,0x02,0x10,0x02,0x83,0x05,0x26,0x00,0x04,0x08,0x18,0x82,0x01,0x04,
+    0x82,0x02,0x08,0xc2,0x82,0x02,0x10,0x20,0x82,0x02,0x21,0x01,0x82,0x0d,0x42,0x11,0x00,0x80,0x84,0x0e,0x00,0x08,0x08,0x00,
+    0x3f,0x00,0x90,0x82,0x01,0x10,
+    /* "应" */
+    0x00,0x05,0xa0,0x20,0x81,0x02,0x01,0xc0,0x82,0x02,0x02,0x20,0x82,0x01,0x02,0x84,0x01,0x10,0x82,0x01,0x01,0x82,0x04,0x1f,
+    0xff,0x0f,0xff,0x84,0x04,0x01,0xff,0xff,0xff,0x85,0x03,0x01,0xe0,0x78,0x85,0x01,0xe0,0x82,0x08,0x01,0x10,0x10,0x80,0x01,
+    0x01,0x00,0x08,0x85,0x01,0x08,0x83,0x02,0x80,0x01,0x83,0x02,0x08,0x10,0x82,0x01,0x80,0x82,0x02,0x04,0x02,0x82,0x03,0x40,
+    0x00,0x20,0x88,0x06,0x22,0x02,0x7c,0x40,0x00,0x22,0x83,0x01,0x1c,0x84,0x03,0x08,0x80,0x44,0x83,0x05,0x03,0xff,0xf0,0xff,
+    0x88,0x83,0x05,0x03,0xff,0xff,0xff,0x90,0x83,
+    /* "的" */
+    0x01,0x06,0x9e,0x1e,0x0b,0x07,0x00,0x78,0x00,0x22,0x00,0x10,0x00,0x08,0x00,0x40,0x82,0x14,0x20,0x00,0x11,0x00,0x08,0x03,
+    0x87,0xf0,0x3f,0xf0,0x00,0x10,0x00,0x03,0xf0,0x07,0xf0,0x00,0x02,0x20,0x86,0x01,0x04,0x87,0x01,0x60,0x82,0x02,0x08,0x40,
+    0x82,0x05,0x10,0x80,0x03,0xf0,0x20,0x83,0x05,0x44,0x00,0x3f,0x00,0x08,0x82,0x02,0x02,0x10,0x82,0x01,0x04,0x83,0x01,0x01,
+    0x83,0x01,0x38,0x87,0x01,0x10,0x83,0x01,0x04,0x84,0x01,0xfc,0x85,0x05,0x20,0x0f,0xc0,0x7f,0x08,0x83,0x01,0x40,
+    /* "点" */
+    0x00,0x06,0xa0,0x1e,0x81,0x02,0x03,0xc0,0x8f,0x02,0x3f,0xff,0x86,0x02,0x3f,0xff,0x8c,0x04,0x0f,0xfc,0x3f,0xf8,0x85,0x03,
+    0xff,0xff,0x80,0x95,0x03,0xff,0xff,0x80,0x85,0x04,0xff,0xff,0x80,0x0f,0x82,0x0b,0x78,0x0c,0x38,0x38,0x30,0x12,0x44,0x40,
+    0x48,0x20,0x40,0x82,0x14,0x02,0x00,0x44,0x44,0x40,0x02,0x00,0x02,0x84,0x20,0x00,0x20,0x08,0x00,0x22,0x01,0x80,0x00,0x02,
+    0x11,
+    /* "阵" */
+    0x01,0x06,0x9f,0x1f,0x82,0x01,0x78,0x82,0x05,0x01,0x10,0x03,0xff,0x80,0x86,0x04,0xc1,0xf0,0xff,0xe0,0x84,0x04,0x0f,0x0f,
+    0xff,0x80,0x83,0x03,0x04,0x40,0x1f,0x82,0x02,0x08,0x80,0x85,0x02,0x44,0x40,0x83,0x01,0x08,0x85,0x03,0x02,0x24,0x40,0x83,
+    0x04,0xf0,0x7e,0x04,0x40,0x83,0x04,0x3f,0xc1,0xf8,0x08,0x83,0x01,0x01,0x8b,0x04,0x07,0xf8,0x3f,0x81,0x83,0x06,0x0c,0x3f,
+    0xe0,0xfe,0x00,0x80,0x82,0x01,0x3e,0x93,
+    /* "为" */
+    0x01,0x07,0x9d,0x1e,0x81,0x01,0x0f,0x82,0x01,0xe0,0x82,0x02,0x08,0x80,0x82,0x01,0x42,0x82,0x02,0x01,0x08,0x82,0x02,0x06,
+    0x20,0x82,0x01,0x09,0x83,0x01,0x30,0x82,0x04,0xff,0xf0,0xff,0xf8,0x83,0x06,0x3f,0xfc,0x3f,0xe0,0x00,0x20,0x83,0x01,0x10,
+    0x86,0x01,0x03,0x82,0x02,0x04,0x24,0x82,0x0d,0x03,0x10,0x00,0x02,0x04,0x40,0x00,0x01,0x01,0x00,0x01,0x00,0x84,0x82,0x01,
+    0x82,0x82,0x0c,0x80,0x09,0x00,0x08,0x40,0x30,0x00,0x84,0x00,0x10,0x08,0x40,0x82,0x01,0x84,0x82,0x0f,0x48,0x40,0x00,0x40,
+    0x84,0x03,0xfc,0x28,0x40,0x00,0x02,0x44,0x00,0xff,0xe0,
+    /* "树" */
+    0x00,0x07,0xa0,0x1e,0x01,0x0f,0x82,0x01,0x38,0x89,0x02,0x3f,0xf8,0x86,0x07,0x3f,0x80,0x00,0xf0,0xe0,0x07,0xc7,0x84,0x0a,
+    0xf0,0xe0,0x0f,0xc7,0x00,0x18,0x80,0x00,0x10,0x24,0x83,0x02,0x20,0x0e,0x82,0x01,0xc2,0x82,0x03,0x20,0x31,0x11,0x82,0x01,
+    0x10,0x83,0x06,0x08,0x08,0x80,0x40,0x90,0x20,0x82,0x08,0x64,0x04,0x00,0x80,0x04,0x23,0x80,0x10,0x84,0x05,0x08,0x10,0x00,
+    0x20,0x10,0x82,0x03,0xc0,0x01,0x88,0x82,0x02,0x22,0x04,0x82,0x02,0x44,0x40,0x82,0x02,0x80,0x04,0x82,0x07,0x98,0x38,0x40,
+    0x00,0x60,0x0f,0x80,0x82,0x02,0x08,0x08,0x82,0x02,0x07,0xf0,
+    /* "莓" */
+    0x00,0x06,0xa0,0x1f,0x81,0x02,0x3c,0x1e,0x89,0x04,0xff,0xc3,0xe1,0xff,0x84,0x06,0xff,0xc3,0xe1,0xff,0x07,0x80,0x83,0x07,
+    0x3c,0x1e,0x00,0x08,0x7f,0xff,0xfc,0x84,0x05,0x11,0xff,0xff,0xfc,0x22,0x87,0x05,0x43,0xff,0xff,0xf0,0x88,0x83,0x07,0xc0,
+    0x7c,0x7f,0x00,0x30,0x04,0x40,0x82,0x02,0x04,0x30,0x82,0x07,0x83,0x10,0x00,0xf8,0xff,0x1f,0x0f,0x84,0x04,0xf0,0xf0,0xff,
+    0x1f,0x82,0x0e,0x81,0x00,0x01,0x0c,0x60,0x00,0x10,0x02,0x20,0x00,0x01,0xfe,0x3e,0x1e,0x84,0x04,0x1f,0xff,0xfe,0x1e,0x82,
+    0x02,0x02,0x20,0x82,0x01,0xfc,0x84,0x01,0x40,
+    /* "派" */
+    0x00,0x07,0xa0,0x1e,0x01,0x38,0x82,0x13,0x3e,0x44,0x00,0x3f,0xc0,0x43,0x3f,0xc0,0x0e,0x20,0x80,0x1f,0xf0,0x18,0x03,0xe0,
+    0x00,0x04,0x80,0x82,0x01,0x03,0x82,0x01,0x3c,0x82,0x07,0x0f,0xc2,0x70,0x01,0xf0,0x06,0x88,0x82,0x06,0xf8,0x84,0x00,0x18,
+    0x80,0x43,0x83,0x01,0x20,0x82,0x02,0x0e,0x11,0x82,0x02,0x11,0x0e,0x82,0x05,0x61,0x00,0x04,0x00,0x06,0x82,0x03,0x04,0x08,
+    0x1c,0x82,0x03,0x30,0x02,0x40,0x84,0x02,0x02,0x20,0x84,0x04,0x22,0x00,0x01,0x10,0x83,0x05,0x08,0x00,0x88,0x00,0x84,0x82,
+    0x16,0x03,0x00,0x41,0x00,0x0c,0x43,0x04,0x10,0x11,0x20,0x02,0x00,0x06,0x11,0x00,0x22,0x18,0x0e,0x02,0x42,0x20,0x00,
+    /* "A" */
+    0x00,0x08,0x97,0x19,0x81,0x03,0x7c,0x00,0x01,0x83,0x01,0x08,0x84,0x02,0x10,0x10,0x84,0x0a,0x04,0x00,0x01,0x00,0x40,0x00,
+    0x20,0x00,0x08,0x10,0x82,0x03,0x01,0x00,0x02,0x82,0x02,0x80,0x42,0x84,0x05,0x20,0x80,0x08,0x7f,0x08,0x83,0x0c,0x40,0x00,
+    0x10,0x07,0xfc,0x00,0x10,0x00,0x04,0x00,0x08,0x40,0x82,0x06,0x01,0x00,0x10,0x40,0x00,0x01,0x83,
+    /* "a" */
+    0x01,0x0f,0x0f,0x12,0x0f,0xf0,0x7f,0xf9,0xff,0xf3,0xe3,0xf7,0x03,0xe0,0x03,0xc0,0x07,0x83,0xff,0x3f,0xfe,0xfe,0x3f,0xe0,
+    0x7f,0xc0,0xff,0x03,0xff,0x07,0xff,0x3f,0xff,0xff,0x7f,0xfe,0x3f,0x3c,
+    /* "b" */
+    0x02,0x07,0x91,0x1a,0x01,0xf0,0x90,0x0d,0x03,0xf8,0x02,0x03,0x02,0x00,0x40,0x38,0x00,0x22,0x08,0x20,0x80,0x82,0x02,0x10,
+    0x10,0x85,0x02,0x02,0x01,0x84,0x0b,0x20,0x84,0x08,0x80,0x03,0x82,0x00,0x02,0x06,0x06,0x00,
+    /* "c" */
+    0x01,0x0f,0x8e,0x12,0x0a,0x03,0xf8,0x30,0x13,0x00,0x10,0x3c,0x03,0x0e,0x10,0x84,0x01,0x08,0x83,0x01,0x80,0x83,0x0a,0x02,
+    0x10,0x00,0x30,0xd0,0x3c,0x20,0x00,0x60,0x10,
+    /* "微" */
+    0x00,0x06,0xa0,0x1f,0x06,0x03,0x07,0x01,0xe0,0x04,0x80,0x83,0x0a,0x80,0x00,0x20,0x08,0xf0,0x78,0x00,0x11,0x00,0x02,0x84,
+    0x02,0x40,0x22,0x82,0x02,0x7f,0x44,0x83,0x09,0x80,0x00,0x04,0x61,0x0f,0x08,0x80,0x00,0x90,0x83,0x0b,0x60,0xff,0x80,0x02,
+    0x08,0x00,0x70,0x00,0x11,0x00,0x10,0x82,0x10,0x7f,0xe0,0x20,0x20,0x00,0x0c,0x40,0x00,0x7f,0xf0,0x00,0x40,0x00,0x02,0x04,
+    0x80,0x84,0x04,0x7f,0xe0,0x00,0x20,0x83,0x04,0xc0,0x07,0x01,0x08,0x82,0x01,0x0e,0x83,0x01,0x11,0x83,0x15,0x02,0x08,0x00,
+    0x01,0x06,0x04,0x00,0x88,0x0c,0x40,0x00,0x01,0x18,0x22,0x01,0x10,0xe0,0x91,0x01,0x20,0x11,0x82,0x03,0xc0,0x12,0x08,
+    /* "雪" */
+    0x01,0x08,0x9e,0x1c,0x04,0x3f,0xff,0xff,0xf0,0x83,0x04,0x03,0xff,0x87,0xff,0x84,0x04,0xff,0xf8,0x7f,0xfc,0x84,0x03,0xff,
+    0x87,0xfc,0x84,0x04,0x0f,0xf8,0x7f,0xc0,0x83,0x05,0x0f,0xff,0x87,0xff,0xc0,0x83,0x04,0x0f,0xf8,0x7f,0xc0,0x84,0x0b,0xff,
+    0x87,0xfc,0x00,0x01,0xe0,0x00,0x3f,0xff,0xff,0xf0,0x83,0x04,0x03,0xff,0xff,0xf0,0x84,0x03,0x3f,0xff,0xff,0x84,0x04,0x03,
+    0xff,0xff,0xf0,0x87,0x04,0x01,0xff,0xff,0xfc,0x84,0x04,0x1f,0xff,0xff,0xc0,
+    /* "电" */
+    0x01,0x06,0x9f,0x1e,0x81,0x01,0x0f,0x8d,0x04,0x0f,0xff,0x0f,0xff,0x84,0x04,0x03,0xfc,0x3f,0x80,0x94,0x03,0xff,0x0f,0xe0,
+    0x84,0x04,0x03,0xfc,0x3f,0x80,0x94,0x03,0xff,0x0f,0xe0,0x84,0x04,0x03,0xfc,0x3f,0xfb,0x83,0x02,0x01,0xf0,0x8a,0x01,0x80,
+    0x83,0x04,0x10,0x00,0x8f,0xfc,0x82,0x03,0x80,0x00,0x80,
+    /* "子" */
+    0x00,0x08,0xa0,0x1c,0x04,0x1f,0xff,0xff,0xf8,0x84,0x03,0x1f,0xff,0xfe,0x83,0x02,0x06,0x18,0x82,0x02,0x08,0x20,0x82,0x02,
+    0x10,0x40,0x82,0x02,0x21,0x80,0x82,0x01,0xc2,0x82,0x02,0x01,0x04,0x82,0x02,0x02,0x18,0x89,0x04,0xff,0xfc,0x1f,0xff,0x84,
+    0x04,0xff,0xfc,0x1f,0xff,0xaa,0x04,0x20,0x00,0x01,0xfc,0x82,0x04,0x01,0x00,0x40,0x00,
+};
+
+static const uint16_t Font24CN_Offset[] = {
+    0,107,205,324,435,535,640,711,796,885,938,1040,1145,1239,1312,1392,
+    1499,1607,1712,1831,1898,1936,1978,2011,2130,2217,2276,2341,
+};
+
+static const uint8_t Font24CN_Codes[] = {
+    0xe4,0xbd,0xa0,  /* "你" */
+    0xe5,0xa5,0xbd,  /* "好" */
+    0xe5,0xbe,0xae,  /* "微" */
+    0xe8,0xbd,0xaf,  /* "软" */
+    0xe9,0x9b,0x85,  /* "雅" */
+    0xe9,0xbb,0x91,  /* "黑" */
+    0xe6,0xad,0xa4,  /* "此" */
+    0xe5,0xad,0x97,  /* "字" */
+    0xe4,0xbd,0x93,  /* "体" */
+    0xe4,0xb8,0x8b,  /* "下" */
+    0xe5,0xaf,0xb9,  /* "对" */
+    0xe5,0xba,0x94,  /* "应" */
+    0xe7,0x9a,0x84,  /* "的" */
+    0xe7,0x82,0xb9,  /* "点" */
+    0xe9,0x98,0xb5,  /* "阵" */
+    0xe4,0xb8,0xba,  /* "为" */
+    0xe6,0xa0,0x91,  /* "树" */
+    0xe8,0x8e,0x93,  /* "莓" */
+    0xe6,0xb4,0xbe,  /* "派" */
+    0x41,0x00,0x00,  /* "A" */
+    0x61,0x00,0x00,  /* "a" */
+    0x62,0x00,0x00,  /* "b" */
+    0x63,0x00,0x00,  /* "c" */
+    0xe5,0xbe,0xae,  /* "微" */
+    0xe9,0x9b,0xaa,  /* "雪" */
+    0xe7,0x94,0xb5,  /* "电" */
+    0xe5,0xad,0x90,  /* "子" */
+};
+
+const FONT_PACK Font24CN_Pack = {
+  Font24CN_Data,
+  Font24CN_Offset,
+  Font24CN_Codes,
+  27, /* Count */
+  32, /* Width */
+  41, /* Height */
+};
+
+#if FONT_PACKED
+cFONT Font24CN = {
+  NULL,
+  27,  /*size of table*/
+  24, /* ASCII Width */
+  32, /* Width */
+  41, /* Height */
+  &Font24CN_Pack,
+};
+#endif
@@ -74,6 +74,27 @@ const unsigned char LUT_DATA_4Gray[112] =    //112bytes
 0x00,	0x00,	
 };
 
+/**
+ * LUT register layout, uploaded through EPD_Lut_Load()
+**/
+static const EPD_LUT_BLOCK EPD_13IN3K_Partial_Blocks[] = {
+    {0x32, Lut_Partial, 105},
+    {0x03, Lut_Partial + 105, 1},   //gate voltage
+    {0x04, Lut_Partial + 106, 3},   //source voltage
+    {0x2C, Lut_Partial + 109, 1},   //VCOM
+};
+static const EPD_LUT_BLOCK EPD_13IN3K_4Gray_Blocks[] = {
+    {0x32, LUT_DATA_4Gray, 105},
+    {0x03, LUT_DATA_4Gray + 105, 1},
+    {0x04, LUT_DATA_4Gray + 106, 3},
+    {0x2C, LUT_DATA_4Gray + 109, 1},
+};
+const EPD_LUT_WAVEFORM EPD_13IN3K_WF_Partial = EPD_LUT_WAVEFORM_DEF("13in3k-partial", EPD_13IN3K_Partial_Blocks);
+const EPD_LUT_WAVEFORM EPD_13IN3K_WF_4Gray = EPD_LUT_WAVEFORM_DEF("13in3k-4gray", EPD_13IN3K_4Gray_Blocks);
+
+EPD_LUT_SLOT EPD_13IN3K_LutSlot;
+static const EPD_LUT_WAVEFORM *EPD_13IN3K_PartWaveform = &EPD_13IN3K_WF_Partial;
+
 /******************************************************************************
 function :	Software reset
 parameter:
@@ -86,6 +107,7 @@ static void EPD_13IN3K_Reset(void)
     DEV_Delay_ms(2);
     DEV_Digital_Write(EPD_RST_PIN, 1);
     DEV_Delay_ms(100);
+    EPD_Lut_Invalidate(&EPD_13IN3K_LutSlot);
 }
 
 /******************************************************************************
@@ -159,26 +181,6 @@ static void EPD_13IN3K_TurnOnDisplay_4GRAY(void)
 	EPD_13IN3K_ReadBusy();
 }
 
-static void EPD_13IN3K_Lut(const UBYTE *LUT)
-{
-    unsigned int count;
-    EPD_13IN3K_SendCommand(0x32);
-    for(count = 0; count < 105 ; count++) {
-        EPD_13IN3K_SendData(LUT[count]);
-    }
-
-    EPD_13IN3K_SendCommand(0x03);
-	EPD_13IN3K_SendData(LUT[105]);
-
-	EPD_13IN3K_SendCommand(0x04);  
-	EPD_13IN3K_SendData(LUT[106]);
-	EPD_13IN3K_SendData(LUT[107]);
-	EPD_13IN3K_SendData(LUT[108]); 
-
-	EPD_13IN3K_SendCommand(0x2C);
-	EPD_13IN3K_SendData(LUT[109]);
-}
-
 /******************************************************************************
 function :	Setting the display window
 parameter:
@@ -213,6 +215,18 @@ static void EPD_13IN3K_SetCursor(UWORD Xstart, UWORD Ystart)
     EPD_13IN3K_SendData((Ystart>>8) & 0x03);
 }
 
+/******************************************************************************
+function :	Replace the partial refresh waveform
+parameter:
+    Waveform : Registered or driver waveform, NULL restores the default
+info:
+    Takes effect with the next EPD_13IN3K_Init_Part()
+******************************************************************************/
+void EPD_13IN3K_SetPartWaveform(const EPD_LUT_WAVEFORM *Waveform)
+{
+    EPD_13IN3K_PartWaveform = Waveform ? Waveform : &EPD_13IN3K_WF_Partial;
+}
+
 /******************************************************************************
 function :	Initialize the e-Paper register
 parameter:
@@ -266,7 +280,7 @@ void EPD_13IN3K_Init_Part(void)
 	EPD_13IN3K_SendCommand(0x3C);        // Border       Border setting 
 	EPD_13IN3K_SendData(0x80);
 
-    EPD_13IN3K_Lut(Lut_Partial);
+    EPD_Lut_Load(&EPD_13IN3K_LutSlot, EPD_13IN3K_PartWaveform, &EPD_LUT_IO_DEV);
 
     EPD_13IN3K_SendCommand(0x37); 
     EPD_13IN3K_SendData(0x00);  
@@ -324,7 +338,7 @@ void EPD_13IN3K_Init_4GRAY(void)
 	
 	EPD_13IN3K_SetCursor(0, 0);
 
-    EPD_13IN3K_Lut(LUT_DATA_4Gray);
+    EPD_Lut_Load(&EPD_13IN3K_LutSlot, &EPD_13IN3K_WF_4Gray, &EPD_LUT_IO_DEV);
 	
 	EPD_13IN3K_ReadBusy();
 }
@@ -32,6 +32,7 @@
 #define __EPD_13IN3K_H_
 
 #include "DEV_Config.h"
+#include "EPD_Lut.h"
 
 // Display resolution
 #define EPD_13IN3K_WIDTH       960
@@ -50,4 +51,10 @@ void EPD_13IN3K_Display_Part(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD l);
 void EPD_13IN3K_4GrayDisplay(UBYTE *Image);
 void EPD_13IN3K_Sleep(void);
 
+extern const EPD_LUT_WAVEFORM EPD_13IN3K_WF_Partial;
+extern const EPD_LUT_WAVEFORM EPD_13IN3K_WF_4Gray;
+extern EPD_LUT_SLOT EPD_13IN3K_LutSlot;
+
+void EPD_13IN3K_SetPartWaveform(const EPD_LUT_WAVEFORM *Waveform);
+
 #endif
@@ -164,6 +164,28 @@ static const unsigned char EPD_2IN13D_lut_bb1[] = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
+/**
+ * LUT register layout, uploaded through EPD_Lut_Load()
+**/
+static const EPD_LUT_BLOCK EPD_2IN13D_Partial_Blocks[] = {
+	{0x20, EPD_2IN13D_lut_vcom1, 44},
+	{0x21, EPD_2IN13D_lut_ww1, 42},
+	{0x22, EPD_2IN13D_lut_bw1, 42},
+	{0x23, EPD_2IN13D_lut_wb1, 42},
+	{0x24, EPD_2IN13D_lut_bb1, 42},
+};
+static const EPD_LUT_BLOCK EPD_2IN13D_Full_Blocks[] = {
+	{0x20, EPD_2IN13D_lut_vcomDC, 44},
+	{0x21, EPD_2IN13D_lut_ww, 42},
+	{0x22, EPD_2IN13D_lut_bw, 42},
+	{0x23, EPD_2IN13D_lut_wb, 42},
+	{0x24, EPD_2IN13D_lut_bb, 42},
+};
+const EPD_LUT_WAVEFORM EPD_2IN13D_WF_Full = EPD_LUT_WAVEFORM_DEF("2in13d-full", EPD_2IN13D_Full_Blocks);
+const EPD_LUT_WAVEFORM EPD_2IN13D_WF_Partial = EPD_LUT_WAVEFORM_DEF("2in13d-partial", EPD_2IN13D_Partial_Blocks);
+
+EPD_LUT_SLOT EPD_2IN13D_LutSlot;
+static const EPD_LUT_WAVEFORM *EPD_2IN13D_PartWaveform = &EPD_2IN13D_WF_Partial;
 
 /******************************************************************************
 function :	Software reset
@@ -177,6 +199,7 @@ static void EPD_2IN13D_Reset(void)
 	DEV_Delay_ms(200);
 	DEV_Digital_Write(EPD_RST_PIN, 1);
 	DEV_Delay_ms(200);
+	EPD_Lut_Invalidate(&EPD_2IN13D_LutSlot);
 }
 
 /******************************************************************************
@@ -231,31 +254,7 @@ static void EPD_2IN13D_SetFullReg(void)
 	EPD_2IN13D_SendCommand(0X50);			//VCOM AND DATA INTERVAL SETTING
 	EPD_2IN13D_SendData(0xb7);		//WBmode:VBDF 17|D7 VBDW 97 VBDB 57		WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
 
-	unsigned int count;
-	EPD_2IN13D_SendCommand(0x20);
-	for(count=0; count<44; count++) {
-		EPD_2IN13D_SendData(EPD_2IN13D_lut_vcomDC[count]);
-	}
-
-	EPD_2IN13D_SendCommand(0x21);
-	for(count=0; count<42; count++) {
-		EPD_2IN13D_SendData(EPD_2IN13D_lut_ww[count]);
-	}
-
-	EPD_2IN13D_SendCommand(0x22);
-	for(count=0; count<42; count++) {
-		EPD_2IN13D_SendData(EPD_2IN13D_lut_bw[count]);
-	}
-
-	EPD_2IN13D_SendCommand(0x23);
-	for(count=0; count<42; count++) {
-		EPD_2IN13D_SendData(EPD_2IN13D_lut_wb[count]);
-	}
-
-	EPD_2IN13D_SendCommand(0x24);
-	for(count=0; count<42; count++) {
-		EPD_2IN13D_SendData(EPD_2IN13D_lut_bb[count]);
-	}
+	EPD_Lut_Load(&EPD_2IN13D_LutSlot, &EPD_2IN13D_WF_Full, &EPD_LUT_IO_DEV);
 }
 
 /******************************************************************************
@@ -269,31 +268,19 @@ static void EPD_2IN13D_SetPartReg(void)
 	EPD_2IN13D_SendCommand(0X50);
 	EPD_2IN13D_SendData(0xb7);
 
-	unsigned int count;
-	EPD_2IN13D_SendCommand(0x20);
-	for(count=0; count<44; count++) {
-		EPD_2IN13D_SendData(EPD_2IN13D_lut_vcom1[count]);
-	}
-
-	EPD_2IN13D_SendCommand(0x21);
-	for(count=0; count<42; count++) {
-		EPD_2IN13D_SendData(EPD_2IN13D_lut_ww1[count]);
-	}
-
-	EPD_2IN13D_SendCommand(0x22);
-	for(count=0; count<42; count++) {
-		EPD_2IN13D_SendData(EPD_2IN13D_lut_bw1[count]);
-	}
-
-	EPD_2IN13D_SendCommand(0x23);
-	for(count=0; count<42; count++) {
-		EPD_2IN13D_SendData(EPD_2IN13D_lut_wb1[count]);
-	}
+	EPD_Lut_Load(&EPD_2IN13D_LutSlot, EPD_2IN13D_PartWaveform, &EPD_LUT_IO_DEV);
+}
 
-	EPD_2IN13D_SendCommand(0x24);
-	for(count=0; count<42; count++) {
-		EPD_2IN13D_SendData(EPD_2IN13D_lut_bb1[count]);
-	}
+/******************************************************************************
+function :	Replace the partial refresh waveform
+parameter:
+    Waveform : Registered or driver waveform, NULL restores the default
+info:
+    Takes effect with the next EPD_2IN13D_DisplayPart()
+******************************************************************************/
+void EPD_2IN13D_SetPartWaveform(const EPD_LUT_WAVEFORM *Waveform)
+{
+	EPD_2IN13D_PartWaveform = Waveform ? Waveform : &EPD_2IN13D_WF_Partial;
 }
 
 /******************************************************************************
@@ -64,6 +64,7 @@
 #define __EPD_2IN13D_H_
 
 #include "DEV_Config.h"
+#include "EPD_Lut.h"
 
 // Display resolution
 #define EPD_2IN13D_WIDTH   104
@@ -75,4 +76,10 @@ void EPD_2IN13D_Display(UBYTE *Image);
 void EPD_2IN13D_DisplayPart(UBYTE *Image);
 void EPD_2IN13D_Sleep(void);
 
+extern const EPD_LUT_WAVEFORM EPD_2IN13D_WF_Full;
+extern const EPD_LUT_WAVEFORM EPD_2IN13D_WF_Partial;
+extern EPD_LUT_SLOT EPD_2IN13D_LutSlot;
+
+void EPD_2IN13D_SetPartWaveform(const EPD_LUT_WAVEFORM *Waveform);
+
 #endif
@@ -192,6 +192,29 @@ static const unsigned char EPD_2in7_gray_lut_bb[] = {
     0x00	,0x00	,0x00	,0x00	,0x00	,0x00,
 };
 
+/**
+ * LUT register layout, uploaded through EPD_Lut_Load()
+**/
+static const EPD_LUT_BLOCK EPD_2in7_Full_Blocks[] = {
+    {0x20, EPD_2in7_lut_vcom_dc, 44},   //vcom
+    {0x21, EPD_2in7_lut_ww, 42},        //ww --
+    {0x22, EPD_2in7_lut_bw, 42},        //bw r
+    {0x23, EPD_2in7_lut_bb, 42},        //wb w
+    {0x24, EPD_2in7_lut_wb, 42},        //bb b
+};
+static const EPD_LUT_BLOCK EPD_2in7_4Gray_Blocks[] = {
+    {0x20, EPD_2in7_gray_lut_vcom, 44}, //vcom
+    {0x21, EPD_2in7_gray_lut_ww, 42},   //red not use
+    {0x22, EPD_2in7_gray_lut_bw, 42},   //bw r
+    {0x23, EPD_2in7_gray_lut_wb, 42},   //wb w
+    {0x24, EPD_2in7_gray_lut_bb, 42},   //bb b
+    {0x25, EPD_2in7_gray_lut_ww, 42},   //vcom
+};
+const EPD_LUT_WAVEFORM EPD_2IN7_WF_Full = EPD_LUT_WAVEFORM_DEF("2in7-full", EPD_2in7_Full_Blocks);
+const EPD_LUT_WAVEFORM EPD_2IN7_WF_4Gray = EPD_LUT_WAVEFORM_DEF("2in7-4gray", EPD_2in7_4Gray_Blocks);
+
+EPD_LUT_SLOT EPD_2IN7_LutSlot;
+
 /******************************************************************************
 function :	Software reset
 parameter:
@@ -204,6 +227,7 @@ static void EPD_2in7_Reset(void)
     DEV_Delay_ms(10);
     DEV_Digital_Write(EPD_RST_PIN, 1);
     DEV_Delay_ms(200);
+    EPD_Lut_Invalidate(&EPD_2IN7_LutSlot);
 }
 
 /******************************************************************************
@@ -255,66 +279,12 @@ parameter:
 ******************************************************************************/
 static void EPD_2in7_SetLut(void)
 {
-    unsigned int count;
-    EPD_2in7_SendCommand(0x20); //vcom
-    for(count = 0; count < 44; count++) {
-        EPD_2in7_SendData(EPD_2in7_lut_vcom_dc[count]);
-    }
-
-    EPD_2in7_SendCommand(0x21); //ww --
-    for(count = 0; count < 42; count++) {
-        EPD_2in7_SendData(EPD_2in7_lut_ww[count]);
-    }
-
-    EPD_2in7_SendCommand(0x22); //bw r
-    for(count = 0; count < 42; count++) {
-        EPD_2in7_SendData(EPD_2in7_lut_bw[count]);
-    }
-
-    EPD_2in7_SendCommand(0x23); //wb w
-    for(count = 0; count < 42; count++) {
-        EPD_2in7_SendData(EPD_2in7_lut_bb[count]);
-    }
-
-    EPD_2in7_SendCommand(0x24); //bb b
-    for(count = 0; count < 42; count++) {
-        EPD_2in7_SendData(EPD_2in7_lut_wb[count]);
-    }
+    EPD_Lut_Load(&EPD_2IN7_LutSlot, &EPD_2IN7_WF_Full, &EPD_LUT_IO_DEV);
 }
 
 void EPD_2in7_gray_SetLut(void)
 {
-    unsigned int count;
-    EPD_2in7_SendCommand(0x20);							//vcom
-    for(count=0; count<44; count++) {
-        EPD_2in7_SendData(EPD_2in7_gray_lut_vcom[count]);
-    }
-
-    EPD_2in7_SendCommand(0x21);							//red not use
-    for(count=0; count<42; count++) {
-        EPD_2in7_SendData(EPD_2in7_gray_lut_ww[count]);
-    }
-
-    EPD_2in7_SendCommand(0x22);							//bw r
-    for(count=0; count<42; count++) {
-        EPD_2in7_SendData(EPD_2in7_gray_lut_bw[count]);
-    }
-
-    EPD_2in7_SendCommand(0x23);							//wb w
-    for(count=0; count<42; count++) {
-        EPD_2in7_SendData(EPD_2in7_gray_lut_wb[count]);
-    }
-
-    EPD_2in7_SendCommand(0x24);							//bb b
-    for(count=0; count<42; count++) {
-        EPD_2in7_SendData(EPD_2in7_gray_lut_bb[count]);
-    }
-
-    EPD_2in7_SendCommand(0x25);							//vcom
-    for(count=0; count<42; count++) {
-        EPD_2in7_SendData(EPD_2in7_gray_lut_ww[count]);
-    }
-
+    EPD_Lut_Load(&EPD_2IN7_LutSlot, &EPD_2IN7_WF_4Gray, &EPD_LUT_IO_DEV);
 }
 
 /******************************************************************************
@@ -94,6 +94,7 @@
 #define __EPD_2IN7_H_
 
 #include "DEV_Config.h"
+#include "EPD_Lut.h"
 
 // Display resolution
 #define EPD_2IN7_WIDTH       176
@@ -108,4 +109,8 @@ void EPD_2IN7_Sleep(void);
 
 void EPD_2IN7_Init_4Gray(void);
 void EPD_2IN7_4GrayDisplay(const UBYTE *Image);
+
+extern const EPD_LUT_WAVEFORM EPD_2IN7_WF_Full;
+extern const EPD_LUT_WAVEFORM EPD_2IN7_WF_4Gray;
+extern EPD_LUT_SLOT EPD_2IN7_LutSlot;
 #endif
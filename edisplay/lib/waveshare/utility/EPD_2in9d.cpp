@@ -104,6 +104,20 @@ const unsigned char EPD_2IN9D_lut_bb1[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
+/**
+ * LUT register layout, uploaded through EPD_Lut_Load()
+**/
+static const EPD_LUT_BLOCK EPD_2IN9D_Partial_Blocks[] = {
+    {0x20, EPD_2IN9D_lut_vcom1, 44},
+    {0x21, EPD_2IN9D_lut_ww1, 42},
+    {0x22, EPD_2IN9D_lut_bw1, 42},
+    {0x23, EPD_2IN9D_lut_wb1, 42},
+    {0x24, EPD_2IN9D_lut_bb1, 42},
+};
+const EPD_LUT_WAVEFORM EPD_2IN9D_WF_Partial = EPD_LUT_WAVEFORM_DEF("2in9d-partial", EPD_2IN9D_Partial_Blocks);
+
+EPD_LUT_SLOT EPD_2IN9D_LutSlot;
+static const EPD_LUT_WAVEFORM *EPD_2IN9D_PartWaveform = &EPD_2IN9D_WF_Partial;
 
 /******************************************************************************
 function :	Software reset
@@ -125,6 +139,7 @@ static void EPD_2IN9D_Reset(void)
     DEV_Delay_ms(2);
     DEV_Digital_Write(EPD_RST_PIN, 1);
     DEV_Delay_ms(20);
+    EPD_Lut_Invalidate(&EPD_2IN9D_LutSlot);
 }
 
 /******************************************************************************
@@ -209,31 +224,19 @@ static void EPD_2IN9D_SetPartReg(void)
     EPD_2IN9D_SendCommand(0X50);
     EPD_2IN9D_SendData(0x97);
 	
-    unsigned int count;
-    EPD_2IN9D_SendCommand(0x20);
-    for(count=0; count<44; count++) {
-        EPD_2IN9D_SendData(EPD_2IN9D_lut_vcom1[count]);
-    }
-
-    EPD_2IN9D_SendCommand(0x21);
-    for(count=0; count<42; count++) {
-        EPD_2IN9D_SendData(EPD_2IN9D_lut_ww1[count]);
-    }
-
-    EPD_2IN9D_SendCommand(0x22);
-    for(count=0; count<42; count++) {
-        EPD_2IN9D_SendData(EPD_2IN9D_lut_bw1[count]);
-    }
-
-    EPD_2IN9D_SendCommand(0x23);
-    for(count=0; count<42; count++) {
-        EPD_2IN9D_SendData(EPD_2IN9D_lut_wb1[count]);
-    }
+    EPD_Lut_Load(&EPD_2IN9D_LutSlot, EPD_2IN9D_PartWaveform, &EPD_LUT_IO_DEV);
+}
 
-    EPD_2IN9D_SendCommand(0x24);
-    for(count=0; count<42; count++) {
-        EPD_2IN9D_SendData(EPD_2IN9D_lut_bb1[count]);
-    }
+/******************************************************************************
+function :	Replace the partial refresh waveform
+parameter:
+    Waveform : Registered or driver waveform, NULL restores the default
+info:
+    Takes effect with the next EPD_2IN9D_DisplayPart()
+******************************************************************************/
+void EPD_2IN9D_SetPartWaveform(const EPD_LUT_WAVEFORM *Waveform)
+{
+    EPD_2IN9D_PartWaveform = Waveform ? Waveform : &EPD_2IN9D_WF_Partial;
 }
 
 /******************************************************************************
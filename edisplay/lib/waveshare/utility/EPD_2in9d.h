@@ -55,6 +55,7 @@
 #define __EPD_2IN9D_H_
 
 #include "DEV_Config.h"
+#include "EPD_Lut.h"
 
 // Display resolution
 #define EPD_2IN9D_WIDTH   128
@@ -66,4 +67,9 @@ void EPD_2IN9D_Display(UBYTE *Image);
 void EPD_2IN9D_DisplayPart(UBYTE *Image);
 void EPD_2IN9D_Sleep(void);
 
+extern const EPD_LUT_WAVEFORM EPD_2IN9D_WF_Partial;
+extern EPD_LUT_SLOT EPD_2IN9D_LutSlot;
+
+void EPD_2IN9D_SetPartWaveform(const EPD_LUT_WAVEFORM *Waveform);
+
 #endif
@@ -271,6 +271,38 @@ const unsigned char EPD_4IN2_4Gray_lut_bb[] ={
     0x00 ,0x00 ,0x00 ,0x00 ,0x00 ,0x00,
 };
 
+/**
+ * LUT register layout, uploaded through EPD_Lut_Load()
+**/
+static const EPD_LUT_BLOCK EPD_4IN2_Fast_Blocks[] = {
+	{0x20, EPD_4IN2_lut_vcom0, 36},
+	{0x21, EPD_4IN2_lut_ww, 36},
+	{0x22, EPD_4IN2_lut_bw, 36},
+	{0x23, EPD_4IN2_lut_wb, 36},
+	{0x24, EPD_4IN2_lut_bb, 36},
+};
+static const EPD_LUT_BLOCK EPD_4IN2_Partial_Blocks[] = {
+	{0x20, EPD_4IN2_Partial_lut_vcom1, 44},
+	{0x21, EPD_4IN2_Partial_lut_ww1, 42},
+	{0x22, EPD_4IN2_Partial_lut_bw1, 42},
+	{0x23, EPD_4IN2_Partial_lut_wb1, 42},
+	{0x24, EPD_4IN2_Partial_lut_bb1, 42},
+};
+static const EPD_LUT_BLOCK EPD_4IN2_4Gray_Blocks[] = {
+	{0x20, EPD_4IN2_4Gray_lut_vcom, 42},	//vcom
+	{0x21, EPD_4IN2_4Gray_lut_ww, 42},		//red not use
+	{0x22, EPD_4IN2_4Gray_lut_bw, 42},		//bw r
+	{0x23, EPD_4IN2_4Gray_lut_wb, 42},		//wb w
+	{0x24, EPD_4IN2_4Gray_lut_bb, 42},		//bb b
+	{0x25, EPD_4IN2_4Gray_lut_ww, 42},		//vcom
+};
+const EPD_LUT_WAVEFORM EPD_4IN2_WF_Fast = EPD_LUT_WAVEFORM_DEF("4in2-fast", EPD_4IN2_Fast_Blocks);
+const EPD_LUT_WAVEFORM EPD_4IN2_WF_Partial = EPD_LUT_WAVEFORM_DEF("4in2-partial", EPD_4IN2_Partial_Blocks);
+const EPD_LUT_WAVEFORM EPD_4IN2_WF_4Gray = EPD_LUT_WAVEFORM_DEF("4in2-4gray", EPD_4IN2_4Gray_Blocks);
+
+EPD_LUT_SLOT EPD_4IN2_LutSlot;
+static const EPD_LUT_WAVEFORM *EPD_4IN2_PartWaveform = &EPD_4IN2_WF_Partial;
+
 /******************************************************************************
 function :	Software reset
 parameter:
@@ -291,6 +323,7 @@ static void EPD_4IN2_Reset(void)
     DEV_Delay_ms(10);
     DEV_Digital_Write(EPD_RST_PIN, 1);
     DEV_Delay_ms(10);
+    EPD_Lut_Invalidate(&EPD_4IN2_LutSlot);
 }
 
 /******************************************************************************
@@ -351,82 +384,32 @@ parameter:
 ******************************************************************************/
 static void EPD_4IN2_Partial_SetLut(void)
 {
-	unsigned int count;
-	EPD_4IN2_SendCommand(0x20);
-	for(count=0;count<44;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_Partial_lut_vcom1[count]);}
-
-	EPD_4IN2_SendCommand(0x21);
-	for(count=0;count<42;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_Partial_lut_ww1[count]);}   
-	
-	EPD_4IN2_SendCommand(0x22);
-	for(count=0;count<42;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_Partial_lut_bw1[count]);} 
-
-	EPD_4IN2_SendCommand(0x23);
-	for(count=0;count<42;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_Partial_lut_wb1[count]);} 
-
-	EPD_4IN2_SendCommand(0x24);
-	for(count=0;count<42;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_Partial_lut_bb1[count]);} 
+	EPD_Lut_Load(&EPD_4IN2_LutSlot, EPD_4IN2_PartWaveform, &EPD_LUT_IO_DEV);
 }
 
 static void EPD_4IN2_SetLut(void)
 {
-	unsigned int count;
-	EPD_4IN2_SendCommand(0x20);
-	for(count=0;count<36;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_lut_vcom0[count]);}
-
-	EPD_4IN2_SendCommand(0x21);
-	for(count=0;count<36;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_lut_ww[count]);}   
-	
-	EPD_4IN2_SendCommand(0x22);
-	for(count=0;count<36;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_lut_bw[count]);} 
-
-	EPD_4IN2_SendCommand(0x23);
-	for(count=0;count<36;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_lut_wb[count]);} 
-
-	EPD_4IN2_SendCommand(0x24);
-	for(count=0;count<36;count++)	     
-		{EPD_4IN2_SendData(EPD_4IN2_lut_bb[count]);}   
+	EPD_Lut_Load(&EPD_4IN2_LutSlot, &EPD_4IN2_WF_Fast, &EPD_LUT_IO_DEV);
 }
 
 //LUT download
 static void EPD_4IN2_4Gray_lut(void)
 {
-	unsigned int count;	 
-	{
-		EPD_4IN2_SendCommand(0x20);							//vcom
-		for(count=0;count<42;count++)
-			{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_vcom[count]);}
-		
-	EPD_4IN2_SendCommand(0x21);							//red not use
-	for(count=0;count<42;count++)
-		{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_ww[count]);}
-
-		EPD_4IN2_SendCommand(0x22);							//bw r
-		for(count=0;count<42;count++)
-			{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_bw[count]);}
-
-		EPD_4IN2_SendCommand(0x23);							//wb w
-		for(count=0;count<42;count++)
-			{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_wb[count]);}
-
-		EPD_4IN2_SendCommand(0x24);							//bb b
-		for(count=0;count<42;count++)
-			{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_bb[count]);}
-
-		EPD_4IN2_SendCommand(0x25);							//vcom
-		for(count=0;count<42;count++)
-			{EPD_4IN2_SendData(EPD_4IN2_4Gray_lut_ww[count]);}
-	}	         
+	EPD_Lut_Load(&EPD_4IN2_LutSlot, &EPD_4IN2_WF_4Gray, &EPD_LUT_IO_DEV);
 }
+
+/******************************************************************************
+function :	Replace the partial refresh waveform
+parameter:
+    Waveform : Registered or driver waveform, NULL restores the default
+info:
+    Takes effect with the next EPD_4IN2_Init_Partial()
+******************************************************************************/
+void EPD_4IN2_SetPartWaveform(const EPD_LUT_WAVEFORM *Waveform)
+{
+    EPD_4IN2_PartWaveform = Waveform ? Waveform : &EPD_4IN2_WF_Partial;
+}
+
 /******************************************************************************
 function :	Initialize the e-Paper register
 parameter:
@@ -113,6 +113,7 @@
 #define _EPD_4IN2_H_
 
 #include "DEV_Config.h"
+#include "EPD_Lut.h"
 
 // Display resolution
 #define EPD_4IN2_WIDTH       400
@@ -128,5 +129,12 @@ void EPD_4IN2_PartialDisplay(UWORD X_start,UWORD Y_start,UWORD X_end,UWORD Y_end
 void EPD_4IN2_Init_4Gray(void);
 void EPD_4IN2_4GrayDisplay(const UBYTE *Image);
 
+extern const EPD_LUT_WAVEFORM EPD_4IN2_WF_Fast;
+extern const EPD_LUT_WAVEFORM EPD_4IN2_WF_Partial;
+extern const EPD_LUT_WAVEFORM EPD_4IN2_WF_4Gray;
+extern EPD_LUT_SLOT EPD_4IN2_LutSlot;
+
+void EPD_4IN2_SetPartWaveform(const EPD_LUT_WAVEFORM *Waveform);
+
 
 #endif
@@ -27,7 +27,7 @@
 # THE SOFTWARE.
 #
 ******************************************************************************/
-#include "EPD_5IN83_V2.h"
+#include "EPD_5in83_V2.h"
 #include "Debug.h"
 
 /******************************************************************************
@@ -0,0 +1,81 @@
+// LVGL's memory hooks on mem_pool, see mem_pool.h. lv_conf.h picks
+// LV_STDLIB_CUSTOM for them when MEM_POOLS is set.
+
+#include <lvgl.h>
+#include "mem_pool.h"
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+
+// lv_init() allocates right after this, so the pools LVGL uses are reserved here
+void lv_mem_init(void) {
+    mem_pool_stats_t stats;
+    mem_pool_get_stats(MEM_POOL_WIDGETS, &stats);
+    if (!stats.size)
+        mem_pool_reserve(MEM_POOL_WIDGETS, MEM_POOL_WIDGETS_SIZE);
+    mem_pool_get_stats(MEM_POOL_TRANSIENT, &stats);
+    if (!stats.size)
+        mem_pool_reserve(MEM_POOL_TRANSIENT, MEM_POOL_TRANSIENT_SIZE);
+}
+
+void lv_mem_deinit(void) {
+}
+
+lv_mem_pool_t lv_mem_add_pool(void *mem, size_t bytes) {
+    LV_UNUSED(mem);
+    LV_UNUSED(bytes);
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool) {
+    LV_UNUSED(pool);
+}
+
+void *lv_malloc_core(size_t size) {
+    return mem_pool_alloc(MEM_POOL_WIDGETS, size);
+}
+
+void *lv_realloc_core(void *p, size_t new_size) {
+    return mem_pool_realloc(MEM_POOL_WIDGETS, p, new_size);
+}
+
+void lv_free_core(void *p) {
+    mem_pool_free(p);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t *mon_p) {
+    mem_pool_stats_t stats;
+    mem_pool_get_stats(MEM_POOL_WIDGETS, &stats);
+    mon_p->total_size = stats.size;
+    mon_p->free_cnt = stats.free_blocks;
+    mon_p->free_size = stats.free_bytes;
+    mon_p->free_biggest_size = stats.largest_free;
+    mon_p->used_cnt = stats.blocks;
+    mon_p->max_used = stats.peak;
+    mon_p->used_pct = stats.size ? (uint8_t)((uint64_t)stats.used * 100 / stats.size) : 0;
+    mon_p->frag_pct = mem_pool_fragmentation(&stats);
+}
+
+lv_result_t lv_mem_test_core(void) {
+    return mem_pool_check() ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+// Room to align the buffer afterwards, like LVGL's own handler
+static void *draw_buf_malloc(size_t size, lv_color_format_t color_format) {
+    LV_UNUSED(color_format);
+    return mem_pool_alloc(MEM_POOL_TRANSIENT, size + LV_DRAW_BUF_ALIGN - 1);
+}
+
+static void draw_buf_free(void *buf) {
+    mem_pool_free(buf);
+}
+
+void mem_pool_lvgl_init() {
+    lv_draw_buf_handlers_t *handlers[] = {lv_draw_buf_get_handlers(), lv_draw_buf_get_font_handlers(),
+                                          lv_draw_buf_get_image_handlers()};
+    for (lv_draw_buf_handlers_t *h : handlers) {
+        h->buf_malloc_cb = draw_buf_malloc;
+        h->buf_free_cb = draw_buf_free;
+    }
+}
+
+#endif
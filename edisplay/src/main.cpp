@@ -3,7 +3,10 @@
 #include <DEV_Config.h>
 #include <EPD.h>
 #include <GUI_Paint.h>
+#include <EPD_Power.h>
 #include "ui/ui.h"
+#include "profiler.h"
+#include "mem_pool.h"
 
 // Display configuration
 static const uint16_t screenWidth = EPD_7IN5_V2_WIDTH;   // 800
@@ -17,6 +20,24 @@ UWORD Imagesize;
 static lv_color_t *buf1 = nullptr;
 static const size_t buffer_pixels = screenWidth * 20; // 20 rows buffer
 
+// Frame buffers get a pool region each, sized to hold exactly that frame
+static UBYTE *frame_alloc(UWORD size)
+{
+#if MEM_POOLS
+  mem_pool_reserve(MEM_POOL_FRAME, MEM_POOL_FIT(size));
+  return (UBYTE *)mem_pool_alloc(MEM_POOL_FRAME, size);
+#else
+  return (UBYTE *)malloc(size);
+#endif
+}
+
+#if MEM_POOLS
+static void mem_print(const char *line)
+{
+  Serial.print(line);
+}
+#endif
+
 // LVGL log callback
 void log_print(lv_log_level_t level, const char *buf)
 {
@@ -30,10 +51,95 @@ static bool display_needs_update = false;
 static unsigned long last_display_update = 0;
 const unsigned long DISPLAY_UPDATE_INTERVAL = 3000; // 3 seconds
 
+// Panel power state: booster kept on between close updates, deep sleep for long idles
+static EPD_PWR epd_power;
+
+// 1: panel refreshes run in a task on the other core while LVGL keeps
+// rendering into BlackImage, 0: loop() refreshes the panel itself
+#ifndef EPD_FLUSH_TASK
+#define EPD_FLUSH_TASK 0
+#endif
+
+#ifdef PROFILER
+// Probe ids index prof_probes; the parents give prof_report its tree. In
+// EPD_FLUSH_TASK builds the panel refresh runs in its own task, a root.
+enum { PROF_LOOP, PROF_TIMER_HANDLER, PROF_RENDER, PROF_FLUSH, PROF_UI_TICK, PROF_EPD_REFRESH };
+static const prof_probe_t prof_probes[] = {
+  {"loop", -1}, {"lv_timer_handler", PROF_LOOP}, {"render", PROF_TIMER_HANDLER},
+  {"flush", PROF_RENDER}, {"ui_tick", PROF_LOOP}, {"epd_refresh", EPD_FLUSH_TASK ? -1 : PROF_LOOP},
+};
+
+// One render pass, flushes included
+static void prof_render_cb(lv_event_t *e)
+{
+  if (lv_event_get_code(e) == LV_EVENT_RENDER_START)
+    PROF_MARK(PROF_RENDER);
+  else
+    PROF_MARK_END(PROF_RENDER);
+}
+#endif
+
+#if EPD_FLUSH_TASK
+// Frame handed to the refresh task. loop() copies BlackImage into it only
+// after taking refresh_idle, and the task owns it until it gives
+// refresh_idle back; EPD_7IN5_V2_Display() inverts it in place, so the
+// copy also keeps BlackImage intact for the next partial renders.
+// Everything that talks to the panel, EPD_Power included, runs in the task.
+static UBYTE *SendImage;
+static QueueHandle_t refresh_queue;       // one slot: time the frame was queued
+static SemaphoreHandle_t refresh_idle;
+
+// Per-frame timing, printed when the next frame is handed over
+static volatile bool refreshing = false;
+static volatile uint32_t refresh_ms = 0;  // panel time in the task
+static uint32_t render_ms = 0;            // LVGL render time while refreshing
+static unsigned long render_start = 0;
+
+static void refresh_task(void *arg)
+{
+  uint32_t queued_at;
+  for (;;)
+  {
+    // Between frames step the panel down once the idle outlasts the break-even time
+    if (xQueueReceive(refresh_queue, &queued_at, pdMS_TO_TICKS(100)) != pdTRUE)
+    {
+      EPD_Power_Poll(&epd_power);
+      continue;
+    }
+
+    uint32_t start = millis();
+    EPD_PWR_STATE woken_from = EPD_Power_Acquire(&epd_power);
+    PROF_BEGIN(PROF_EPD_REFRESH);
+    EPD_7IN5_V2_Display(SendImage);
+    PROF_END(PROF_EPD_REFRESH);
+    EPD_PWR_STATE idle = EPD_Power_Release(&epd_power, 0);
+    refresh_ms = millis() - start;
+
+    Serial.printf("Display update complete (queued %lu ms, woke from %s, idling %s)\n", (unsigned long)(start - queued_at),
+                  EPD_Power_StateName(woken_from), EPD_Power_StateName(idle));
+    refreshing = false;
+    xSemaphoreGive(refresh_idle);
+  }
+}
+
+// LVGL render time that overlapped a panel refresh on the other core
+static void render_timing_cb(lv_event_t *e)
+{
+  if (lv_event_get_code(e) == LV_EVENT_REFR_START)
+    render_start = millis();
+  else if (refreshing)
+    render_ms += millis() - render_start;
+}
+#endif
+
 // LVGL flush callback - integrates with proven Waveshare library
 void display_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
 {
+#ifdef FLUSH_LOG
+  // Ahead of the probe, which would otherwise mostly time the UART
   Serial.printf("LVGL flush: x1:%d y1:%d x2:%d y2:%d\n", area->x1, area->y1, area->x2, area->y2);
+#endif
+  PROF_BEGIN(PROF_FLUSH);
 
   int16_t width = area->x2 - area->x1 + 1;
   int16_t height = area->y2 - area->y1 + 1;
@@ -42,12 +148,10 @@ void display_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map
   {
     Serial.println("Invalid area dimensions");
     lv_display_flush_ready(disp);
+    PROF_END(PROF_FLUSH);
     return;
   }
 
-  // Add debugging for pixel data
-  Serial.printf("Processing %d x %d pixels\n", width, height);
-
   // Select the BlackImage buffer (same one used in working code)
   Paint_SelectImage(BlackImage);
 
@@ -67,8 +171,43 @@ void display_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map
 
   display_needs_update = true;
   lv_display_flush_ready(disp);
+  PROF_END(PROF_FLUSH);
+}
+
+#ifdef FONT_BENCH
+static void bench_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+  LV_UNUSED(area);
+  LV_UNUSED(px_map);
+  lv_display_flush_ready(disp);
 }
 
+// Renders one label of the screens' text font with the panel left out, to
+// compare the 1bpp subsets with the stock fonts (-D FONT_SUBSET=0)
+static void font_bench(lv_display_t *disp)
+{
+  const int runs = 50;
+  lv_obj_t *label = lv_label_create(lv_screen_active());
+  lv_obj_set_style_text_font(label, &lv_font_montserrat_26, LV_PART_MAIN);
+  lv_label_set_text(label, "Hello, world!");
+  lv_display_set_flush_cb(disp, bench_flush_cb);
+  lv_refr_now(disp);
+
+  unsigned long start = micros();
+  for (int i = 0; i < runs; i++)
+  {
+    lv_obj_invalidate(label);
+    lv_refr_now(disp);
+  }
+  unsigned long elapsed = micros() - start;
+  Serial.printf("Font bench (%s): %lu us per render\n", FONT_SUBSET ? "1bpp subset" : "stock 4bpp",
+                elapsed / runs);
+
+  lv_display_set_flush_cb(disp, display_flush_cb);
+  lv_obj_delete(label);
+}
+#endif
+
 void setup()
 {
   Serial.begin(115200);
@@ -80,16 +219,30 @@ void setup()
   DEV_Module_Init();
   Serial.println("e-Paper Init and Clear...");
   EPD_7IN5_V2_Init();
+  EPD_Power_Init(&epd_power, &EPD_PWR_PROFILE_7IN5_V2, &EPD_PWR_IO_DEV, EPD_PWR_POWERED);
 
   // Create image cache (same as working code)
   Imagesize = ((EPD_7IN5_V2_WIDTH % 8 == 0) ? (EPD_7IN5_V2_WIDTH / 8) : (EPD_7IN5_V2_WIDTH / 8 + 1)) * EPD_7IN5_V2_HEIGHT;
-  if ((BlackImage = (UBYTE *)malloc(Imagesize)) == NULL)
+  if ((BlackImage = frame_alloc(Imagesize)) == NULL)
   {
     Serial.println("Failed to apply for black memory...");
     while (1)
       ;
   }
 
+#if EPD_FLUSH_TASK
+  if ((SendImage = frame_alloc(Imagesize)) == NULL)
+  {
+    Serial.println("Failed to apply for the refresh frame...");
+    while (1)
+      ;
+  }
+  refresh_queue = xQueueCreate(1, sizeof(uint32_t));
+  refresh_idle = xSemaphoreCreateBinary();
+  xSemaphoreGive(refresh_idle);
+  xTaskCreatePinnedToCore(refresh_task, "epd", 4096, NULL, 2, NULL, xPortGetCoreID() ^ 1);
+#endif
+
   Serial.println("Paint_NewImage");
   Paint_NewImage(BlackImage, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, 0, WHITE);
 
@@ -97,10 +250,17 @@ void setup()
   Serial.println("Initializing LVGL...");
   lv_init();
   lv_log_register_print_cb(log_print);
+#if MEM_POOLS
+  mem_pool_lvgl_init();
+#endif
 
   // Allocate LVGL buffer
   size_t buffer_size_bytes = buffer_pixels * sizeof(uint8_t);
+#if MEM_POOLS
+  buf1 = (lv_color_t *)mem_pool_alloc(MEM_POOL_TRANSIENT, buffer_size_bytes);
+#else
   buf1 = (lv_color_t *)lv_malloc(buffer_size_bytes);
+#endif
 
   if (!buf1)
   {
@@ -114,41 +274,117 @@ void setup()
   lv_display_t *lvDisp = lv_display_create(screenWidth, screenHeight);
   lv_display_set_color_format(lvDisp, LV_COLOR_FORMAT_L8); // Monochrome
   lv_display_set_flush_cb(lvDisp, display_flush_cb);
+#ifdef PROFILER
+  prof_init(prof_probes, sizeof(prof_probes) / sizeof(prof_probes[0]));
+  lv_display_add_event_cb(lvDisp, prof_render_cb, LV_EVENT_RENDER_START, NULL);
+  lv_display_add_event_cb(lvDisp, prof_render_cb, LV_EVENT_RENDER_READY, NULL);
+#endif
   lv_display_set_buffers(lvDisp, buf1, NULL, buffer_size_bytes, LV_DISPLAY_RENDER_MODE_PARTIAL);
+#if EPD_FLUSH_TASK
+  lv_display_add_event_cb(lvDisp, render_timing_cb, LV_EVENT_REFR_START, NULL);
+  lv_display_add_event_cb(lvDisp, render_timing_cb, LV_EVENT_REFR_READY, NULL);
+#endif
+
+#ifdef FONT_BENCH
+  font_bench(lvDisp);
+#endif
 
   // Initialize EEZ Studio generated UI
   ui_init();
 
   Serial.println("UI initialized and ready");
   Serial.printf("Free heap: %d bytes\n", ESP.getFreeHeap());
+#if MEM_POOLS
+  mem_pool_dump(mem_print);
+#endif
   Serial.println("Setup complete");
 }
 
 void loop()
 {
+  PROF_BEGIN(PROF_LOOP);
+
   // Tell LVGL how much time has passed
   lv_tick_inc(100);
 
   // Handle LVGL tasks (this will call display_flush_cb when needed)
+  PROF_BEGIN(PROF_TIMER_HANDLER);
   lv_timer_handler();
+  PROF_END(PROF_TIMER_HANDLER);
 
-  // Handle EEZ Studio UI updates
+  // Handle EEZ Studio UI updates. ui_tick() changes objects outside
+  // lv_timer_handler(), so it takes the lock lv_timer_handler() renders under
+  lv_lock();
+  PROF_BEGIN(PROF_UI_TICK);
   ui_tick();
+  PROF_END(PROF_UI_TICK);
+  lv_unlock();
 
   // Periodic display update using proven Waveshare library
   if (display_needs_update && (millis() - last_display_update > DISPLAY_UPDATE_INTERVAL))
   {
+#if EPD_FLUSH_TASK
+    // Back-pressure: while the previous frame is still on the panel, LVGL
+    // keeps rendering into BlackImage and the frame goes out on a later pass
+    if (xSemaphoreTake(refresh_idle, 0) == pdTRUE)
+    {
+      if (refresh_ms)
+        Serial.printf("Last frame: refresh %lu ms, LVGL rendered %lu ms meanwhile\n",
+                      (unsigned long)refresh_ms, (unsigned long)render_ms);
+      render_ms = 0;
+
+      unsigned long start = millis();
+      memcpy(SendImage, BlackImage, Imagesize);
+      refreshing = true;
+      uint32_t queued_at = millis();
+      xQueueSend(refresh_queue, &queued_at, 0);
+      Serial.printf("Frame handed to the refresh task (copy %lu ms)\n", queued_at - start);
+
+      display_needs_update = false;
+      last_display_update = queued_at;
+    }
+#else
     Serial.println("Updating e-paper display via LVGL integration...");
 
+    // Wake the panel the cheapest way from wherever it idles
+    EPD_PWR_STATE woken_from = EPD_Power_Acquire(&epd_power);
+
     // Use the same proven display function from working code
+    PROF_BEGIN(PROF_EPD_REFRESH);
     EPD_7IN5_V2_Display(BlackImage);
+    PROF_END(PROF_EPD_REFRESH);
 
     display_needs_update = false;
     last_display_update = millis();
-    Serial.println("Display update complete");
 
-    EPD_7IN5_V2_Sleep();
+    EPD_PWR_STATE idle = EPD_Power_Release(&epd_power, 0);
+    Serial.printf("Display update complete (woke from %s, idling %s)\n",
+                  EPD_Power_StateName(woken_from), EPD_Power_StateName(idle));
+#endif
+  }
+
+#if !EPD_FLUSH_TASK
+  // Step down to standby / deep sleep once the idle outlasts the break-even time
+  EPD_Power_Poll(&epd_power);
+#endif
+
+  PROF_END(PROF_LOOP);
+#if MEM_POOLS
+  // 'm' on Serial dumps the pools; the profiler's commands are read in the
+  // same loop, so neither gets stuck behind the other's
+  while (Serial.available())
+  {
+    int c = Serial.read();
+    if (c == 'm')
+      mem_pool_dump(mem_print);
+#ifdef PROFILER
+    else
+      prof_command(c); // 'p' arms, 'd' dumps, 'c' clears
+#endif
   }
+#elif defined(PROFILER)
+  prof_serial(); // 'p' arms, 'd' dumps, 'c' clears
+#endif
 
   delay(100);
 }
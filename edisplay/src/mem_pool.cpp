@@ -0,0 +1,411 @@
+// Pooled allocator, see mem_pool.h.
+
+#include "mem_pool.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+
+// LVGL's draw units allocate on both cores
+static portMUX_TYPE pool_lock = portMUX_INITIALIZER_UNLOCKED;
+#define POOL_LOCK() portENTER_CRITICAL(&pool_lock)
+#define POOL_UNLOCK() portEXIT_CRITICAL(&pool_lock)
+#define CAPS_ANY (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define CAPS_DMA (MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA)
+#else
+#include <stdlib.h>
+
+#define POOL_LOCK()
+#define POOL_UNLOCK()
+#define CAPS_ANY 0
+#define CAPS_DMA 0
+#define heap_caps_malloc(bytes, caps) malloc(bytes)
+#define heap_caps_free(p) free(p)
+#endif
+
+// Boundary tag in front of every block; a region ends with a used, empty one
+typedef struct {
+    uint32_t size;       // whole block, bit 0 set while allocated
+    uint32_t prev_size;  // the block before it, 0 for the first
+} block_t;
+
+// A free block keeps its region's free list links after the tag
+typedef struct free_block {
+    block_t tag;
+    struct free_block *next;
+    struct free_block *prev;
+} free_block_t;
+
+// In front of spilled allocations, which come straight from the heap
+typedef struct {
+    uint32_t size;
+    uint32_t pool;
+} spill_t;
+
+typedef struct {
+    uint8_t *base;
+    uint8_t *end;  // the end tag
+    free_block_t *free;
+} region_t;
+
+typedef struct {
+    const char *name;
+    uint32_t caps;
+    uint8_t region_count;
+    region_t regions[MEM_POOL_MAX_REGIONS];
+    mem_pool_stats_t stats;  // the free_* fields are filled in by mem_pool_get_stats()
+} pool_t;
+
+#define HEADER sizeof(block_t)
+#define MIN_BLOCK ((sizeof(free_block_t) + 7) & ~(uint32_t)7)
+
+static pool_t pools[MEM_POOL_COUNT] = {
+    {"widgets", CAPS_ANY, 0, {}, {}},
+    {"transient", CAPS_DMA, 0, {}, {}},
+    {"frame", CAPS_DMA, 0, {}, {}},
+};
+
+static inline uint32_t block_size(const block_t *b) {
+    return b->size & ~(uint32_t)1;
+}
+
+static inline bool block_used(const block_t *b) {
+    return b->size & 1;
+}
+
+static inline block_t *block_at(void *base, ptrdiff_t offset) {
+    return (block_t *)((uint8_t *)base + offset);
+}
+
+// Block size for bytes of payload, 0 when that doesn't fit in 32 bits
+static uint32_t block_need(size_t bytes) {
+    if (bytes > UINT32_MAX - HEADER - 8)
+        return 0;
+    uint32_t need = (uint32_t)((bytes + HEADER + 7) & ~(size_t)7);
+    return need < MIN_BLOCK ? MIN_BLOCK : need;
+}
+
+static void list_remove(region_t *r, free_block_t *f) {
+    if (f->prev)
+        f->prev->next = f->next;
+    else
+        r->free = f->next;
+    if (f->next)
+        f->next->prev = f->prev;
+}
+
+static void list_push(region_t *r, free_block_t *f) {
+    f->prev = NULL;
+    f->next = r->free;
+    if (r->free)
+        r->free->prev = f;
+    r->free = f;
+}
+
+// Frees size bytes at b, merged with the free blocks on either side
+static void release(region_t *r, block_t *b, uint32_t size) {
+    block_t *next = block_at(b, size);
+    if (!block_used(next)) {
+        list_remove(r, (free_block_t *)next);
+        size += block_size(next);
+    }
+    if (b->prev_size) {
+        block_t *prev = block_at(b, -(ptrdiff_t)b->prev_size);
+        if (!block_used(prev)) {
+            list_remove(r, (free_block_t *)prev);
+            size += block_size(prev);
+            b = prev;
+        }
+    }
+    b->size = size;
+    block_at(b, size)->prev_size = size;
+    list_push(r, (free_block_t *)b);
+}
+
+// Shrinks the allocated block b to need, when the rest makes a block
+static void trim(region_t *r, block_t *b, uint32_t need) {
+    uint32_t size = block_size(b);
+    if (size - need < MIN_BLOCK)
+        return;
+    b->size = need | 1;
+    block_t *rest = block_at(b, need);
+    rest->prev_size = need;
+    release(r, rest, size - need);
+}
+
+static void grow_used(pool_t *pool, uint32_t bytes) {
+    pool->stats.used += bytes;
+    if (pool->stats.used > pool->stats.peak)
+        pool->stats.peak = pool->stats.used;
+}
+
+// Best fit over the pool's regions; called locked
+static void *take(pool_t *pool, uint32_t need) {
+    for (uint8_t i = 0; i < pool->region_count; i++) {
+        region_t *r = &pool->regions[i];
+        free_block_t *best = NULL;
+        for (free_block_t *f = r->free; f; f = f->next) {
+            if (f->tag.size >= need && (!best || f->tag.size < best->tag.size)) {
+                best = f;
+                if (f->tag.size == need)
+                    break;
+            }
+        }
+        if (!best)
+            continue;
+
+        list_remove(r, best);
+        block_t *b = &best->tag;
+        b->size |= 1;
+        trim(r, b, need);
+        grow_used(pool, block_size(b));
+        pool->stats.blocks++;
+        pool->stats.allocs++;
+        return b + 1;
+    }
+    return NULL;
+}
+
+static region_t *find_region(const void *p, pool_t **owner) {
+    for (pool_t *pool = pools; pool < pools + MEM_POOL_COUNT; pool++) {
+        for (uint8_t i = 0; i < pool->region_count; i++) {
+            region_t *r = &pool->regions[i];
+            if ((const uint8_t *)p > r->base && (const uint8_t *)p < r->end) {
+                *owner = pool;
+                return r;
+            }
+        }
+    }
+    return NULL;
+}
+
+static void *spill(mem_pool_id_t id, size_t bytes) {
+    pool_t *pool = &pools[id];
+    spill_t *s = bytes <= UINT32_MAX ? (spill_t *)heap_caps_malloc(sizeof(spill_t) + bytes, pool->caps) : NULL;
+
+    POOL_LOCK();
+    if (!s) {
+        pool->stats.failed++;
+        POOL_UNLOCK();
+        return NULL;
+    }
+    s->size = (uint32_t)bytes;
+    s->pool = id;
+    pool->stats.allocs++;
+    pool->stats.spills++;
+    pool->stats.spill_bytes += s->size;
+    if (pool->stats.spill_bytes > pool->stats.spill_peak)
+        pool->stats.spill_peak = pool->stats.spill_bytes;
+    POOL_UNLOCK();
+    return s + 1;
+}
+
+bool mem_pool_reserve(mem_pool_id_t id, size_t bytes) {
+    pool_t *pool = &pools[id];
+    if (pool->region_count == MEM_POOL_MAX_REGIONS || bytes > UINT32_MAX)
+        return false;
+
+    uint8_t *mem = (uint8_t *)heap_caps_malloc(bytes, pool->caps);
+    if (!mem)
+        return false;
+    // heap_caps_malloc() only promises 4-byte alignment
+    uint8_t *base = (uint8_t *)(((uintptr_t)mem + 7) & ~(uintptr_t)7);
+    uint32_t size = (uint32_t)((bytes - (base - mem)) & ~(size_t)7);
+    if (size < MIN_BLOCK + HEADER) {
+        heap_caps_free(mem);
+        return false;
+    }
+
+    block_t *first = (block_t *)base;
+    first->size = size - HEADER;
+    first->prev_size = 0;
+    block_t *end = block_at(base, size - HEADER);
+    end->size = 1;
+    end->prev_size = first->size;
+
+    POOL_LOCK();
+    region_t *r = &pool->regions[pool->region_count++];
+    r->base = base;
+    r->end = (uint8_t *)end;
+    r->free = NULL;
+    list_push(r, (free_block_t *)first);
+    pool->stats.size += size;
+    POOL_UNLOCK();
+    return true;
+}
+
+void *mem_pool_alloc(mem_pool_id_t id, size_t bytes) {
+    uint32_t need = block_need(bytes);
+    void *p = NULL;
+    if (need) {
+        POOL_LOCK();
+        p = take(&pools[id], need);
+        POOL_UNLOCK();
+    }
+    return p ? p : spill(id, bytes);
+}
+
+void mem_pool_free(void *p) {
+    if (!p)
+        return;
+
+    POOL_LOCK();
+    pool_t *pool;
+    region_t *r = find_region(p, &pool);
+    if (r) {
+        block_t *b = (block_t *)p - 1;
+        uint32_t size = block_size(b);
+        pool->stats.used -= size;
+        pool->stats.blocks--;
+        release(r, b, size);
+        POOL_UNLOCK();
+        return;
+    }
+
+    spill_t *s = (spill_t *)p - 1;
+    pools[s->pool].stats.spill_bytes -= s->size;
+    POOL_UNLOCK();
+    heap_caps_free(s);
+}
+
+void *mem_pool_realloc(mem_pool_id_t id, void *p, size_t bytes) {
+    if (!p)
+        return mem_pool_alloc(id, bytes);
+    if (!bytes) {
+        mem_pool_free(p);
+        return NULL;
+    }
+
+    size_t old;
+    POOL_LOCK();
+    pool_t *pool;
+    region_t *r = find_region(p, &pool);
+    if (r) {
+        block_t *b = (block_t *)p - 1;
+        uint32_t size = block_size(b);
+        uint32_t need = block_need(bytes);
+        block_t *next = block_at(b, size);
+        if (need && need <= size) {
+            trim(r, b, need);
+            pool->stats.used -= size - block_size(b);
+            POOL_UNLOCK();
+            return p;
+        }
+        // Grow into the free block behind it
+        if (need && !block_used(next) && size + block_size(next) >= need) {
+            uint32_t grown = size + block_size(next);
+            list_remove(r, (free_block_t *)next);
+            b->size = grown | 1;
+            block_at(b, grown)->prev_size = grown;
+            trim(r, b, need);
+            grow_used(pool, block_size(b) - size);
+            POOL_UNLOCK();
+            return p;
+        }
+        id = (mem_pool_id_t)(pool - pools);
+        old = size - HEADER;
+    } else {
+        // A spill moves back into its pool when there is room again
+        spill_t *s = (spill_t *)p - 1;
+        id = (mem_pool_id_t)s->pool;
+        old = s->size;
+    }
+    POOL_UNLOCK();
+
+    void *q = mem_pool_alloc(id, bytes);
+    if (!q)
+        return NULL;
+    memcpy(q, p, old < bytes ? old : bytes);
+    mem_pool_free(p);
+    return q;
+}
+
+void mem_pool_get_stats(mem_pool_id_t id, mem_pool_stats_t *stats) {
+    pool_t *pool = &pools[id];
+    POOL_LOCK();
+    *stats = pool->stats;
+    stats->free_bytes = stats->free_blocks = stats->largest_free = 0;
+    for (uint8_t i = 0; i < pool->region_count; i++) {
+        for (free_block_t *f = pool->regions[i].free; f; f = f->next) {
+            stats->free_bytes += f->tag.size;
+            stats->free_blocks++;
+            if (f->tag.size > stats->largest_free)
+                stats->largest_free = f->tag.size;
+        }
+    }
+    POOL_UNLOCK();
+}
+
+uint8_t mem_pool_fragmentation(const mem_pool_stats_t *stats) {
+    if (!stats->free_bytes)
+        return 0;
+    return 100 - (uint8_t)((uint64_t)stats->largest_free * 100 / stats->free_bytes);
+}
+
+static bool check_region(const region_t *r, uint32_t *used) {
+    uint32_t prev_size = 0;
+    uint32_t free_blocks = 0;
+    bool prev_free = false;
+    uint8_t *p = r->base;
+    while (p < r->end) {
+        const block_t *b = (const block_t *)p;
+        uint32_t size = block_size(b);
+        if (b->prev_size != prev_size || size < MIN_BLOCK || size & 7 || p + size > r->end)
+            return false;
+        if (block_used(b)) {
+            *used += size;
+            prev_free = false;
+        } else {
+            if (prev_free)
+                return false;  // two free neighbours should have been merged
+            free_blocks++;
+            prev_free = true;
+        }
+        prev_size = size;
+        p += size;
+    }
+    const block_t *end = (const block_t *)r->end;
+    if (p != r->end || end->size != 1 || end->prev_size != prev_size)
+        return false;
+
+    const free_block_t *prev = NULL;
+    for (const free_block_t *f = r->free; f; prev = f, f = f->next) {
+        if (f->prev != prev || block_used(&f->tag) || (const uint8_t *)f < r->base || (const uint8_t *)f >= r->end)
+            return false;
+        if (!free_blocks--)
+            return false;
+    }
+    return free_blocks == 0;
+}
+
+bool mem_pool_check() {
+    bool ok = true;
+    POOL_LOCK();
+    for (pool_t *pool = pools; pool < pools + MEM_POOL_COUNT && ok; pool++) {
+        uint32_t used = 0;
+        for (uint8_t i = 0; i < pool->region_count && ok; i++)
+            ok = check_region(&pool->regions[i], &used);
+        ok = ok && used == pool->stats.used;
+    }
+    POOL_UNLOCK();
+    return ok;
+}
+
+void mem_pool_dump(void (*print)(const char *line)) {
+    char line[240];
+    for (uint8_t id = 0; id < MEM_POOL_COUNT; id++) {
+        mem_pool_stats_t s;
+        mem_pool_get_stats((mem_pool_id_t)id, &s);
+        snprintf(line, sizeof(line),
+                 "mem %-9s %6lu of %6lu used, peak %6lu, %4lu blocks, %5lu free in %3lu (largest %6lu, %u%% "
+                 "fragmented), %lu spills (%lu bytes now, peak %lu), %lu failed\n",
+                 pools[id].name, (unsigned long)s.used, (unsigned long)s.size, (unsigned long)s.peak,
+                 (unsigned long)s.blocks, (unsigned long)s.free_bytes, (unsigned long)s.free_blocks,
+                 (unsigned long)s.largest_free, mem_pool_fragmentation(&s), (unsigned long)s.spills,
+                 (unsigned long)s.spill_bytes, (unsigned long)s.spill_peak, (unsigned long)s.failed);
+        print(line);
+    }
+}
@@ -0,0 +1,76 @@
+// Pooled allocator with per-pool accounting.
+//
+// Allocations go into one of three pools, each made of up to
+// MEM_POOL_MAX_REGIONS regions reserved once from the heap region that
+// suits it: LVGL's long-lived state, the transient render and decoder
+// buffers, and the frame buffers sent to the panel. Inside a region the
+// blocks carry an 8-byte boundary tag; a free block is merged with its
+// free neighbours at once and allocation takes the best fit, so short-lived
+// buffers can't leave the long-lived objects scattered over the heap.
+//
+// An allocation that doesn't fit its pool is taken from the heap with the
+// pool's capabilities and counted as a spill, so an undersized pool costs
+// nothing but the statistics. mem_pool_dump() prints per pool the bytes in
+// use, the high-water mark, the free blocks and how fragmented they are.
+//
+// With MEM_POOLS (lv_conf.h) LVGL's lv_malloc() goes to the widget pool and
+// its draw buffers to the transient pool, see lv_mem_pool.cpp. The pool
+// code itself has no LVGL or Arduino dependency; edisplay/host/mem_soak
+// runs it on the host.
+
+#ifndef MEM_POOL_H
+#define MEM_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MEM_POOL_MAX_REGIONS 2
+#define MEM_POOL_WIDGETS_SIZE (48 * 1024)
+#define MEM_POOL_TRANSIENT_SIZE (40 * 1024)
+
+// Region size that holds one block of bytes: its header, the region's end
+// tag and the heap's 4-byte alignment
+#define MEM_POOL_FIT(bytes) ((((bytes) + 7) & ~(size_t)7) + 24)
+
+typedef enum {
+    MEM_POOL_WIDGETS,    // lv_malloc(): objects, styles, LVGL's own state
+    MEM_POOL_TRANSIENT,  // draw buffers, decoded images and glyphs, DMA-capable
+    MEM_POOL_FRAME,      // frame buffers for the panel, DMA-capable
+    MEM_POOL_COUNT,
+} mem_pool_id_t;
+
+typedef struct {
+    uint32_t size;          // bytes reserved in regions
+    uint32_t used;          // bytes in allocated blocks, headers included
+    uint32_t peak;          // high-water mark of used
+    uint32_t blocks;        // allocated blocks
+    uint32_t allocs;        // allocations so far, spills included
+    uint32_t free_bytes;
+    uint32_t free_blocks;
+    uint32_t largest_free;
+    uint32_t spills;        // allocations taken from the heap instead
+    uint32_t spill_bytes;   // heap bytes held now
+    uint32_t spill_peak;
+    uint32_t failed;        // not even the heap had room
+} mem_pool_stats_t;
+
+// Adds a region of bytes to the pool, from the heap region the pool belongs in
+bool mem_pool_reserve(mem_pool_id_t pool, size_t bytes);
+
+void *mem_pool_alloc(mem_pool_id_t pool, size_t bytes);
+// p stays in its pool; pool is only used when p is NULL
+void *mem_pool_realloc(mem_pool_id_t pool, void *p, size_t bytes);
+void mem_pool_free(void *p);
+
+void mem_pool_get_stats(mem_pool_id_t pool, mem_pool_stats_t *stats);
+// Share of the free bytes outside the largest free block, in percent
+uint8_t mem_pool_fragmentation(const mem_pool_stats_t *stats);
+// Walks every region; false when a tag or the free list is damaged
+bool mem_pool_check();
+// One line per pool, each passed to print
+void mem_pool_dump(void (*print)(const char *line));
+
+// lv_mem_pool.cpp: routes LVGL's draw buffers to MEM_POOL_TRANSIENT; after lv_init()
+void mem_pool_lvgl_init();
+
+#endif
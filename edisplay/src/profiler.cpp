@@ -0,0 +1,108 @@
+// Cycle-counter profiler, see profiler.h.
+
+#include "profiler.h"
+
+#ifdef PROFILER
+
+typedef struct {
+    uint32_t count;
+    uint32_t max;
+    uint64_t total;
+    uint32_t buckets[PROF_BUCKETS];
+} prof_histogram_t;
+
+volatile bool prof_armed = false;
+uint32_t prof_started[PROF_MAX_PROBES];
+
+static const prof_probe_t *probe_table;
+static uint8_t probe_count;
+static prof_histogram_t histograms[PROF_MAX_PROBES];
+static uint32_t armed_ms = 0;   // recording time before the last disarm
+static uint32_t armed_at = 0;
+
+// 0..3 exact, then four buckets per power of two:
+// [ (4 + sub) << (msb - 2), (5 + sub) << (msb - 2) )
+static inline uint8_t prof_bucket(uint32_t cycles) {
+    if (cycles < 4)
+        return cycles;
+    uint8_t msb = 31 - __builtin_clz(cycles);
+    return 4 * (msb - 1) + ((cycles >> (msb - 2)) & 3);
+}
+
+void prof_record(uint8_t id, uint32_t cycles) {
+    prof_histogram_t *h = &histograms[id];
+    h->count++;
+    h->total += cycles;
+    if (cycles > h->max)
+        h->max = cycles;
+    h->buckets[prof_bucket(cycles)]++;
+}
+
+void prof_init(const prof_probe_t *probes, uint8_t count) {
+    probe_table = probes;
+    probe_count = count < PROF_MAX_PROBES ? count : PROF_MAX_PROBES;
+}
+
+void prof_arm(bool armed) {
+    if (armed == prof_armed)
+        return;
+    if (armed)
+        armed_at = millis();
+    else
+        armed_ms += millis() - armed_at;
+    prof_armed = armed;
+}
+
+void prof_clear() {
+    bool armed = prof_armed;
+    prof_armed = false;
+    memset(histograms, 0, sizeof(histograms));
+    armed_ms = 0;
+    armed_at = millis();
+    prof_armed = armed;
+}
+
+// One row per probe, buckets as "index:count" for the non-empty ones
+void prof_dump(Print &out) {
+    uint32_t recorded_ms = armed_ms + (prof_armed ? millis() - armed_at : 0);
+    out.printf("# profile cpu_mhz=%lu recorded_ms=%lu\n", (unsigned long)getCpuFrequencyMhz(), (unsigned long)recorded_ms);
+    out.println("id,name,parent,count,total_cycles,max_cycles,buckets");
+    for (uint8_t id = 0; id < probe_count; id++) {
+        const prof_histogram_t *h = &histograms[id];
+        out.printf("%u,%s,%d,%lu,%llu,%lu,", id, probe_table[id].name, probe_table[id].parent, (unsigned long)h->count,
+                   (unsigned long long)h->total, (unsigned long)h->max);
+        bool first = true;
+        for (uint8_t b = 0; b < PROF_BUCKETS; b++) {
+            if (!h->buckets[b])
+                continue;
+            out.printf(first ? "%u:%lu" : " %u:%lu", b, (unsigned long)h->buckets[b]);
+            first = false;
+        }
+        out.println();
+    }
+    out.println("# end");
+}
+
+bool prof_command(int c) {
+    switch (c) {
+    case 'p':
+        prof_arm(!prof_armed);
+        Serial.printf("# profiler %s\n", prof_armed ? "armed" : "disarmed");
+        return true;
+    case 'd':
+        prof_dump(Serial);
+        return true;
+    case 'c':
+        prof_clear();
+        Serial.println("# profiler cleared");
+        return true;
+    }
+    return false;
+}
+
+void prof_serial() {
+    while (Serial.available())
+        prof_command(Serial.read());
+}
+
+#endif
@@ -0,0 +1,457 @@
+"""Writes 1bpp subsets of the LVGL fonts the e-paper UI uses.
+
+LVGL's built-in Montserrat fonts are 4bpp and cover ASCII plus the
+symbols. display_flush_cb() in main.cpp turns every pixel darker than 200
+black and the rest white, so of a glyph only the pixels with an opacity of
+INK_MIN_OPA or more ever reach the panel. This script reads the stock font
+sources from the LVGL library, keeps the codepoints the UI's texts use,
+cuts their bitmaps at INK_MIN_OPA, trims each box to what is left and
+writes them as 1bpp fonts under the stock names to src/font_subset.c.
+With dark text on a light background, as in this UI, the panel shows the
+same pixels as before; LVGL no longer blends the gray steps the flush
+throws away, and the firmware no longer carries glyphs nobody draws.
+
+The font of a text is read from the generated src/ui/screens.c, with
+text_font inherited by the children as in LVGL; texts without one use
+LV_FONT_DEFAULT from include/lv_conf.h. Characters of texts set at run
+time go in EXTRA. src/font_subset.h declares the fonts for lv_conf.h,
+which then builds no stock Montserrat. When the LVGL sources are not
+found, or the build has -D FONT_SUBSET=0, both files are removed and the
+stock fonts are used; the generated source is also empty unless
+FONT_SUBSET is on, so a stale copy cannot stand in for them.
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and
+rewrites the output only when it changes. Standalone:
+
+    python3 tools/font_subset.py [--lvgl DIR]
+
+prints the stock and subset size of each font.
+"""
+
+import glob
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821, PlatformIO pre-build hook; SCons leaves __file__ unset
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+    LVGL_DIRS = [env.subst("$PROJECT_LIBDEPS_DIR/$PIOENV/lvgl")]  # noqa: F821
+except NameError:
+    env = None
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    LVGL_DIRS = sorted(glob.glob(os.path.join(PROJECT_DIR, ".pio", "libdeps", "*", "lvgl")))
+SCREENS_C = os.path.join(PROJECT_DIR, "src", "ui", "screens.c")
+LV_CONF = os.path.join(PROJECT_DIR, "include", "lv_conf.h")
+OUTPUT_C = os.path.join(PROJECT_DIR, "src", "font_subset.c")
+OUTPUT_H = os.path.join(PROJECT_DIR, "src", "font_subset.h")
+
+# Dark text (the default theme's 0x212121) blended over white stays below
+# the flush's 200 from this opacity on; 4bpp level 4 (68) is the first one
+INK_MIN_OPA = 64
+
+# Characters texts set at run time need, per font, e.g.
+# {"lv_font_montserrat_26": "0123456789:."}
+EXTRA = {}
+
+# lv_font_fmt_txt_cmap_type_t
+FORMAT0_TINY, FORMAT0_FULL, SPARSE_TINY, SPARSE_FULL = range(4)
+CMAP_TYPES = ["LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY", "LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL",
+              "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY", "LV_FONT_FMT_TXT_CMAP_SPARSE_FULL"]
+
+# Struct sizes on the ESP32, for the size report
+GLYPH_DSC_SIZE = 8
+CMAP_SIZE = 20
+KERN_CLASSES_SIZE = 16
+
+
+class Glyph:
+    def __init__(self, adv_w, box_w, box_h, ofs_x, ofs_y, pixels):
+        self.adv_w = adv_w
+        self.box_w = box_w
+        self.box_h = box_h
+        self.ofs_x = ofs_x
+        self.ofs_y = ofs_y
+        self.pixels = pixels  # opacity per pixel, rows top down
+
+
+class Font:
+    def __init__(self):
+        self.bpp = 0
+        self.line_height = 0
+        self.base_line = 0
+        self.underline_position = 0
+        self.underline_thickness = 0
+        self.kern_scale = 16
+        self.glyphs = {}     # codepoint: Glyph
+        self.left = {}       # codepoint: kerning class, classes
+        self.right = {}
+        self.class_values = {}   # (left, right): value
+        self.pairs = {}      # (codepoint, codepoint): value, pair kerning
+        self.size = 0        # bytes of font data
+
+
+def unescape(text):
+    """C string literal contents to str; screens.c holds UTF-8."""
+    simple = {"n": b"\n", "t": b"\t", "r": b"\r", "\\": b"\\", '"': b'"', "'": b"'", "0": b"\0"}
+    out = bytearray()
+    data = text.encode("utf-8")
+    i = 0
+    while i < len(data):
+        c = data[i:i + 1]
+        if c != b"\\":
+            out += c
+            i += 1
+            continue
+        e = chr(data[i + 1])
+        if e == "x":
+            m = re.match(rb"[0-9a-fA-F]+", data[i + 2:])
+            out.append(int(m.group(0), 16) & 0xFF)
+            i += 2 + len(m.group(0))
+        elif e in "1234567":
+            m = re.match(rb"[0-7]{1,3}", data[i + 1:])
+            out.append(int(m.group(0), 8) & 0xFF)
+            i += 1 + len(m.group(0))
+        else:
+            out += simple.get(e, e.encode())
+            i += 2
+    return out.decode("utf-8", errors="replace")
+
+
+def default_font():
+    with open(LV_CONF) as f:
+        m = re.search(r"^\s*#define\s+LV_FONT_DEFAULT\s+&\s*(\w+)", f.read(), re.M)
+    return m.group(1) if m else None
+
+
+def used_codepoints():
+    """{font name: set of codepoints} for the texts in screens.c."""
+    root = {"font": None, "strings": [], "children": []}
+    stack = [root]
+    with open(SCREENS_C, encoding="utf-8") as f:
+        for line in f:
+            if line.lstrip().startswith("#"):
+                continue
+            m = re.search(r"lv_obj_set_style_text_font\(\s*obj\s*,\s*&\s*(\w+)", line)
+            if m:
+                stack[-1]["font"] = m.group(1)
+            stack[-1]["strings"] += [unescape(s) for s in re.findall(r'"((?:[^"\\]|\\.)*)"', line)]
+            for c in re.sub(r'"(?:[^"\\]|\\.)*"', "", line):
+                if c == "{":
+                    block = {"font": None, "strings": [], "children": []}
+                    stack[-1]["children"].append(block)
+                    stack.append(block)
+                elif c == "}" and len(stack) > 1:
+                    stack.pop()
+
+    used = {}
+
+    def walk(block, font):
+        font = block["font"] or font
+        for s in block["strings"]:
+            used.setdefault(font, set()).update(ord(c) for c in s if c >= " ")
+        for child in block["children"]:
+            walk(child, font)
+
+    walk(root, default_font())
+    used.setdefault(default_font(), set())
+    for name, chars in EXTRA.items():
+        used.setdefault(name, set()).update(ord(c) for c in chars)
+    for chars in used.values():
+        chars.add(0x20)
+    return used
+
+
+def c_array(src, name):
+    m = re.search(r"\b%s\[\]\s*=\s*\{(.*?)\};" % name, src, re.S)
+    return [int(v, 0) for v in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", m.group(1))] if m else None
+
+
+def c_field(text, name):
+    m = re.search(r"\.%s\s*=\s*(&?-?\w+)" % name, text)
+    if not m:
+        return None
+    v = m.group(1)
+    return int(v, 0) if re.match(r"-?(0x)?\d", v) else v
+
+
+def read_font(path):
+    """Parses a font source as lv_font_conv writes it, for LVGL 9."""
+    with open(path) as f:
+        src = re.sub(r"/\*.*?\*/", "", f.read(), flags=re.S)
+    font = Font()
+    font.bpp = c_field(src, "bpp")
+    if c_field(src, "bitmap_format"):
+        raise ValueError("compressed bitmaps")
+    font.line_height = c_field(src, "line_height")
+    font.base_line = c_field(src, "base_line")
+    font.underline_position = c_field(src, "underline_position") or 0
+    font.underline_thickness = c_field(src, "underline_thickness") or 0
+    font.kern_scale = c_field(src, "kern_scale") or 16
+
+    bitmap = c_array(src, "glyph_bitmap")
+    dscs = [tuple(int(v) for v in m) for m in re.findall(
+        r"\{\s*\.bitmap_index\s*=\s*(\d+),\s*\.adv_w\s*=\s*(\d+),\s*\.box_w\s*=\s*(\d+),\s*\.box_h\s*=\s*(\d+),"
+        r"\s*\.ofs_x\s*=\s*(-?\d+),\s*\.ofs_y\s*=\s*(-?\d+)\s*\}", src)]
+    font.size = len(bitmap) + GLYPH_DSC_SIZE * len(dscs)
+
+    m = re.search(r"\bcmaps\[\]\s*=\s*\{(.*?)\n\s*\};", src, re.S)
+    gid_of = {}
+    for entry in re.findall(r"\{([^{}]*)\}", m.group(1)):
+        start = c_field(entry, "range_start")
+        length = c_field(entry, "range_length")
+        gid_start = c_field(entry, "glyph_id_start")
+        ctype = CMAP_TYPES.index(c_field(entry, "type"))
+        unicode_list = c_array(src, c_field(entry, "unicode_list")) if c_field(entry, "unicode_list") != "NULL" else None
+        ofs_list = c_array(src, c_field(entry, "glyph_id_ofs_list")) \
+            if c_field(entry, "glyph_id_ofs_list") != "NULL" else None
+        font.size += CMAP_SIZE + 2 * len(unicode_list or []) + (1 if ctype == FORMAT0_FULL else 2) * len(ofs_list or [])
+        if ctype == FORMAT0_TINY:
+            for i in range(length):
+                gid_of[start + i] = gid_start + i
+        elif ctype == FORMAT0_FULL:
+            for i in range(length):
+                gid_of[start + i] = gid_start + ofs_list[i]
+        elif ctype == SPARSE_TINY:
+            for i, ofs in enumerate(unicode_list):
+                gid_of[start + ofs] = gid_start + i
+        else:
+            for i, ofs in enumerate(unicode_list):
+                gid_of[start + ofs] = gid_start + ofs_list[i]
+
+    levels = (1 << font.bpp) - 1
+    for cp, gid in gid_of.items():
+        index, adv_w, box_w, box_h, ofs_x, ofs_y = dscs[gid]
+        pixels = []
+        for i in range(box_w * box_h):
+            bit = index * 8 + i * font.bpp
+            v = (bitmap[bit // 8] << 8 | (bitmap[bit // 8 + 1] if bit // 8 + 1 < len(bitmap) else 0))
+            v = (v >> (16 - bit % 8 - font.bpp)) & levels
+            pixels.append(v * 255 // levels)
+        font.glyphs[cp] = Glyph(adv_w, box_w, box_h, ofs_x, ofs_y, pixels)
+
+    cp_of = {gid: cp for cp, gid in gid_of.items()}
+    if c_field(src, "kern_classes") == 1:
+        left = c_array(src, "kern_left_class_mapping")
+        right = c_array(src, "kern_right_class_mapping")
+        values = c_array(src, "kern_class_values")
+        right_cnt = c_field(src, "right_class_cnt")
+        font.size += len(left) + len(right) + len(values) + KERN_CLASSES_SIZE
+        for gid, cp in cp_of.items():
+            font.left[cp] = left[gid]
+            font.right[cp] = right[gid]
+        for i, v in enumerate(values):
+            if v:
+                font.class_values[(i // right_cnt + 1, i % right_cnt + 1)] = v
+    elif c_field(src, "kern_dsc") not in (None, "NULL"):
+        ids = c_array(src, "kern_pair_glyph_ids")
+        values = c_array(src, "kern_pair_values")
+        font.size += (1 if c_field(src, "glyph_ids_size") == 0 else 2) * len(ids) + len(values) + KERN_CLASSES_SIZE
+        for i, v in enumerate(values):
+            if ids[2 * i] in cp_of and ids[2 * i + 1] in cp_of:
+                font.pairs[(cp_of[ids[2 * i]], cp_of[ids[2 * i + 1]])] = v
+    return font
+
+
+def ink(glyph):
+    """The glyph cut at INK_MIN_OPA and trimmed: (box_w, box_h, ofs_x, ofs_y, rows of 0/1)."""
+    rows = [[1 if glyph.pixels[y * glyph.box_w + x] >= INK_MIN_OPA else 0 for x in range(glyph.box_w)]
+            for y in range(glyph.box_h)]
+    ys = [y for y, row in enumerate(rows) if any(row)]
+    xs = [x for x in range(glyph.box_w) if any(row[x] for row in rows)]
+    if not ys:
+        return 0, 0, 0, 0, []
+    top, bottom, left, right = ys[0], ys[-1], xs[0], xs[-1]
+    rows = [row[left:right + 1] for row in rows[top:bottom + 1]]
+    return right - left + 1, bottom - top + 1, glyph.ofs_x + left, glyph.ofs_y + glyph.box_h - 1 - bottom, rows
+
+
+def hex_lines(values, indent="    ", per_line=16, fmt="0x%02x"):
+    return [indent + ", ".join(fmt % v for v in values[i:i + per_line]) + ","
+            for i in range(0, len(values), per_line)]
+
+
+def emit_font(name, font, codepoints):
+    """C source of the 1bpp subset; returns (lines, bytes of font data, missing codepoints)."""
+    cps = sorted(cp for cp in codepoints if cp in font.glyphs)
+    missing = sorted(cp for cp in codepoints if cp not in font.glyphs)
+    out = ["/*", " * %s: 1bpp, %d glyphs" % (name, len(cps)), " */", ""]
+
+    bitmap = []
+    dscs = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,"]
+    bitmap_lines = []
+    for cp in cps:
+        box_w, box_h, ofs_x, ofs_y, rows = ink(font.glyphs[cp])
+        bits = [b for row in rows for b in row]
+        data = [sum(bits[i + j] << (7 - j) for j in range(8) if i + j < len(bits)) for i in range(0, len(bits), 8)]
+        char = chr(cp) if 0x20 < cp < 0x7F and chr(cp) not in "\\*/" else ""
+        bitmap_lines.append("    /* U+%04X %s*/" % (cp, '"%s" ' % char if char else ""))
+        bitmap_lines += hex_lines(data)
+        dscs.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d},"
+                    % (len(bitmap), font.glyphs[cp].adv_w, box_w, box_h, ofs_x, ofs_y))
+        bitmap += data
+    size = len(bitmap) + GLYPH_DSC_SIZE * len(dscs)
+
+    prefix = name + "_"
+    out += ["static const uint8_t %sglyph_bitmap[] = {" % prefix] + (bitmap_lines or ["    0,"]) + ["};", ""]
+    out += ["static const lv_font_fmt_txt_glyph_dsc_t %sglyph_dsc[] = {" % prefix] + dscs + ["};", ""]
+
+    # Codepoints in order, glyph ids from 1: one range, dense or sparse
+    first, last = cps[0], cps[-1]
+    if last - first + 1 == len(cps):
+        cmap = (".range_start = %d, .range_length = %d, .glyph_id_start = 1, .unicode_list = NULL, "
+                ".glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY"
+                % (first, len(cps)))
+        size += CMAP_SIZE
+    else:
+        if last - first > 0xFFFF:
+            sys.exit("font_subset: %s spans more than 64K codepoints" % name)
+        out += ["static const uint16_t %sunicode_list[] = {" % prefix]
+        out += hex_lines([cp - first for cp in cps], per_line=12, fmt="0x%x") + ["};", ""]
+        cmap = (".range_start = %d, .range_length = %d, .glyph_id_start = 1, .unicode_list = %sunicode_list, "
+                ".glyph_id_ofs_list = NULL, .list_length = %d, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY"
+                % (first, last - first + 1, prefix, len(cps)))
+        size += CMAP_SIZE + 2 * len(cps)
+    out += ["static const lv_font_fmt_txt_cmap_t %scmaps[] = {" % prefix, "    {" + cmap + "},", "};", ""]
+
+    # Kerning, classes renumbered to the ones the subset still uses
+    kern = "NULL"
+    kern_classes = 0
+    if font.class_values:
+        lefts = sorted({font.left[cp] for cp in cps} - {0})
+        rights = sorted({font.right[cp] for cp in cps} - {0})
+        values = [font.class_values.get((l, r), 0) for l in lefts for r in rights]
+        if any(values):
+            left_map = [0] + [lefts.index(font.left[cp]) + 1 if font.left[cp] else 0 for cp in cps]
+            right_map = [0] + [rights.index(font.right[cp]) + 1 if font.right[cp] else 0 for cp in cps]
+            out += ["static const uint8_t %skern_left_class_mapping[] = {" % prefix] + hex_lines(
+                left_map, fmt="%d") + ["};", ""]
+            out += ["static const uint8_t %skern_right_class_mapping[] = {" % prefix] + hex_lines(
+                right_map, fmt="%d") + ["};", ""]
+            out += ["static const int8_t %skern_class_values[] = {" % prefix] + hex_lines(
+                values, per_line=len(rights), fmt="%d") + ["};", ""]
+            out += ["static const lv_font_fmt_txt_kern_classes_t %skern_classes = {" % prefix,
+                    "    .class_pair_values = %skern_class_values," % prefix,
+                    "    .left_class_mapping = %skern_left_class_mapping," % prefix,
+                    "    .right_class_mapping = %skern_right_class_mapping," % prefix,
+                    "    .left_class_cnt = %d," % len(lefts),
+                    "    .right_class_cnt = %d," % len(rights),
+                    "};", ""]
+            kern = "&%skern_classes" % prefix
+            kern_classes = 1
+            size += len(left_map) + len(right_map) + len(values) + KERN_CLASSES_SIZE
+    elif font.pairs:
+        gid = {cp: i + 1 for i, cp in enumerate(cps)}
+        pairs = sorted((gid[a], gid[b], v) for (a, b), v in font.pairs.items() if a in gid and b in gid)
+        if pairs:
+            out += ["static const uint8_t %skern_pair_glyph_ids[] = {" % prefix] + hex_lines(
+                [g for a, b, v in pairs for g in (a, b)], fmt="%d") + ["};", ""]
+            out += ["static const int8_t %skern_pair_values[] = {" % prefix] + hex_lines(
+                [v for a, b, v in pairs], fmt="%d") + ["};", ""]
+            out += ["static const lv_font_fmt_txt_kern_pair_t %skern_pairs = {" % prefix,
+                    "    .glyph_ids = %skern_pair_glyph_ids," % prefix,
+                    "    .values = %skern_pair_values," % prefix,
+                    "    .pair_cnt = %d," % len(pairs),
+                    "    .glyph_ids_size = 0,",
+                    "};", ""]
+            kern = "&%skern_pairs" % prefix
+            size += 3 * len(pairs) + KERN_CLASSES_SIZE
+
+    out += ["static const lv_font_fmt_txt_dsc_t %sdsc = {" % prefix,
+            "    .glyph_bitmap = %sglyph_bitmap," % prefix,
+            "    .glyph_dsc = %sglyph_dsc," % prefix,
+            "    .cmaps = %scmaps," % prefix,
+            "    .kern_dsc = %s," % kern,
+            "    .kern_scale = %d," % font.kern_scale,
+            "    .cmap_num = 1,",
+            "    .bpp = 1,",
+            "    .kern_classes = %d," % kern_classes,
+            "    .bitmap_format = 0,",
+            "};", "",
+            "const lv_font_t %s = {" % name,
+            "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,",
+            "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,",
+            "    .line_height = %d," % font.line_height,
+            "    .base_line = %d," % font.base_line,
+            "    .subpx = LV_FONT_SUBPX_NONE,",
+            "    .underline_position = %d," % font.underline_position,
+            "    .underline_thickness = %d," % font.underline_thickness,
+            "    .dsc = &%sdsc," % prefix,
+            "    .fallback = NULL,",
+            "    .user_data = NULL,",
+            "};", ""]
+    return out, size, missing
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return
+    with open(path, "w") as f:
+        f.write(text)
+
+
+def remove_outputs(reason):
+    print("font_subset: %s, using the stock fonts" % reason)
+    for path in (OUTPUT_C, OUTPUT_H):
+        if os.path.exists(path):
+            os.remove(path)
+
+
+def subset_enabled(env):
+    """FONT_SUBSET from the build's -D flags; on unless set to 0."""
+    for define in env.get("CPPDEFINES", []):
+        if isinstance(define, (list, tuple)) and define[0] == "FONT_SUBSET":
+            return str(define[1]).strip() not in ("0", "")
+    return True
+
+
+def build(lvgl_dirs):
+    fonts_dir = next((os.path.join(d, "src", "font") for d in lvgl_dirs
+                      if os.path.isdir(os.path.join(d, "src", "font"))), None)
+    if not fonts_dir:
+        remove_outputs("LVGL sources not found")
+        return
+
+    body = []
+    names = []
+    for name, codepoints in sorted(used_codepoints().items()):
+        path = os.path.join(fonts_dir, name + ".c")
+        if not os.path.exists(path):
+            continue  # a project font from src/ui, left as it is
+        try:
+            font = read_font(path)
+        except (ValueError, AttributeError, TypeError, IndexError) as e:
+            remove_outputs("%s.c not understood (%s)" % (name, e))
+            return
+        lines, size, missing = emit_font(name, font, codepoints)
+        body += lines
+        names.append(name)
+        print("font_subset: %-24s %3d glyphs, %6d bytes stock %dbpp, %5d bytes 1bpp subset"
+              % (name, len(codepoints) - len(missing), font.size, font.bpp, size))
+        if missing:
+            print("font_subset: %s has no glyph for %s" % (name, " ".join("U+%04X" % cp for cp in missing)))
+    if not names:
+        remove_outputs("no LVGL font in the UI")
+        return
+
+    header = ["// Generated by tools/font_subset.py, do not edit. Included by lv_conf.h.", "",
+              "#ifndef FONT_SUBSET_H", "#define FONT_SUBSET_H", "",
+              "#define FONT_SUBSET_DECLARE %s" % " ".join("LV_FONT_DECLARE(%s)" % n for n in names), "",
+              "#endif", ""]
+    # lv_conf.h builds LVGL's own fonts of these names when FONT_SUBSET is 0
+    source = ["// Generated by tools/font_subset.py from the LVGL fonts and src/ui/screens.c, do not edit.", "",
+              "#include <lvgl.h>", "", "#if FONT_SUBSET", ""] + body + ["#endif", ""]
+    write_if_changed(OUTPUT_H, "\n".join(header))
+    write_if_changed(OUTPUT_C, "\n".join(source))
+
+
+if env is not None:
+    if subset_enabled(env):
+        build(LVGL_DIRS)
+    else:
+        remove_outputs("-D FONT_SUBSET=0")
+elif __name__ == "__main__":
+    args = sys.argv[1:]
+    build([args[args.index("--lvgl") + 1]] if "--lvgl" in args else LVGL_DIRS)
@@ -0,0 +1,323 @@
+"""Packs the GUI_Paint bitmap fonts in lib/waveshare/ into lib/waveshare/fonts_packed.c.
+
+The Waveshare tables store every glyph at full cell size, each row padded
+to whole bytes, and the CN tables every glyph in a 32x41 matrix whatever
+the font's size. Here each glyph is cut to the box its set pixels span and
+stored as a 4-byte header and its bits; a direct offset index per font
+finds glyph n. The bits are kept either plain or, when that is shorter,
+with every row XORed with the one above and the bytes zero-run coded (see
+GUI_FontCache.h for the layout). GUI_FontCache expands a glyph back into
+the stock layout on first use and keeps the recently used ones in RAM.
+
+The output defines a FONT_PACK per font, and with FONT_PACKED (fonts.h,
+default 1) the sFONT / cFONT objects GUI_Paint takes, pointing at the
+packs; the stock files then only keep their tables for -D FONT_PACKED=0.
+A font whose pack is not smaller than its stock table (Font8) keeps the
+table with Pack NULL, so that no font takes more flash packed; its pack is
+then only there for epd_bench and the linker drops it from the firmware.
+Every glyph is decoded again here and compared with the stock table
+before anything is written.
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and
+rewrites the output only when a font file is newer. Standalone:
+
+    python3 tools/pack_fonts.py [--force]
+
+prints stock and packed size per font.
+"""
+
+import glob
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821, PlatformIO pre-build hook; SCons leaves __file__ unset
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    env = None
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+FONT_DIR = os.path.join(PROJECT_DIR, "lib", "waveshare")
+OUTPUT = os.path.join(FONT_DIR, "fonts_packed.c")
+SCRIPT = os.path.join(PROJECT_DIR, "tools", "pack_fonts.py")
+
+# fonts.h
+MAX_HEIGHT_FONT = 41
+MAX_WIDTH_FONT = 32
+CN_MATRIX = MAX_HEIGHT_FONT * MAX_WIDTH_FONT // 8
+CN_ENTRY = 3 + CN_MATRIX
+
+FIRST_CHAR = 0x20   # Paint_DrawChar(): (Acsii_Char - ' ')
+DELTA = 0x80        # FONT_PACK_DELTA, in the header's W byte
+ZERO_RUN = 0x80     # FONT_PACK_ZERO_RUN
+MAX_RUN = 127
+
+
+def hex_bytes(text):
+    return [int(x, 16) for x in re.findall(r"0[xX]([0-9A-Fa-f]{2})\b", text)]
+
+
+def font_fields(src, names, path):
+    """The numbers after the table pointer in the sFONT / cFONT initializer."""
+    values = []
+    for name in names:
+        m = re.search(r"(\d+)\s*,\s*/\*\s*%s\s*\*/" % re.escape(name), src)
+        if not m:
+            sys.exit("%s: no %s in the font definition" % (path, name))
+        values.append(int(m.group(1)))
+    return values
+
+
+def parse_en(path):
+    """font8.cpp ... font24.cpp: one uint8_t table, glyphs ' ' to '~' at full cell size."""
+    src = open(path, encoding="utf-8").read()
+    m = re.search(r"const\s+uint8_t\s+(Font\d+)_Table\s*\[\]\s*=\s*\{(.*?)\n\};", src, re.S)
+    if not m:
+        sys.exit("%s: no FontN_Table" % path)
+    data = hex_bytes(re.sub(r"//[^\n]*", "", m.group(2)))
+    width, height = font_fields(src, ["Width", "Height"], path)
+    stride = (width + 7) // 8
+    size = stride * height
+    if len(data) % size:
+        sys.exit("%s: %d bytes is no whole number of %dx%d glyphs" % (path, len(data), width, height))
+    glyphs = []
+    for i in range(len(data) // size):
+        code = FIRST_CHAR + i
+        glyphs.append(("'%s'" % chr(code) if code < 0x7F else "0x%02X" % code, None, data[i * size:(i + 1) * size]))
+    return {"name": m.group(1), "cn": False, "width": width, "height": height, "stride": stride,
+            "glyphs": glyphs, "stock": len(data), "path": path}
+
+
+def parse_cn(path):
+    """font12CN.c, font24CN.c: CH_CN entries of a UTF-8 index and a 32x41 matrix."""
+    src = open(path, encoding="utf-8").read()
+    m = re.search(r"const\s+CH_CN\s+(Font\d+CN)_Table\s*\[\]\s*=\s*\{(.*?)\n\};", src, re.S)
+    if not m:
+        sys.exit("%s: no FontNCN_Table" % path)
+    ascii_width, width, height = font_fields(src, ["ASCII Width", "Width", "Height"], path)
+    stride = (width + 7) // 8
+    glyphs = []
+    for text, body in re.findall(r'\{\s*"([^"]*)"\s*,(.*?)\}', re.sub(r"/\*.*?\*/", "", m.group(2), flags=re.S),
+                                 re.S):
+        index = list(text.encode("utf-8"))
+        matrix = hex_bytes(body)
+        if len(index) > 3 or len(matrix) > CN_MATRIX:
+            sys.exit("%s: entry \"%s\" doesn't fit a CH_CN" % (path, text))
+        matrix += [0] * (CN_MATRIX - len(matrix))
+        if any(matrix[stride * height:]):
+            sys.exit("%s: \"%s\" has pixels outside its %dx%d cell" % (path, text, width, height))
+        glyphs.append(('"%s"' % text, index + [0] * (3 - len(index)), matrix[:stride * height]))
+    return {"name": m.group(1), "cn": True, "width": width, "height": height, "stride": stride,
+            "ascii_width": ascii_width, "glyphs": glyphs, "stock": len(glyphs) * CN_ENTRY, "path": path}
+
+
+def to_rows(cell, width, stride):
+    """Glyph rows as ints, bit width-1 the leftmost pixel."""
+    rows = []
+    for y in range(len(cell) // stride):
+        row = 0
+        for b in cell[y * stride:(y + 1) * stride]:
+            row = row << 8 | b
+        rows.append(row >> (stride * 8 - width))
+    return rows
+
+
+def pack_bits(rows, width):
+    bits = 0
+    count = 0
+    for row in rows:
+        bits = bits << width | row
+        count += width
+    pad = -count % 8
+    return list((bits << pad).to_bytes((count + pad) // 8, "big")) if count else []
+
+
+def zero_runs(data):
+    """0x80 | n: n zero bytes; n: n literal bytes follow."""
+    out = []
+    i = 0
+    while i < len(data):
+        run = 0
+        while i + run < len(data) and run < MAX_RUN and data[i + run] == 0:
+            run += 1
+        if run:
+            out.append(ZERO_RUN | run)
+            i += run
+            continue
+        j = i
+        while j < len(data) and j - i < MAX_RUN and not (data[j] == 0 and j + 1 < len(data) and data[j + 1] == 0):
+            j += 1
+        out.append(j - i)
+        out += data[i:j]
+        i = j
+    return out
+
+
+def unzero_runs(data):
+    out = []
+    i = 0
+    while i < len(data):
+        ctrl = data[i]
+        i += 1
+        if ctrl & ZERO_RUN:
+            out += [0] * (ctrl & MAX_RUN)
+        else:
+            out += data[i:i + ctrl]
+            i += ctrl
+    return out
+
+
+def encode(cell, width, stride):
+    """Header X, Y, W | DELTA, H and the box's bits, plain or delta coded."""
+    rows = to_rows(cell, width, stride)
+    used = [y for y, row in enumerate(rows) if row]
+    if not used:
+        return [0, 0, 0, 0]
+    mask = 0
+    for row in rows:
+        mask |= row
+    left = width - mask.bit_length()
+    right = (mask & -mask).bit_length() - 1
+    box_w = width - left - right
+    top, box_h = used[0], used[-1] - used[0] + 1
+    box = [row >> right for row in rows[top:top + box_h]]
+    plain = pack_bits(box, box_w)
+    delta = zero_runs(pack_bits([row ^ (box[y - 1] if y else 0) for y, row in enumerate(box)], box_w))
+    if len(delta) < len(plain):
+        return [left, top, box_w | DELTA, box_h] + delta
+    return [left, top, box_w, box_h] + plain
+
+
+def decode(record, width, height, stride):
+    """What GUI_FontCache_Get() makes of a record: the glyph in the stock layout."""
+    cell = [0] * (stride * height)
+    left, top, box_w, box_h = record[0], record[1], record[2] & ~DELTA, record[3]
+    if not box_w:
+        return cell
+    data = record[4:]
+    if record[2] & DELTA:
+        data = unzero_runs(data)
+    bits = int.from_bytes(bytes(data), "big") >> (len(data) * 8 - box_w * box_h)
+    prev = 0
+    for y in range(box_h):
+        row = bits >> ((box_h - 1 - y) * box_w) & ((1 << box_w) - 1)
+        if record[2] & DELTA:
+            row ^= prev
+            prev = row
+        line = row << (stride * 8 - left - box_w)
+        for i in range(stride):
+            cell[(top + y) * stride + i] = line >> ((stride - 1 - i) * 8) & 0xFF
+    return cell
+
+
+def c_bytes(data, indent="    ", per_line=24):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ",".join("0x%02x" % b for b in data[i:i + per_line]) + ",")
+    return lines
+
+
+def emit(fonts):
+    out = ["/* Generated by tools/pack_fonts.py from lib/waveshare/font*.c*, do not edit. */",
+           "",
+           "#include <stddef.h>",
+           "#include \"fonts.h\"",
+           ""]
+    for font in fonts:
+        name = font["name"]
+        out += ["/* %dx%d, %d glyphs, %d bytes stock, %d packed */"
+                % (font["width"], font["height"], len(font["glyphs"]), font["stock"], font["packed"]),
+                "static const uint8_t %s_Data[] = {" % name]
+        for (label, _, _), record in zip(font["glyphs"], font["records"]):
+            out.append("    /* %s */" % label)
+            out += c_bytes(record)
+        out += ["};",
+                "",
+                "static const uint16_t %s_Offset[] = {" % name]
+        offsets = font["offsets"]
+        out += ["    " + ",".join("%d" % o for o in offsets[i:i + 16]) + "," for i in range(0, len(offsets), 16)]
+        out += ["};", ""]
+        codes = "NULL"
+        if font["cn"]:
+            out.append("static const uint8_t %s_Codes[] = {" % name)
+            for label, index, _ in font["glyphs"]:
+                out.append("    " + ",".join("0x%02x" % b for b in index) + ",  /* %s */" % label)
+            out += ["};", ""]
+            codes = "%s_Codes" % name
+        out += ["const FONT_PACK %s_Pack = {" % name,
+                "  %s_Data," % name,
+                "  %s_Offset," % name,
+                "  %s," % codes,
+                "  %d, /* Count */" % len(font["glyphs"]),
+                "  %d, /* Width */" % font["width"],
+                "  %d, /* Height */" % font["height"],
+                "};",
+                "",
+                "#if FONT_PACKED"]
+        table, pack_ref = "NULL", "&%s_Pack" % name
+        if font["packed"] >= font["stock"]:
+            out.append("/* The stock table is smaller */")
+            table, pack_ref = "%s_Table" % name, "NULL"
+        if font["cn"]:
+            out += ["cFONT %s = {" % name,
+                    "  %s," % table,
+                    "  %d,  /*size of table*/" % len(font["glyphs"]),
+                    "  %d, /* ASCII Width */" % font["ascii_width"],
+                    "  %d, /* Width */" % font["width"],
+                    "  %d, /* Height */" % font["height"],
+                    "  %s," % pack_ref,
+                    "};"]
+        else:
+            out += ["sFONT %s = {" % name,
+                    "  %s," % table,
+                    "  %d, /* Width */" % font["width"],
+                    "  %d, /* Height */" % font["height"],
+                    "  %s," % pack_ref,
+                    "};"]
+        out += ["#endif", ""]
+    return "\n".join(out)
+
+
+def pack(force=False):
+    sources = sorted(glob.glob(os.path.join(FONT_DIR, "font[0-9]*.c*")))
+    if not sources:
+        return
+    if (not force and os.path.exists(OUTPUT)
+            and os.path.getmtime(OUTPUT) >= max(os.path.getmtime(p) for p in sources + [SCRIPT])):
+        return
+
+    fonts = []
+    for path in sources:
+        fonts.append(parse_cn(path) if path.endswith("CN.c") else parse_en(path))
+    fonts.sort(key=lambda f: (f["cn"], f["height"]))
+
+    stock_total = packed_total = 0
+    for font in fonts:
+        records = []
+        offsets = [0]
+        for label, _, cell in font["glyphs"]:
+            record = encode(cell, font["width"], font["stride"])
+            if decode(record, font["width"], font["height"], font["stride"]) != cell:
+                sys.exit("%s: glyph %s doesn't survive packing" % (font["path"], label))
+            records.append(record)
+            offsets.append(offsets[-1] + len(record))
+        if offsets[-1] > 0xFFFF:
+            sys.exit("%s: %d bytes packed, more than a 16-bit offset reaches" % (font["path"], offsets[-1]))
+        font["records"] = records
+        font["offsets"] = offsets
+        font["packed"] = offsets[-1] + 2 * len(offsets) + (3 * len(records) if font["cn"] else 0)
+        stock_total += font["stock"]
+        packed_total += min(font["packed"], font["stock"])
+        print("pack_fonts: %-10s %6d -> %5d bytes%s" % (font["name"], font["stock"], font["packed"],
+                                                        ", stock table kept" if font["packed"] >= font["stock"] else ""))
+
+    with open(OUTPUT, "w", encoding="utf-8") as f:
+        f.write(emit(fonts))
+    print("pack_fonts: %d fonts, %d -> %d bytes of flash, %d saved"
+          % (len(fonts), stock_total, packed_total, stock_total - packed_total))
+
+
+if env is not None:
+    pack()
+elif __name__ == "__main__":
+    pack(force="--force" in sys.argv)